@@ -137,19 +137,31 @@ template<class T> class allocator {
 			if(n > max_size()) {
 				throw bad_alloc();
 			}
-			return static_cast<pointer>( ::operator new(type_info<value_type>::size() * n) );
+			// memory of movable types is resized by realloc() so we have to use
+			// malloc(), at least one byte is allocated so result is never NULL
+			size_type bytes = type_info<value_type>::size() * n;
+			void* mem = ::malloc(bytes != 0 ? bytes : 1);
+			if(mem == NULL) {
+				throw bad_alloc();
+			}
+			return static_cast<pointer>(mem);
 		};
 		void deallocate(pointer mem, size_type = -1) {
 			if(mem == NULL) {
 				throw bad_alloc();
 			}
-			::operator delete(mem);
+			::free(static_cast<void*>(mem));
 		};
 		pointer reallocate(pointer, size_type, size_type);
 
 		void construct(pointer p, const_reference val) {
 			new (static_cast<void*>(p)) value_type(val);
 		};
+#if WQ_HAS_MOVE
+		void construct(pointer p, value_type&& val) {
+			new (static_cast<void*>(p)) value_type( WQ_MOVE(val) );
+		};
+#endif
 		void destroy(pointer p) {
 			p->~value_type();
 		};
@@ -165,15 +177,23 @@ template<class T> T* allocator<T>::reallocate(pointer old_ptr, size_type old_siz
     }
     pointer retval = NULL;
 	if(type_info<value_type>::is_movable()) {
-		// if type is moveable we can use realloc function
-		retval = static_cast<pointer>( ::realloc(static_cast<void*>(old_ptr),
-									   type_info<value_type>::size() * new_size) );
+		// if type is moveable we can use realloc function, like allocate()
+		// it never gets zero size because realloc() would free memory
+		size_type bytes = type_info<value_type>::size() * new_size;
+		retval = static_cast<pointer>( ::realloc(static_cast<void*>(old_ptr), bytes != 0 ? bytes : 1) );
+		if(retval == NULL) {
+			throw bad_alloc();
+		}
 	}
 	else {
-		// else we must write own algorithm
+		// else we must write own algorithm, old objects are
+		// destroyed so they can be moved
 		retval = allocate(new_size);
 		if(old_ptr != NULL) {
-			copy(retval, old_ptr, (old_size > new_size ? new_size : old_size));
+			size_type count = old_size > new_size ? new_size : old_size;
+			for(size_type i = 0; i != count; i++) {
+				construct(retval + i, WQ_MOVE(old_ptr[i]));
+			}
 			for(pointer i = old_ptr; i != old_ptr + old_size; i++) {
 				destroy(i);
 			}
@@ -202,7 +222,7 @@ template<class T> T* allocator<T>::copy(pointer dest, const_pointer mem, size_ty
 template<class T> T* allocator<T>::ocopy(pointer dest, const_pointer mem, size_type n) {
 	if(type_info<value_type>::is_movable()) {
 		// overlap safe copying
-		memmove(static_cast<void*>(dest), static_cast<const void*>(mem), n);
+		memmove(static_cast<void*>(dest), static_cast<const void*>(mem), type_info<value_type>::size() * n);
 	}
 	else {
 		// for not-movable I must write some lines :(
@@ -212,12 +232,12 @@ template<class T> T* allocator<T>::ocopy(pointer dest, const_pointer mem, size_t
 		}
 
 		pointer tmp_dest = dest;
-		const_pointer tmp_buff = buffer;
-		const_pointer buff_last = tmp_buff + n;
+		pointer tmp_buff = buffer;
+		pointer buff_last = tmp_buff + n;
 		for( ; tmp_buff != buff_last; tmp_buff++, tmp_dest++) {
-			// destination memory must not be empty
+			// destination memory must not be empty, buffer is temporary so it can be moved
 			destroy(tmp_dest);
-			construct(tmp_dest, *tmp_buff);
+			construct(tmp_dest, WQ_MOVE(*tmp_buff));
 		}
 
 		for(size_type i = 0; i != n; i++) {
@@ -0,0 +1,93 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_ATOM_H
+#define WQ_CORE_ATOM_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+#include "wq/core/atomic.h"
+
+namespace wq {
+namespace core {
+
+// handle of string stored in process-wide table, equal strings
+// have the same handle so they are compared by pointers
+class WQ_EXPORT atom {
+    public:
+        //! Type which handle sizes of atom's text.
+        typedef string::size_type size_type;
+
+        // construction
+        atom() : m_data(NULL) { };
+        explicit atom(const string&);
+        explicit atom(const string_ref&);
+        explicit atom(const char*);
+
+        // interned text
+        const string& str() const;
+        size_type size() const {
+            return str().size();
+        };
+        size_type bytes() const {
+            return str().bytes();
+        };
+        bool empty() const {
+            return m_data == NULL;
+        };
+        size_type hash() const;
+
+        // comparing - operator< orders by handles, not alphabetically
+        bool operator== (const atom& r) const {
+            return m_data == r.m_data;
+        };
+        bool operator!= (const atom& r) const {
+            return m_data != r.m_data;
+        };
+        bool operator< (const atom& r) const {
+            return m_data < r.m_data;
+        };
+
+        // number of interned strings
+        static size_type count();
+
+    private:
+        // interned strings and process-wide table of them
+        struct data;
+        struct node;
+        struct table;
+        static table* new_table(size_type);
+        static atomic<table*>& current_table();
+        static atomic<int>& write_lock();
+        static void lock();
+        static void unlock();
+
+        static const data* intern(const string_ref&);
+        static const data* lookup(const string_ref&, size_type);
+
+        const data* m_data;
+};
+
+}  // namespace core
+}  // namespace wq
+
+// define movable types
+WQ_MOVABLE_TYPE(atom);
+
+#endif  // WQ_CORE_ATOM_H
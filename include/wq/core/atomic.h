@@ -24,6 +24,17 @@
 namespace wq {
 namespace core {
 
+// counter of locked instructions, it is used only by benchmarks
+// so it is not thread-safe
+#if WQ_ATOMIC_STATS
+	struct WQ_EXPORT atomic_stats {
+		static wq::uint64 sm_locked_ops;
+	};
+	#define WQ_ATOMIC_LOCKED_OP() (++::wq::core::atomic_stats::sm_locked_ops)
+#else
+	#define WQ_ATOMIC_LOCKED_OP()
+#endif
+
 // template class only for few types is allowed
 template<class T> class atomic;
 
@@ -51,6 +62,7 @@ template<> class atomic<int> {
 		// operating with value
 		int set(value_type);
 		int cmp_set(value_type, value_type);
+		void release(value_type);
 		int inc(value_type = 1);
 		int dec(value_type by = 1) {
 			return inc(-by);
@@ -94,19 +106,21 @@ template<> class atomic<int> {
 
 inline int atomic<int>::set(value_type new_val) {
 	int old;
+	WQ_ATOMIC_LOCKED_OP();
 #if defined(__i386__) || defined(__x86_64__)
 	asm __volatile__
     (
     	"lock xchgl %0, %1;"
     	: "=r" (old), "=m" (m_num)
     	: "0" (new_val)
-    	:
+    	: "memory"
     );
 #endif
 	return old;
 }
 
 inline int atomic<int>::cmp_set(value_type cmp_val, value_type new_val) {
+	WQ_ATOMIC_LOCKED_OP();
 #if defined(__i386__) || defined(__x86_64__)
 	int old;
 	asm __volatile__
@@ -114,25 +128,119 @@ inline int atomic<int>::cmp_set(value_type cmp_val, value_type new_val) {
     	"lock cmpxchgl %2, %0;"
     	: "=m" (m_num), "=a" (old)
     	: "r" (new_val), "m" (m_num), "a" (cmp_val)
-    	:
+    	: "memory"
     );
 #endif
 	return old;
 }
 
+// plain store with release ordering, all writes before it are visible to
+// threads which see the new value (it is used to unlock spin locks)
+inline void atomic<int>::release(value_type new_val) {
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+	__atomic_store_n(&m_num, new_val, __ATOMIC_RELEASE);
+#else
+	// stores are not reordered by x86 processors, only compiler must not move them
+	asm __volatile__ ("" : : : "memory");
+	m_num = new_val;
+#endif
+}
+
 inline int atomic<int>::inc(value_type by) {
+	WQ_ATOMIC_LOCKED_OP();
 #if defined(__i386__) || defined(__x86_64__)
 	asm __volatile__
 	(
 		"lock addl %1, %0;"
 		: "=m" (m_num)
 		: "ir" (by), "m" (m_num)
-		:
+		: "memory"
     );
 #endif
 	return m_num - by;
 }
 
+// for unsigned integer of size of pointer (sizes, hashes etc.)
+template<> class atomic<wq::size_t> {
+	public:
+		typedef wq::size_t value_type;
+
+		// creation
+		atomic(value_type val = 0) : m_num(val) { };
+		atomic(const atomic& r) : m_num(r.val()) { };
+		atomic& operator= (const atomic& r) {
+			if(this != &r) {
+				set(r.val());
+			}
+			return *this;
+		};
+
+		// operating with value
+		value_type set(value_type);
+		value_type cmp_set(value_type, value_type);
+		void release(value_type);
+		value_type val() const {
+			return m_num;
+		};
+
+	private:
+		volatile value_type m_num;
+};
+
+inline wq::size_t atomic<wq::size_t>::set(value_type new_val) {
+	value_type old;
+	WQ_ATOMIC_LOCKED_OP();
+#if defined(__i386__) || defined(__x86_64__)
+	asm __volatile__
+    (
+	#if defined(__x86_64__)
+		"lock xchgq %0, %1;"
+	#else
+		"lock xchgl %0, %1;"
+	#endif
+    	: "=r" (old), "=m" (m_num)
+    	: "0" (new_val)
+    	: "memory"
+    );
+#endif
+	return old;
+}
+
+inline wq::size_t atomic<wq::size_t>::cmp_set(value_type cmp_val, value_type new_val) {
+	value_type old;
+	WQ_ATOMIC_LOCKED_OP();
+#if defined(__i386__) || defined(__x86_64__)
+	asm __volatile__
+    (
+	#if defined(__x86_64__)
+		"lock cmpxchgq %2, %0;"
+	#else
+		"lock cmpxchgl %2, %0;"
+	#endif
+    	: "=m" (m_num), "=a" (old)
+    	: "r" (new_val), "m" (m_num), "a" (cmp_val)
+    	: "memory"
+    );
+#endif
+	return old;
+}
+
+inline void atomic<wq::size_t>::release(value_type new_val) {
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+	__atomic_store_n(&m_num, new_val, __ATOMIC_RELEASE);
+#else
+	asm __volatile__ ("" : : : "memory");
+	m_num = new_val;
+#endif
+}
+
+// tells processor that thread waits in busy loop for other thread
+inline void spin_pause() {
+#if defined(__i386__) || defined(__x86_64__)
+	asm __volatile__ ("pause" : : : "memory");
+#endif
+}
+
 // and for all pointers types
 template<class T> class atomic<T*> {
 	public:
@@ -208,6 +316,7 @@ template<class T> class atomic<T*> {
 
 template<class T> inline T* atomic<T*>::set(pointer new_val) {
 	pointer old;
+	WQ_ATOMIC_LOCKED_OP();
 #if defined(__i386__) || defined(__x86_64__)
 	asm __volatile__
     (
@@ -218,7 +327,7 @@ template<class T> inline T* atomic<T*>::set(pointer new_val) {
 	#endif
        	: "=r" (old), "=m" (m_ptr)
         : "0" (new_val)
-		:
+		: "memory"
     );
 #endif
 	return old;
@@ -226,6 +335,7 @@ template<class T> inline T* atomic<T*>::set(pointer new_val) {
 
 template<class T> inline T* atomic<T*>::cmp_set(pointer cmp_val, pointer new_val) {
 	pointer old;
+	WQ_ATOMIC_LOCKED_OP();
 #if defined(__i386__) || defined(__x86_64__)
 	asm __volatile__
     (
@@ -236,7 +346,7 @@ template<class T> inline T* atomic<T*>::cmp_set(pointer cmp_val, pointer new_val
 	#endif
        	: "=m" (m_ptr), "=a" (old)
        	: "r" (new_val), "m" (m_ptr), "a" (cmp_val)
-        :
+        : "memory"
     );
 #endif
 	return old;
@@ -53,6 +53,31 @@ template<class T> class auto_ptr {
 			return *this;
 		};
 
+#if WQ_HAS_MOVE
+		// moving takes data without changing of owners count
+		auto_ptr(auto_ptr&& from) : m_ptr(from.m_ptr), m_count(from.m_count) {
+			from.m_ptr = NULL;
+			from.m_count = NULL;
+		};
+		auto_ptr& operator= (auto_ptr&& r) {
+			if(this != &r) {
+				unset();
+				swap(r);
+			}
+			return *this;
+		};
+#endif
+
+		// exchanging of data without changing of owners count
+		void swap(auto_ptr& with) {
+			wq::core::atomic<pointer>* tmp_ptr = m_ptr;
+			wq::core::atomic<int>* tmp_count = m_count;
+			m_ptr = with.m_ptr;
+			m_count = with.m_count;
+			with.m_ptr = tmp_ptr;
+			with.m_count = tmp_count;
+		};
+
 		// destruction
 		~auto_ptr() {
 			unset();
@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_BREAK_ITERATOR_H
+#define WQ_CORE_BREAK_ITERATOR_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+
+namespace wq {
+namespace core {
+
+// finds boundaries of grapheme clusters, words or sentences (Unicode Standard
+// Annex #29) in referred text, boundaries are found one by one without allocation
+class WQ_EXPORT break_iterator {
+    public:
+        //! Type which handle indexes etc. in break_iterator objects.
+        typedef string::size_type size_type;
+
+        // kinds of text segments
+        enum break_type {
+            grapheme,
+            word,
+            sentence
+        };
+
+        // construction
+        explicit break_iterator(const string_ref&, break_type = grapheme);
+
+        // informations
+        break_type type() const {
+            return m_type;
+        };
+        size_type position() const {
+            return m_pos;
+        };
+        size_type byte_position() const {
+            return m_ptr - m_first;
+        };
+        bool at_end() const {
+            return m_ptr == m_last;
+        };
+
+        // segment between previous and current boundary
+        string_ref segment() const {
+            return string_ref(m_prev, m_ptr - m_prev);
+        };
+        bool is_word() const {
+            return m_word;
+        };
+
+        // moving, every ASCII character except CR LF is grapheme cluster if
+        // other ASCII character follows it
+        bool next() {
+            if(m_type == grapheme && m_ptr != m_last && wq::uint8(*m_ptr) < 0x80 && *m_ptr != '\r' &&
+                    (m_ptr + 1 == m_last || wq::uint8(m_ptr[1]) < 0x80)) {
+                m_prev = m_ptr++;
+                m_pos++;
+                return true;
+            }
+            return next_segment();
+        };
+        void reset();
+
+    private:
+        bool next_segment();
+
+        // referred text, current boundary and the previous one
+        const char* m_first;
+        const char* m_last;
+        const char* m_ptr;
+        const char* m_prev;
+        size_type m_pos;
+        break_type m_type;
+        bool m_word;
+};
+
+}  // namespace core
+}  // namespace wq
+
+#endif  // WQ_CORE_BREAK_ITERATOR_H
@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_CODEPOINT_SET_H
+#define WQ_CORE_CODEPOINT_SET_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+#include "wq/core/vector.h"
+
+namespace wq {
+namespace core {
+
+// set of unicode characters, characters below 256 are stored in bitmap
+// and the others in sorted ranges
+class WQ_EXPORT codepoint_set {
+    public:
+        //! Type which handle sizes in codepoint_set objects.
+        typedef string::size_type size_type;
+
+        // construction
+        codepoint_set();
+        explicit codepoint_set(const string_ref&, bool = true);
+
+        // inserting
+        void insert(wq::uint32);
+        void insert(wq::uint32, wq::uint32);
+        void insert(const string_ref&, bool = true);
+        void clear();
+
+        // membership
+        bool contains(wq::uint32 c) const {
+            if(c < 256) {
+                return ((m_latin1[c >> 5] >> (c & 31)) & 1) != 0;
+            }
+            return contains_range(c);
+        };
+        bool is_ascii() const {
+            return m_ranges.empty() && (m_latin1[4] | m_latin1[5] | m_latin1[6] | m_latin1[7]) == 0;
+        };
+        bool empty() const {
+            return m_ranges.empty() && is_ascii() && (m_latin1[0] | m_latin1[1] | m_latin1[2] | m_latin1[3]) == 0;
+        };
+
+    private:
+        // inclusive range of characters above Latin-1
+        struct range {
+            wq::uint32 m_first;
+            wq::uint32 m_last;
+        };
+
+        bool contains_range(wq::uint32) const;
+
+        // searching kernels use nibble tables of ASCII characters
+        friend const char* utf8_find_of(const char*, const char*, const codepoint_set&, bool);
+        friend const char* utf8_rfind_of(const char*, const char*, const codepoint_set&, bool);
+
+        wq::uint32 m_latin1[8];
+        char m_nibbles[16];
+        vector<range> m_ranges;
+};
+
+}  // namespace core
+}  // namespace wq
+
+#endif  // WQ_CORE_CODEPOINT_SET_H
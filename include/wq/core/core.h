@@ -32,12 +32,21 @@
 
 // strings etc.
 #include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+#include "wq/core/string_builder.h"
+#include "wq/core/codepoint_set.h"
+#include "wq/core/multi_matcher.h"
+#include "wq/core/regex.h"
+#include "wq/core/break_iterator.h"
+#include "wq/core/atom.h"
+#include "wq/core/hash.h"
 #include "wq/core/encoder.h"
 
 // other containers
 #include "wq/core/list.h"
 #include "wq/core/vector.h"
 #include "wq/core/string_list.h"
+#include "wq/core/rope.h"
 
 // other
 #include "wq/core/locale.h"
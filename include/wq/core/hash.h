@@ -0,0 +1,70 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_HASH_H
+#define WQ_CORE_HASH_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+#include "wq/core/atom.h"
+
+#if WQ_STD_COMPATIBILITY && WQ_HAS_MOVE
+	#include <functional>
+#endif
+
+namespace wq {
+namespace core {
+
+// hash of raw bytes, all texts are hashed by it so equal texts have equal hashes
+WQ_EXPORT wq::size_t hash_bytes(const void*, wq::size_t);
+
+// functor for hash containers, it is specialized for hashable types
+template<class T> struct hash;
+
+template<> struct hash<string> {
+	wq::size_t operator() (const string& str) const {
+		return str.hash();
+	};
+};
+
+template<> struct hash<string_ref> {
+	wq::size_t operator() (const string_ref& str) const {
+		return hash_bytes( str.data(), str.bytes() );
+	};
+};
+
+template<> struct hash<atom> {
+	wq::size_t operator() (const atom& a) const {
+		return a.hash();
+	};
+};
+
+}  // namespace core
+}  // namespace wq
+
+// std::hash exists only in new standard
+#if WQ_STD_COMPATIBILITY && WQ_HAS_MOVE
+namespace std {
+	template<> struct hash<wq::core::string> : public wq::core::hash<wq::core::string> { };
+	template<> struct hash<wq::core::string_ref> : public wq::core::hash<wq::core::string_ref> { };
+	template<> struct hash<wq::core::atom> : public wq::core::hash<wq::core::atom> { };
+}
+#endif
+
+#endif  // WQ_CORE_HASH_H
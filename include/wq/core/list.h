@@ -55,6 +55,15 @@ template<class T, class Allocator = std::allocator<T> > class list : public std:
 			}
 			return *this;
 		};
+#if WQ_HAS_MOVE
+		list(list&& r) : std::list<T, Allocator>( WQ_MOVE(r) ) { };
+		list& operator= (list&& r) {
+			if(&r != this) {
+				std::list<T, Allocator>::operator=( WQ_MOVE(r) );
+			}
+			return *this;
+		};
+#endif
 };
 
 }  // namespace core
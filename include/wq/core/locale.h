@@ -458,6 +458,10 @@ class WQ_EXPORT locale {
         locale(const string&);
         locale(const locale&);
         locale& operator= (const locale&);
+#if WQ_HAS_MOVE
+        locale(locale&&);
+        locale& operator= (locale&&);
+#endif
 
         // destruction
         ~locale();
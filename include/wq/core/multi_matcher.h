@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_MULTI_MATCHER_H
+#define WQ_CORE_MULTI_MATCHER_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+#include "wq/core/string_list.h"
+#include "wq/core/vector.h"
+
+namespace wq {
+namespace core {
+
+// finds all occurrences of many patterns in one pass, patterns are compiled
+// to Aho-Corasick automaton over UTF-8 bytes
+class WQ_EXPORT multi_matcher {
+    public:
+        //! Type which handle sizes in multi_matcher objects.
+        typedef string::size_type size_type;
+
+        // one occurrence of pattern, positions are indexes of characters
+        struct match {
+            size_type m_pattern;
+            size_type m_pos;
+            size_type m_len;
+        };
+
+        // construction
+        multi_matcher();
+        explicit multi_matcher(const string_list&, bool = true);
+
+        // informations
+        size_type patterns() const {
+            return m_lengths.size();
+        };
+        size_type states() const {
+            return m_out_begin.size() - 1;
+        };
+        bool is_case_sensitive() const {
+            return m_cs;
+        };
+
+        // searching
+        size_type find_all(const string_ref&, vector<match>&) const;
+        vector<match> find_all(const string_ref& text) const {
+            vector<match> ret_val;
+            find_all(text, ret_val);
+            return ret_val;
+        };
+        bool contains(const string_ref&) const;
+
+    private:
+        void build(const vector<char>&, const vector<size_type>&);
+        template<class Visitor> bool scan(const string_ref&, Visitor&) const;
+
+        // bytes are mapped to classes, bytes which are in no pattern share class 0
+        wq::uint8 m_classes[256];
+        wq::uint32 m_class_count;
+
+        // dense table of transitions, one row of m_class_count items for every state,
+        // transitions are offsets of rows and rows of states with matches are the last ones
+        vector<wq::uint32> m_table;
+        wq::uint32 m_first_match;
+
+        // patterns found in state i are m_out[m_out_begin[i]] - m_out[m_out_begin[i + 1] - 1]
+        vector<wq::uint32> m_out_begin;
+        vector<wq::uint32> m_out;
+
+        // lengths of patterns in characters
+        vector<size_type> m_lengths;
+        bool m_cs;
+};
+
+}  // namespace core
+}  // namespace wq
+
+#endif  // WQ_CORE_MULTI_MATCHER_H
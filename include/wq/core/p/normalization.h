@@ -0,0 +1,73 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_P_NORMALIZATION_H
+#define WQ_CORE_P_NORMALIZATION_H
+
+#include "wq/core/string.h"
+
+namespace wq {
+namespace core {
+
+// tables of Unicode normalization (see normalizationtables.cpp)
+// quick check flags of character, characters without flags are normalized in all forms
+enum uc_quick_check_flags {
+    uc_nfd_no = 0x01,
+    uc_nfkd_no = 0x02,
+    uc_nfc_no = 0x04,
+    uc_nfc_maybe = 0x08,
+    uc_nfkc_no = 0x10,
+    uc_nfkc_maybe = 0x20
+};
+extern const wq::uint8 uc_quick_check_index[];
+extern const wq::uint8 uc_quick_check_blocks[];
+
+static inline wq::uint8 uc_quick_check(wq::uint32 c) {
+    return uc_quick_check_blocks[ uc_quick_check_index[c >> 8] * 256 + (c & 0xFF) ];
+}
+
+// full canonical and compatibility decompositions of character, characters are
+// in uc_decomposition_map (m_canonical_count is 0 if it has no canonical one)
+struct uc_decomposition {
+    wq::uint16 m_canonical;
+    wq::uint16 m_compat;
+    wq::uint8 m_canonical_count;
+    wq::uint8 m_compat_count;
+};
+extern const wq::uint8 uc_decomposition_index[];
+extern const wq::uint16 uc_decomposition_blocks[];
+extern const uc_decomposition uc_decompositions[];
+extern const wq::uint32 uc_decomposition_map[];
+
+static inline const uc_decomposition& uc_get_decomposition(wq::uint32 c) {
+    return uc_decompositions[ uc_decomposition_blocks[ uc_decomposition_index[c >> 8] * 256 + (c & 0xFF) ] ];
+}
+
+// primary composite of two characters (Hangul syllables are not there)
+struct uc_composition {
+    wq::uint32 m_first;
+    wq::uint32 m_second;
+    wq::uint32 m_composite;
+};
+extern const uc_composition uc_compositions[];
+extern const string::size_type uc_compositions_count;
+
+}  // namespace core
+}  // namespace wq
+
+#endif  // WQ_CORE_P_NORMALIZATION_H
@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_P_UTF8_H
+#define WQ_CORE_P_UTF8_H
+
+#include "wq/core/string.h"
+
+namespace wq {
+namespace core {
+
+// helpers for walking through valid UTF-8 sequences
+static inline bool utf8_is_trail(char c) {
+    return (c & 0xC0) == 0x80;
+}
+
+// kernels which process whole blocks of bytes at once (see utf8.cpp)
+// skips n characters, returns last if there is not enough characters
+const char* utf8_skip(const char*, const char*, string::size_type);
+
+// skips n characters backwards, returns first if there is not enough characters
+const char* utf8_skip_back(const char*, const char*, string::size_type);
+
+// counts characters in sequence
+string::size_type utf8_count(const char*, const char*);
+
+// returns first invalid byte (or last) and adds count of valid characters to len
+const char* utf8_validate(const char*, const char*, string::size_type& len);
+
+// finds first (last) occurrence of byte sequence in other one, returns NULL if it is not there
+const char* utf8_find(const char*, const char*, const char*, const char*);
+const char* utf8_rfind(const char*, const char*, const char*, const char*);
+
+// length of invalid sequence which is replaced by one replacement character
+string::size_type utf8_invalid_length(const char*, const char*);
+
+// case insensitive kernels, characters are compared by simple case folding
+wq::uint32 utf8_fold(wq::uint32);
+int utf8_compare_nocase(const char*, const char*, const char*, const char*);
+const char* utf8_find_nocase(const char*, const char*, const char*, const char*);
+const char* utf8_rfind_nocase(const char*, const char*, const char*, const char*);
+
+// writes UTF-8 encoding of character to out (4 bytes are enough), returns its length
+string::size_type utf8_encode(wq::uint32, char*);
+
+// case mappings of whole sequences, characters are written to out while at least
+// 9 bytes are free, returns end of mapped characters and adds their count to len
+enum utf8_case_mapping {
+    utf8_to_lower,
+    utf8_to_upper,
+    utf8_case_fold
+};
+const char* utf8_map_case(const char*, const char*, char*&, char*, utf8_case_mapping, string::size_type& len);
+
+// skips bytes less than limit (as unsigned numbers), returns first other byte or last
+const char* utf8_skip_below(const char*, const char*, wq::uint8);
+
+// all characters with the same case folding as given one, returns 0 if there are more than max
+string::size_type utf8_case_variants(wq::uint32, wq::uint32*, string::size_type);
+
+// characters after this one have no case variants
+wq::uint32 utf8_last_cased();
+
+// finds first (last) character which is (or is not) in set, returns NULL if there is no such one
+const char* utf8_find_of(const char*, const char*, const codepoint_set&, bool);
+const char* utf8_rfind_of(const char*, const char*, const codepoint_set&, bool);
+
+}  // namespace core
+}  // namespace wq
+
+#endif  // WQ_CORE_P_UTF8_H
@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_REGEX_H
+#define WQ_CORE_REGEX_H
+
+#include "wq/core/defs.h"
+#include "wq/core/exception.h"
+#include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+
+namespace wq {
+namespace core {
+
+// exception that indicates invalid or unsupported pattern
+class WQ_EXPORT regex_error : public wq::core::exception {
+    public:
+        regex_error(const char*) throw();
+        const char* what() const throw();
+
+    private:
+        const char* m_what;
+};
+
+// regular expression compiled to automaton over UTF-8 bytes, states of
+// deterministic automaton are built lazily during matching
+class WQ_EXPORT regex {
+    public:
+        //! Type which handle indexes etc. in regex objects.
+        typedef string::size_type size_type;
+
+        // construction
+        regex();
+        explicit regex(const string_ref&, bool = true);
+        regex(const regex&);
+        regex& operator= (const regex&);
+        ~regex();
+
+        // informations
+        const string& pattern() const {
+            return m_pattern;
+        };
+        bool is_case_sensitive() const {
+            return m_cs;
+        };
+
+        // matching
+        bool matches(const string_ref&) const;
+        bool contains(const string_ref&) const;
+        size_type find(const string_ref&, size_type = 0, size_type* = NULL) const;
+
+    private:
+        class program;
+
+        string m_pattern;
+        bool m_cs;
+
+        // compiled automata and cache of their states
+        program* m_program;
+};
+
+}  // namespace core
+}  // namespace wq
+
+#endif  // WQ_CORE_REGEX_H
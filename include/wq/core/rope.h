@@ -0,0 +1,232 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_ROPE_H
+#define WQ_CORE_ROPE_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+#include "wq/core/auto_ptr.h"
+
+#include <iterator>
+
+namespace wq {
+namespace core {
+
+// class for long texts which are often changed, contents are stored
+// in balanced tree of string pieces
+class WQ_EXPORT rope {
+    private:
+        class node;
+        typedef wq::core::auto_ptr<node> node_ptr;
+
+    public:
+        //! Type which handle indexes etc. in rope objects.
+        typedef string::size_type size_type;
+
+        //! Type which describe result of math operations over iterators.
+        typedef string::difference_type difference_type;
+
+        //! Type of characters in rope.
+        typedef string::value_type value_type;
+
+        //! Constant reference type for class.
+        typedef string::const_reference const_reference;
+
+        //! Class which represent constant iterator over rope's characters.
+        class const_iterator {
+            public:
+                typedef rope::value_type value_type;
+                typedef value_type reference;
+                typedef value_type const_reference;
+                typedef const value_type* pointer;
+                typedef const value_type* const_pointer;
+                typedef rope::difference_type difference_type;
+                typedef std::bidirectional_iterator_tag iterator_category;
+
+                // creation and copying
+                const_iterator() : m_owner(NULL), m_leaf(NULL), m_leaf_first(0), m_index(0), m_byte(0) { };
+
+                // converting - character is returned by value, so reverse
+                // iterator which dereferences copy of this does not dangle
+                const_reference operator* () const {
+                    return m_val;
+                };
+                const_pointer operator-> () const {
+                    return &m_val;
+                };
+
+                // comparing
+                bool operator== (const const_iterator& r) const {
+                    return m_index == r.m_index;
+                };
+                bool operator!= (const const_iterator& r) const {
+                    return m_index != r.m_index;
+                };
+                bool operator< (const const_iterator& r) const {
+                    return m_index < r.m_index;
+                };
+                bool operator> (const const_iterator& r) const {
+                    return m_index > r.m_index;
+                };
+                bool operator<= (const const_iterator& r) const {
+                    return m_index <= r.m_index;
+                };
+                bool operator>= (const const_iterator& r) const {
+                    return m_index >= r.m_index;
+                };
+
+                // distance of iterators
+                difference_type operator- (const const_iterator& r) const {
+                    return difference_type(m_index) - difference_type(r.m_index);
+                };
+
+                // incrementing and decrementing
+                const_iterator operator+ (size_type n) const {
+                    return const_iterator(m_owner, m_index + n);
+                };
+                const_iterator operator- (size_type n) const {
+                    return const_iterator(m_owner, m_index - n);
+                };
+                const_iterator& operator+= (size_type n) {
+                    return ( (*this) = ((*this) + n) );
+                };
+                const_iterator& operator-= (size_type n) {
+                    return ( (*this) = ((*this) - n) );
+                };
+                const_iterator& operator++ ();
+                const_iterator& operator-- ();
+                const_iterator operator++ (int) {
+                    const_iterator ret = *this;
+                    ++(*this);
+                    return ret;
+                };
+                const_iterator operator-- (int) {
+                    const_iterator ret = *this;
+                    --(*this);
+                    return ret;
+                };
+
+                // index of character in rope
+                size_type index() const {
+                    return m_index;
+                };
+
+            private:
+                friend class rope;
+                const_iterator(const rope*, size_type);
+                void load();
+
+                const rope* m_owner;
+                const node* m_leaf;
+                size_type m_leaf_first;
+                size_type m_index;
+                size_type m_byte;
+                value_type m_val;
+        };
+
+        //! Constant reverse iterator type.
+        typedef string::reverse_iter<const_iterator> const_reverse_iterator;
+
+        // construction
+        rope();
+        rope(const string&);
+        rope(const rope&);
+        rope& operator= (const rope&);
+        ~rope();
+
+        // size etc.
+        size_type size() const;
+        size_type length() const {
+            return size();
+        };
+        size_type bytes() const;
+        bool empty() const {
+            return size() == 0;
+        };
+        size_type depth() const;
+
+        // iterators
+        const_iterator begin() const {
+            return const_iterator(this, 0);
+        };
+        const_iterator end() const {
+            return const_iterator(this, size());
+        };
+        const_reverse_iterator rbegin() const {
+            return const_reverse_iterator( end() );
+        };
+        const_reverse_iterator rend() const {
+            return const_reverse_iterator( begin() );
+        };
+
+        // characters returning
+        value_type at(size_type) const;
+        value_type operator[] (size_type i) const {
+            return at(i);
+        };
+
+        // changing contents
+        void clear();
+        rope& append(const string&);
+        rope& append(const rope&);
+        rope& insert(size_type, const string&);
+        rope& insert(size_type, const rope&);
+        rope& erase(size_type = 0, size_type = string::npos);
+        rope& replace(size_type, size_type, const string&);
+        rope& operator+= (const string& str) {
+            return append(str);
+        };
+        rope& operator+= (const rope& r) {
+            return append(r);
+        };
+
+        // converting
+        string substr(size_type = 0, size_type = string::npos) const;
+        rope subrope(size_type = 0, size_type = string::npos) const;
+        string to_string() const {
+            return substr();
+        };
+
+        //! Maximal number of bytes in one piece of rope.
+        static const size_type leaf_capacity = 1024;
+
+    private:
+        rope(const node_ptr&);
+
+        // tree algorithms - nodes are never changed, changed path is copied
+        static int height(const node_ptr&);
+        static node_ptr make_leaf(const string&);
+        static node_ptr make_inner(const node_ptr&, const node_ptr&);
+        static node_ptr make_tree(const string&, size_type, size_type);
+        static node_ptr balance(const node_ptr&, const node_ptr&);
+        static node_ptr join(const node_ptr&, const node_ptr&);
+        static void split(const node_ptr&, size_type, node_ptr&, node_ptr&);
+        static const node* find_leaf(const node_ptr&, size_type&);
+        static void append_to(const node_ptr&, string&, size_type, size_type);
+
+        node_ptr m_root;
+};
+
+}  // namespace core
+}  // namespace wq
+
+// define movable types
+WQ_MOVABLE_TYPE(rope);
+
+#endif  // WQ_CORE_ROPE_H
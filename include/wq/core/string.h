@@ -25,6 +25,7 @@
 #include "wq/core/auto_ptr.h"
 
 #include <iterator>
+#include <cstring>
 
 #if WQ_STD_COMPATIBILITY
 	#include <string>
@@ -33,6 +34,9 @@
 namespace wq {
 namespace core {
 
+class string_ref;
+class codepoint_set;
+
 // class for handling all strings in wq, with unicode support of course
 class WQ_EXPORT string {
 	public:
@@ -49,7 +53,7 @@ class WQ_EXPORT string {
 		class value_type {
 			public:
 				// basic construction
-				value_type();
+				value_type() : m_val(0) { };
 				value_type(int val);
 				value_type(wq::uint32 val) : m_val(val) { };
 				value_type(char, const text_encoder& = ascii_encoder());
@@ -57,8 +61,11 @@ class WQ_EXPORT string {
 				value_type(wq::uint16, wq::uint16, bool = true);
 
 				// coping
-				value_type(const value_type&);
-				value_type& operator= (const value_type&);
+				value_type(const value_type& from) : m_val(from.m_val) { };
+				value_type& operator= (const value_type& r) {
+				    m_val = r.m_val;
+				    return *this;
+				};
 
 				// convince functions
 				size_type bytes() const {
@@ -148,6 +155,7 @@ class WQ_EXPORT string {
                     ushort sentence_break : 8;
                 };
                 static const uc_properties* get_uc_properties(wq::uint32);
+                static const wq::uint16* get_special_case(int);
 
                 // testing character's category
                 enum uc_category {
@@ -205,15 +213,19 @@ class WQ_EXPORT string {
                     return category() == letter_titlecase;
                 };
 
-                // getting lower/upper characters etc.
+                // getting lower/upper characters etc., characters which map to more
+                // characters are not changed (see string::to_lower())
                 value_type lower() const {
-                    return value_type(m_val + get_uc_properties(m_val)->lower_case_diff);
+                    const uc_properties* p = get_uc_properties(m_val);
+                    return value_type(p->lower_case_special ? m_val : m_val + p->lower_case_diff);
                 };
                 value_type upper() const {
-                    return value_type(m_val + get_uc_properties(m_val)->upper_case_diff);
+                    const uc_properties* p = get_uc_properties(m_val);
+                    return value_type(p->upper_case_special ? m_val : m_val + p->upper_case_diff);
                 };
                 value_type title() const {
-                    return value_type(m_val + get_uc_properties(m_val)->title_case_diff);
+                    const uc_properties* p = get_uc_properties(m_val);
+                    return value_type(p->title_case_special ? m_val : m_val + p->title_case_diff);
                 };
 
             private:
@@ -234,6 +246,7 @@ class WQ_EXPORT string {
                 // properties tables
                 static const unsigned short sm_property_trie[];
                 static const uc_properties sm_properties[];
+                static const unsigned short sm_special_case_map[];
 		};
 
 	    class iterator;
@@ -246,10 +259,16 @@ class WQ_EXPORT string {
 	    friend class reference;
 	    class reference : public value_type {
 	        public:
-	            // construction
-	            reference(string*, char*);
-	            reference(const string*, char*);
-	            reference(const reference&);
+	            // construction - character is decoded at once, so iterators
+	            // which hold references are created often without calls
+	            reference(string* owner, char* ptr) : value_type(), m_owner(owner), m_ptr(ptr) {
+	                decode();
+	            };
+	            reference(const string* owner, char* ptr) :
+	                    value_type(), m_owner(const_cast<string*>(owner)), m_ptr(ptr) {
+	                decode();
+	            };
+	            reference(const reference& from) : value_type(from), m_owner(from.m_owner), m_ptr(from.m_ptr) { };
 
 	            // assignment with replace in string
 	            reference& operator= (const reference&);
@@ -286,14 +305,41 @@ class WQ_EXPORT string {
                     return m_ptr;
                 };
                 bool is_first() const {
-                    return ptr() == owner()->d()->m_start;
+                    return ptr() == owner()->data();
                 };
                 bool is_last() const {
-                    return ptr() == owner()->d()->m_last;
+                    return ptr() == owner()->data_last();
+                };
+                void rebind(const reference& n) {
+                    value_type::operator= (n);
+                    m_owner = n.m_owner;
+                    m_ptr = n.m_ptr;
                 };
-                void rebind(const reference&);
                 reference next() const;
                 reference prev() const;
+
+                // moving by one character in place, they throw range_error at ends
+                void step_forward();
+                void step_back();
+
+                // character at end of string is 0
+                void decode() {
+                    const char* last = owner()->data_last();
+                    value_type::operator= ( m_ptr == last ? wq::uint32(0) : cp_iterator(m_ptr, last).utf32() );
+                };
+		};
+
+		// proxy returned by operator-> of iterators which create characters when
+		// they are dereferenced, pointer to its copy is valid until end of expression
+		template<class Ref> class arrow_proxy {
+			public:
+				arrow_proxy(const Ref& val) : m_val(val) { };
+				Ref* operator-> () const {
+					return &m_val;
+				};
+
+			private:
+				mutable Ref m_val;
 		};
 
 		//! Class which represent special iterator.
@@ -388,10 +434,12 @@ class WQ_EXPORT string {
 					return ( (*this) = ((*this) - n) );
 				};
 				iterator& operator++ () {
-					return ( (*this) += 1 );
+					m_val.step_forward();
+					return *this;
 				};
 				iterator& operator-- () {
-					return ( (*this) -= 1 );
+					m_val.step_back();
+					return *this;
 				};
 				iterator& operator++ (int) {
 					return ( (*this) += 1 );
@@ -420,7 +468,7 @@ class WQ_EXPORT string {
                 typedef string::value_type value_type;
                 typedef string::reference reference;
                 typedef const reference const_reference;
-                typedef value_type* pointer;
+                typedef const value_type* pointer;
                 typedef const value_type* const_pointer;
                 typedef string::difference_type difference_type;
                 typedef std::bidirectional_iterator_tag iterator_category;
@@ -506,10 +554,12 @@ class WQ_EXPORT string {
 					return ( (*this) = ((*this) - n) );
 				};
 				const_iterator& operator++ () {
-					return ( (*this) += 1 );
+					m_val.step_forward();
+					return *this;
 				};
 				const_iterator& operator-- () {
-					return ( (*this) -= 1 );
+					m_val.step_back();
+					return *this;
 				};
 				const_iterator& operator++ (int) {
 					return ( (*this) += 1 );
@@ -529,18 +579,203 @@ class WQ_EXPORT string {
 				};
 		};
 
+		//! Class which represent reverse iterator over iterator or const_iterator.
+		template<class Iter> class reverse_iter {
+			public:
+				typedef typename Iter::value_type value_type;
+				typedef typename Iter::reference reference;
+				typedef arrow_proxy<reference> pointer;
+				typedef string::difference_type difference_type;
+				typedef std::bidirectional_iterator_tag iterator_category;
+
+				// creation - iterator points after character at base
+				explicit reverse_iter(const Iter& base) : m_base(base) { };
+				template<class Other> reverse_iter(const reverse_iter<Other>& r) : m_base( r.base() ) { };
+				Iter base() const {
+					return m_base;
+				};
+
+				// converting - character is created from copy of base, so
+				// operator-> returns proxy instead of pointer into temporary
+				reference operator* () const {
+					Iter tmp(m_base);
+					--tmp;
+					return *tmp;
+				};
+				pointer operator-> () const {
+					return pointer( operator*() );
+				};
+
+				// comparing
+				template<class Other> bool operator== (const reverse_iter<Other>& r) const {
+					return m_base == r.base();
+				};
+				template<class Other> bool operator!= (const reverse_iter<Other>& r) const {
+					return m_base != r.base();
+				};
+				template<class Other> bool operator< (const reverse_iter<Other>& r) const {
+					return m_base > r.base();
+				};
+				template<class Other> bool operator> (const reverse_iter<Other>& r) const {
+					return m_base < r.base();
+				};
+				template<class Other> bool operator<= (const reverse_iter<Other>& r) const {
+					return m_base >= r.base();
+				};
+				template<class Other> bool operator>= (const reverse_iter<Other>& r) const {
+					return m_base <= r.base();
+				};
+
+				// distance of iterators
+				template<class Other> difference_type operator- (const reverse_iter<Other>& r) const {
+					return r.base() - m_base;
+				};
+
+				// incrementing and decrementing
+				reverse_iter operator+ (size_type n) const {
+					return reverse_iter(m_base - n);
+				};
+				reverse_iter operator- (size_type n) const {
+					return reverse_iter(m_base + n);
+				};
+				reverse_iter& operator+= (size_type n) {
+					m_base -= n;
+					return *this;
+				};
+				reverse_iter& operator-= (size_type n) {
+					m_base += n;
+					return *this;
+				};
+				reverse_iter& operator++ () {
+					--m_base;
+					return *this;
+				};
+				reverse_iter& operator-- () {
+					++m_base;
+					return *this;
+				};
+				reverse_iter operator++ (int) {
+					reverse_iter ret(*this);
+					--m_base;
+					return ret;
+				};
+				reverse_iter operator-- (int) {
+					reverse_iter ret(*this);
+					++m_base;
+					return ret;
+				};
+
+			private:
+				Iter m_base;
+		};
+
 		//! Reverse iterator type.
-		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef reverse_iter<iterator> reverse_iterator;
 
 		//! Constant reverse iterator type.
-		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef reverse_iter<const_iterator> const_reverse_iterator;
+
+		//! Compact read-only iterator over code points of UTF-8 data.
+		class cp_iterator {
+			public:
+				typedef string::value_type value_type;
+				typedef value_type reference;
+				typedef value_type const_reference;
+				typedef arrow_proxy<value_type> pointer;
+				typedef string::difference_type difference_type;
+				typedef std::bidirectional_iterator_tag iterator_category;
+
+				// creation - data are valid UTF-8 which ends at last
+				cp_iterator() : m_ptr(NULL), m_last(NULL) { };
+				cp_iterator(const char* ptr, const char* last) : m_ptr(ptr), m_last(last) { };
+
+				// character is decoded only when it is requested
+				value_type operator* () const {
+					return value_type( int( utf32() ) );
+				};
+				pointer operator-> () const {
+					return pointer( operator*() );
+				};
+				wq::uint32 utf32() const {
+					wq::uint32 c = wq::uint8(m_ptr[0]);
+					if(c < 0x80) {
+						return c;
+					}
+					else if(c < 0xE0) {
+						return ((c & 0x1F) << 6) | (m_ptr[1] & 0x3F);
+					}
+					else if(c < 0xF0) {
+						return ((c & 0x0F) << 12) | ((m_ptr[1] & 0x3F) << 6) | (m_ptr[2] & 0x3F);
+					}
+					return ((c & 0x07) << 18) | ((m_ptr[1] & 0x3F) << 12) | ((m_ptr[2] & 0x3F) << 6) | (m_ptr[3] & 0x3F);
+				};
+				size_type bytes() const {
+					wq::uint8 c = wq::uint8(m_ptr[0]);
+					return c < 0x80 ? 1 : (c < 0xE0 ? 2 : (c < 0xF0 ? 3 : 4));
+				};
+
+				// position
+				const char* ptr() const {
+					return m_ptr;
+				};
+				const char* last() const {
+					return m_last;
+				};
+				bool at_end() const {
+					return m_ptr == m_last;
+				};
+
+				// comparing
+				bool operator== (const cp_iterator& r) const {
+					return m_ptr == r.m_ptr;
+				};
+				bool operator!= (const cp_iterator& r) const {
+					return m_ptr != r.m_ptr;
+				};
+				bool operator< (const cp_iterator& r) const {
+					return m_ptr < r.m_ptr;
+				};
+
+				// moving - caller must not move before first character
+				cp_iterator& operator++ () {
+					m_ptr += bytes();
+					return *this;
+				};
+				cp_iterator& operator-- () {
+					do {
+						m_ptr--;
+					} while((*m_ptr & 0xC0) == 0x80);
+					return *this;
+				};
+				cp_iterator operator++ (int) {
+					cp_iterator ret = *this;
+					++(*this);
+					return ret;
+				};
+				cp_iterator operator-- (int) {
+					cp_iterator ret = *this;
+					--(*this);
+					return ret;
+				};
+
+			private:
+				const char* m_ptr;
+				const char* m_last;
+		};
 
 		// construction
 		string();
 		string(const char*, size_type = npos, const text_encoder& = default_encoder());
 		string(const string&);
 		string(size_type, const_reference);
+#if WQ_HAS_MOVE
+		string(string&& from) : m_tempbuff(NULL), m_local(from.m_local), d_ptr( WQ_MOVE(from.d_ptr) ) {
+		    from.m_local.m_bytes = 0;
+		    from.m_local.m_len = 0;
+		};
+#endif
 		string(const_iterator, const_iterator);
+		explicit string(const string_ref&);
 
         #if WQ_STD_COMPATIBILITY
             string(const std::string&, const text_encoder& = default_encoder());
@@ -554,29 +789,44 @@ class WQ_EXPORT string {
 
 	    // assignment operators
 		string& operator= (const string&);
+#if WQ_HAS_MOVE
+		string& operator= (string&& r) {
+		    if(&r != this) {
+		        d_ptr = WQ_MOVE(r.d_ptr);
+		        m_local = r.m_local;
+		        r.m_local.m_bytes = 0;
+		        r.m_local.m_len = 0;
+		    }
+		    return *this;
+		};
+#endif
 
 		// manipulating with contents
 		void clear();
 
 		// size, capacity etc.
 		size_type size() const {
-			return d()->m_len;
+			return is_local() ? m_local.m_len : d()->m_len;
 		};
 		size_type length() const {
 			return size();
 		};
 		size_type capacity() const {
-			return d()->m_end - d()->m_start;
+			return is_local() ? size_type(local_capacity) : d()->m_end - d()->m_start;
 		};
 		size_type bytes() const {
-			return d()->m_last - d()->m_start;
+			return is_local() ? m_local.m_bytes : d()->m_last - d()->m_start;
 		};
 		size_type max_size() const {
-			return d()->m_alloc.max_size();
+			return wq_data::m_alloc.max_size();
 		};
 		bool empty() const {
 			return size() == 0;
 		};
+		bool is_ascii() const {
+			return size() == bytes();
+		};
+		size_type hash() const;
 
 		// size, capacity manipulation
 		void reserve(size_type = 0);
@@ -584,16 +834,27 @@ class WQ_EXPORT string {
 
 		// iterators
 		iterator begin() {
-			return iterator( reference(this, cd()->m_start) );
+			return iterator( reference(this, const_cast<char*>( data() )) );
 		};
 		iterator end() {
-			return iterator( reference(this, cd()->m_last) );
+			return iterator( reference(this, const_cast<char*>( data_last() )) );
 		};
 		const_iterator begin() const {
-			return const_iterator( reference(this, d()->m_start) );
+			return const_iterator( reference(this, const_cast<char*>( data() )) );
 		};
 		const_iterator end() const {
-			return const_iterator( reference(this, d()->m_last) );
+			return const_iterator( reference(this, const_cast<char*>( data_last() )) );
+		};
+
+		// code point iterators
+		cp_iterator cp_begin() const {
+			return cp_iterator( data(), data_last() );
+		};
+		cp_iterator cp_end() const {
+			return cp_iterator( data_last(), data_last() );
+		};
+		cp_iterator cp_at(size_type i) const {
+			return cp_iterator( data() + byte_offset(i), data_last() );
 		};
 
 		// reverse iterators
@@ -612,14 +873,18 @@ class WQ_EXPORT string {
 
 		// characters returning
 		reference at(size_type);
-		const_reference at(size_type) const;
+		value_type at(size_type) const;
 		reference operator[] (size_type i) {
 			return at(i);
 		};
-		const_reference operator[] (size_type i) const {
+		value_type operator[] (size_type i) const {
 			return at(i);
 		};
 
+		// converting between characters indexes and bytes offsets
+		size_type byte_offset(size_type) const;
+		size_type index_of_byte(size_type) const;
+
 		// assigning
 		string& assign(const string&, size_type = 0, size_type = npos);
 		string& assign(const char* str, size_type size = npos, const text_encoder& enc = default_encoder()) {
@@ -635,6 +900,7 @@ class WQ_EXPORT string {
 		};
 		string& append(size_type, const_reference);
 		string& append(const_iterator, const_iterator);
+		string& append(const string_ref&);
 
 		// inserting
 		string& insert(size_type, const string&, size_type = 0, size_type = npos);
@@ -644,6 +910,7 @@ class WQ_EXPORT string {
 		string& insert(size_type i, size_type n, const_reference c) {
 		    return insert( i, string(n, c) );
 		}
+		string& insert(size_type, const string_ref&);
 		iterator insert(iterator, const string&, size_type = 0, size_type = npos);
 		iterator insert(iterator, const char*, size_type = npos, const text_encoder& = default_encoder());
 		iterator insert(iterator, size_type, const_reference);
@@ -662,16 +929,16 @@ class WQ_EXPORT string {
 		    return replace( from, n, string(count, c) );
 		};
 		string& replace(iterator from, iterator to, const string& str) {
-		    return replace(from - begin(), to - from, str);
+		    return replace(index_of(from), index_of(to) - index_of(from), str);
 		};
 		string& replace(iterator from, iterator to, const_iterator from2, const_iterator to2) {
 		    return replace( from, to, string(from2, to2) );
 		};
 		string& replace(iterator from, iterator to, const char* str, size_type size = npos, const text_encoder& enc = default_encoder()) {
-		    return replace(from - begin(), to - from, str, size, enc);
+		    return replace(index_of(from), index_of(to) - index_of(from), str, size, enc);
 		};
 		string& replace(iterator from, iterator to, size_type count, const_reference c) {
-		    return replace(from - begin(), to - from, count, c);
+		    return replace(index_of(from), index_of(to) - index_of(from), count, c);
 		};
 
 		// comparing
@@ -685,24 +952,29 @@ class WQ_EXPORT string {
 		int compare(size_type from, size_type n, const char* str, size_type size = npos, bool cs = true, const text_encoder& enc = default_encoder()) const {
 		    return compare(from, n, string(str, size, enc), 0, npos, cs);
 		};
+		int compare(const string_ref&) const;
 		bool operator== (const string& r) const {
-		    return compare(r, 0, npos, true) == 0;
+		    // UTF-8 sequences are equal only if their bytes are equal, copies share bytes
+		    return bytes() == r.bytes() && (data() == r.data() || memcmp(data(), r.data(), bytes()) == 0);
 		};
 		bool operator== (const char* r) const {
-		    return compare(r, true, default_encoder()) == 0;
+		    return operator== ( string(r, npos, default_encoder()) );
 		};
 		bool operator== (const value_type& c) const {
-		    return compare(string(1, c), 0, npos, true) == 0;
+		    return bytes() == c.bytes() && memcmp(data(), c.utf8(), c.bytes()) == 0;
 		};
         bool operator!= (const string& r) const {
-            return compare(r, 0, npos, true) != 0;
+            return !operator== (r);
         };
         bool operator!= (const char* r) const {
-            return compare(r, true, default_encoder()) != 0;
+            return !operator== (r);
         };
         bool operator!= (const value_type& c) const {
-            return compare(string(1, c), 0, npos, true) != 0;
+            return !operator== (c);
         };
+		bool starts_with(const string_ref&, bool = true) const;
+		bool ends_with(const string_ref&, bool = true) const;
+		bool contains(const string_ref&, bool = true) const;
 
 		// finding
 		size_type find(const string&, size_type = 0, bool = true) const;
@@ -712,9 +984,8 @@ class WQ_EXPORT string {
 		size_type find(const char* s, size_type pos, size_type n, bool cs = true, const text_encoder& enc = default_encoder()) const {
 		    return find(string(s, n, enc), pos, cs);
 		};
-		size_type find(value_type c, size_type pos = 0, bool cs = true) const {
-		    return find(string(1, c), pos, cs);
-		};
+		size_type find(const string_ref&, size_type = 0, bool = true) const;
+		size_type find(value_type, size_type = 0, bool = true) const;
 
 	    size_type rfind(const string&, size_type = npos, bool = true) const;
 	    size_type rfind(const char* s, size_type pos = npos, bool cs = true, const text_encoder& enc = default_encoder()) const {
@@ -723,9 +994,8 @@ class WQ_EXPORT string {
 	    size_type rfind(const char* s, size_type pos, size_type n, bool cs = true, const text_encoder& enc = default_encoder()) const {
 	        return rfind(string(s, n, enc), pos, cs);
 	    };
-	    size_type rfind(value_type c, size_type pos = npos, bool cs = true) const {
-	        return rfind(string(1, c), pos, cs);
-	    };
+	    size_type rfind(const string_ref&, size_type = npos, bool = true) const;
+	    size_type rfind(value_type, size_type = npos, bool = true) const;
 
         size_type find_first_of(const string&, size_type = 0, bool = true) const;
         size_type find_first_of(const char* s, size_type pos = 0, bool cs = true, const text_encoder& enc = default_encoder()) const {
@@ -737,6 +1007,7 @@ class WQ_EXPORT string {
         size_type find_first_of(value_type c, size_type pos = 0, bool cs = true) const {
             return find_first_of(string(1, c), pos, cs);
         };
+        size_type find_first_of(const codepoint_set&, size_type = 0) const;
 
         size_type find_first_not_of(const string&, size_type = 0, bool = true) const;
         size_type find_first_not_of(const char* s, size_type pos = 0, bool cs = true, const text_encoder& enc = default_encoder()) const {
@@ -748,34 +1019,52 @@ class WQ_EXPORT string {
         size_type find_first_not_of(value_type c, size_type pos = 0, bool cs = true) const {
             return find_first_not_of(string(1, c), pos, cs);
         };
+        size_type find_first_not_of(const codepoint_set&, size_type = 0) const;
 
-        size_type find_last_of(const string&, size_type = 0, bool = true) const;
-        size_type find_last_of(const char* s, size_type pos = 0, bool cs = true, const text_encoder& enc = default_encoder()) const {
+        size_type find_last_of(const string&, size_type = npos, bool = true) const;
+        size_type find_last_of(const char* s, size_type pos = npos, bool cs = true, const text_encoder& enc = default_encoder()) const {
             return find_last_of(string(s, npos, enc), pos, cs);
         };
         size_type find_last_of(const char* s, size_type pos, size_type n, bool cs = true, const text_encoder& enc = default_encoder()) const {
             return find_last_of(string(s, n, enc), pos, cs);
         };
-        size_type find_last_of(value_type c, size_type pos = 0, bool cs = true) const {
+        size_type find_last_of(value_type c, size_type pos = npos, bool cs = true) const {
             return find_last_of(string(1, c), pos, cs);
         };
+        size_type find_last_of(const codepoint_set&, size_type = npos) const;
 
-        size_type find_last_not_of(const string&, size_type = 0, bool = true) const;
-        size_type find_last_not_of(const char* s, size_type pos = 0, bool cs = true, const text_encoder& enc = default_encoder()) const {
+        size_type find_last_not_of(const string&, size_type = npos, bool = true) const;
+        size_type find_last_not_of(const char* s, size_type pos = npos, bool cs = true, const text_encoder& enc = default_encoder()) const {
             return find_last_not_of(string(s, npos, enc), pos, cs);
         };
         size_type find_last_not_of(const char* s, size_type pos, size_type n, bool cs = true, const text_encoder& enc = default_encoder()) const {
             return find_last_not_of(string(s, n, enc), pos, cs);
         };
-        size_type find_last_not_of(value_type c, size_type pos = 0, bool cs = true) const {
+        size_type find_last_not_of(value_type c, size_type pos = npos, bool cs = true) const {
             return find_last_not_of(string(1, c), pos, cs);
         };
+        size_type find_last_not_of(const codepoint_set&, size_type = npos) const;
 
 		// other functions
 		size_type copy(char*, size_type, size_type = 0) const;
 		void swap(string&);
 		string substr(size_type = 0, size_type = -1) const;
 
+		// case mapping of whole string
+		string to_lower() const;
+		string to_upper() const;
+		string case_fold() const;
+
+		// Unicode normalization
+		enum normalization_form {
+		    normalization_d,    // canonical decomposition
+		    normalization_c,    // canonical decomposition and composition
+		    normalization_kd,   // compatibility decomposition
+		    normalization_kc    // compatibility decomposition and canonical composition
+		};
+		string normalized(normalization_form) const;
+		bool is_normalized(normalization_form) const;
+
 		// inline functions and operators for appending data
 		void push_back(const_reference c) {
 		    append(1, c);
@@ -790,15 +1079,14 @@ class WQ_EXPORT string {
 		    return append(c);
 		};
 
-		string operator+ (const string& str) const {
-            return string(*this).append(str);
-        };
-        string operator+ (const char* str) const {
-            return string(*this).append(str);
-        };
-        string operator+ (const_reference c) const {
-            return string(*this).append(c);
-        };
+		// result is built in new object with exact size so no shared data are
+		// copied and detached, temporary at left side is appended in place
+		// (see operator+ for string&& below)
+		string operator+ (const string&) const;
+		string operator+ (const char* str) const {
+		    return operator+ ( string(str) );
+		};
+		string operator+ (const_reference) const;
 
 		// converting
 		const char* any_str(const text_encoder& enc) const {
@@ -816,16 +1104,30 @@ class WQ_EXPORT string {
 
 		// getters
 		const char* data() const {
-		    return d()->m_start;
+		    return is_local() ? m_local.m_buff : d()->m_start;
 		};
 		allocator_type get_allocator() const {
-		    return d()->m_alloc;
+		    return wq_data::m_alloc;
 		};
 
+		//! Number of bytes which can be stored without allocation of shared data.
+		static const size_type local_capacity = 22;
+
 	private:
+		// sparse index which holds byte offset of every index_step-th character
+		class offset_index {
+			public:
+				offset_index(const char*, const char*, size_type);
+				~offset_index();
+
+				size_type* m_offsets;
+				size_type m_count;
+		};
+		static const size_type index_step = 64;
+
 		class wq_data {
 			public:
-				wq_data() : m_start(NULL), m_last(NULL), m_end(NULL), m_len(0) { };
+				wq_data() : m_start(NULL), m_last(NULL), m_end(NULL), m_len(0), m_index(NULL), m_hash(0), m_owner() { };
 				wq_data(const wq_data&);
 				~wq_data();
 
@@ -834,27 +1136,106 @@ class WQ_EXPORT string {
 				char* m_end;
 				size_type m_len;
 				static allocator_type m_alloc;
+
+				// built by first index based access, dropped by every change
+				mutable wq::core::atomic<offset_index*> m_index;
+
+				// hash of contents, zero until it is computed and after every change,
+				// it is published by cmp_set because copies share it
+				mutable wq::core::atomic<wq::size_t> m_hash;
+
+				// set for substrings which point to buffer of other string
+				wq::core::auto_ptr<wq_data> m_owner;
 		};
 
+		// short strings are stored directly in object, d_ptr is not set then
+		struct local_data {
+		    char m_buff[local_capacity];
+		    wq::uint8 m_bytes;
+		    wq::uint8 m_len;
+		};
+
+		bool is_local() const {
+		    return !d_ptr.is_ok();
+		};
+		const char* data_last() const {
+		    return data() + bytes();
+		};
+
+		// fast conversions for iterators
+		const offset_index* get_index() const;
+		const_iterator iterator_at(size_type i) const {
+		    return const_iterator( reference(this, const_cast<char*>( data() ) + byte_offset(i)) );
+		};
+		iterator iterator_at(size_type i) {
+		    return iterator( reference(this, const_cast<char*>( data() ) + byte_offset(i)) );
+		};
+		size_type index_of(const const_iterator& iter) const {
+		    return index_of_byte(iter.ptr() - data());
+		};
+
+		// moving by characters for iterators, range_error is thrown if string is too short
+		const char* skip_forward(const char*, size_type) const;
+		const char* skip_backward(const char*, size_type) const;
+		difference_type distance(const char*, const char*) const;
+
+		// functions for manipulating with raw contents
+		char* wdata();
+		void set_sizes(size_type, size_type);
+		void share(const string&);
+		void append_raw(const char*, size_type, size_type);
+		void insert_raw(size_type, const char*, size_type, size_type);
+		char* assign_raw(size_type, size_type);
+		void adopt_raw(char*, size_type, size_type, size_type);
+		string map_case(int) const;
+		friend class string_builder;
+		friend class utf8_encoder;
+
 		// temp buffer for *_str functions
 		mutable char* m_tempbuff;
 
 		char* set_tempbuff(char* buff) const {
 		    if(m_tempbuff != NULL) {
-		        d()->m_alloc.deallocate(m_tempbuff);
+		        wq_data::m_alloc.deallocate(m_tempbuff);
 		    }
 		    return (m_tempbuff = buff);
 		};
 
+		// contents of short string
+		local_data m_local;
+
 	public:
 		//! Constant that indicates greatest possible or automatic size.
 		static const size_type npos;
 
 	protected:
 		WQ_NEW_SHARED_DATA();
-		WQ_SHARED_DATA();
+
+		// shared data functions - non constant d() detaches also substrings
+		friend class wq_data;
+		wq_data* d();
+		const wq_data* cd() const {
+		    return static_cast<const wq_data*>( d_ptr.const_data() );
+		};
+		const wq_data* d() const {
+		    return static_cast<const wq_data*>( d_ptr.data() );
+		};
 };
 
+#if WQ_HAS_MOVE
+// concatenation to temporary string (e.g. all operators in "a + b + c" but
+// the first one) appends to it instead of creating new string, so the whole
+// chain grows only one buffer
+inline string operator+ (string&& l, const string& r) {
+    return WQ_MOVE( l.append(r) );
+}
+inline string operator+ (string&& l, const char* r) {
+    return WQ_MOVE( l.append(r) );
+}
+inline string operator+ (string&& l, string::const_reference c) {
+    return WQ_MOVE( l.append(1, c) );
+}
+#endif
 
 }  // namespace core
 }  // namespace wq
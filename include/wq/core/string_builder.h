@@ -0,0 +1,114 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_STRING_BUILDER_H
+#define WQ_CORE_STRING_BUILDER_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+
+namespace wq {
+namespace core {
+
+// class for building long strings, appended text is stored in chain
+// of chunks which are never moved and copied to string only once
+class WQ_EXPORT string_builder {
+    WQ_NO_COPY(string_builder)
+
+    public:
+        //! Type which handle sizes in string_builder objects.
+        typedef string::size_type size_type;
+
+        //! Type of appended characters.
+        typedef string::value_type value_type;
+
+        //! Constant reference type for class.
+        typedef string::const_reference const_reference;
+
+        // construction
+        string_builder(size_type = 0);
+        ~string_builder();
+
+        // size etc.
+        size_type size() const {
+            return m_len;
+        };
+        size_type length() const {
+            return m_len;
+        };
+        size_type bytes() const {
+            return m_bytes;
+        };
+        bool empty() const {
+            return m_bytes == 0;
+        };
+
+        // appending
+        string_builder& append(const string_ref&);
+        string_builder& append(const string& str) {
+            return append( string_ref(str) );
+        };
+        string_builder& append(const char* str, const text_encoder& enc = default_encoder()) {
+            return append( string(str, string::npos, enc) );
+        };
+        string_builder& append(size_type, const_reference);
+        string_builder& append(const_reference c) {
+            return append(1, c);
+        };
+        string_builder& operator+= (const string& str) {
+            return append(str);
+        };
+        string_builder& operator+= (const string_ref& str) {
+            return append(str);
+        };
+        string_builder& operator+= (const char* str) {
+            return append(str);
+        };
+        string_builder& operator+= (const_reference c) {
+            return append(1, c);
+        };
+
+        // getting result
+        void clear();
+        string str() const;
+        string freeze();
+
+    private:
+        // one piece of built text
+        struct chunk {
+            char* m_start;
+            char* m_last;
+            char* m_end;
+            chunk* m_next;
+        };
+
+        char* reserve(size_type);
+        void copy_to(char*) const;
+
+        chunk* m_first;
+        chunk* m_current;
+        size_type m_bytes;
+        size_type m_len;
+        size_type m_next_capacity;
+};
+
+}  // namespace core
+}  // namespace wq
+
+#endif  // WQ_CORE_STRING_BUILDER_H
@@ -21,6 +21,7 @@
 
 #include "wq/core/list.h"
 #include "wq/core/string.h"
+#include "wq/core/string_ref.h"
 
 namespace wq {
 namespace core {
@@ -44,15 +45,34 @@ class WQ_EXPORT string_list : public list<string> {
         // creation
         string_list() : list<string>() { };
         string_list(const string&, string::const_reference = string::value_type::delim_char());
+        string_list(const string_ref&, string::const_reference = string::value_type::delim_char());
+        string_list(const char* str, string::const_reference delim = string::value_type::delim_char()) : list<string>() {
+            operator= ( from_string(string(str), delim) );
+        };
         string_list(const_iterator, const_iterator);
         string_list(const string_list& from) : list<string>(from) { };
+#if WQ_HAS_MOVE
+        string_list(string_list&& from) : list<string>( WQ_MOVE(from) ) { };
+#endif
 
         // assignment
         string_list& operator= (const string_list&);
+#if WQ_HAS_MOVE
+        string_list& operator= (string_list&& r) {
+            if(&r != this) {
+                list<string>::operator= ( WQ_MOVE(r) );
+            }
+            return *this;
+        };
+#endif
 
         // new functions for converting
         string to_string(string::const_reference = string::value_type::delim_char()) const;
         static string_list from_string(const string&, string::const_reference = string::value_type::delim_char());
+        static string_list from_string(const string_ref&, string::const_reference = string::value_type::delim_char());
+        static string_list from_string(const char* str, string::const_reference delim = string::value_type::delim_char()) {
+            return from_string(string(str), delim);
+        };
 
         // comparing returning boolean
         bool compare(const string_list& list, bool cs = true) const;
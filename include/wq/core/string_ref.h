@@ -0,0 +1,131 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#ifndef WQ_CORE_STRING_REF_H
+#define WQ_CORE_STRING_REF_H
+
+#include "wq/core/defs.h"
+#include "wq/core/string.h"
+
+#include <cstring>
+
+namespace wq {
+namespace core {
+
+// class which refers to UTF-8 text owned by someone else
+class WQ_EXPORT string_ref {
+    public:
+        //! Type which handle indexes etc. in string_ref objects.
+        typedef string::size_type size_type;
+
+        //! Type which describe result of math operations.
+        typedef string::difference_type difference_type;
+
+        //! Type of characters in referred text.
+        typedef string::value_type value_type;
+
+        // construction
+        string_ref() : m_data(""), m_bytes(0), m_len(0) { };
+        string_ref(const string& str) : m_data(str.data()), m_bytes(str.bytes()), m_len(str.size()) { };
+        string_ref(const string&, size_type, size_type = string::npos);
+        string_ref(const char*, size_type = string::npos);
+
+        // size etc.
+        const char* data() const {
+            return m_data;
+        };
+        size_type bytes() const {
+            return m_bytes;
+        };
+        size_type size() const;
+        size_type length() const {
+            return size();
+        };
+        bool empty() const {
+            return m_bytes == 0;
+        };
+        bool is_ascii() const {
+            return size() == m_bytes;
+        };
+
+        // code point iterators
+        string::cp_iterator cp_begin() const {
+            return string::cp_iterator(m_data, m_data + m_bytes);
+        };
+        string::cp_iterator cp_end() const {
+            return string::cp_iterator(m_data + m_bytes, m_data + m_bytes);
+        };
+
+        // characters returning
+        value_type at(size_type) const;
+        value_type operator[] (size_type i) const {
+            return at(i);
+        };
+
+        // parts of text
+        string_ref substr(size_type = 0, size_type = string::npos) const;
+        string to_string() const {
+            return string(*this);
+        };
+
+        // comparing
+        int compare(const string_ref&, bool = true) const;
+        bool operator== (const string_ref& r) const {
+            return m_bytes == r.m_bytes && (m_data == r.m_data || memcmp(m_data, r.m_data, m_bytes) == 0);
+        };
+        bool operator!= (const string_ref& r) const {
+            return !operator== (r);
+        };
+
+        // finding
+        size_type find(const string_ref&, size_type = 0, bool = true) const;
+        size_type find(value_type c, size_type pos = 0, bool cs = true) const {
+            return find(string_ref( c.utf8() ), pos, cs);
+        };
+        size_type rfind(const string_ref&, size_type = string::npos, bool = true) const;
+        size_type rfind(value_type c, size_type pos = string::npos, bool cs = true) const {
+            return rfind(string_ref( c.utf8() ), pos, cs);
+        };
+        bool starts_with(const string_ref&, bool = true) const;
+        bool ends_with(const string_ref&, bool = true) const;
+        bool contains(const string_ref& what, bool cs = true) const {
+            return find_bytes(m_data, m_data + m_bytes, what.m_data, what.m_data + what.m_bytes, cs) != NULL;
+        };
+
+    private:
+        friend class string;
+        friend class string_list;
+
+        // functions working over bytes which are shared with string
+        static int compare_bytes(const char*, const char*, const char*, const char*, bool);
+        static const char* find_bytes(const char*, const char*, const char*, const char*, bool);
+        static const char* rfind_bytes(const char*, const char*, const char*, const char*, bool);
+
+        // referred text and its size
+        const char* m_data;
+        size_type m_bytes;
+        mutable size_type m_len;
+};
+
+}  // namespace core
+}  // namespace wq
+
+// define movable types
+WQ_MOVABLE_TYPE(string_ref);
+
+#endif  // WQ_CORE_STRING_REF_H
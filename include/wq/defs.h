@@ -23,6 +23,10 @@
 
 #include <cstddef>
 
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+	#include <utility>
+#endif
+
 namespace wq {
 
 // first of all - defines for exporting to DLL libs
@@ -42,6 +46,16 @@ namespace wq {
 		className(const className&);	\
 		className& operator= (const className&);
 
+// move semantics are used only when compiler supports rvalue references,
+// WQ_MOVE() falls back to copying for older compilers
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+	#define WQ_HAS_MOVE 1
+	#define WQ_MOVE(val) std::move(val)
+#else
+	#define WQ_HAS_MOVE 0
+	#define WQ_MOVE(val) (val)
+#endif
+
 // now defining of integer types for each size
 typedef signed char int8;
 typedef unsigned char uint8;
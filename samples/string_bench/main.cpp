@@ -0,0 +1,1441 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/wq.h"
+
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#if WQ_HAS_MOVE
+    #include <regex>
+#endif
+
+#ifdef WQ_UNIX
+    #include <pthread.h>
+    #include <sys/time.h>
+#endif
+
+namespace wq {
+    using namespace core;
+}
+
+// counting of allocations - we replace malloc() family because both
+// wq::core::allocator and operator new end up there
+static unsigned long g_allocs_count = 0;
+static unsigned long long g_allocs_bytes = 0;
+
+#ifdef __GLIBC__
+extern "C" {
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void __libc_free(void*);
+
+    void* malloc(size_t n) {
+        g_allocs_count++;
+        g_allocs_bytes += n;
+        return __libc_malloc(n);
+    }
+    void* calloc(size_t n, size_t size) {
+        g_allocs_count++;
+        g_allocs_bytes += n * size;
+        return __libc_calloc(n, size);
+    }
+    void* realloc(void* ptr, size_t n) {
+        g_allocs_count++;
+        g_allocs_bytes += n;
+        return __libc_realloc(ptr, n);
+    }
+    void free(void* ptr) {
+        __libc_free(ptr);
+    }
+}
+#endif
+
+// result of one measured operation
+class bench_timer {
+    public:
+        bench_timer(const char* name, unsigned long ops) :
+                m_name(name), m_ops(ops), m_allocs(g_allocs_count), m_bytes(g_allocs_bytes), m_start(clock()) {
+        #if WQ_ATOMIC_STATS
+            m_locked = wq::atomic_stats::sm_locked_ops;
+        #endif
+        };
+        ~bench_timer() {
+            double ns = double(clock() - m_start) * 1e9 / CLOCKS_PER_SEC / m_ops;
+            double allocs = double(g_allocs_count - m_allocs) / m_ops;
+            double bytes = double(g_allocs_bytes - m_bytes) / m_ops;
+            printf("  %-44s %10.1f ns/op %8.2f allocs/op %10.1f bytes/op", m_name, ns, allocs, bytes);
+        #if WQ_ATOMIC_STATS
+            // number of lock prefixed instructions
+            printf(" %8.2f locked/op", double(wq::atomic_stats::sm_locked_ops - m_locked) / m_ops);
+        #endif
+            printf("\n");
+        };
+
+    private:
+        const char* m_name;
+        unsigned long m_ops;
+        unsigned long m_allocs;
+        unsigned long long m_bytes;
+        clock_t m_start;
+    #if WQ_ATOMIC_STATS
+        wq::uint64 m_locked;
+    #endif
+};
+
+// prevents compiler from throwing away results
+static volatile wq::size_t g_sink = 0;
+
+// short strings are stored in object, long strings use the shared data layout
+static void bench_local_strings() {
+    const unsigned long ops = 1000000;
+    const char* short_key = "user:1234567";
+    const char* long_key = "user:1234567/session:89abcdef01234567";
+
+    std::cout << "local strings (" << wq::string::local_capacity << " bytes in object):" << std::endl;
+    {
+        bench_timer t("empty string", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            wq::string str;
+            g_sink += str.size();
+        }
+    }
+
+    const char* keys[] = { short_key, long_key };
+    const char* names[][4] = {
+        { "construct short key", "copy short key", "append to short key", "short key + short key" },
+        { "construct long key", "copy long key", "append to long key", "long key + long key" }
+    };
+    for(int k = 0; k != 2; k++) {
+        wq::string key(keys[k], wq::string::npos, wq::utf8_encoder());
+        {
+            bench_timer t(names[k][0], ops);
+            for(unsigned long i = 0; i != ops; i++) {
+                wq::string str(keys[k], wq::string::npos, wq::utf8_encoder());
+                g_sink += str.size();
+            }
+        }
+        {
+            bench_timer t(names[k][1], ops);
+            for(unsigned long i = 0; i != ops; i++) {
+                wq::string str = key;
+                g_sink += str.size();
+            }
+        }
+        {
+            bench_timer t(names[k][2], ops);
+            for(unsigned long i = 0; i != ops; i++) {
+                wq::string str = key;
+                str.append(key, 0, 4);
+                g_sink += str.size();
+            }
+        }
+        {
+            bench_timer t(names[k][3], ops);
+            for(unsigned long i = 0; i != ops; i++) {
+                wq::string str = key + key;
+                g_sink += str.size();
+            }
+        }
+    }
+}
+
+// builds multilingual text with given number of characters
+static wq::string make_text(wq::size_t len) {
+    const char* words[] = { "ahoj ", "m\xc3\xa1\xc5\xa1 ", "\xd0\xbf\xd1\x80\xd0\xb8 ", "\xe2\x82\xac ",
+                            "\xe6\x97\xa5\xe6\x9c\xac ", "text " };
+    wq::string ret_str;
+    for(int i = 0; ret_str.size() < len; i = (i + 1) % 6) {
+        ret_str.append(words[i], wq::string::npos, wq::utf8_encoder());
+    }
+    ret_str.erase(len);
+    return ret_str;
+}
+
+// index based access to characters of long string
+static void bench_index_access() {
+    const wq::size_t len = 5000;
+    wq::string text = make_text(len);
+
+    std::cout << "index access (" << len << " characters):" << std::endl;
+    {
+        bench_timer t("text[i] for all i", len);
+        for(wq::size_t i = 0; i != len; i++) {
+            g_sink += text[i].utf32();
+        }
+    }
+    {
+        bench_timer t("text.insert(i, \"x\") + erase(i, 1)", len / 10);
+        for(wq::size_t i = 0; i < len; i += 10) {
+            text.insert(i, "x", wq::string::npos, wq::utf8_encoder());
+            text.erase(i, 1);
+        }
+    }
+}
+
+// same operations over ASCII and multilingual text of same length
+static void bench_ascii_text() {
+    const wq::size_t len = 5000;
+    wq::string texts[2];
+    texts[0] = make_text(len);
+    for(wq::size_t i = 0; texts[1].size() < len; i++) {
+        texts[1].append("plain ascii log line ", wq::string::npos, wq::utf8_encoder());
+    }
+    texts[1].erase(len);
+    const char* names[] = { "multilingual", "ascii" };
+
+    char buffer[len * 4];
+    for(int k = 0; k != 2; k++) {
+        const wq::string& text = texts[k];
+        std::cout << names[k] << " text (" << len << " characters):" << std::endl;
+        {
+            bench_timer t("text[i] for all i", len);
+            for(wq::size_t i = 0; i != len; i++) {
+                g_sink += text[i].utf32();
+            }
+        }
+        {
+            bench_timer t("begin() + i, end() - iter", len / 10);
+            for(wq::size_t i = 0; i < len; i += 10) {
+                wq::string::const_iterator iter = text.begin() + i;
+                g_sink += text.end() - iter;
+            }
+        }
+        {
+            bench_timer t("substr(i, 50)", len / 10);
+            for(wq::size_t i = 0; i < len - 50; i += 10) {
+                g_sink += text.substr(i, 50).bytes();
+            }
+        }
+        {
+            bench_timer t("copy(buffer, 100, i)", len / 10);
+            for(wq::size_t i = 0; i < len - 100; i += 10) {
+                g_sink += text.copy(buffer, 100, i);
+            }
+        }
+    }
+}
+
+// editing of long text - string moves whole tail, rope copies only one path of tree
+static void bench_rope_edits() {
+    const wq::size_t len = 1000000;
+    const unsigned long ops = 10000;
+    wq::string text = make_text(len);
+    wq::string word("slovo ", wq::string::npos, wq::utf8_encoder());
+
+    std::cout << "rope edits (" << len << " characters):" << std::endl;
+    {
+        wq::string str = text;
+        bench_timer t("string: insert(i, word) + erase(j, 6)", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            str.insert((i * 7919) % len, word);
+            str.erase((i * 104729) % len, 6);
+        }
+        g_sink += str.size();
+    }
+    {
+        wq::rope rp(text);
+        bench_timer t("rope: insert(i, word) + erase(j, 6)", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            rp.insert((i * 7919) % len, word);
+            rp.erase((i * 104729) % len, 6);
+        }
+        g_sink += rp.size();
+    }
+    {
+        bench_timer t("string: text[i]", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            g_sink += text[(i * 7919) % len].utf32();
+        }
+    }
+    wq::rope rp(text);
+    {
+        bench_timer t("rope: rp[i]", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            g_sink += rp[(i * 7919) % len].utf32();
+        }
+    }
+    {
+        bench_timer t("rope: snapshot + insert(i, word)", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            wq::rope snapshot = rp;
+            rp.insert((i * 7919) % len, word);
+            g_sink += snapshot.size();
+        }
+    }
+    {
+        bench_timer t("rope: iterate all characters", len);
+        for(wq::rope::const_iterator iter = rp.begin(); iter != rp.end(); ++iter) {
+            g_sink += iter->utf32();
+        }
+    }
+    {
+        bench_timer t("rope: to_string()", 1);
+        g_sink += rp.to_string().bytes();
+    }
+}
+
+// parsing of key=value lines - substr() copies every part, string_ref only points to it
+static void bench_string_ref() {
+    const unsigned long lines = 20000;
+    wq::string text;
+    for(unsigned long i = 0; i != lines; i++) {
+        text.append("user.name=Kaka\xc5\xa1 Richard, Bratislava, Slovakia;", wq::string::npos, wq::utf8_encoder());
+    }
+    wq::string key("user.name", wq::string::npos, wq::utf8_encoder());
+
+    std::cout << "string_ref parsing (" << lines << " lines):" << std::endl;
+    {
+        bench_timer t("find + substr + compare", lines);
+        wq::size_t pos = 0, end;
+        while( (end = text.find(wq::string::value_type(';'), pos)) != wq::string::npos ) {
+            wq::size_t eq = text.find(wq::string::value_type('='), pos);
+            g_sink += text.substr(pos, eq - pos).compare(key) == 0;
+            g_sink += text.substr(eq + 1, end - eq - 1).size();
+            pos = end + 1;
+        }
+    }
+    {
+        bench_timer t("find + string_ref + compare", lines);
+        wq::string_ref rest(text);
+        wq::size_t end;
+        while( (end = rest.find(wq::string::value_type(';'))) != wq::string::npos ) {
+            wq::string_ref line = rest.substr(0, end);
+            wq::size_t eq = line.find(wq::string::value_type('='));
+            g_sink += line.substr(0, eq).compare(key) == 0;
+            g_sink += line.substr(eq + 1).size();
+            rest = rest.substr(end + 1);
+        }
+    }
+    {
+        bench_timer t("string_list::from_string", lines);
+        g_sink += wq::string_list::from_string(text, wq::string::value_type(';')).size();
+    }
+}
+
+// tokenizing of big file to lines - long substrings share buffer of file contents
+static void bench_tokenize() {
+    const wq::size_t file_size = 100 * 1024 * 1024;
+    const char* lines[] = {
+        "2010-11-02 12:00:01 INFO  server started on port 8080, waiting for connections\n",
+        "2010-11-02 12:00:02 WARN  u\xc5\xbe\xc3\xadvate\xc4\xbe 'kaka\xc5\xa1' nem\xc3\xa1 nastaven\xc3\xbd jazyk\n",
+        "2010-11-02 12:00:03 DEBUG request /index.html served in 3 ms\n"
+    };
+    wq::string line_strs[3];
+    for(int i = 0; i != 3; i++) {
+        line_strs[i].assign(lines[i], wq::string::npos, wq::utf8_encoder());
+    }
+    wq::string text;
+    text.reserve(file_size + 128);
+    for(int i = 0; text.bytes() < file_size; i = (i + 1) % 3) {
+        text.append(line_strs[i]);
+    }
+
+    unsigned long count = 0;
+    for(wq::size_t pos = 0, end; (end = text.find(wq::string::value_type('\n'), pos)) != wq::string::npos; pos = end + 1) {
+        count++;
+    }
+
+    std::cout << "tokenizing (" << text.bytes() / (1024 * 1024) << " MB, " << count << " lines):" << std::endl;
+    {
+        bench_timer t("find + substr", count);
+        wq::size_t pos = 0, end;
+        while( (end = text.find(wq::string::value_type('\n'), pos)) != wq::string::npos ) {
+            wq::string line = text.substr(pos, end - pos);
+            g_sink += line.size();
+            pos = end + 1;
+        }
+    }
+    {
+        unsigned long long bytes = g_allocs_bytes;
+        wq::list<wq::string> tokens;
+        bench_timer t("find + substr, all lines kept", count);
+        wq::size_t pos = 0, end;
+        while( (end = text.find(wq::string::value_type('\n'), pos)) != wq::string::npos ) {
+            tokens.push_back( text.substr(pos, end - pos) );
+            pos = end + 1;
+        }
+        std::cout << "  memory of kept lines: " << (g_allocs_bytes - bytes) / (1024 * 1024) << " MB" << std::endl;
+    }
+}
+
+// returning of temporaries - with move semantics they should not need locked instructions
+static wq::string make_name(const wq::string& key, int i) {
+    wq::string ret_str = key;
+    ret_str.append(1, wq::string::value_type('0' + i % 10));
+    return ret_str;
+}
+
+static void bench_temporaries() {
+    const unsigned long ops = 200000;
+    wq::string key("configuration.section.value", wq::string::npos, wq::utf8_encoder());
+    wq::string text = make_text(1000);
+    wq::locale lc(wq::locale::Slovak, wq::locale::Slovakia);
+    wq::utf8_encoder enc;
+    const char* raw = "configuration.section.value";
+
+    std::cout << "temporaries (move semantics " << (WQ_HAS_MOVE ? "on" : "off");
+    std::cout << ", locked instructions " << (WQ_ATOMIC_STATS ? "counted" : "not counted") << "):" << std::endl;
+    {
+        bench_timer t("str = key + key", ops);
+        wq::string str;
+        for(unsigned long i = 0; i != ops; i++) {
+            str = key + key;
+            g_sink += str.size();
+        }
+    }
+    {
+        bench_timer t("str = text.substr(i, 100)", ops);
+        wq::string str;
+        for(unsigned long i = 0; i != ops; i++) {
+            str = text.substr(i % 500, 100);
+            g_sink += str.size();
+        }
+    }
+    {
+        bench_timer t("str = enc.encode(raw)", ops);
+        wq::string str;
+        for(unsigned long i = 0; i != ops; i++) {
+            str = enc.encode(raw);
+            g_sink += str.size();
+        }
+    }
+    {
+        bench_timer t("str = lc.name()", ops);
+        wq::string str;
+        for(unsigned long i = 0; i != ops; i++) {
+            str = lc.name();
+            g_sink += str.size();
+        }
+    }
+    {
+        bench_timer t("str = make_name(key, i)", ops);
+        wq::string str;
+        for(unsigned long i = 0; i != ops; i++) {
+            str = make_name(key, i);
+            g_sink += str.size();
+        }
+    }
+    {
+        bench_timer t("str.swap(other)", ops);
+        wq::string str = key + key, other = text;
+        for(unsigned long i = 0; i != ops; i++) {
+            str.swap(other);
+            g_sink += str.size();
+        }
+    }
+    {
+        bench_timer t("list = string_list::from_string(key)", ops);
+        wq::string_list list;
+        for(unsigned long i = 0; i != ops; i++) {
+            list = wq::string_list::from_string(key, wq::string::value_type('.'));
+            g_sink += list.size();
+        }
+    }
+}
+
+// message assembly by chains of operator+
+static void bench_concat() {
+    const unsigned long ops = 200000;
+    wq::utf8_encoder enc;
+    wq::string name = enc.encode("connection.timeout");
+    wq::string value = enc.encode("1500");
+    wq::string unit = enc.encode("milliseconds");
+    wq::string sep = enc.encode(" = ");
+    wq::string path = enc.encode("/var/lib/application/data/storage/");
+    wq::string file = enc.encode("index.db");
+    wq::string::value_type nl('\n');
+
+    std::cout << "concatenation chains:" << std::endl;
+    {
+        bench_timer t("msg = name + sep + value + ' ' + unit + nl", ops);
+        wq::string msg;
+        for(unsigned long i = 0; i != ops; i++) {
+            msg = name + sep + value + wq::string::value_type(' ') + unit + nl;
+            g_sink += msg.size();
+        }
+    }
+    {
+        bench_timer t("msg = file + nl (short result)", ops);
+        wq::string msg;
+        for(unsigned long i = 0; i != ops; i++) {
+            msg = file + nl;
+            g_sink += msg.size();
+        }
+    }
+    {
+        bench_timer t("msg = path + name + sep + path + file", ops);
+        wq::string msg;
+        for(unsigned long i = 0; i != ops; i++) {
+            msg = path + name + sep + path + file;
+            g_sink += msg.size();
+        }
+    }
+    {
+        bench_timer t("msg = name + \" = \" + value (literal)", ops);
+        wq::string msg;
+        for(unsigned long i = 0; i != ops; i++) {
+            msg = name + " = " + value;
+            g_sink += msg.size();
+        }
+    }
+}
+
+// output of tables_gen's create_tables() - quoted names separated by commas
+static void bench_builder() {
+    const unsigned long tables = 2000;
+    wq::utf8_encoder enc;
+    wq::string names[12];
+    for(int i = 0; i != 12; i++) {
+        char buffer[32];
+        sprintf(buffer, "m\xc3\xa9si\xc3\xa1\x63 %d", i + 1);
+        names[i] = enc.encode(buffer);
+    }
+    wq::string head = enc.encode("const char* locale::wq_data::months_names[][12] = {\n");
+    wq::string open = enc.encode("{"), close = enc.encode("}"), quote = enc.encode("\"");
+    wq::string comma = enc.encode(", "), line_end = enc.encode(",\n");
+
+    std::cout << "building of " << tables << " tables:" << std::endl;
+    {
+        bench_timer t("out = out + quote + name + quote", tables);
+        wq::string out = head;
+        for(unsigned long i = 0; i != tables; i++) {
+            out += open;
+            for(int n = 0; n != 12; n++) {
+                out = out + quote + names[n] + quote;
+                if(n != 11) {
+                    out += comma;
+                }
+            }
+            out += close;
+            out += line_end;
+        }
+        g_sink += out.size();
+    }
+    {
+        bench_timer t("string += quote, name, quote", tables);
+        wq::string out = head;
+        for(unsigned long i = 0; i != tables; i++) {
+            out += open;
+            for(int n = 0; n != 12; n++) {
+                out += quote;
+                out += names[n];
+                out += quote;
+                if(n != 11) {
+                    out += comma;
+                }
+            }
+            out += close;
+            out += line_end;
+        }
+        g_sink += out.size();
+    }
+    {
+        bench_timer t("string_builder += ..., freeze()", tables);
+        wq::string_builder out;
+        out += head;
+        for(unsigned long i = 0; i != tables; i++) {
+            out += open;
+            for(int n = 0; n != 12; n++) {
+                out += quote;
+                out += names[n];
+                out += quote;
+                if(n != 11) {
+                    out += comma;
+                }
+            }
+            out += close;
+            out += line_end;
+        }
+        g_sink += out.freeze().size();
+    }
+}
+
+// identifiers which are looked up by atom benchmark
+static const unsigned long sm_atom_ids = 2000;
+static wq::string sm_atom_names[sm_atom_ids];
+
+#ifdef WQ_UNIX
+// one thread of atom lookup benchmark
+static void* atom_lookup_thread(void* arg) {
+    unsigned long ops = *static_cast<unsigned long*>(arg);
+    wq::size_t sum = 0;
+    for(unsigned long i = 0; i != ops; i++) {
+        sum += wq::atom( wq::string_ref(sm_atom_names[(i * 7919) % sm_atom_ids]) ).hash();
+    }
+    g_sink += sum;
+    return NULL;
+}
+#endif
+
+// interning of identifiers and comparing of them
+static void bench_atoms() {
+    const unsigned long ops = 2000000;
+    wq::utf8_encoder enc;
+    for(unsigned long i = 0; i != sm_atom_ids; i++) {
+        char buffer[64];
+        sprintf(buffer, "metrics.http.server.requests.%lu.latency", i);
+        sm_atom_names[i] = enc.encode(buffer);
+    }
+
+    // the same texts in other buffers so compare() can not stop on equal pointers
+    wq::string copies[sm_atom_ids];
+    wq::atom atoms[sm_atom_ids];
+    for(unsigned long i = 0; i != sm_atom_ids; i++) {
+        copies[i] = wq::string( wq::string_ref(sm_atom_names[i]) );
+        atoms[i] = wq::atom(sm_atom_names[i]);
+    }
+
+    std::cout << "atoms of " << sm_atom_ids << " identifiers:" << std::endl;
+    {
+        bench_timer t("string == string (equal)", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            g_sink += sm_atom_names[i % sm_atom_ids] == copies[i % sm_atom_ids];
+        }
+    }
+    {
+        bench_timer t("atom == atom (equal)", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            g_sink += atoms[i % sm_atom_ids] == wq::atom(atoms[i % sm_atom_ids]);
+        }
+    }
+    {
+        bench_timer t("atom(string_ref) lookup", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            g_sink += wq::atom( wq::string_ref(copies[(i * 7919) % sm_atom_ids]) ).hash();
+        }
+    }
+#ifdef WQ_UNIX
+    // wall time of the same lookups spread over threads
+    for(unsigned long threads = 1; threads <= 8; threads *= 2) {
+        pthread_t ids[8];
+        unsigned long per_thread = ops / threads;
+        timeval start, end;
+        gettimeofday(&start, NULL);
+        for(unsigned long i = 0; i != threads; i++) {
+            pthread_create(&ids[i], NULL, atom_lookup_thread, &per_thread);
+        }
+        for(unsigned long i = 0; i != threads; i++) {
+            pthread_join(ids[i], NULL);
+        }
+        gettimeofday(&end, NULL);
+        double secs = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+        char name[64];
+        sprintf(name, "atom lookup, %lu threads (wall time)", threads);
+        printf("  %-44s %10.1f ns/op %8.1f Mops/s\n", name,
+               secs * 1e9 / (per_thread * threads), per_thread * threads / secs / 1e6);
+    }
+#endif
+}
+
+// throughput of hashing for short keys and long texts
+static void bench_hash() {
+    std::cout << "hashing:" << std::endl;
+    const wq::size_t sizes[] = { 16, 44, 256, 4096, 64 * 1024 * 1024 };
+    for(int s = 0; s != 5; s++) {
+        std::string raw(sizes[s], 'a');
+        for(wq::size_t i = 0; i != raw.size(); i++) {
+            raw[i] = char('a' + (i * 7) % 26);
+        }
+        unsigned long ops = (unsigned long)(wq::size_t(256) * 1024 * 1024 / sizes[s]);
+        char name[64];
+        sprintf(name, "hash_bytes(), %lu bytes", (unsigned long)sizes[s]);
+
+        clock_t start = clock();
+        for(unsigned long i = 0; i != ops; i++) {
+            g_sink += wq::hash_bytes(raw.data(), raw.size() - (i & 1));
+        }
+        double secs = double(clock() - start) / CLOCKS_PER_SEC;
+        printf("  %-44s %10.1f ns/op %8.2f GB/s\n", name, secs * 1e9 / ops, double(ops) * sizes[s] / secs / 1e9);
+    }
+
+    // cached hash of shared data
+    const unsigned long ops = 1000000;
+    wq::string text = make_text(4096);
+    {
+        bench_timer t("string::hash(), 4096 bytes, cached", ops);
+        for(unsigned long i = 0; i != ops; i++) {
+            g_sink += wq::hash<wq::string>()(text);
+        }
+    }
+}
+
+// walking through all characters of long text
+static void bench_scan() {
+    const wq::size_t len = 1000000;
+    const unsigned long rounds = 20;
+    wq::string text = make_text(len);
+    wq::string copy = wq::string( wq::string_ref(text) );
+    wq::string delims = wq::utf8_encoder().encode("#@|");
+
+    std::cout << "scan of " << len << " characters (per character):" << std::endl;
+    {
+        bench_timer t("const_iterator, sum of utf32()", len * rounds);
+        const wq::string& ctext = text;
+        for(unsigned long r = 0; r != rounds; r++) {
+            wq::uint32 sum = 0;
+            for(wq::string::const_iterator iter = ctext.begin(); iter != ctext.end(); ++iter) {
+                sum += iter->utf32();
+            }
+            g_sink += sum;
+        }
+    }
+    {
+        bench_timer t("cp_iterator, sum of utf32()", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            wq::uint32 sum = 0;
+            for(wq::string::cp_iterator iter = text.cp_begin(); iter != text.cp_end(); ++iter) {
+                sum += iter.utf32();
+            }
+            g_sink += sum;
+        }
+    }
+    {
+        bench_timer t("find_first_of(\"#@|\") (not found)", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.find_first_of(delims);
+        }
+    }
+    {
+        bench_timer t("compare() of equal texts", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.compare(copy);
+        }
+    }
+    {
+        bench_timer t("compare() case insensitive", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.compare(copy, 0, wq::string::npos, false);
+        }
+    }
+}
+
+// moving iterators by many characters and measuring distances between them
+static void bench_advance() {
+    const wq::size_t len = 1000000;
+    const unsigned long rounds = 20;
+    wq::string text = make_text(len);
+    const wq::string& ctext = text;
+
+    std::cout << "iterator arithmetic over " << len << " characters (per character):" << std::endl;
+    {
+        bench_timer t("begin() + size()", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += (ctext.begin() + (len - r)) != ctext.end();
+        }
+    }
+    {
+        bench_timer t("end() - size()", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += (ctext.end() - (len - r)) != ctext.begin();
+        }
+    }
+    {
+        bench_timer t("end() - begin()", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += ctext.end() - ctext.begin();
+        }
+    }
+    {
+        bench_timer t("append(begin(), end())", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            wq::string copy;
+            copy.append(ctext.begin(), ctext.end());
+            g_sink += copy.bytes();
+        }
+    }
+}
+
+// converting of UTF-8 payloads to strings
+static void bench_encode() {
+    const wq::size_t len = 1000000;
+    const unsigned long rounds = 10;
+    wq::string text = make_text(len);
+    std::string payload(text.data(), text.bytes());
+    std::string ascii_payload(payload.size(), 'x');
+
+    std::cout << "encoding of " << payload.size() << " bytes of UTF-8 (per byte):" << std::endl;
+    {
+        bench_timer t("utf8_encoder::encode(), multilingual", payload.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += wq::utf8_encoder().encode( payload.data(), payload.size() ).size();
+        }
+    }
+    {
+        bench_timer t("utf8_encoder::encode(), ASCII", payload.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += wq::utf8_encoder().encode( ascii_payload.data(), ascii_payload.size() ).size();
+        }
+    }
+    payload[payload.size() / 2] = char(0xFF);
+    {
+        bench_timer t("utf8_encoder::encode(), one invalid byte", payload.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += wq::utf8_encoder(false).encode( payload.data(), payload.size() ).size();
+        }
+    }
+}
+
+// walking through string from its end
+static void bench_reverse() {
+    const wq::size_t len = 100000;
+    const unsigned long rounds = 20;
+    wq::string text = make_text(len);
+    const wq::string& ctext = text;
+
+    std::cout << "reverse scan of " << len << " characters (per character):" << std::endl;
+    {
+        bench_timer t("const_reverse_iterator", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            wq::uint32 sum = 0;
+            for(wq::string::const_reverse_iterator iter = ctext.rbegin(); iter != ctext.rend(); ++iter) {
+                sum += (*iter).utf32();
+            }
+            g_sink += sum;
+        }
+    }
+    {
+        bench_timer t("--const_iterator", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            wq::uint32 sum = 0;
+            for(wq::string::const_iterator iter = ctext.end(); iter != ctext.begin(); ) {
+                --iter;
+                sum += iter->utf32();
+            }
+            g_sink += sum;
+        }
+    }
+    {
+        bench_timer t("--cp_iterator", len * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            wq::uint32 sum = 0;
+            for(wq::string::cp_iterator iter = text.cp_end(); iter != text.cp_begin(); ) {
+                --iter;
+                sum += iter.utf32();
+            }
+            g_sink += sum;
+        }
+    }
+}
+
+// searching of short and long texts in long multilingual text
+static void bench_find() {
+    const wq::size_t len = 1000000;
+    const unsigned long rounds = 20;
+    wq::string text = make_text(len);
+    wq::string marker = wq::utf8_encoder().encode("\xd0\xbf\xd1\x80\xd0\xb8 \xe2\x82\xac!");
+    wq::string long_needle = text.substr(len / 2, 60) + marker;
+    text.insert(len - 100, long_needle);
+
+    const char* names[] = { "find() of short absent text", "find() of short text near end",
+                            "find() of 62 characters near end" };
+    wq::string needles[] = { wq::utf8_encoder().encode("qwe"), marker, long_needle };
+    g_sink += text.byte_offset(len / 2);  // index of long string is built outside of timers
+
+    std::cout << "find in " << text.size() << " characters (per search):" << std::endl;
+    for(int k = 0; k != 3; k++) {
+        bench_timer t(names[k], rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.find(needles[k]);
+        }
+    }
+}
+
+// case insensitive searching and comparing
+static void bench_nocase() {
+    const wq::size_t len = 1000000;
+    const unsigned long rounds = 20;
+    wq::string text = make_text(len);
+    wq::string upper_text = wq::string( wq::string_ref(text) );
+    wq::string marker = wq::utf8_encoder().encode("\xd0\xbf\xd1\x80\xd0\xb8 \xe2\x82\xac!");
+    text.insert(len - 100, marker);
+    g_sink += text.byte_offset(len / 2);
+    g_sink += marker.find("x", 0, false);  // builds case folding table
+
+    const char* needles[] = { "qwe", "\xd0\x9f\xd0\xa0\xd0\x98 \xe2\x82\xac!", "TEXT AHOJ M\xc3\x81\xc5\xa0 \xd0\x9f\xd0\xa0\xd0\x98 \xe2\x82\xac!" };
+    const char* names[][2] = {
+        { "find(\"qwe\") (absent)", "find(\"QWE\", false) (absent)" },
+        { "find() of short text near end", "find(..., false) of short text near end" },
+        { "find() of longer text (absent)", "find(..., false) of longer text (absent)" }
+    };
+    std::cout << "case insensitive find in " << text.size() << " characters (per search):" << std::endl;
+    for(int k = 0; k != 3; k++) {
+        wq::string needle = wq::utf8_encoder().encode(needles[k]);
+        wq::string lower_needle = needle;
+        for(wq::size_t i = 0; i != lower_needle.size(); i++) {
+            lower_needle[i] = lower_needle[i].lower();
+        }
+        {
+            bench_timer t(names[k][0], rounds);
+            for(unsigned long r = 0; r != rounds; r++) {
+                g_sink += text.find(lower_needle);
+            }
+        }
+        {
+            bench_timer t(names[k][1], rounds);
+            for(unsigned long r = 0; r != rounds; r++) {
+                g_sink += text.find(needle, 0, false);
+            }
+        }
+    }
+
+    for(wq::size_t i = 0; i < upper_text.size(); i += 7) {
+        upper_text[i] = upper_text[i].upper();
+    }
+    {
+        bench_timer t("compare(..., false) of texts differing in case", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.compare(0, len - 100, upper_text, 0, len - 100, false);
+        }
+    }
+}
+
+// searching of characters from sets, as tokenizers do
+static void bench_charset() {
+    const wq::size_t len = 1000000;
+    const unsigned long rounds = 10;
+    const char* lines[] = {
+        "2010-11-02 12:00:01 INFO  server started on port 8080, waiting for connections\n",
+        "2010-11-02 12:00:02 WARN  u\xc5\xbe\xc3\xadvate\xc4\xbe 'kaka\xc5\xa1' nem\xc3\xa1 nastaven\xc3\xbd jazyk\n",
+        "2010-11-02 12:00:03 DEBUG request /index.html served in 3 ms\n"
+    };
+    wq::string text;
+    for(int i = 0; text.size() < len; i = (i + 1) % 3) {
+        text.append(lines[i], wq::string::npos, wq::utf8_encoder());
+    }
+    g_sink += text.byte_offset(text.size() / 2);
+    wq::string delims(" ,'\n");
+    wq::codepoint_set delims_set(delims);
+    wq::string accents("\xc5\xbe\xc3\xa1\xc3\xbd", wq::string::npos, wq::utf8_encoder());
+
+    std::cout << "character sets (" << text.size() << " characters, per character):" << std::endl;
+    {
+        bench_timer t("tokens by find_first_of(string)", text.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            for(wq::size_t pos = 0; (pos = text.find_first_of(delims, pos)) != wq::string::npos; pos++) {
+                g_sink += pos;
+            }
+        }
+    }
+    {
+        bench_timer t("tokens by find_first_of(codepoint_set)", text.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            for(wq::size_t pos = 0; (pos = text.find_first_of(delims_set, pos)) != wq::string::npos; pos++) {
+                g_sink += pos;
+            }
+        }
+    }
+    {
+        bench_timer t("find_first_of(\"#@|\") (not found)", text.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.find_first_of("#@|");
+        }
+    }
+    {
+        bench_timer t("find_last_of(\"#@|\") (not found)", text.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.find_last_of("#@|");
+        }
+    }
+    {
+        bench_timer t("find_first_of(\"#\u20ac\") (not found)", text.size() * rounds);
+        wq::string euro("#\xe2\x82\xac", wq::string::npos, wq::utf8_encoder());
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.find_first_of(euro);
+        }
+    }
+    {
+        bench_timer t("all find_first_of(accents, false)", text.size() * rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            for(wq::size_t pos = 0; (pos = text.find_first_of(accents, pos, false)) != wq::string::npos; pos++) {
+                g_sink += pos;
+            }
+        }
+    }
+}
+
+// finding last separator in long path and long log line
+static void bench_rfind() {
+    const unsigned long rounds = 100000;
+    wq::string path("/home/u\xc5\xbe\xc3\xadvate\xc4\xbe", wq::string::npos, wq::utf8_encoder());
+    while(path.size() < 4000) {
+        path.append("/projekt/zdroje");
+    }
+    path.append("/s\xc3\xba" "bor.txt", wq::string::npos, wq::utf8_encoder());
+
+    const wq::size_t len = 100000;
+    wq::string line("2010-11-02 12:00:01 | ERROR | ");
+    wq::string words = make_text(len);
+    line.append(words);
+    g_sink += line.byte_offset(line.size() / 2);
+    g_sink += path.rfind("x", 0, false);  // builds case folding table
+    wq::string::value_type slash('/');
+
+    const unsigned long line_rounds = 100;
+    std::cout << "rfind (per search):" << std::endl;
+    {
+        bench_timer t("rfind('/') in path of 4000 characters", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += path.rfind(slash);
+        }
+    }
+    {
+        bench_timer t("rfind(\"/projekt\", middle of path)", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += path.rfind("/projekt", path.size() / 2);
+        }
+    }
+    {
+        bench_timer t("rfind(\" | \") in log line (at beginning)", line_rounds);
+        for(unsigned long r = 0; r != line_rounds; r++) {
+            g_sink += line.rfind(" | ");
+        }
+    }
+    {
+        bench_timer t("rfind(\"error\", false) in log line", line_rounds);
+        for(unsigned long r = 0; r != line_rounds; r++) {
+            g_sink += line.rfind("error", wq::string::npos, false);
+        }
+    }
+}
+
+// comparing of long texts which differ only at end
+static void bench_compare() {
+    const unsigned long rounds = 10000;
+    wq::string text = make_text(10000);
+    wq::string copy( (wq::string_ref(text)) );
+    wq::string other( (wq::string_ref(text)) );
+    other.append("x");
+    wq::string shared = text;
+    wq::string head = text.substr(0, 5000);
+    wq::string tail = text.substr(5000);
+
+    std::cout << "compare texts of 10000 characters (per operation):" << std::endl;
+    {
+        bench_timer t("text == copy", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text == copy;
+        }
+    }
+    {
+        bench_timer t("text == shared (copy of string object)", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text == shared;
+        }
+    }
+    {
+        bench_timer t("text != other (one character longer)", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text != other;
+        }
+    }
+    {
+        bench_timer t("text.compare(other)", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.compare(other) < 0;
+        }
+    }
+    {
+        bench_timer t("text.starts_with(head)", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.starts_with(head);
+        }
+    }
+    {
+        bench_timer t("text.ends_with(tail)", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.ends_with(tail);
+        }
+    }
+    {
+        bench_timer t("text.contains(tail)", rounds);
+        for(unsigned long r = 0; r != rounds; r++) {
+            g_sink += text.contains(tail);
+        }
+    }
+}
+
+// scanning of log lines for few hundred keywords
+static void bench_keywords() {
+    const unsigned long keywords_count = 300;
+    const unsigned long lines_count = 2000;
+    const char* roots[] = { "timeout", "refused", "overflow", "deadlock", "corrupt", "denied", "panic", "chyba" };
+    wq::string_list keywords;
+    for(unsigned long i = 0; i != keywords_count; i++) {
+        char buffer[64];
+        sprintf(buffer, "%s_%lu", roots[i % 8], i);
+        keywords.push_back( wq::utf8_encoder().encode(buffer) );
+    }
+    const char* lines[] = {
+        "2010-11-02 12:00:01 INFO  server started on port 8080, waiting for connections",
+        "2010-11-02 12:00:02 WARN  u\xc5\xbe\xc3\xadvate\xc4\xbe 'kaka\xc5\xa1' nem\xc3\xa1 nastaven\xc3\xbd jazyk",
+        "2010-11-02 12:00:03 ERROR connection refused_117 by peer after timeout_40 seconds"
+    };
+    wq::string line_strs[lines_count];
+    for(unsigned long i = 0; i != lines_count; i++) {
+        line_strs[i].assign(lines[i % 3], wq::string::npos, wq::utf8_encoder());
+    }
+
+    std::cout << "keywords (" << keywords_count << " keywords, per line):" << std::endl;
+    {
+        bench_timer t("string::find for every keyword", lines_count);
+        for(unsigned long i = 0; i != lines_count; i++) {
+            for(wq::string_list::const_iterator iter = keywords.begin(); iter != keywords.end(); ++iter) {
+                g_sink += line_strs[i].find(*iter) != wq::string::npos;
+            }
+        }
+    }
+    {
+        bench_timer t("multi_matcher construction (once)", 1);
+        wq::multi_matcher matcher(keywords);
+        g_sink += matcher.states();
+    }
+    wq::multi_matcher matcher(keywords);
+    wq::multi_matcher matcher_nocase(keywords, false);
+    {
+        bench_timer t("multi_matcher::find_all", lines_count);
+        wq::vector<wq::multi_matcher::match> found;
+        for(unsigned long i = 0; i != lines_count; i++) {
+            found.clear();
+            g_sink += matcher.find_all(line_strs[i], found);
+        }
+    }
+    {
+        bench_timer t("multi_matcher::contains", lines_count);
+        for(unsigned long i = 0; i != lines_count; i++) {
+            g_sink += matcher.contains(line_strs[i]);
+        }
+    }
+    {
+        bench_timer t("multi_matcher::find_all (case insensitive)", lines_count);
+        wq::vector<wq::multi_matcher::match> found;
+        for(unsigned long i = 0; i != lines_count; i++) {
+            found.clear();
+            g_sink += matcher_nocase.find_all(line_strs[i], found);
+        }
+    }
+}
+
+static void bench_regex() {
+    const unsigned long lines_count = 2000;
+    const char* lines[] = {
+        "2010-11-02 12:00:01 INFO  server started on port 8080, waiting for connections",
+        "2010-11-02 12:00:02 WARN  u\xc5\xbe\xc3\xadvate\xc4\xbe 'kaka\xc5\xa1' nem\xc3\xa1 nastaven\xc3\xbd jazyk",
+        "2010-11-02 12:00:03 ERROR connection refused by peer 10.0.0.17 after 40 seconds"
+    };
+    wq::string line_strs[lines_count];
+    for(unsigned long i = 0; i != lines_count; i++) {
+        line_strs[i].assign(lines[i % 3], wq::string::npos, wq::utf8_encoder());
+    }
+    const char* pattern = "(?:ERROR|WARN) +[a-z]+ .*\\d+\\.\\d+\\.\\d+\\.\\d+";
+    const char* words = "\\p{Ll}+\\p{Lu}";
+
+    // optional repetitions which match empty text fail like in ECMAScript,
+    // expected matches are the ones of RegExp.exec()
+    struct regex_case {
+        const char* m_pattern;
+        const char* m_text;
+        wq::size_t m_pos;
+        wq::size_t m_len;
+    };
+    const regex_case cases[] = {
+        { "(?:(B*)?\?){2,}", "BB", 0, 2 },
+        { "(A|[^a]?\?){0,}", "Ab", 0, 2 },
+        { "(?:|a)*", "aaa", 0, 3 },
+        { "(?:(?:)|a)*a", "aab", 0, 2 },
+        { "(?:|b{1,2}?)?", "bb", 0, 1 },
+        { "(?:[ab]*?)*", "aaaa", 0, 4 },
+        { "(?:|ab)*a", "abab", 0, 3 },
+        { "x(?:|a)+?", "xaa", 0, 1 }
+    };
+    for(unsigned long i = 0; i != sizeof(cases) / sizeof(cases[0]); i++) {
+        wq::size_t len = 0;
+        wq::size_t pos = wq::regex( wq::utf8_encoder().encode(cases[i].m_pattern) ).find(cases[i].m_text, 0, &len);
+        if(pos != cases[i].m_pos || len != cases[i].m_len) {
+            std::cout << "  unexpected match of " << cases[i].m_pattern << " in " << cases[i].m_text << std::endl;
+        }
+    }
+
+    std::cout << "regex (per line):" << std::endl;
+    {
+        bench_timer t("regex construction (once)", 1);
+        wq::regex re( wq::utf8_encoder().encode(pattern) );
+        g_sink += re.pattern().size();
+    }
+    wq::regex re( wq::utf8_encoder().encode(pattern) );
+    wq::regex re_words( wq::utf8_encoder().encode(words) );
+    {
+        bench_timer t("regex::find", lines_count);
+        for(unsigned long i = 0; i != lines_count; i++) {
+            g_sink += re.find(line_strs[i]) != wq::string::npos;
+        }
+    }
+    {
+        bench_timer t("regex::contains", lines_count);
+        for(unsigned long i = 0; i != lines_count; i++) {
+            g_sink += re.contains(line_strs[i]);
+        }
+    }
+    {
+        bench_timer t("regex::find (\\p{Ll}+\\p{Lu})", lines_count);
+        for(unsigned long i = 0; i != lines_count; i++) {
+            g_sink += re_words.find(line_strs[i]) != wq::string::npos;
+        }
+    }
+#if WQ_HAS_MOVE
+    // std::regex works with std::string, it does not know Unicode categories
+    std::string std_strs[lines_count];
+    for(unsigned long i = 0; i != lines_count; i++) {
+        std_strs[i].assign(line_strs[i].data(), line_strs[i].bytes());
+    }
+    std::regex std_re(pattern);
+    {
+        bench_timer t("std::regex_search", lines_count);
+        for(unsigned long i = 0; i != lines_count; i++) {
+            std::smatch m;
+            g_sink += std::regex_search(std_strs[i], m, std_re);
+        }
+    }
+#endif
+}
+
+// characters mapped by value_type::lower()/upper()/title(), characters
+// with special mappings (more characters) have to stay unchanged
+struct case_check {
+    wq::uint32 ch;
+    char mapping;
+    wq::uint32 expected;
+};
+
+static const case_check sm_case_checks[] = {
+    { 'a', 'u', 'A' },
+    { 'A', 'l', 'a' },
+    { 0xE9, 'u', 0xC9 },
+    { 0x1C6, 't', 0x1C5 },
+    { 0xDF, 'u', 0xDF },
+    { 0xDF, 't', 0xDF },
+    { 0x130, 'l', 0x130 },
+    { 0x149, 'u', 0x149 },
+    { 0xFB00, 'u', 0xFB00 },
+    { 0xFB00, 't', 0xFB00 },
+    { 0x1F80, 'u', 0x1F80 }
+};
+
+static void check_case() {
+    const int count = sizeof(sm_case_checks) / sizeof(sm_case_checks[0]);
+    for(int i = 0; i != count; i++) {
+        const case_check& c = sm_case_checks[i];
+        wq::string::value_type ch(c.ch);
+        wq::string::value_type mapped = c.mapping == 'l' ? ch.lower() : c.mapping == 'u' ? ch.upper() : ch.title();
+        if(mapped.utf32() != c.expected) {
+            std::printf("unexpected mapping '%c' of U+%04X: U+%04X\n", c.mapping, unsigned(c.ch), unsigned(mapped.utf32()));
+        }
+    }
+}
+
+static void bench_case() {
+    const unsigned long repeats = 200;
+    wq::string ascii, mixed;
+    for(int i = 0; i != 64; i++) {
+        ascii += "The Quick Brown Fox Jumps Over The Lazy Dog. ";
+        mixed.append("P\xc5\x98\xc3\x8dLI\xc5\xa0 \xc5\xbdlu\xc5\xa5ou\xc4\x8dk\xc3\xbd k\xc5\xaf\xc5\x88 \xc3\xbap\xc4\x9bl. ",
+                     wq::string::npos, wq::utf8_encoder());
+    }
+    check_case();
+
+    std::cout << "case (per string, " << ascii.bytes() << " and " << mixed.bytes() << " bytes):" << std::endl;
+    {
+        bench_timer t("value_type::lower() per character (ASCII)", 20);
+        for(unsigned long r = 0; r != 20; r++) {
+            wq::string lower = ascii;
+            for(wq::string::size_type i = 0; i != lower.size(); i++) {
+                lower[i] = lower[i].lower();
+            }
+            g_sink += lower.bytes();
+        }
+    }
+    {
+        bench_timer t("string::to_lower (ASCII)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += ascii.to_lower().bytes();
+        }
+    }
+    {
+        bench_timer t("string::to_upper (ASCII)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += ascii.to_upper().bytes();
+        }
+    }
+    {
+        bench_timer t("string::to_lower (Czech)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += mixed.to_lower().bytes();
+        }
+    }
+    {
+        bench_timer t("string::case_fold (Czech)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += mixed.case_fold().bytes();
+        }
+    }
+}
+
+static void bench_normalize() {
+    const unsigned long repeats = 200;
+    wq::string ascii, composed, decomposed;
+    for(int i = 0; i != 64; i++) {
+        ascii += "The Quick Brown Fox Jumps Over The Lazy Dog. ";
+        composed.append("P\xc5\x99\xc3\xadli\xc5\xa1 \xc5\xbelu\xc5\xa5ou\xc4\x8dk\xc3\xbd k\xc5\xaf\xc5\x88 \xc3\xbap\xc4\x9bl. ",
+                        wq::string::npos, wq::utf8_encoder());
+    }
+    decomposed = composed.normalized(wq::string::normalization_d);
+
+    std::cout << "normalize (per string, " << ascii.bytes() << ", " << composed.bytes() << " and "
+              << decomposed.bytes() << " bytes):" << std::endl;
+    {
+        bench_timer t("string::is_normalized NFC (ASCII)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += ascii.is_normalized(wq::string::normalization_c);
+        }
+    }
+    {
+        bench_timer t("string::is_normalized NFC (Czech NFC)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += composed.is_normalized(wq::string::normalization_c);
+        }
+    }
+    {
+        bench_timer t("string::is_normalized NFKC (Czech NFC)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += composed.is_normalized(wq::string::normalization_kc);
+        }
+    }
+    {
+        bench_timer t("string::normalized NFC (Czech NFC)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += composed.normalized(wq::string::normalization_c).bytes();
+        }
+    }
+    {
+        bench_timer t("string::normalized NFC (Czech NFD)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += decomposed.normalized(wq::string::normalization_c).bytes();
+        }
+    }
+    {
+        bench_timer t("string::normalized NFD (Czech NFC)", repeats);
+        for(unsigned long r = 0; r != repeats; r++) {
+            g_sink += composed.normalized(wq::string::normalization_d).bytes();
+        }
+    }
+}
+
+static void bench_breaks() {
+    const unsigned long repeats = 200;
+    wq::string ascii, czech;
+    for(int i = 0; i != 64; i++) {
+        ascii += "The quick brown fox can't jump over 3.14 lazy dogs. ";
+        czech.append("P\xc5\x99\xc3\xadli\xc5\xa1 \xc5\xbelu\xc5\xa5ou\xc4\x8dk\xc3\xbd k\xc5\xaf\xc5\x88 \xc3\xbap\xc4\x9bl. ",
+                     wq::string::npos, wq::utf8_encoder());
+    }
+    const wq::string* texts[] = { &ascii, &czech };
+    const char* names[] = { "ASCII", "Czech" };
+    const char* types[] = { "grapheme", "word", "sentence" };
+
+    std::cout << "breaks (per string, " << ascii.bytes() << " and " << czech.bytes() << " bytes):" << std::endl;
+    for(int t = 0; t != 3; t++) {
+        for(int i = 0; i != 2; i++) {
+            std::string label = std::string("break_iterator ") + types[t] + " (" + names[i] + ")";
+            bench_timer timer(label.c_str(), repeats);
+            for(unsigned long r = 0; r != repeats; r++) {
+                wq::break_iterator iter(*texts[i], wq::break_iterator::break_type(t));
+                wq::size_t segments = 0;
+                while(iter.next()) {
+                    segments += iter.is_word() ? 2 : 1;
+                }
+                g_sink += segments;
+            }
+        }
+    }
+}
+
+// table of all benchmarks
+struct bench_entry {
+    const char* name;
+    void (*func)();
+};
+
+static const bench_entry sm_benchmarks[] = {
+    { "local", bench_local_strings },
+    { "index", bench_index_access },
+    { "ascii", bench_ascii_text },
+    { "rope", bench_rope_edits },
+    { "ref", bench_string_ref },
+    { "tokenize", bench_tokenize },
+    { "move", bench_temporaries },
+    { "concat", bench_concat },
+    { "builder", bench_builder },
+    { "atom", bench_atoms },
+    { "hash", bench_hash },
+    { "scan", bench_scan },
+    { "advance", bench_advance },
+    { "encode", bench_encode },
+    { "reverse", bench_reverse },
+    { "find", bench_find },
+    { "nocase", bench_nocase },
+    { "charset", bench_charset },
+    { "rfind", bench_rfind },
+    { "compare", bench_compare },
+    { "keywords", bench_keywords },
+    { "regex", bench_regex },
+    { "case", bench_case },
+    { "normalize", bench_normalize },
+    { "breaks", bench_breaks }
+};
+
+/*!
+    This program measures speed and number of allocations of wq::string
+    operations. Without arguments all benchmarks are run, otherwise only
+    benchmarks with given names are run:
+    \code
+        string_bench local
+    \endcode
+*/
+int main(int argc, char* args[]) {
+    try {
+        const int count = sizeof(sm_benchmarks) / sizeof(sm_benchmarks[0]);
+        for(int i = 0; i != count; i++) {
+            bool run = argc == 1;
+            for(int a = 1; a < argc; a++) {
+                run = run || strcmp(args[a], sm_benchmarks[i].name) == 0;
+            }
+            if(run) {
+                sm_benchmarks[i].func();
+            }
+        }
+    }
+    catch(wq::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
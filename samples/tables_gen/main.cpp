@@ -17,6 +17,7 @@
 ****************************************************************************/
 
 #include "wq/wq.h"
+#include "wq/core/p/normalization.h"
 
 #include <iostream>
 #include <fstream>
@@ -24,6 +25,10 @@
 #include <string>
 #include <clocale>
 #include <algorithm>
+#include <map>
+#include <set>
+#include <cstdio>
+#include <cstdlib>
 #include <langinfo.h>
 
 namespace wq {
@@ -39,7 +44,7 @@ class locale_gen {
         wq::string create_tables();
 
     private:
-        void put_one_table(const wq::vector<wq::string_list>&, wq::string&, const wq::string& = "table_name");
+        void put_one_table(const wq::vector<wq::string_list>&, wq::string_builder&, const wq::string& = "table_name");
 
         // data for tables
         wq::vector<wq::string_list> m_days_names;
@@ -162,60 +167,66 @@ void locale_gen::add_locale(const wq::string& name) {
     }
 }
 
-void locale_gen::put_one_table(const wq::vector<wq::string_list>& table, wq::string& out_str, const wq::string& table_name) {
+void locale_gen::put_one_table(const wq::vector<wq::string_list>& table, wq::string_builder& out, const wq::string& table_name) {
     char buffer[5];
     sprintf(buffer, "%d", table.front().size());
-    out_str = out_str + "const char* locale::wq_data::" + table_name + "[][" + buffer + "] = {\n";
+    out += "const char* locale::wq_data::";
+    out += table_name;
+    out += "[][";
+    out += buffer;
+    out += "] = {\n";
     for(wq::vector<wq::string_list>::const_iterator i = table.begin(); i != table.end(); i++) {
-        out_str += "{";
+        out += "{";
         for(wq::string_list::const_iterator i2 = i->begin(); i2 != i->end(); i2++) {
-            out_str = out_str + "\"" + *i2 + "\"";
+            out += "\"";
+            out += *i2;
+            out += "\"";
             wq::string_list::const_iterator tmp = i2;
             if(++tmp != i->end()) {
-                out_str += ", ";
+                out += ", ";
             }
         }
-        out_str += "}";
+        out += "}";
         if(i + 1 != table.end()) {
-            out_str += ",\n";
+            out += ",\n";
         }
     }
-    out_str += "\n};";
+    out += "\n};";
 }
 
 wq::string locale_gen::create_tables() {
-    wq::string ret_str;
+    wq::string_builder out;
     char buffer[15];
-    ret_str = ret_str + "locale::wq_data::data locale::wq_data::locales[] = {\n";
+    out += "locale::wq_data::data locale::wq_data::locales[] = {\n";
     for(wq::vector<locale_indexes>::const_iterator iter = m_locale_indexes.begin(); iter != m_locale_indexes.end(); iter++) {
         sprintf(buffer, "{%d, ", iter->m_lang);
-        ret_str += buffer;
+        out += buffer;
         sprintf(buffer, "%d, ", iter->m_terr);
-        ret_str += buffer;
+        out += buffer;
         sprintf(buffer, "%d, ", iter->m_days);
-        ret_str += buffer;
+        out += buffer;
         sprintf(buffer, "%d, ", iter->m_ab_days);
-        ret_str += buffer;
+        out += buffer;
         sprintf(buffer, "%d, ", iter->m_months);
-        ret_str += buffer;
+        out += buffer;
         sprintf(buffer, "%d}", iter->m_ab_months);
-        ret_str += buffer;
+        out += buffer;
         if(iter + 1 != m_locale_indexes.end()) {
-            ret_str += ",";
+            out += ",";
         }
-        ret_str += "\n";
+        out += "\n";
     }
-    ret_str += "};\n\n";
+    out += "};\n\n";
 
-    put_one_table(m_days_names, ret_str, "days_names");
-    ret_str += "\n\n";
-    put_one_table(m_ab_days_names, ret_str, "ab_days_names");
-    ret_str += "\n\n";
-    put_one_table(m_months_names, ret_str, "months_names");
-    ret_str += "\n\n";
-    put_one_table(m_ab_months_names, ret_str, "ab_months_names");
+    put_one_table(m_days_names, out, "days_names");
+    out += "\n\n";
+    put_one_table(m_ab_days_names, out, "ab_days_names");
+    out += "\n\n";
+    put_one_table(m_months_names, out, "months_names");
+    out += "\n\n";
+    put_one_table(m_ab_months_names, out, "ab_months_names");
 
-    return ret_str;
+    return out.freeze();
 }
 
 // generator for "8bit to utf8" tables
@@ -264,6 +275,445 @@ wq::string utf8bit_gen::create_table() {
     return ret_str;
 }
 
+// generator for normalization tables (normalizationtables.cpp) from Unicode
+// Character Database, only characters which have properties in unicodetables.cpp
+// are used, so tables match them even if database is newer
+class normalization_gen {
+    public:
+        normalization_gen() { };
+
+        void add_data_line(const std::string&);
+        void add_exclusion_line(const std::string&);
+        wq::string create_tables();
+
+    private:
+        typedef wq::vector<wq::uint32> sequence;
+
+        static bool is_assigned(wq::uint32 c) {
+            wq::uint32 category = wq::string::value_type::get_uc_properties(c)->category;
+            return category != wq::string::value_type::no_category && category != wq::string::value_type::other_not_assigned;
+        };
+        static bool is_hangul(wq::uint32 c) {
+            return c >= 0xAC00 && c <= 0xD7A3;
+        };
+        bool is_excluded(wq::uint32) const;
+        void decompose(wq::uint32, bool, sequence&) const;
+        bool full_decomposition(wq::uint32, bool, sequence&) const;
+        wq::uint32 add_sequence(const sequence&);
+        void put_rows(const wq::vector<wq::uint32>&, wq::size_t, const char*, wq::string_builder&);
+        void put_blocks(const wq::vector<wq::uint32>&, const char*, const char*, const char*, wq::string_builder&);
+
+        // data from UnicodeData.txt and CompositionExclusions.txt
+        std::map<wq::uint32, sequence> m_mappings;
+        std::set<wq::uint32> m_compat_mappings;
+        std::map<wq::uint32, wq::uint32> m_classes;
+        std::set<wq::uint32> m_exclusions;
+
+        // decomposed sequences which are written to uc_decomposition_map
+        wq::vector<wq::uint32> m_map;
+        std::map<sequence, wq::uint32> m_map_offsets;
+};
+
+// parses line of UnicodeData.txt, only combining classes and decomposition
+// mappings are needed
+void normalization_gen::add_data_line(const std::string& line) {
+    wq::vector<std::string> fields;
+    std::istringstream line_stream(line);
+    std::string field;
+    while( getline(line_stream, field, ';') ) {
+        fields.push_back(field);
+    }
+    if(fields.size() < 6) {
+        return;
+    }
+    wq::uint32 c = strtoul(fields[0].c_str(), NULL, 16);
+    m_classes[c] = strtoul(fields[3].c_str(), NULL, 10);
+
+    std::istringstream mapping_stream(fields[5]);
+    std::string part;
+    sequence mapping;
+    while(mapping_stream >> part) {
+        if(part[0] == '<') {
+            m_compat_mappings.insert(c);
+            continue;
+        }
+        mapping.push_back( strtoul(part.c_str(), NULL, 16) );
+    }
+    if( !mapping.empty() ) {
+        m_mappings[c] = mapping;
+    }
+}
+
+// parses line of CompositionExclusions.txt
+void normalization_gen::add_exclusion_line(const std::string& line) {
+    std::string code = line.substr( 0, line.find('#') );
+    if(code.find_first_not_of(" \t\r") != std::string::npos) {
+        m_exclusions.insert( strtoul(code.c_str(), NULL, 16) );
+    }
+}
+
+// full composition exclusion - excluded characters, singletons and characters
+// which decompose to non-starters
+bool normalization_gen::is_excluded(wq::uint32 c) const {
+    std::map<wq::uint32, sequence>::const_iterator found = m_mappings.find(c);
+    if( found == m_mappings.end() || m_compat_mappings.count(c) ) {
+        return false;
+    }
+    std::map<wq::uint32, wq::uint32>::const_iterator first_class = m_classes.find(found->second[0]);
+    return m_exclusions.count(c) || found->second.size() == 1 || m_classes.find(c)->second != 0 ||
+           (first_class != m_classes.end() && first_class->second != 0);
+}
+
+// appends recursive decomposition of c (Hangul syllables are decomposed algorithmically)
+void normalization_gen::decompose(wq::uint32 c, bool compat, sequence& out) const {
+    if( is_hangul(c) ) {
+        wq::uint32 index = c - 0xAC00;
+        out.push_back(0x1100 + index / (21 * 28));
+        out.push_back(0x1161 + (index % (21 * 28)) / 28);
+        if(index % 28 != 0) {
+            out.push_back(0x11A7 + index % 28);
+        }
+        return;
+    }
+    std::map<wq::uint32, sequence>::const_iterator found = m_mappings.find(c);
+    if( found == m_mappings.end() || (!compat && m_compat_mappings.count(c)) ) {
+        out.push_back(c);
+        return;
+    }
+    for(sequence::const_iterator iter = found->second.begin(); iter != found->second.end(); iter++) {
+        decompose(*iter, compat, out);
+    }
+}
+
+// full decomposition in canonical order, returns false if character has not
+// decomposition or some of characters in it are not assigned
+bool normalization_gen::full_decomposition(wq::uint32 c, bool compat, sequence& out) const {
+    out.clear();
+    decompose(c, compat, out);
+    if(out.size() == 1 && out[0] == c) {
+        return false;
+    }
+    for(wq::size_t i = 0; i != out.size(); i++) {
+        if( !is_assigned(out[i]) ) {
+            return false;
+        }
+    }
+
+    // canonical ordering of combining marks (stable sorting by classes)
+    for(wq::size_t i = 1; i < out.size(); i++) {
+        for(wq::size_t k = i; k != 0; k--) {
+            wq::uint32 prev_class = m_classes.count(out[k - 1]) ? m_classes.find(out[k - 1])->second : 0;
+            wq::uint32 cur_class = m_classes.count(out[k]) ? m_classes.find(out[k])->second : 0;
+            if(cur_class == 0 || prev_class <= cur_class) {
+                break;
+            }
+            std::swap(out[k - 1], out[k]);
+        }
+    }
+    return true;
+}
+
+// returns offset of sequence in decomposition map, equal sequences are shared
+wq::uint32 normalization_gen::add_sequence(const sequence& seq) {
+    std::map<sequence, wq::uint32>::const_iterator found = m_map_offsets.find(seq);
+    if( found != m_map_offsets.end() ) {
+        return found->second;
+    }
+    wq::uint32 offset = m_map.size();
+    m_map_offsets[seq] = offset;
+    m_map.insert(m_map.end(), seq.begin(), seq.end());
+    return offset;
+}
+
+void normalization_gen::put_rows(const wq::vector<wq::uint32>& items, wq::size_t per_row, const char* format, wq::string_builder& out) {
+    char buffer[32];
+    for(wq::size_t i = 0; i != items.size(); i++) {
+        out += i % per_row == 0 ? "    " : " ";
+        sprintf(buffer, format, items[i]);
+        out += buffer;
+        if(i % per_row == per_row - 1 || i + 1 == items.size()) {
+            out += "\n";
+        }
+    }
+}
+
+// two level table - index of blocks of 256 values and blocks which are shared
+// by all parts of Unicode with the same values
+void normalization_gen::put_blocks(const wq::vector<wq::uint32>& values, const char* index_type, const char* index_name,
+                                   const char* blocks_type, wq::string_builder& out) {
+    wq::vector<wq::uint32> index;
+    wq::vector<wq::vector<wq::uint32> > blocks;
+    for(wq::uint32 first = 0; first != values.size(); first += 256) {
+        wq::vector<wq::uint32> block(values.begin() + first, values.begin() + first + 256);
+        wq::vector<wq::vector<wq::uint32> >::const_iterator found = std::find(blocks.begin(), blocks.end(), block);
+        index.push_back(found - blocks.begin());
+        if( found == blocks.end() ) {
+            blocks.push_back(block);
+        }
+    }
+
+    char buffer[100];
+    sprintf(buffer, "const wq::%s %s_index[] = {\n", index_type, index_name);
+    out += buffer;
+    put_rows(index, 16, "%d,", out);
+    out += "};\n\n";
+    sprintf(buffer, "const wq::%s %s_blocks[] = {\n", blocks_type, index_name);
+    out += buffer;
+    for(wq::size_t i = 0; i != blocks.size(); i++) {
+        sprintf(buffer, "    // block %d\n", int(i));
+        out += buffer;
+        put_rows(blocks[i], 16, "%d,", out);
+    }
+    out += "};\n";
+}
+
+wq::string normalization_gen::create_tables() {
+    // decompositions and primary composites of assigned characters
+    std::map<wq::uint32, sequence> canonical;
+    std::map<wq::uint32, sequence> compat;
+    std::map<std::pair<wq::uint32, wq::uint32>, wq::uint32> compositions;
+    std::set<wq::uint32> seconds;
+    for(wq::uint32 c = 0; c != 0x110000; c++) {
+        sequence seq;
+        if( !is_assigned(c) || is_hangul(c) ) {
+            continue;
+        }
+        if( full_decomposition(c, false, seq) ) {
+            canonical[c] = seq;
+        }
+        if( full_decomposition(c, true, seq) ) {
+            compat[c] = seq;
+        }
+        std::map<wq::uint32, sequence>::const_iterator found = m_mappings.find(c);
+        if(found != m_mappings.end() && found->second.size() == 2 && !m_compat_mappings.count(c) && !is_excluded(c) &&
+                is_assigned(found->second[0]) && is_assigned(found->second[1])) {
+            compositions[ std::make_pair(found->second[0], found->second[1]) ] = c;
+            seconds.insert(found->second[1]);
+        }
+    }
+    for(wq::uint32 c = 0x1161; c != 0x1176; c++) {
+        seconds.insert(c);
+    }
+    for(wq::uint32 c = 0x11A8; c != 0x11C3; c++) {
+        seconds.insert(c);
+    }
+
+    // quick check flags
+    wq::vector<wq::uint32> flags(0x110000, 0);
+    for(wq::uint32 c = 0; c != 0x110000; c++) {
+        if( !is_assigned(c) ) {
+            continue;
+        }
+        bool has_canonical = canonical.count(c) != 0;
+        bool has_compat = compat.count(c) != 0;
+        bool nfc_no = has_canonical && is_excluded(c);
+        bool nfkc_no = nfc_no || (has_compat && (!has_canonical || canonical[c] != compat[c]));
+        flags[c] |= (has_canonical || is_hangul(c)) ? wq::uc_nfd_no : 0;
+        flags[c] |= (has_compat || is_hangul(c)) ? wq::uc_nfkd_no : 0;
+        flags[c] |= nfc_no ? wq::uc_nfc_no : (seconds.count(c) ? wq::uc_nfc_maybe : 0);
+        flags[c] |= nfkc_no ? wq::uc_nfkc_no : (seconds.count(c) ? wq::uc_nfkc_maybe : 0);
+    }
+
+    // records of decompositions, 0 is record of characters without them
+    wq::vector<wq::uint32> numbers(0x110000, 0);
+    wq::vector<wq::uint32> records;
+    std::set<wq::uint32> decomposed;
+    for(std::map<wq::uint32, sequence>::const_iterator iter = canonical.begin(); iter != canonical.end(); iter++) {
+        decomposed.insert(iter->first);
+    }
+    for(std::map<wq::uint32, sequence>::const_iterator iter = compat.begin(); iter != compat.end(); iter++) {
+        decomposed.insert(iter->first);
+    }
+    for(std::set<wq::uint32>::const_iterator iter = decomposed.begin(); iter != decomposed.end(); iter++) {
+        const sequence& canonical_seq = canonical[*iter];
+        const sequence& compat_seq = compat.count(*iter) ? compat[*iter] : canonical_seq;
+        records.push_back( canonical_seq.empty() ? 0 : add_sequence(canonical_seq) );
+        records.push_back( add_sequence(compat_seq) );
+        records.push_back( canonical_seq.size() );
+        records.push_back( compat_seq.size() );
+        numbers[*iter] = records.size() / 4;
+    }
+
+    wq::string_builder out;
+    out.append(
+        "/****************************************************************************\n"
+        "**\n"
+        "** Copyright (C) 2010 Richard Kaka\xc5\xa1.\n"
+        "** All rights reserved.\n"
+        "** Contact: Richard Kaka\xc5\xa1 <richard.kakas@gmail.com>\n"
+        "**\n"
+        "** @LICENSE_START@\n"
+        "** GNU General Public License Usage\n"
+        "** This file may be used under the terms of the GNU\n"
+        "** General Public License version 3.0 as published by the Free Software\n"
+        "** Foundation and appearing in the file LICENSE included in the\n"
+        "** packaging of this file.  Please review the following information to\n"
+        "** ensure the GNU General Public License version 3.0 requirements will be\n"
+        "** met: http://www.gnu.org/copyleft/gpl.html.\n"
+        "** @LICENSE_END@\n"
+        "**\n"
+        "****************************************************************************/\n\n", wq::utf8_encoder());
+    out += "#include \"wq/core/p/normalization.h\"\n\n"
+           "namespace wq {\n"
+           "namespace core {\n\n"
+           "// Tables are generated by samples/tables_gen (option -n) from UnicodeData.txt and\n"
+           "// CompositionExclusions.txt for characters which have properties in unicodetables.cpp\n\n"
+           "// quick check flags of characters (see uc_quick_check_flags), blocks of 256\n"
+           "// characters are shared by all parts of Unicode with the same flags\n";
+    put_blocks(flags, "uint8", "uc_quick_check", "uint8", out);
+
+    out += "\n// decompositions of characters - blocks of 256 characters contain numbers of\n"
+           "// their decompositions in uc_decompositions (0 for characters without them)\n";
+    put_blocks(numbers, "uint8", "uc_decomposition", "uint16", out);
+
+    out += "\n// full canonical and compatibility decompositions, sequences are in uc_decomposition_map\n"
+           "const uc_decomposition uc_decompositions[] = {\n"
+           "    {0, 0, 0, 0},\n";
+    char buffer[100];
+    for(wq::size_t i = 0; i != records.size(); i += 4) {
+        sprintf(buffer, "%s{%d, %d, %d, %d},", i % 16 == 0 ? "    " : " ", records[i], records[i + 1], records[i + 2], records[i + 3]);
+        out += buffer;
+        out += (i % 16 == 12 || i + 4 == records.size()) ? "\n" : "";
+    }
+    out += "};\n\n"
+           "const wq::uint32 uc_decomposition_map[] = {\n";
+    put_rows(m_map, 8, "0x%x,", out);
+
+    out += "};\n\n"
+           "// primary composites sorted by their canonical decompositions\n"
+           "const uc_composition uc_compositions[] = {\n";
+    wq::size_t i = 0;
+    for(std::map<std::pair<wq::uint32, wq::uint32>, wq::uint32>::const_iterator iter = compositions.begin();
+            iter != compositions.end(); iter++, i++) {
+        sprintf(buffer, "%s{0x%x, 0x%x, 0x%x},", i % 4 == 0 ? "    " : " ", iter->first.first, iter->first.second, iter->second);
+        out += buffer;
+        out += (i % 4 == 3 || i + 1 == compositions.size()) ? "\n" : "";
+    }
+    out += "};\n"
+           "const string::size_type uc_compositions_count = sizeof(uc_compositions) / sizeof(uc_compositions[0]);\n\n"
+           "}  // namespace core\n"
+           "}  // namespace wq\n";
+    return out.freeze();
+}
+
+// generator for special case map (sm_special_case_map in unicodetables.cpp)
+// from SpecialCasing.txt, sequences are put at indexes which *_case_diff of
+// characters with *_case_special flag already have in properties table
+class special_case_gen {
+    public:
+        special_case_gen() { };
+
+        void add_line(const std::string&);
+        wq::string create_table();
+
+    private:
+        typedef wq::vector<wq::uint32> sequence;
+
+        // unconditional lower, title and upper mappings of character
+        struct case_mappings {
+            sequence mappings[3];
+        };
+
+        bool put_sequence(wq::uint32, const sequence&, int);
+
+        std::map<wq::uint32, case_mappings> m_mappings;
+
+        // map in UTF-16 and its positions which were already written
+        wq::vector<wq::uint32> m_map;
+        wq::vector<bool> m_written;
+};
+
+// parses line of SpecialCasing.txt, mappings with conditions (language or
+// context) are skipped
+void special_case_gen::add_line(const std::string& line) {
+    wq::vector<std::string> fields;
+    std::istringstream line_stream( line.substr( 0, line.find('#') ) );
+    std::string field;
+    while( getline(line_stream, field, ';') ) {
+        fields.push_back(field);
+    }
+    if(fields.size() < 4 || (fields.size() > 4 && fields[4].find_first_not_of(" \t\r") != std::string::npos)) {
+        return;
+    }
+    sequence* mappings = m_mappings[ strtoul(fields[0].c_str(), NULL, 16) ].mappings;
+    for(int i = 0; i != 3; i++) {
+        std::istringstream mapping_stream(fields[i + 1]);
+        std::string part;
+        while(mapping_stream >> part) {
+            mappings[i].push_back( strtoul(part.c_str(), NULL, 16) );
+        }
+    }
+}
+
+// writes zero terminated UTF-16 sequence at index, characters which share
+// index must have the same sequence
+bool special_case_gen::put_sequence(wq::uint32 c, const sequence& seq, int index) {
+    sequence utf16;
+    for(wq::size_t i = 0; i != seq.size(); i++) {
+        if(seq[i] >= 0x10000) {
+            utf16.push_back( 0xD800 + ((seq[i] - 0x10000) >> 10) );
+            utf16.push_back( 0xDC00 + ((seq[i] - 0x10000) & 0x3FF) );
+        }
+        else {
+            utf16.push_back(seq[i]);
+        }
+    }
+    utf16.push_back(0);
+
+    if(index + utf16.size() > m_map.size()) {
+        m_map.resize(index + utf16.size(), 0);
+        m_written.resize(index + utf16.size(), false);
+    }
+    for(wq::size_t i = 0; i != utf16.size(); i++) {
+        if(m_written[index + i] && m_map[index + i] != utf16[i]) {
+            std::cerr << "Special case mapping of U+" << std::hex << std::uppercase << c << " overlaps other mapping." << std::endl;
+            return false;
+        }
+        m_map[index + i] = utf16[i];
+        m_written[index + i] = true;
+    }
+    return true;
+}
+
+wq::string special_case_gen::create_table() {
+    for(wq::uint32 c = 0; c != 0x110000; c++) {
+        const wq::string::value_type::uc_properties* p = wq::string::value_type::get_uc_properties(c);
+        int special[3] = { p->lower_case_special, p->title_case_special, p->upper_case_special };
+        int diffs[3] = { p->lower_case_diff, p->title_case_diff, p->upper_case_diff };
+        for(int i = 0; i != 3; i++) {
+            if( !special[i] ) {
+                continue;
+            }
+            std::map<wq::uint32, case_mappings>::const_iterator found = m_mappings.find(c);
+            if( found == m_mappings.end() || found->second.mappings[i].empty() ) {
+                std::cerr << "Special case mapping of U+" << std::hex << std::uppercase << c << " is missing." << std::endl;
+                return wq::string();
+            }
+            if( !put_sequence(c, found->second.mappings[i], diffs[i]) ) {
+                return wq::string();
+            }
+        }
+    }
+    if(std::find(m_written.begin(), m_written.end(), false) != m_written.end()) {
+        std::cerr << "Special case map has unused positions." << std::endl;
+        return wq::string();
+    }
+
+    wq::string_builder out;
+    out += "// special case mappings - zero terminated UTF-16 sequences, *_case_diff of\n"
+           "// characters with *_case_special flag is index to this table, it is generated\n"
+           "// by samples/tables_gen (option -s) from SpecialCasing.txt\n"
+           "const unsigned short string::value_type::sm_special_case_map[] = {\n";
+    char buffer[32];
+    for(wq::size_t i = 0; i != m_map.size(); i++) {
+        sprintf(buffer, "%s0x%x,", i % 8 == 0 ? "    " : " ", m_map[i]);
+        out += buffer;
+        out += (i % 8 == 7 || i + 1 == m_map.size()) ? "\n" : "";
+    }
+    out += "};";
+    return out.freeze();
+}
+
 /*!
     This program takes file (argument for program) in format like this:
     \code
@@ -275,6 +725,18 @@ wq::string utf8bit_gen::create_table() {
     \endcode
     Program's output is sent to standard output. The output is C/C++ like array
     which can be useful for programming *_encoder classes.
+
+    With option -n program takes UnicodeData.txt and CompositionExclusions.txt
+    files of Unicode Character Database and writes whole normalizationtables.cpp:
+    \code
+        tables_gen -n UnicodeData.txt CompositionExclusions.txt > normalizationtables.cpp
+    \endcode
+
+    With option -s program takes SpecialCasing.txt and writes special case map
+    (sm_special_case_map) of unicodetables.cpp:
+    \code
+        tables_gen -s SpecialCasing.txt
+    \endcode
 */
 int main(int argc, char* args[]) {
     if(argc == 1) {
@@ -302,6 +764,46 @@ int main(int argc, char* args[]) {
         }
         std::cout << generator.create_table().locale_str() << std::endl;
     }
+    if(wq::string(args[1]) == "-n") {
+        if(argc < 4) {
+            std::cout << "UnicodeData.txt and CompositionExclusions.txt files must be specified." << std::endl;
+            return 1;
+        }
+        std::ifstream data_file(args[2]);
+        std::ifstream exclusions_file(args[3]);
+        if( !data_file.is_open() || !exclusions_file.is_open() ) {
+            std::cout << "Unicode data file does not exist." << std::endl;
+            return 1;
+        }
+
+        normalization_gen generator;
+        std::string line_str;
+        while( getline(data_file, line_str) ) {
+            generator.add_data_line(line_str);
+        }
+        while( getline(exclusions_file, line_str) ) {
+            generator.add_exclusion_line(line_str);
+        }
+        std::cout << generator.create_tables().utf8_str();
+    }
+    if(wq::string(args[1]) == "-s") {
+        std::ifstream special_file(args[2]);
+        if( !special_file.is_open() ) {
+            std::cout << "Special casing file does not exist." << std::endl;
+            return 1;
+        }
+
+        special_case_gen generator;
+        std::string line_str;
+        while( getline(special_file, line_str) ) {
+            generator.add_line(line_str);
+        }
+        wq::string table = generator.create_table();
+        if( table.empty() ) {
+            return 1;
+        }
+        std::cout << table.utf8_str() << std::endl;
+    }
     if(wq::string(args[1]) == "-l") {
         locale_gen generator;
         generator.add_locale( wq::string() );
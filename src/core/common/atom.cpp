@@ -0,0 +1,217 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/atom.h"
+#include "wq/core/hash.h"
+
+#include <cstring>
+
+namespace wq {
+namespace core {
+
+// one interned string, it is never deleted
+struct atom::data {
+    string m_str;
+    size_type m_hash;
+};
+
+// hash table of interned strings, readers never lock it - buckets are
+// published by atomic operations and nodes are never changed or deleted
+// after publishing, replaced tables are kept for readers which still use them
+struct atom::node {
+    const data* m_data;
+    node* m_next;
+};
+
+struct atom::table {
+    size_type m_mask;
+    size_type m_count;
+    atomic<node*>* m_buckets;
+    table* m_prev;
+};
+
+/*!
+    \class atom
+    \brief Interned string.
+
+    All atoms created from equal texts refer to the same string which is
+    stored in process-wide table, so atoms are compared by comparing
+    pointers and their hash is computed only once. This makes atom useful
+    for identifiers (names of locales, keys, ...) which are compared or
+    used as keys many times.
+
+    Creating of atom looks up the table without any lock, so atoms can be
+    created from many threads at once. Only threads which add new text to
+    the table are serialized. Interned strings are never deleted.
+
+    Default constructed atom refers to empty string.
+
+    \sa string
+*/
+
+/*!
+    \brief Constructs atom for text of \a str.
+*/
+atom::atom(const string& str) : m_data( intern( string_ref(str) ) ) {
+
+}
+
+/*!
+    \brief Constructs atom for text referred by \a str.
+*/
+atom::atom(const string_ref& str) : m_data( intern(str) ) {
+
+}
+
+/*!
+    \brief Constructs atom for \a str.
+
+    \a str has to be valid UTF-8 sequence ended by \b 0, it is not
+    converted by any encoder.
+*/
+atom::atom(const char* str) : m_data( intern( string_ref(str) ) ) {
+
+}
+
+/*!
+    \brief Returns interned string.
+
+    Returned string shares its data with all copies of it.
+*/
+const string& atom::str() const {
+    static const string* empty_str = new string();
+    return m_data == NULL ? *empty_str : m_data->m_str;
+}
+
+/*!
+    \brief Returns hash of interned text.
+
+    Hash is computed only once when text is added to the table, it is
+    equal to hash of interned string.
+*/
+atom::size_type atom::hash() const {
+    return m_data == NULL ? hash_bytes("", 0) : m_data->m_hash;
+}
+
+/*!
+    \brief Returns number of strings in process-wide table.
+*/
+atom::size_type atom::count() {
+    // writers change number of strings under lock
+    lock();
+    size_type ret_val = current_table().val()->m_count;
+    unlock();
+    return ret_val;
+}
+
+// private functions
+// creates empty table with given number of buckets (power of 2)
+atom::table* atom::new_table(size_type buckets) {
+    table* tab = new table;
+    tab->m_mask = buckets - 1;
+    tab->m_count = 0;
+    tab->m_buckets = new atomic<node*>[buckets];
+    tab->m_prev = NULL;
+    return tab;
+}
+
+// table and lock for writers live until end of process, so atoms
+// can be used in destructors of static objects too
+atomic<atom::table*>& atom::current_table() {
+    static atomic<table*>* tab = new atomic<table*>( new_table(1024) );
+    return *tab;
+}
+atomic<int>& atom::write_lock() {
+    static atomic<int>* lock = new atomic<int>(0);
+    return *lock;
+}
+
+// writers are serialized by spin lock, they hold it only for short time
+void atom::lock() {
+    while(write_lock().cmp_set(0, 1) != 0) {
+        while(write_lock().val() != 0) {
+            spin_pause();
+        }
+    }
+}
+void atom::unlock() {
+    write_lock().release(0);
+}
+
+// returns interned data for str, they are added to table if needed
+const atom::data* atom::intern(const string_ref& str) {
+    if(str.empty()) {
+        return NULL;
+    }
+    size_type hash = hash_bytes(str.data(), str.bytes());
+    const data* found = lookup(str, hash);
+    if(found != NULL) {
+        return found;
+    }
+
+    // other writer could add the same text while we were waiting for lock
+    lock();
+    found = lookup(str, hash);
+    if(found == NULL) {
+        data* new_data = new data;
+        new_data->m_str = string(str);
+        new_data->m_hash = hash;
+
+        table* tab = current_table().val();
+        node* new_node = new node;
+        new_node->m_data = new_data;
+        new_node->m_next = tab->m_buckets[hash & tab->m_mask].val();
+        tab->m_buckets[hash & tab->m_mask].set(new_node);
+        tab->m_count++;
+
+        // too many strings, new table is filled with new nodes and published
+        if(tab->m_count > tab->m_mask) {
+            table* bigger = new_table( (tab->m_mask + 1) * 2 );
+            for(size_type i = 0; i <= tab->m_mask; i++) {
+                for(const node* n = tab->m_buckets[i].val(); n != NULL; n = n->m_next) {
+                    node* moved = new node;
+                    moved->m_data = n->m_data;
+                    moved->m_next = bigger->m_buckets[n->m_data->m_hash & bigger->m_mask].val();
+                    bigger->m_buckets[n->m_data->m_hash & bigger->m_mask].set(moved);
+                }
+            }
+            bigger->m_count = tab->m_count;
+            bigger->m_prev = tab;
+            current_table().set(bigger);
+        }
+        found = new_data;
+    }
+    unlock();
+    return found;
+}
+
+// finds str in current table without locking
+const atom::data* atom::lookup(const string_ref& str, size_type hash) {
+    const table* tab = current_table().val();
+    for(const node* n = tab->m_buckets[hash & tab->m_mask].val(); n != NULL; n = n->m_next) {
+        const data* d = n->m_data;
+        if(d->m_hash == hash && d->m_str.bytes() == str.bytes() &&
+                memcmp(d->m_str.data(), str.data(), str.bytes()) == 0) {
+            return d;
+        }
+    }
+    return NULL;
+}
+
+}  // namespace core
+}  // namespace wq
@@ -0,0 +1,38 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/atomic.h"
+
+namespace wq {
+namespace core {
+
+#if WQ_ATOMIC_STATS
+/*!
+    \class atomic_stats
+    \brief Statistics of atomic operations.
+
+    This class exists only when library is built with WQ_ATOMIC_STATS
+    option. Member sm_locked_ops is incremented by every atomic operation
+    which executes locked instruction, so benchmarks can check how many
+    of them were needed. Counter itself is not thread-safe.
+*/
+wq::uint64 atomic_stats::sm_locked_ops = 0;
+#endif
+
+}  // namespace core
+}  // namespace wq
@@ -0,0 +1,345 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/break_iterator.h"
+
+namespace wq {
+namespace core {
+
+/*!
+    \class break_iterator
+    \brief Finds boundaries of grapheme clusters, words or sentences.
+
+    Boundaries are found by rules of Unicode Standard Annex #29 and
+    \c grapheme_break, \c word_break and \c sentence_break properties
+    of characters (see string::value_type::get_uc_properties()). Text
+    is not copied and nothing is allocated, every call of next() finds
+    only the following boundary:
+    \code
+        wq::break_iterator words(text, wq::break_iterator::word);
+        while(words.next()) {
+            if(words.is_word()) {
+                index(words.segment(), words.position());
+            }
+        }
+    \endcode
+
+    Rules are compiled to small tables of automata, one row of states for
+    every class of characters. Segment is the longest text accepted by
+    automaton, so rules which look ahead (like letters around apostrophe
+    in words) need no special code. Format characters and combining marks
+    do not change state of word and sentence automata, so they always stay
+    with characters before them.
+
+    In grapheme iterator ASCII character followed by other ASCII character
+    (except CR LF) is whole segment without any lookup.
+
+    Iterator refers to text, so it must not be changed or destroyed while
+    iterator is used.
+*/
+
+/*!
+    \enum break_iterator::break_type
+    \brief Kinds of segments.
+
+    \var break_iterator::grapheme
+    User-perceived characters - character with following combining marks,
+    Hangul syllable made of jamo or CR LF.
+
+    \var break_iterator::word
+    Words, numbers and all characters between them (like spaces and
+    punctuation), see is_word().
+
+    \var break_iterator::sentence
+    Sentences with following spaces and paragraph separator.
+*/
+
+// classes of characters - values of grapheme_break property
+enum grapheme_class {
+    gc_other, gc_cr, gc_lf, gc_control, gc_extend, gc_l, gc_v, gc_t, gc_lv, gc_lvt, gc_count
+};
+
+// values of word_break property, other characters are classified by their grapheme_break
+enum word_class {
+    wc_other, wc_format, wc_katakana, wc_letter, wc_mid_letter, wc_mid_num, wc_numeric, wc_extend_num,
+    wc_cr, wc_lf, wc_control, wc_count
+};
+
+// values of sentence_break property, CR and LF are separated from other separators
+// and combining marks are format characters
+enum sentence_class {
+    sc_other, sc_sep, sc_format, sc_sp, sc_lower, sc_upper, sc_o_letter, sc_numeric, sc_a_term, sc_s_term,
+    sc_close, sc_cr, sc_lf, sc_count
+};
+
+// classes of ASCII characters for every break_type
+static const wq::uint8 sm_ascii_classes[][128] = {
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3
+    },
+    {
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 10, 10, 8, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 5, 0, 5, 0,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 5, 0, 0, 0, 0,
+        0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 7,
+        0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 10
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 12, 3, 3, 11, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 9, 10, 0, 0, 0, 0, 10, 10, 10, 0, 0, 0, 0, 8, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 9,
+        0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 0, 10, 0, 0,
+        0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 0, 10, 0, 0
+    }
+};
+
+// word classes of characters without word_break property by their grapheme_break
+static const wq::uint8 sm_word_grapheme_classes[] = {
+    wc_other, wc_cr, wc_lf, wc_control, wc_format, wc_other, wc_other, wc_other, wc_other, wc_other
+};
+
+// automata - state 0 is start and transitions to 0 mean end of segment
+// grapheme clusters, state is class of the last character (rules GB3 - GB10)
+enum grapheme_state {
+    gs_start, gs_other, gs_cr, gs_lf, gs_control, gs_extend, gs_l, gs_v, gs_t, gs_lv, gs_lvt
+};
+
+static const wq::uint8 sm_grapheme_table[][gc_count] = {
+    // other     cr     lf     control     extend     l     v     t     lv     lvt
+    { gs_other, gs_cr, gs_lf, gs_control, gs_extend, gs_l, gs_v, gs_t, gs_lv, gs_lvt },  // start
+    { 0, 0, 0, 0, gs_extend, 0, 0, 0, 0, 0 },                                             // other
+    { 0, 0, gs_lf, 0, 0, 0, 0, 0, 0, 0 },                                                 // cr
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },                                                     // lf
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },                                                     // control
+    { 0, 0, 0, 0, gs_extend, 0, 0, 0, 0, 0 },                                             // extend
+    { 0, 0, 0, 0, gs_extend, gs_l, gs_v, 0, gs_lv, gs_lvt },                              // l
+    { 0, 0, 0, 0, gs_extend, 0, gs_v, gs_t, 0, 0 },                                       // v
+    { 0, 0, 0, 0, gs_extend, 0, 0, gs_t, 0, 0 },                                          // t
+    { 0, 0, 0, 0, gs_extend, 0, gs_v, gs_t, 0, 0 },                                       // lv
+    { 0, 0, 0, 0, gs_extend, 0, 0, gs_t, 0, 0 }                                           // lvt
+};
+
+// words, letters and numbers joined by middle punctuation have states which
+// are not accepting - segment ends before punctuation if no letter or number follows
+enum word_state {
+    ws_start, ws_other, ws_cr, ws_newline, ws_letter, ws_letter_mid, ws_numeric, ws_numeric_mid,
+    ws_katakana, ws_extend_num
+};
+
+static const wq::uint8 sm_word_table[][wc_count] = {
+    // other     format      katakana     letter     mid_letter      mid_num         numeric
+    // extend_num     cr     lf          control
+    { ws_other, ws_other, ws_katakana, ws_letter, ws_other, ws_other, ws_numeric,
+      ws_extend_num, ws_cr, ws_newline, ws_newline },                                     // start
+    { 0, ws_other, 0, 0, 0, 0, 0, 0, 0, 0, 0 },                                           // other
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, ws_newline, 0 },                                         // cr
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },                                                  // newline
+    { 0, ws_letter, 0, ws_letter, ws_letter_mid, 0, ws_numeric,
+      ws_extend_num, 0, 0, 0 },                                                           // letter
+    { 0, ws_letter_mid, 0, ws_letter, 0, 0, 0, 0, 0, 0, 0 },                              // letter_mid
+    { 0, ws_numeric, 0, ws_letter, 0, ws_numeric_mid, ws_numeric,
+      ws_extend_num, 0, 0, 0 },                                                           // numeric
+    { 0, ws_numeric_mid, 0, 0, 0, 0, ws_numeric, 0, 0, 0, 0 },                            // numeric_mid
+    { 0, ws_katakana, ws_katakana, 0, 0, 0, 0, ws_extend_num, 0, 0, 0 },                  // katakana
+    { 0, ws_extend_num, ws_katakana, ws_letter, 0, 0, ws_numeric,
+      ws_extend_num, 0, 0, 0 }                                                            // extend_num
+};
+
+// sentences, text after full stop is looked ahead to lower case letter (rule SB8)
+// in not accepting state
+enum sentence_state {
+    ss_start, ss_text, ss_upper, ss_sep, ss_cr, ss_a_term, ss_upper_a_term, ss_a_term_close,
+    ss_a_term_sp, ss_a_term_look, ss_s_term, ss_s_term_close, ss_s_term_sp
+};
+
+static const wq::uint8 sm_sentence_table[][sc_count] = {
+    // other     sep      format       sp       lower     upper      o_letter    numeric
+    // a_term      s_term      close      cr      lf
+    { ss_text, ss_sep, ss_text, ss_text, ss_text, ss_upper, ss_text, ss_text,
+      ss_a_term, ss_s_term, ss_text, ss_cr, ss_sep },                                     // start
+    { ss_text, ss_sep, ss_text, ss_text, ss_text, ss_upper, ss_text, ss_text,
+      ss_a_term, ss_s_term, ss_text, ss_cr, ss_sep },                                     // text
+    { ss_text, ss_sep, ss_upper, ss_text, ss_text, ss_upper, ss_text, ss_text,
+      ss_upper_a_term, ss_s_term, ss_text, ss_cr, ss_sep },                               // upper
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },                                            // sep
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ss_sep },                                       // cr
+    { ss_a_term_look, ss_sep, ss_a_term, ss_a_term_sp, ss_text, 0, 0, ss_text,
+      ss_a_term, ss_s_term, ss_a_term_close, ss_cr, ss_sep },                             // a_term
+    { ss_a_term_look, ss_sep, ss_upper_a_term, ss_a_term_sp, ss_text, ss_upper, 0, ss_text,
+      ss_a_term, ss_s_term, ss_a_term_close, ss_cr, ss_sep },                             // upper_a_term
+    { ss_a_term_look, ss_sep, ss_a_term_close, ss_a_term_sp, ss_text, 0, 0, ss_a_term_look,
+      ss_a_term, ss_s_term, ss_a_term_close, ss_cr, ss_sep },                             // a_term_close
+    { ss_a_term_look, ss_sep, ss_a_term_sp, ss_a_term_sp, ss_text, 0, 0, ss_a_term_look,
+      ss_a_term, ss_s_term, ss_a_term_look, ss_cr, ss_sep },                              // a_term_sp
+    { ss_a_term_look, 0, ss_a_term_look, ss_a_term_look, ss_text, 0, 0, ss_a_term_look,
+      0, 0, ss_a_term_look, 0, 0 },                                                       // a_term_look
+    { 0, ss_sep, ss_s_term, ss_s_term_sp, 0, 0, 0, 0,
+      ss_a_term, ss_s_term, ss_s_term_close, ss_cr, ss_sep },                             // s_term
+    { 0, ss_sep, ss_s_term_close, ss_s_term_sp, 0, 0, 0, 0,
+      ss_a_term, ss_s_term, ss_s_term_close, ss_cr, ss_sep },                             // s_term_close
+    { 0, ss_sep, ss_s_term_sp, ss_s_term_sp, 0, 0, 0, 0,
+      ss_a_term, ss_s_term, 0, ss_cr, ss_sep }                                            // s_term_sp
+};
+
+// automaton of break_type, accepting states and states which end words are bit masks
+struct break_rules {
+    const wq::uint8* m_table;
+    wq::uint32 m_classes;
+    wq::uint32 m_accepting;
+    wq::uint32 m_words;
+};
+
+static const break_rules sm_rules[] = {
+    { sm_grapheme_table[0], gc_count, 0xFFFFFFFFu, 0 },
+    { sm_word_table[0], wc_count, ~((1u << ws_letter_mid) | (1u << ws_numeric_mid)),
+      (1u << ws_letter) | (1u << ws_numeric) | (1u << ws_katakana) | (1u << ws_extend_num) },
+    { sm_sentence_table[0], sc_count, ~(1u << ss_a_term_look), 0 }
+};
+
+// returns class of character for automaton of type
+static inline wq::uint32 classify(wq::uint32 c, break_iterator::break_type type) {
+    if(c < 0x80) {
+        return sm_ascii_classes[type][c];
+    }
+    const string::value_type::uc_properties* p = string::value_type::get_uc_properties(c);
+    if(type == break_iterator::grapheme) {
+        return p->grapheme_break;
+    }
+    if(type == break_iterator::word) {
+        return p->word_break != wc_other ? p->word_break : sm_word_grapheme_classes[p->grapheme_break];
+    }
+    return (p->sentence_break == sc_other && p->grapheme_break == gc_extend) ?
+        sc_format : sentence_class(p->sentence_break);
+}
+
+/*!
+    \brief Constructs iterator over \a text, which is at its beginning.
+
+    Segments are kinds of \a type.
+*/
+break_iterator::break_iterator(const string_ref& text, break_type type) :
+    m_first(text.data()), m_last(text.data() + text.bytes()), m_ptr(m_first), m_prev(m_first),
+    m_pos(0), m_type(type), m_word(false) {
+
+}
+
+/*!
+    \fn break_iterator::type() const
+    \brief Returns kind of segments.
+*/
+
+/*!
+    \fn break_iterator::position() const
+    \brief Returns index of character at current boundary.
+*/
+
+/*!
+    \fn break_iterator::byte_position() const
+    \brief Returns offset of byte at current boundary.
+*/
+
+/*!
+    \fn break_iterator::at_end() const
+    \brief Returns \b true if current boundary is end of text.
+*/
+
+/*!
+    \fn break_iterator::segment() const
+    \brief Returns text between previous and current boundary.
+*/
+
+/*!
+    \fn break_iterator::is_word() const
+    \brief Returns \b true if segment() is word.
+
+    Words are segments of word iterator which contain letters, numbers,
+    katakana or connector punctuation (like underscore). Spaces, other
+    punctuation and symbols are segments which are not words. Segments
+    of other kinds are never words.
+*/
+
+/*!
+    \fn break_iterator::next()
+    \brief Moves to the next boundary.
+
+    \return \b false if iterator was at end of text.
+*/
+
+// private functions
+// finds the next boundary by automaton of m_type
+bool break_iterator::next_segment() {
+    const char* ptr = m_ptr;
+    const char* last = m_last;
+    if(ptr == last) {
+        return false;
+    }
+    m_prev = ptr;
+
+    // the first character is always accepted, segment is ended by the last accepting state
+    const break_rules& rules = sm_rules[m_type];
+    wq::uint32 state = 0;
+    wq::uint32 accepted_state = 0;
+    const char* accepted = ptr;
+    size_type chars = 0;
+    size_type accepted_chars = 0;
+    while(ptr != last) {
+        string::cp_iterator iter(ptr, last);
+        wq::uint32 next_state = rules.m_table[state * rules.m_classes + classify(iter.utf32(), m_type)];
+        if(next_state == 0) {
+            break;
+        }
+        state = next_state;
+        ptr += iter.bytes();
+        chars++;
+        if((rules.m_accepting >> state) & 1) {
+            accepted = ptr;
+            accepted_chars = chars;
+            accepted_state = state;
+        }
+    }
+    m_ptr = accepted;
+    m_pos += accepted_chars;
+    m_word = ((rules.m_words >> accepted_state) & 1) != 0;
+    return true;
+}
+
+/*!
+    \brief Moves iterator back to beginning of text.
+*/
+void break_iterator::reset() {
+    m_ptr = m_first;
+    m_prev = m_first;
+    m_pos = 0;
+    m_word = false;
+}
+
+}  // namespace core
+}  // namespace wq
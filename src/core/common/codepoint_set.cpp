@@ -0,0 +1,184 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/codepoint_set.h"
+#include "wq/core/p/utf8.h"
+
+#include <cstring>
+
+namespace wq {
+namespace core {
+
+/*!
+    \class codepoint_set
+    \brief Set of unicode characters.
+
+    Membership of characters below 256 (ASCII and Latin-1) is one bit test
+    in bitmap, other characters are stored in sorted ranges which are
+    searched by binary search. Set is meant to be built once and used
+    for many searches:
+    \code
+        wq::codepoint_set delims(" ,;\t");
+        wq::size_t pos = text.find_first_not_of(delims);
+        while(pos != wq::string::npos) {
+            wq::size_t end = text.find_first_of(delims, pos);
+            ...
+            pos = text.find_first_not_of(delims, end);
+        }
+    \endcode
+
+    Searching in sets which have only ASCII characters is fastest, because
+    bytes of text are tested directly.
+
+    \sa string::find_first_of()
+*/
+
+/*!
+    \brief Constructs empty set.
+*/
+codepoint_set::codepoint_set() {
+    clear();
+}
+
+/*!
+    \brief Constructs set of all characters of \a str.
+
+    If \a cs is \b false set contains also all characters which differ
+    from characters of \a str only in case.
+*/
+codepoint_set::codepoint_set(const string_ref& str, bool cs) {
+    clear();
+    insert(str, cs);
+}
+
+/*!
+    \fn codepoint_set::contains(wq::uint32 c) const
+    \brief Returns \b true if character \a c is in set.
+*/
+
+/*!
+    \fn codepoint_set::is_ascii() const
+    \brief Returns \b true if all characters of set are ASCII.
+*/
+
+/*!
+    \brief Inserts character \a c to set.
+*/
+void codepoint_set::insert(wq::uint32 c) {
+    insert(c, c);
+}
+
+/*!
+    \brief Inserts all characters from \a first to \a last (inclusive) to set.
+
+    Ranges above Latin-1 are merged with overlapping and adjacent ones,
+    so ranges of set stay sorted and disjoint.
+*/
+void codepoint_set::insert(wq::uint32 first, wq::uint32 last) {
+    for( ; first <= last && first < 256; first++) {
+        m_latin1[first >> 5] |= wq::uint32(1) << (first & 31);
+        if(first < 128) {
+            m_nibbles[first & 15] |= char(1 << (first >> 4));
+        }
+    }
+    if(first > last) {
+        return;
+    }
+
+    // first range which does not end before first (first is at least 256)
+    size_type low = 0;
+    size_type high = m_ranges.size();
+    while(low != high) {
+        size_type middle = (low + high) / 2;
+        if(m_ranges[middle].m_last < first - 1) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    range new_range = { first, last };
+    vector<range>::iterator iter = m_ranges.begin() + low;
+    while(iter != m_ranges.end() && iter->m_first - 1 <= last) {
+        new_range.m_first = iter->m_first < new_range.m_first ? iter->m_first : new_range.m_first;
+        new_range.m_last = iter->m_last > new_range.m_last ? iter->m_last : new_range.m_last;
+        iter = m_ranges.erase(iter);
+    }
+    m_ranges.insert(iter, new_range);
+}
+
+/*!
+    \brief Inserts all characters of \a str to set.
+
+    If \a cs is \b false also all characters with the same case folding
+    are inserted (e.g. 'k', 'K' and Kelvin sign for 'k').
+*/
+void codepoint_set::insert(const string_ref& str, bool cs) {
+    if(cs && str.is_ascii()) {
+        // bytes are characters
+        for(const char* ptr = str.data(); ptr != str.data() + str.bytes(); ptr++) {
+            wq::uint32 c = wq::uint8(*ptr);
+            m_latin1[c >> 5] |= wq::uint32(1) << (c & 31);
+            m_nibbles[c & 15] |= char(1 << (c >> 4));
+        }
+        return;
+    }
+    for(string::cp_iterator iter(str.data(), str.data() + str.bytes()); !iter.at_end(); ++iter) {
+        wq::uint32 c = iter.utf32();
+        insert(c);
+        if(!cs) {
+            wq::uint32 variants[8];
+            size_type n = utf8_case_variants(c, variants, 8);
+            for(size_type i = 0; i != n; i++) {
+                insert(variants[i]);
+            }
+        }
+    }
+}
+
+/*!
+    \brief Removes all characters from set.
+*/
+void codepoint_set::clear() {
+    memset(m_latin1, 0, sizeof(m_latin1));
+    memset(m_nibbles, 0, sizeof(m_nibbles));
+    m_ranges.clear();
+}
+
+// binary search of character above Latin-1
+bool codepoint_set::contains_range(wq::uint32 c) const {
+    size_type low = 0;
+    size_type high = m_ranges.size();
+    while(low != high) {
+        size_type middle = (low + high) / 2;
+        if(m_ranges[middle].m_last < c) {
+            low = middle + 1;
+        }
+        else if(m_ranges[middle].m_first > c) {
+            high = middle;
+        }
+        else {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace core
+}  // namespace wq
@@ -19,6 +19,7 @@
 #include "wq/core/string.h"
 #include "wq/core/encoder.h"
 #include "wq/core/locale.h"
+#include "wq/core/p/utf8.h"
 
 #include <cstring>
 
@@ -90,33 +91,44 @@ const text_encoder& text_encoder::default_encoder(bool thexce) {
 }
 
 // utf8_encoder class
+/*!
+    \brief Encodes UTF-8 text.
+
+    Whole text is validated in one pass (see utf8_validate()) and valid text
+    is then copied to string at once. Invalid sequences are reported by
+    encode_error or replaced by string::value_type::repl_char() (one for
+    every maximal invalid part of sequence) if encoder is not throwing.
+*/
 string utf8_encoder::encode(const char* str, wq::size_t size) const {
     if(size == -1) {
         size = strlen(str);
     }
+    const char* last = str + size;
+    string::size_type len = 0;
+    const char* valid_last = utf8_validate(str, last, len);
+
     string ret_val;
-    ret_val.reserve(size);
+    if(valid_last == last) {
+        memcpy(ret_val.assign_raw(size, len), str, size);
+        return ret_val;
+    }
+    if(is_throwing()) {
+        throw encode_error();
+    }
 
-    // we will go threw all chars and check if all are correct
-    // if not we will add replacement char or throw exception (is_throwing func)
-    wq::size_t i = 0;
-    while(i < size) {
-        string::value_type c;
-        try {
-            c = str + i;
-        }
-        catch(const encode_error&) {
-            if(is_throwing()) {
-                throw;
-            }
-            else {
-                c = string::value_type::repl_char();
-            }
+    // valid parts are copied and invalid parts are replaced
+    string::value_type repl = string::value_type::repl_char();
+    ret_val.reserve(size);
+    while(1) {
+        ret_val.append_raw(str, valid_last - str, len);
+        if(valid_last == last) {
+            break;
         }
-        ret_val.push_back(c);
-        i += c.bytes();
+        ret_val.append_raw(repl.utf8(), repl.bytes(), 1);
+        str = valid_last + utf8_invalid_length(valid_last, last);
+        len = 0;
+        valid_last = utf8_validate(str, last, len);
     }
-
     return ret_val;
 }
 
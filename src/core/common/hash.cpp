@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/hash.h"
+
+#include <cstring>
+
+namespace wq {
+namespace core {
+
+// primes and mixing functions of hash, algorithm is the same as xxHash64
+static const wq::uint64 prime1 = 11400714785074694791ULL;
+static const wq::uint64 prime2 = 14029467366897019519ULL;
+static const wq::uint64 prime3 = 1609587929392839161ULL;
+static const wq::uint64 prime4 = 9650029242287828579ULL;
+static const wq::uint64 prime5 = 2870177450012600261ULL;
+
+static inline wq::uint64 rotl(wq::uint64 x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static inline wq::uint64 read64(const char* p) {
+	wq::uint64 val;
+	memcpy(&val, p, sizeof(val));
+	return val;
+}
+
+static inline wq::uint64 hash_round(wq::uint64 acc, wq::uint64 input) {
+	return rotl(acc + input * prime2, 31) * prime1;
+}
+
+static inline wq::uint64 merge_round(wq::uint64 acc, wq::uint64 val) {
+	return (acc ^ hash_round(0, val)) * prime1 + prime4;
+}
+
+/*!
+	\brief Returns hash of \a n bytes at \a data.
+
+	Bytes are processed in 32 byte blocks by 4 independent lanes, so
+	processor (or vectorizing compiler) computes them in parallel. Strings
+	and all other texts are hashed by this function, so texts with
+	the same UTF-8 bytes have the same hash. Returned hash is never 0.
+
+	\sa string::hash()
+*/
+wq::size_t hash_bytes(const void* data, wq::size_t n) {
+	const char* p = static_cast<const char*>(data);
+	const char* last = p + n;
+	wq::uint64 hash;
+
+	if(n >= 32) {
+		wq::uint64 lanes[4] = { prime1 + prime2, prime2, 0, 0 - prime1 };
+		const char* stop = last - 32;
+		do {
+			for(int i = 0; i != 4; i++) {
+				lanes[i] = hash_round(lanes[i], read64(p + 8 * i));
+			}
+			p += 32;
+		} while(p <= stop);
+
+		hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+		for(int i = 0; i != 4; i++) {
+			hash = merge_round(hash, lanes[i]);
+		}
+	}
+	else {
+		hash = prime5;
+	}
+	hash += wq::uint64(n);
+
+	// tail of bytes
+	for( ; p + 8 <= last; p += 8) {
+		hash = rotl(hash ^ hash_round(0, read64(p)), 27) * prime1 + prime4;
+	}
+	if(p + 4 <= last) {
+		wq::uint32 val;
+		memcpy(&val, p, sizeof(val));
+		hash = rotl(hash ^ (wq::uint64(val) * prime1), 23) * prime2 + prime3;
+		p += 4;
+	}
+	for( ; p != last; p++) {
+		hash = rotl(hash ^ (wq::uint8(*p) * prime5), 11) * prime1;
+	}
+
+	// final mixing of bits
+	hash ^= hash >> 33;
+	hash *= prime2;
+	hash ^= hash >> 29;
+	hash *= prime3;
+	hash ^= hash >> 32;
+
+	// 0 marks hashes which are not computed yet (see string::hash())
+	return wq::size_t(hash) == 0 ? 1 : wq::size_t(hash);
+}
+
+}  // namespace core
+}  // namespace wq
@@ -20,6 +20,7 @@
 #include "wq/core/p/locale.h"
 
 #include "wq/core/string.h"
+#include "wq/core/string_ref.h"
 
 #include <clocale>
 
@@ -45,12 +46,12 @@ locale::wq_data::wq_data(const string& name) :
         m_lang_index(1), m_terr_index(0), m_data_ptr(NULL) {
     if( !name.empty() ) {
         string::size_type _pos = name.find( string::value_type('_') );
-        string lang_code = name.substr(0, _pos);
-        string terr_code = name.substr(_pos + 1, name.size() - (_pos + 1));
+        string_ref lang_code(name, 0, _pos);
+        string_ref terr_code(name, _pos == string::npos ? name.size() : _pos + 1);
 
         // finding language index
         for(wq::ushort i = 0; i != locale::last_language; i++) {
-            if(string(sm_lang_names[i][1]).compare(lang_code, false) == 0) {
+            if(string_ref(sm_lang_names[i][1]).compare(lang_code, false) == 0) {
                 m_lang_index = i;
             }
         }
@@ -61,7 +62,7 @@ locale::wq_data::wq_data(const string& name) :
 
         // finding territory index
         for(wq::ushort i = 0; i != locale::last_country; i++) {
-            if(string(sm_terr_names[i][1]).compare(terr_code, false) == 0) {
+            if(string_ref(sm_terr_names[i][1]).compare(terr_code, false) == 0) {
                 m_terr_index = i;
             }
         }
@@ -149,6 +150,21 @@ locale& locale::operator= (const locale& r) {
     return *this;
 }
 
+#if WQ_HAS_MOVE
+locale::locale(locale&& from) :
+        d_ptr( WQ_MOVE(from.d_ptr) ), m_encoding( WQ_MOVE(from.m_encoding) ) {
+
+}
+
+locale& locale::operator= (locale&& r) {
+    if(&r != this) {
+        m_encoding = WQ_MOVE(r.m_encoding);
+        d_ptr = WQ_MOVE(r.d_ptr);
+    }
+    return *this;
+}
+#endif
+
 locale::~locale() {
 
 }
@@ -163,19 +179,19 @@ locale::country locale::country_id() const {
 }
 
 string locale::language_name() const {
-    return string( wq_data::sm_lang_names[d()->m_lang_index][0], utf8_encoder() );
+    return string( wq_data::sm_lang_names[d()->m_lang_index][0], string::npos, utf8_encoder() );
 }
 
 string locale::language_shortcut() const {
-    return string( wq_data::sm_lang_names[d()->m_lang_index][1], utf8_encoder() );
+    return string( wq_data::sm_lang_names[d()->m_lang_index][1], string::npos, utf8_encoder() );
 }
 
 string locale::country_name() const {
-    return string( wq_data::sm_terr_names[d()->m_terr_index][0], utf8_encoder() );
+    return string( wq_data::sm_terr_names[d()->m_terr_index][0], string::npos, utf8_encoder() );
 }
 
 string locale::country_shortcut() const {
-    return string( wq_data::sm_terr_names[d()->m_terr_index][1], utf8_encoder() );
+    return string( wq_data::sm_terr_names[d()->m_terr_index][1], string::npos, utf8_encoder() );
 }
 
 string locale::name() const {
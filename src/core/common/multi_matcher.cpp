@@ -0,0 +1,329 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/multi_matcher.h"
+#include "wq/core/exception.h"
+#include "wq/core/p/utf8.h"
+
+#include <cstring>
+
+namespace wq {
+namespace core {
+
+/*!
+    \class multi_matcher
+    \brief Finds many patterns in text at once.
+
+    Patterns are compiled to Aho-Corasick automaton over UTF-8 bytes,
+    so text is read only once regardless of number of patterns:
+    \code
+        wq::string_list words;
+        words.push_back("error");
+        words.push_back("timeout");
+        wq::multi_matcher keywords(words, false);
+        wq::vector<wq::multi_matcher::match> found = keywords.find_all(line);
+        for(wq::size_t i = 0; i != found.size(); i++) {
+            report(found[i].m_pattern, found[i].m_pos);
+        }
+    \endcode
+
+    Bytes are mapped to classes (all bytes which are in no pattern share
+    one class) and every state has one row of transitions for all classes,
+    so every byte of text costs one lookup in table. States are numbered
+    in breadth-first order, so states near the root, which are visited most
+    often, lie at beginning of table.
+
+    Case insensitive matcher is built from folded patterns (see
+    string::value_type::get_uc_properties() and \c case_fold_diff). ASCII
+    letters of both cases are mapped to the same class, other characters
+    of text are folded during searching.
+
+    Empty patterns are never found.
+
+    \sa string::find()
+*/
+
+/*!
+    \class multi_matcher::match
+    \brief Occurrence of pattern found by multi_matcher.
+
+    \a m_pattern is index of pattern in list passed to constructor,
+    \a m_pos is index of first character of occurrence in text and
+    \a m_len is its number of characters.
+*/
+
+// marks transitions which are not in trie yet
+static const wq::uint32 sm_no_state = 0xFFFFFFFFu;
+
+// visitors of scan(), they get matches of state and end of text read so far
+// and return false to stop searching
+struct match_collector {
+    match_collector(const char* start, const vector<multi_matcher::size_type>& lengths,
+                    vector<multi_matcher::match>& matches) :
+        m_counted(start), m_chars(0), m_found(0), m_lengths(lengths), m_matches(matches) { };
+
+    bool operator() (const wq::uint32* first, const wq::uint32* last, const char* end) {
+        // characters are counted only up to end of found occurrence
+        m_chars += utf8_count(m_counted, end);
+        m_counted = end;
+        for( ; first != last; ++first) {
+            multi_matcher::match m = { *first, m_chars - m_lengths[*first], m_lengths[*first] };
+            m_matches.push_back(m);
+            m_found++;
+        }
+        return true;
+    };
+
+    const char* m_counted;
+    multi_matcher::size_type m_chars;
+    multi_matcher::size_type m_found;
+    const vector<multi_matcher::size_type>& m_lengths;
+    vector<multi_matcher::match>& m_matches;
+};
+
+struct match_stopper {
+    bool operator() (const wq::uint32*, const wq::uint32*, const char*) {
+        return false;
+    };
+};
+
+/*!
+    \brief Constructs matcher without patterns.
+*/
+multi_matcher::multi_matcher() :
+    m_class_count(1), m_table(1, 0), m_first_match(1), m_out_begin(2, 0), m_cs(true) {
+    memset(m_classes, 0, sizeof(m_classes));
+}
+
+/*!
+    \brief Compiles \a patterns.
+
+    If \a cs is \b false patterns are found case insensitively.
+    \sa find_all()
+*/
+multi_matcher::multi_matcher(const string_list& patterns, bool cs) : m_class_count(1), m_first_match(0), m_cs(cs) {
+    // bytes of all patterns, folded if case insensitive
+    vector<char> bytes;
+    vector<size_type> ends;
+    for(string_list::const_iterator iter = patterns.begin(); iter != patterns.end(); ++iter) {
+        m_lengths.push_back( iter->size() );
+        const char* ptr = iter->data();
+        const char* last = ptr + iter->bytes();
+        if(cs) {
+            bytes.insert(bytes.end(), ptr, last);
+        }
+        for( ; !cs && ptr != last; ptr = utf8_skip(ptr, last, 1)) {
+            char buff[4];
+            size_type n = utf8_encode(utf8_fold( string::cp_iterator(ptr, last).utf32() ), buff);
+            bytes.insert(bytes.end(), buff, buff + n);
+        }
+        ends.push_back( bytes.size() );
+    }
+    build(bytes, ends);
+}
+
+/*!
+    \fn multi_matcher::patterns() const
+    \brief Returns number of patterns.
+*/
+
+/*!
+    \fn multi_matcher::states() const
+    \brief Returns number of states of automaton.
+*/
+
+/*!
+    \brief Finds all occurrences of all patterns in \a text.
+
+    Found occurrences (also overlapping ones) are appended to \a matches
+    ordered by their ends, occurrences which end at the same character
+    are ordered from the longest one. Indexes of characters are counted
+    only for found occurrences (by blocks of bytes).
+
+    \return Number of found occurrences.
+*/
+multi_matcher::size_type multi_matcher::find_all(const string_ref& text, vector<match>& matches) const {
+    match_collector visitor(text.data(), m_lengths, matches);
+    scan(text, visitor);
+    return visitor.m_found;
+}
+
+/*!
+    \brief Returns \b true if \a text contains some of patterns.
+
+    Searching stops at the first occurrence and no indexes are counted.
+*/
+bool multi_matcher::contains(const string_ref& text) const {
+    match_stopper visitor;
+    return !scan(text, visitor);
+}
+
+// private functions
+// builds automaton from bytes of patterns, i-th pattern ends at ends[i]
+void multi_matcher::build(const vector<char>& bytes, const vector<size_type>& ends) {
+    // every used byte has its own class, ASCII letters are folded by classes
+    memset(m_classes, 0, sizeof(m_classes));
+    for(size_type i = 0; i != bytes.size(); i++) {
+        m_classes[wq::uint8(bytes[i])] = 1;
+    }
+    m_class_count = 1;
+    for(int b = 0; b != 256; b++) {
+        m_classes[b] = m_classes[b] ? wq::uint8(m_class_count++) : 0;
+    }
+    for(int b = 'A'; !m_cs && b <= 'Z'; b++) {
+        m_classes[b] = m_classes[b + 32];
+    }
+    const wq::uint32 count = m_class_count;
+
+    // trie of patterns, patterns which end in the same state are linked by next_pattern
+    vector<wq::uint32> trie(count, sm_no_state);
+    vector<wq::uint32> first_pattern(1, sm_no_state);
+    vector<wq::uint32> next_pattern(ends.size(), sm_no_state);
+    size_type start = 0;
+    for(size_type p = 0; p != ends.size(); start = ends[p++]) {
+        if(start == ends[p]) {
+            continue;
+        }
+        wq::uint32 state = 0;
+        for(size_type i = start; i != ends[p]; i++) {
+            wq::uint32& next = trie[state * count + m_classes[wq::uint8(bytes[i])]];
+            if(next == sm_no_state) {
+                next = wq::uint32(first_pattern.size());
+                first_pattern.push_back(sm_no_state);
+                trie.resize(trie.size() + count, sm_no_state);
+                state = wq::uint32(first_pattern.size() - 1);
+                continue;
+            }
+            state = next;
+        }
+        next_pattern[p] = first_pattern[state];
+        first_pattern[state] = wq::uint32(p);
+    }
+    size_type states = first_pattern.size();
+    if(states * count > 0x7FFFFFFFu) {
+        throw range_error();
+    }
+
+    // breadth-first walk computes failure links and replaces missing transitions
+    // by transitions of failure states, so automaton never goes back
+    vector<wq::uint32> queue(1, 0);
+    vector<wq::uint32> fail(states, 0);
+    queue.reserve(states);
+    for(size_type q = 0; q != queue.size(); q++) {
+        wq::uint32 state = queue[q];
+        for(wq::uint32 c = 0; c != count; c++) {
+            wq::uint32& next = trie[state * count + c];
+            wq::uint32 fail_next = state == 0 ? 0 : trie[fail[state] * count + c];
+            if(next == sm_no_state) {
+                next = fail_next;
+                continue;
+            }
+            fail[next] = fail_next;
+            queue.push_back(next);
+        }
+    }
+
+    // matches of state are its own patterns followed by matches of its failure state
+    vector<wq::uint32> outs;
+    vector<wq::uint32> outs_first(states);
+    vector<wq::uint32> outs_last(states);
+    for(size_type q = 0; q != states; q++) {
+        wq::uint32 state = queue[q];
+        outs_first[state] = wq::uint32( outs.size() );
+        vector<wq::uint32> own;
+        for(wq::uint32 p = first_pattern[state]; p != sm_no_state; p = next_pattern[p]) {
+            own.push_back(p);
+        }
+        outs.insert(outs.end(), own.rbegin(), own.rend());
+        for(wq::uint32 i = outs_first[ fail[state] ]; state != 0 && i != outs_last[ fail[state] ]; i++) {
+            outs.push_back(outs[i]);
+        }
+        outs_last[state] = wq::uint32( outs.size() );
+    }
+
+    // states are renumbered in breadth-first order, states with matches are
+    // placed after all other ones, so one compare tells that state has matches
+    vector<wq::uint32> numbers(states);
+    vector<wq::uint32> order;
+    order.reserve(states);
+    for(int with_matches = 0; with_matches != 2; with_matches++) {
+        m_first_match = wq::uint32(order.size() * count);
+        for(size_type q = 0; q != states; q++) {
+            if((outs_first[ queue[q] ] != outs_last[ queue[q] ]) == (with_matches != 0)) {
+                numbers[ queue[q] ] = wq::uint32( order.size() );
+                order.push_back(queue[q]);
+            }
+        }
+    }
+
+    // transitions lead directly to rows of target states
+    m_table.resize(states * count);
+    m_out.clear();
+    m_out_begin.resize(states + 1);
+    for(size_type n = 0; n != states; n++) {
+        for(wq::uint32 c = 0; c != count; c++) {
+            m_table[n * count + c] = numbers[ trie[order[n] * count + c] ] * count;
+        }
+        m_out_begin[n] = wq::uint32( m_out.size() );
+        m_out.insert(m_out.end(), outs.begin() + outs_first[ order[n] ], outs.begin() + outs_last[ order[n] ]);
+    }
+    m_out_begin[states] = wq::uint32( m_out.size() );
+}
+
+// runs automaton over text, visitor is called with matches of every state
+// with matches and end of text read so far, returns false if visitor stopped it
+template<class Visitor> bool multi_matcher::scan(const string_ref& text, Visitor& visitor) const {
+    const wq::uint32* table = &m_table[0];
+    const wq::uint32* out = m_out.empty() ? NULL : &m_out[0];
+    const wq::uint8* classes = m_classes;
+    const wq::uint32 first_match = m_first_match;
+    const char* ptr = text.data();
+    const char* last = ptr + text.bytes();
+    wq::uint32 state = 0;
+    while(ptr != last) {
+        if(m_cs) {
+            // bytes are read by the shortest loop, which stops only at matches
+            do {
+                state = table[state + classes[wq::uint8(*ptr++)]];
+            } while(state < first_match && ptr != last);
+        }
+        else if(wq::uint8(*ptr) < 0x80) {
+            state = table[state + classes[wq::uint8(*ptr++)]];
+        }
+        else {
+            // other characters than ASCII are folded, match can end only after whole character
+            string::cp_iterator iter(ptr, last);
+            char buff[4];
+            size_type n = utf8_encode(utf8_fold( iter.utf32() ), buff);
+            ptr += iter.bytes();
+            for(size_type i = 0; i != n; i++) {
+                state = table[state + classes[wq::uint8(buff[i])]];
+            }
+        }
+        if(state >= first_match) {
+            wq::uint32 number = state / m_class_count;
+            if( !visitor(out + m_out_begin[number], out + m_out_begin[number + 1], ptr) ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace core
+}  // namespace wq
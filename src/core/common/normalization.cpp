@@ -0,0 +1,283 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/string.h"
+#include "wq/core/vector.h"
+#include "wq/core/p/normalization.h"
+#include "wq/core/p/utf8.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace wq {
+namespace core {
+
+typedef string::size_type size_type;
+
+// Hangul syllables are composed and decomposed algorithmically
+static const wq::uint32 sm_hangul_s = 0xAC00;
+static const wq::uint32 sm_hangul_l = 0x1100;
+static const wq::uint32 sm_hangul_v = 0x1161;
+static const wq::uint32 sm_hangul_t = 0x11A7;
+static const wq::uint32 sm_hangul_l_count = 19;
+static const wq::uint32 sm_hangul_v_count = 21;
+static const wq::uint32 sm_hangul_t_count = 28;
+static const wq::uint32 sm_hangul_s_count = sm_hangul_l_count * sm_hangul_v_count * sm_hangul_t_count;
+
+// quick check flags and lead bytes of the first characters with some flag
+// (or combining class) for every form, all text below them is normalized
+static const wq::uint8 sm_no_flags[] = { uc_nfd_no, uc_nfc_no, uc_nfkd_no, uc_nfkc_no };
+static const wq::uint8 sm_maybe_flags[] = { 0, uc_nfc_maybe, 0, uc_nfkc_maybe };
+static const wq::uint8 sm_lead_limits[] = { 0xC3, 0xCC, 0xC2, 0xC2 };
+
+// characters below the first combining mark are all starters
+static inline wq::uint8 combining_class(wq::uint32 c) {
+    return c < 0x300 ? 0 : wq::uint8( string::value_type::get_uc_properties(c)->combining_class );
+}
+
+// finds the first character which breaks quick check of form - no is set if text is
+// not normalized for sure, otherwise it must be normalized to see it, returns last
+// for normalized text
+static const char* quick_check(const char* ptr, const char* last, string::normalization_form form, bool& no) {
+    const wq::uint8 no_flag = sm_no_flags[form];
+    const wq::uint8 maybe_flag = sm_maybe_flags[form];
+    const wq::uint8 limit = sm_lead_limits[form];
+    wq::uint8 last_class = 0;
+    no = false;
+    while(true) {
+        // skipped characters are normalized and have combining class 0
+        const char* skipped = utf8_skip_below(ptr, last, limit);
+        last_class = skipped != ptr ? 0 : last_class;
+        ptr = skipped;
+        if(ptr == last) {
+            return last;
+        }
+
+        do {
+            string::cp_iterator iter(ptr, last);
+            wq::uint32 c = iter.utf32();
+            wq::uint8 cc = combining_class(c);
+            wq::uint8 flags = uc_quick_check(c);
+            if((cc != 0 && last_class > cc) || (flags & no_flag)) {
+                no = true;
+                return ptr;
+            }
+            if(flags & maybe_flag) {
+                return ptr;
+            }
+            last_class = cc;
+            ptr += iter.bytes();
+        } while(ptr != last && wq::uint8(*ptr) >= limit);
+    }
+}
+
+// returns beginning of the last starter before ptr, which can not be changed by
+// characters before it or combined with them - text is normalized again from it
+static const char* segment_start(const char* first, const char* ptr, string::normalization_form form) {
+    while(ptr != first) {
+        do {
+            ptr--;
+        } while(ptr != first && utf8_is_trail(*ptr));
+        wq::uint32 c = string::cp_iterator(ptr, ptr).utf32();
+        if(combining_class(c) == 0 && (uc_quick_check(c) & sm_maybe_flags[form]) == 0) {
+            break;
+        }
+    }
+    return ptr;
+}
+
+static bool composition_less(const uc_composition& comp, const uc_composition& with) {
+    return comp.m_first < with.m_first || (comp.m_first == with.m_first && comp.m_second < with.m_second);
+}
+
+// appends character and moves it in front of following characters with greater combining class
+static inline void append_ordered(wq::uint32 c, vector<wq::uint32>& chars, vector<wq::uint8>& classes) {
+    wq::uint8 cc = combining_class(c);
+    size_type i = chars.size();
+    chars.push_back(c);
+    classes.push_back(cc);
+    for( ; cc != 0 && i != 0 && classes[i - 1] > cc; i--) {
+        std::swap(chars[i], chars[i - 1]);
+        std::swap(classes[i], classes[i - 1]);
+    }
+}
+
+// fully decomposes characters in canonical order, characters are stored with their combining classes
+static void decompose(const char* ptr, const char* last, bool compat, vector<wq::uint32>& chars, vector<wq::uint8>& classes) {
+    const wq::uint8 no_flag = compat ? uc_nfkd_no : uc_nfd_no;
+    while(ptr != last) {
+        string::cp_iterator iter(ptr, last);
+        wq::uint32 c = iter.utf32();
+        ptr += iter.bytes();
+        if((uc_quick_check(c) & no_flag) == 0) {
+            append_ordered(c, chars, classes);
+            continue;
+        }
+
+        if(c - sm_hangul_s < sm_hangul_s_count) {
+            wq::uint32 index = c - sm_hangul_s;
+            append_ordered(sm_hangul_l + index / (sm_hangul_v_count * sm_hangul_t_count), chars, classes);
+            append_ordered(sm_hangul_v + (index % (sm_hangul_v_count * sm_hangul_t_count)) / sm_hangul_t_count, chars, classes);
+            if(index % sm_hangul_t_count != 0) {
+                append_ordered(sm_hangul_t + index % sm_hangul_t_count, chars, classes);
+            }
+            continue;
+        }
+        // no flag is set only for characters with decomposition of the form
+        const uc_decomposition& found = uc_get_decomposition(c);
+        const wq::uint32* mapping = uc_decomposition_map + (compat ? found.m_compat : found.m_canonical);
+        const wq::uint8 count = compat ? found.m_compat_count : found.m_canonical_count;
+        for(wq::uint8 i = 0; i != count; i++) {
+            append_ordered(mapping[i], chars, classes);
+        }
+    }
+}
+
+// returns primary composite of two characters or 0
+static wq::uint32 compose_pair(wq::uint32 first, wq::uint32 second) {
+    if(first - sm_hangul_l < sm_hangul_l_count && second - sm_hangul_v < sm_hangul_v_count) {
+        return sm_hangul_s + ((first - sm_hangul_l) * sm_hangul_v_count + (second - sm_hangul_v)) * sm_hangul_t_count;
+    }
+    if(first - sm_hangul_s < sm_hangul_s_count && (first - sm_hangul_s) % sm_hangul_t_count == 0 &&
+            second - sm_hangul_t - 1 < sm_hangul_t_count - 1) {
+        return first + (second - sm_hangul_t);
+    }
+
+    // only characters with maybe flag are second characters of composites
+    if((uc_quick_check(second) & (uc_nfc_maybe | uc_nfkc_maybe)) == 0) {
+        return 0;
+    }
+    const uc_composition pair = { first, second, 0 };
+    const uc_composition* last = uc_compositions + uc_compositions_count;
+    const uc_composition* found = std::lower_bound(uc_compositions, last, pair, composition_less);
+    return (found != last && found->m_first == first && found->m_second == second) ? found->m_composite : 0;
+}
+
+// canonical composition, character is combined with the last starter if no
+// character between them has the same or greater combining class
+static void compose(vector<wq::uint32>& chars, vector<wq::uint8>& classes) {
+    size_type starter = string::npos;
+    int last_class = 0;
+    size_type n = 0;
+    for(size_type i = 0; i != chars.size(); i++) {
+        wq::uint32 c = chars[i];
+        int cc = classes[i];
+        if(starter != string::npos && (last_class < cc || last_class == 0)) {
+            wq::uint32 composite = compose_pair(chars[starter], c);
+            if(composite != 0) {
+                chars[starter] = composite;
+                continue;
+            }
+        }
+        starter = cc == 0 ? n : starter;
+        last_class = cc;
+        chars[n] = c;
+        classes[n] = wq::uint8(cc);
+        n++;
+    }
+    chars.resize(n);
+    classes.resize(n);
+}
+
+static void normalize(const char* ptr, const char* last, string::normalization_form form, vector<wq::uint32>& chars) {
+    vector<wq::uint8> classes;
+    chars.reserve(last - ptr);
+    classes.reserve(last - ptr);
+    decompose(ptr, last, form == string::normalization_kd || form == string::normalization_kc, chars, classes);
+    if(form == string::normalization_c || form == string::normalization_kc) {
+        compose(chars, classes);
+    }
+}
+
+/*!
+    \brief Returns string normalized to Unicode normalization \a form.
+
+    Text is checked by quick check of Unicode Standard Annex #15 first - ASCII
+    (and other characters which are normalized in every context, like Latin-1
+    letters for NFC) are skipped by blocks and other characters are looked up
+    in tables. Already normalized string is returned without copying of its
+    bytes. Otherwise only the part from the last stable character before the
+    first unnormalized one is decomposed, ordered and composed again.
+
+    Hangul syllables are composed and decomposed algorithmically, other
+    mappings are in tables which cover characters of string::value_type
+    properties.
+
+    \sa is_normalized()
+*/
+string string::normalized(normalization_form form) const {
+    bool no;
+    const char* first = data();
+    const char* last = data_last();
+    const char* ptr = quick_check(first, last, form, no);
+    if(ptr == last) {
+        return *this;
+    }
+
+    ptr = segment_start(first, ptr, form);
+    vector<wq::uint32> chars;
+    normalize(ptr, last, form, chars);
+
+    size_type prefix = ptr - first;
+    size_type n = prefix;
+    char buff[4];
+    for(size_type i = 0; i != chars.size(); i++) {
+        n += utf8_encode(chars[i], buff);
+    }
+    string ret_str;
+    char* out = ret_str.assign_raw(n, utf8_count(first, ptr) + chars.size());
+    wq_data::m_alloc.copy(out, first, prefix);
+    out += prefix;
+    for(size_type i = 0; i != chars.size(); i++) {
+        out += utf8_encode(chars[i], out);
+    }
+    return ret_str;
+}
+
+/*!
+    \brief Returns \b true if string is normalized to \a form.
+
+    Characters are checked in one pass without allocation by quick check,
+    only when it can not decide (for example combining mark after letter
+    in NFC) the rest of string is normalized and compared.
+
+    \sa normalized()
+*/
+bool string::is_normalized(normalization_form form) const {
+    bool no;
+    const char* first = data();
+    const char* last = data_last();
+    const char* ptr = quick_check(first, last, form, no);
+    if(ptr == last || no) {
+        return ptr == last;
+    }
+
+    ptr = segment_start(first, ptr, form);
+    vector<wq::uint32> chars;
+    normalize(ptr, last, form, chars);
+    size_type i = 0;
+    for(cp_iterator iter(ptr, last); !iter.at_end(); ++iter, i++) {
+        if(i == chars.size() || iter.utf32() != chars[i]) {
+            return false;
+        }
+    }
+    return i == chars.size();
+}
+
+}  // namespace core
+}  // namespace wq
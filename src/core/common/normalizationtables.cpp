@@ -0,0 +1,4614 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/p/normalization.h"
+
+namespace wq {
+namespace core {
+
+// Tables are generated by samples/tables_gen (option -n) from UnicodeData.txt and
+// CompositionExclusions.txt for characters which have properties in unicodetables.cpp
+
+// quick check flags of characters (see uc_quick_check_flags), blocks of 256
+// characters are shared by all parts of Unicode with the same flags
+const wq::uint8 uc_quick_check_index[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 7, 7, 7, 7, 7, 7, 7, 7, 7, 17, 7, 18, 19, 20,
+    21, 22, 23, 24, 25, 7, 7, 7, 7, 7, 26, 7, 7, 27, 28, 29,
+    30, 31, 32, 33, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 35, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 36, 37, 38, 33, 39, 40, 41,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 42, 7, 7, 43, 44, 45, 46, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 36, 36, 47, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+};
+
+const wq::uint8 uc_quick_check_blocks[] = {
+    // block 0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 0, 0, 0, 0, 0, 0, 0, 18, 0, 18, 0, 0, 0, 0, 18,
+    0, 0, 18, 18, 18, 18, 0, 0, 18, 18, 18, 0, 18, 18, 18, 0,
+    3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0,
+    3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 3,
+    // block 1
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 18, 18, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 18,
+    18, 0, 0, 3, 3, 3, 3, 3, 3, 18, 0, 0, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 18, 18, 18, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    // block 2
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 0, 0,
+    18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 3
+    40, 40, 40, 40, 40, 0, 40, 40, 40, 40, 40, 40, 40, 0, 0, 40,
+    0, 40, 0, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0,
+    0, 0, 0, 40, 40, 40, 40, 40, 40, 0, 0, 0, 0, 40, 40, 0,
+    40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0,
+    23, 23, 40, 23, 23, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 18, 0, 0, 0, 23, 0,
+    0, 0, 0, 0, 18, 19, 3, 23, 3, 3, 3, 0, 3, 0, 3, 3,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0,
+    18, 18, 18, 19, 19, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 0, 18, 18, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0,
+    // block 4
+    3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 3, 3, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 3, 3, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3,
+    0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
+    // block 5
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 6
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 40, 40, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 7
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 8
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 23, 23, 23, 23, 23, 23, 23, 23,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 23, 23, 0, 23,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 9
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 23, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 23, 23, 0, 0, 23, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 10
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 40, 40, 0, 0, 0, 0, 23, 23, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 11
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 40, 0, 0, 0, 0, 3, 3, 0, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 40, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 12
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 3, 3, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 13
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 14
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0,
+    0, 0, 23, 0, 0, 0, 0, 23, 0, 0, 0, 0, 23, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 23, 0, 23, 23, 18, 23, 18, 0, 0, 0, 0, 0, 0,
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0,
+    0, 0, 23, 0, 0, 0, 0, 23, 0, 0, 0, 0, 23, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 15
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 40, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+    // block 16
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 17
+    0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0,
+    3, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 18
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 19
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18, 19, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+    // block 20
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 23, 3, 23, 3, 23, 3, 23, 3, 23, 3, 23, 3, 23, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 23, 3, 18, 23, 18,
+    18, 19, 3, 3, 3, 0, 3, 3, 3, 23, 3, 23, 3, 19, 19, 19,
+    3, 3, 3, 23, 0, 0, 3, 3, 3, 3, 3, 23, 0, 19, 19, 19,
+    3, 3, 3, 23, 3, 3, 3, 3, 3, 3, 3, 23, 3, 19, 23, 23,
+    0, 0, 3, 3, 3, 0, 3, 3, 3, 23, 3, 23, 3, 23, 18, 0,
+    // block 21
+    23, 23, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    0, 18, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    0, 0, 0, 18, 18, 0, 18, 18, 0, 0, 0, 0, 18, 0, 18, 0,
+    0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 22
+    18, 18, 18, 18, 0, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 0, 18, 18, 0, 0, 18, 18, 18, 18, 18, 0, 0,
+    18, 18, 18, 0, 18, 0, 23, 0, 18, 0, 23, 23, 18, 18, 0, 18,
+    18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18,
+    18, 0, 0, 0, 0, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 23
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 18, 18, 0, 18,
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 3, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 24
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 25
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 26
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 27
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 28
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 29
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 30
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 0, 18, 18, 18, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 40, 40, 18, 18, 0, 3, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0, 3, 18,
+    // block 31
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 32
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    // block 33
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    // block 34
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    // block 35
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 36
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    // block 37
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 0, 0,
+    23, 0, 23, 0, 0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 0,
+    23, 0, 23, 0, 0, 23, 23, 0, 0, 0, 23, 23, 23, 23, 0, 0,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 0, 0, 0, 0, 0,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 38
+    18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 23, 0, 23,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 0, 23, 23, 23, 23, 23, 0, 23, 0,
+    23, 23, 0, 23, 23, 0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    // block 39
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0,
+    // block 40
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 0, 0, 0, 0,
+    18, 18, 18, 0, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0,
+    // block 41
+    0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    0, 0, 18, 18, 18, 18, 18, 18, 0, 0, 18, 18, 18, 18, 18, 18,
+    0, 0, 18, 18, 18, 18, 18, 18, 0, 0, 18, 18, 18, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 42
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 23,
+    23, 23, 23, 23, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 23, 23, 23, 23,
+    23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 43
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 18, 18,
+    0, 0, 18, 0, 0, 18, 18, 0, 0, 18, 18, 18, 18, 0, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 18, 0, 18, 18, 18,
+    18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    // block 44
+    18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 0, 0, 18, 18, 18,
+    18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 0, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 0,
+    18, 18, 18, 18, 18, 0, 18, 0, 0, 0, 18, 18, 18, 18, 18, 18,
+    18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    // block 45
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    // block 46
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    // block 47
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// decompositions of characters - blocks of 256 characters contain numbers of
+// their decompositions in uc_decompositions (0 for characters without them)
+const wq::uint8 uc_decomposition_index[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 16, 7, 17, 18, 19,
+    20, 21, 22, 23, 24, 7, 7, 7, 7, 7, 25, 7, 7, 26, 27, 28,
+    29, 30, 31, 32, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 33, 34, 35, 36, 37, 38, 39,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 40, 7, 7, 41, 42, 43, 44, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 45, 46, 47, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+};
+
+const wq::uint16 uc_decomposition_blocks[] = {
+    // block 0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 4,
+    0, 0, 5, 6, 7, 8, 0, 0, 9, 10, 11, 0, 12, 13, 14, 0,
+    15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    0, 30, 31, 32, 33, 34, 35, 0, 0, 36, 37, 38, 39, 40, 0, 0,
+    41, 42, 43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    0, 56, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 0, 67,
+    // block 1
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    0, 0, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 99, 100, 101, 102, 103, 0, 0, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 0, 113, 114, 115, 116, 117, 118, 0, 119, 120, 121, 122, 123, 124, 125,
+    126, 0, 0, 127, 128, 129, 130, 131, 132, 133, 0, 0, 134, 135, 136, 137,
+    138, 139, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 0, 0, 158, 159, 160, 161, 162, 163, 164, 165,
+    166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184,
+    185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+    198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+    213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226,
+    227, 228, 229, 230, 231, 232, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240,
+    // block 2
+    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+    257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270,
+    0, 0, 0, 0, 0, 0, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+    281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    285, 286, 287, 288, 289, 290, 291, 292, 293, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297, 298, 299, 0, 0,
+    300, 301, 302, 303, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 3
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    305, 306, 0, 307, 308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 309, 0, 0, 0, 0, 0, 310, 0, 0, 0, 311, 0,
+    0, 0, 0, 0, 312, 313, 314, 315, 316, 317, 318, 0, 319, 0, 320, 321,
+    322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 323, 324, 325, 326, 327, 328,
+    329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 330, 331, 332, 333, 334, 0,
+    335, 336, 337, 338, 339, 340, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    342, 343, 344, 0, 345, 346, 0, 0, 0, 347, 0, 0, 0, 0, 0, 0,
+    // block 4
+    348, 349, 0, 350, 0, 0, 0, 351, 0, 0, 0, 0, 352, 353, 354, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 356, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    357, 358, 0, 359, 0, 0, 0, 360, 0, 0, 0, 0, 361, 362, 363, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 364, 365, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 366, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    368, 369, 370, 371, 0, 0, 372, 373, 0, 0, 374, 375, 376, 377, 378, 379,
+    0, 0, 380, 381, 382, 383, 384, 385, 0, 0, 386, 387, 388, 389, 390, 391,
+    392, 393, 394, 395, 396, 397, 0, 0, 398, 399, 0, 0, 0, 0, 0, 0,
+    // block 5
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 400, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 6
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 401, 402, 403, 404, 405, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 406, 407, 408, 409, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    410, 0, 411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 7
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 8
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0,
+    0, 414, 0, 0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 416, 417, 418, 419, 420, 421, 422, 423,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 424, 425, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 426, 427, 0, 428,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 9
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 429, 0, 0, 430, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 431, 432, 433, 0, 0, 434, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 10
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 435, 0, 0, 436, 437, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 438, 439, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 441, 442, 443, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 11
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 444, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    445, 0, 0, 0, 0, 0, 0, 446, 447, 0, 448, 449, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 12
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 450, 451, 452, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 453, 0, 454, 455, 456, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 13
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 460, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 14
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 461, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 463, 0, 0,
+    0, 0, 464, 0, 0, 0, 0, 465, 0, 0, 0, 0, 466, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 467, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 468, 0, 469, 470, 471, 472, 473, 0, 0, 0, 0, 0, 0,
+    0, 474, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 475, 0, 0, 0, 0, 0, 0, 0, 0, 0, 476, 0, 0,
+    0, 0, 477, 0, 0, 0, 0, 478, 0, 0, 0, 0, 479, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 480, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 15
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 482, 0, 0, 0,
+    // block 16
+    0, 0, 0, 0, 0, 0, 483, 0, 484, 0, 485, 0, 486, 0, 487, 0,
+    0, 0, 488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 489, 0, 490, 0, 0,
+    491, 492, 0, 493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 17
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 494, 495, 496, 0,
+    497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 0, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 0, 526,
+    527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542,
+    543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 554, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 18
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+    672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+    704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+    720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
+    736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 0, 0, 0, 0,
+    748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763,
+    764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
+    780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795,
+    796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811,
+    812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827,
+    828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 0, 0, 0, 0, 0, 0,
+    // block 19
+    838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853,
+    854, 855, 856, 857, 858, 859, 0, 0, 860, 861, 862, 863, 864, 865, 0, 0,
+    866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881,
+    882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897,
+    898, 899, 900, 901, 902, 903, 0, 0, 904, 905, 906, 907, 908, 909, 0, 0,
+    910, 911, 912, 913, 914, 915, 916, 917, 0, 918, 0, 919, 0, 920, 0, 921,
+    922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937,
+    938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 0, 0,
+    952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967,
+    968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983,
+    984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999,
+    1000, 1001, 1002, 1003, 1004, 0, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014,
+    1015, 1016, 1017, 1018, 1019, 0, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
+    1030, 1031, 1032, 1033, 0, 0, 1034, 1035, 1036, 1037, 1038, 1039, 0, 1040, 1041, 1042,
+    1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058,
+    0, 0, 1059, 1060, 1061, 0, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 0,
+    // block 20
+    1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0, 0, 0,
+    0, 1082, 0, 0, 0, 0, 0, 1083, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1084, 1085, 1086, 0, 0, 0, 0, 0, 0, 0, 0, 1087,
+    0, 0, 0, 1088, 1089, 0, 1090, 1091, 0, 0, 0, 0, 1092, 0, 1093, 0,
+    0, 0, 0, 0, 0, 0, 0, 1094, 1095, 1096, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1097, 0, 0, 0, 0, 0, 0, 0, 1098,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1099, 1100, 0, 0, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+    1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 0,
+    1128, 1129, 1130, 1131, 1132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1133, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 21
+    1134, 1135, 1136, 1137, 0, 1138, 1139, 1140, 0, 1141, 1142, 1143, 1144, 1145, 1146, 1147,
+    1148, 1149, 1150, 1151, 0, 1152, 1153, 0, 0, 1154, 1155, 1156, 1157, 1158, 0, 0,
+    1159, 1160, 1161, 0, 1162, 0, 1163, 0, 1164, 0, 1165, 1166, 1167, 1168, 0, 1169,
+    1170, 1171, 0, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 0, 1179, 1180, 1181, 1182, 1183,
+    1184, 0, 0, 0, 0, 1185, 1186, 1187, 1188, 1189, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
+    1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218,
+    1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1235, 1236, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1237, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1238, 1239, 1240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 22
+    0, 0, 0, 0, 1241, 0, 0, 0, 0, 1242, 0, 0, 1243, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1244, 0, 1245, 0, 0, 0, 0, 0, 1246, 1247, 0, 1248,
+    1249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1250, 0, 0, 1251, 0, 0, 1252, 0, 1253, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1254, 0, 1255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1256, 1257, 1258,
+    1259, 1260, 0, 0, 1261, 1262, 0, 0, 1263, 1264, 0, 0, 0, 0, 0, 0,
+    1265, 1266, 0, 0, 1267, 1268, 0, 0, 1269, 1270, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1271, 1272, 1273, 1274,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1275, 1276, 1277, 1278, 0, 0, 0, 0, 0, 0, 1279, 1280, 1281, 1282, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 23
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1283, 1284, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 24
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
+    1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
+    1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332,
+    1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
+    1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+    1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380,
+    1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396,
+    1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412,
+    1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 25
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1424, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1425, 1426, 1427, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1428, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 26
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1429,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 27
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1430,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 28
+    1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447,
+    1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463,
+    1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479,
+    1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
+    1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511,
+    1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527,
+    1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543,
+    1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559,
+    1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
+    1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591,
+    1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
+    1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623,
+    1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639,
+    1640, 1641, 1642, 1643, 1644, 1645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 29
+    1646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1647, 0, 1648, 1649, 1650, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1651, 0, 1652, 0,
+    1653, 0, 1654, 0, 1655, 0, 1656, 0, 1657, 0, 1658, 0, 1659, 0, 1660, 0,
+    1661, 0, 1662, 0, 0, 1663, 0, 1664, 0, 1665, 0, 0, 0, 0, 0, 0,
+    1666, 1667, 0, 1668, 1669, 0, 1670, 1671, 0, 1672, 1673, 0, 1674, 1675, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1676, 0, 0, 0, 0, 0, 0, 1677, 1678, 0, 1679, 1680,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1681, 0, 1682, 0,
+    1683, 0, 1684, 0, 1685, 0, 1686, 0, 1687, 0, 1688, 0, 1689, 0, 1690, 0,
+    1691, 0, 1692, 0, 0, 1693, 0, 1694, 0, 1695, 0, 0, 0, 0, 0, 0,
+    1696, 1697, 0, 1698, 1699, 0, 1700, 1701, 0, 1702, 1703, 0, 1704, 1705, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1706, 0, 0, 1707, 1708, 1709, 1710, 0, 0, 0, 1711, 1712,
+    // block 30
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+    1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+    1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759,
+    1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+    1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 0,
+    0, 0, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 31
+    1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836,
+    1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 0,
+    1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867,
+    1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883,
+    1884, 1885, 1886, 1887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+    1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+    1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 0,
+    1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950,
+    1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966,
+    1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982,
+    1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998,
+    1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014,
+    2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030,
+    2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046,
+    2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 0,
+    // block 32
+    2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077,
+    2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093,
+    2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109,
+    2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125,
+    2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141,
+    2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157,
+    2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173,
+    2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189,
+    2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205,
+    2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221,
+    2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237,
+    2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253,
+    2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269,
+    2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285,
+    2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301,
+    2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317,
+    // block 33
+    2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333,
+    2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349,
+    2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365,
+    2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381,
+    2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397,
+    2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+    2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429,
+    2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445,
+    2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461,
+    2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477,
+    2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493,
+    2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509,
+    2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525,
+    2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541,
+    2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557,
+    2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+    // block 34
+    2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 0, 0,
+    2588, 0, 2589, 0, 0, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 0,
+    2600, 0, 2601, 0, 0, 2602, 2603, 0, 0, 0, 2604, 2605, 2606, 2607, 0, 0,
+    2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+    2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639,
+    2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655,
+    2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 0, 0, 0, 0, 0,
+    2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682,
+    2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698,
+    2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714,
+    2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730,
+    2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746,
+    2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762,
+    2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 35
+    2773, 2774, 2775, 2776, 2777, 2778, 2779, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2780, 2781, 2782, 2783, 2784, 0, 0, 0, 0, 0, 2785, 0, 2786,
+    2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802,
+    2803, 2804, 2805, 2806, 2807, 2808, 2809, 0, 2810, 2811, 2812, 2813, 2814, 0, 2815, 0,
+    2816, 2817, 0, 2818, 2819, 0, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829,
+    2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845,
+    2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861,
+    2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877,
+    2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893,
+    2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909,
+    2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925,
+    2926, 2927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940,
+    2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956,
+    2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972,
+    // block 36
+    2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988,
+    2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004,
+    3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020,
+    3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036,
+    3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052,
+    3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068,
+    3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084,
+    3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100,
+    3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116,
+    3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132,
+    3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148,
+    3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164,
+    3165, 3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180,
+    3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196,
+    3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212,
+    3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228,
+    // block 37
+    3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244,
+    3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260,
+    3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276,
+    3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3291, 3292, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306,
+    3307, 3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322,
+    3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338,
+    3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354,
+    0, 0, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367, 3368,
+    3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384,
+    3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400,
+    3401, 3402, 3403, 3404, 3405, 3406, 3407, 3408, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 0, 0, 0,
+    // block 38
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447,
+    3448, 3449, 3450, 3451, 3452, 0, 0, 3453, 3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461,
+    3462, 3463, 3464, 0, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476,
+    3477, 3478, 3479, 3480, 3481, 3482, 3483, 0, 3484, 3485, 3486, 3487, 0, 0, 0, 0,
+    3488, 3489, 3490, 0, 3491, 0, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501,
+    3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517,
+    3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533,
+    3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549,
+    3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565,
+    3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581,
+    3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597,
+    3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613,
+    3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 0, 0, 0,
+    // block 39
+    0, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641,
+    3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657,
+    3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673,
+    3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689,
+    3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705,
+    3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721,
+    3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737,
+    3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753,
+    3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769,
+    3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785,
+    3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798, 3799, 3800, 3801,
+    3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 0,
+    0, 0, 3817, 3818, 3819, 3820, 3821, 3822, 0, 0, 3823, 3824, 3825, 3826, 3827, 3828,
+    0, 0, 3829, 3830, 3831, 3832, 3833, 3834, 0, 0, 3835, 3836, 3837, 0, 0, 0,
+    3838, 3839, 3840, 3841, 3842, 3843, 3844, 0, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 40
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3852, 3853,
+    3854, 3855, 3856, 3857, 3858, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3859, 3860, 3861, 3862, 3863,
+    3864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // block 41
+    3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880,
+    3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896,
+    3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912,
+    3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928,
+    3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944,
+    3945, 3946, 3947, 3948, 3949, 0, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959,
+    3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975,
+    3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991,
+    3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007,
+    4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 0, 4021, 4022,
+    0, 0, 4023, 0, 0, 4024, 4025, 0, 0, 4026, 4027, 4028, 4029, 0, 4030, 4031,
+    4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041, 0, 4042, 0, 4043, 4044, 4045,
+    4046, 4047, 4048, 4049, 0, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060,
+    4061, 4062, 4063, 4064, 4065, 4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076,
+    4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092,
+    4093, 4094, 4095, 4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108,
+    // block 42
+    4109, 4110, 4111, 4112, 4113, 4114, 0, 4115, 4116, 4117, 4118, 0, 0, 4119, 4120, 4121,
+    4122, 4123, 4124, 4125, 4126, 0, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 0, 4134, 4135,
+    4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149, 4150, 4151,
+    4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 4161, 0, 4162, 4163, 4164, 4165, 0,
+    4166, 4167, 4168, 4169, 4170, 0, 4171, 0, 0, 0, 4172, 4173, 4174, 4175, 4176, 4177,
+    4178, 0, 4179, 4180, 4181, 4182, 4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190, 4191, 4192,
+    4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208,
+    4209, 4210, 4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218, 4219, 4220, 4221, 4222, 4223, 4224,
+    4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236, 4237, 4238, 4239, 4240,
+    4241, 4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256,
+    4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272,
+    4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288,
+    4289, 4290, 4291, 4292, 4293, 4294, 4295, 4296, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304,
+    4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320,
+    4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335, 4336,
+    4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352,
+    // block 43
+    4353, 4354, 4355, 4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368,
+    4369, 4370, 4371, 4372, 4373, 4374, 4375, 4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384,
+    4385, 4386, 4387, 4388, 4389, 4390, 4391, 4392, 4393, 4394, 4395, 4396, 4397, 4398, 4399, 4400,
+    4401, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416,
+    4417, 4418, 4419, 4420, 4421, 4422, 4423, 4424, 4425, 4426, 4427, 4428, 4429, 4430, 4431, 4432,
+    4433, 4434, 4435, 4436, 4437, 4438, 4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448,
+    4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464,
+    4465, 4466, 4467, 4468, 4469, 4470, 4471, 4472, 4473, 4474, 4475, 4476, 4477, 4478, 4479, 4480,
+    4481, 4482, 4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496,
+    4497, 4498, 4499, 4500, 4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512,
+    4513, 4514, 4515, 4516, 4517, 4518, 0, 0, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526,
+    4527, 4528, 4529, 4530, 4531, 4532, 4533, 4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542,
+    4543, 4544, 4545, 4546, 4547, 4548, 4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558,
+    4559, 4560, 4561, 4562, 4563, 4564, 4565, 4566, 4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574,
+    4575, 4576, 4577, 4578, 4579, 4580, 4581, 4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590,
+    4591, 4592, 4593, 4594, 4595, 4596, 4597, 4598, 4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606,
+    // block 44
+    4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622,
+    4623, 4624, 4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638,
+    4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654,
+    4655, 4656, 4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670,
+    4671, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685, 4686,
+    4687, 4688, 4689, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700, 4701, 4702,
+    4703, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718,
+    4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734,
+    4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4743, 4744, 4745, 4746, 4747, 4748, 4749, 4750,
+    4751, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764, 4765, 4766,
+    4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778, 4779, 4780, 4781, 4782,
+    4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 4793, 4794, 4795, 4796, 4797, 4798,
+    4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808, 4809, 4810, 0, 0, 4811, 4812,
+    4813, 4814, 4815, 4816, 4817, 4818, 4819, 4820, 4821, 4822, 4823, 4824, 4825, 4826, 4827, 4828,
+    4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840, 4841, 4842, 4843, 4844,
+    4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860,
+    // block 45
+    4861, 4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876,
+    4877, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885, 4886, 4887, 4888, 4889, 4890, 4891, 4892,
+    4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908,
+    4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924,
+    4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937, 4938, 4939, 4940,
+    4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951, 4952, 4953, 4954, 4955, 4956,
+    4957, 4958, 4959, 4960, 4961, 4962, 4963, 4964, 4965, 4966, 4967, 4968, 4969, 4970, 4971, 4972,
+    4973, 4974, 4975, 4976, 4977, 4978, 4979, 4980, 4981, 4982, 4983, 4984, 4985, 4986, 4987, 4988,
+    4989, 4990, 4991, 4992, 4993, 4994, 4995, 4996, 4997, 4998, 4999, 5000, 5001, 5002, 5003, 5004,
+    5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012, 5013, 5014, 5015, 5016, 5017, 5018, 5019, 5020,
+    5021, 5022, 5023, 5024, 5025, 5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036,
+    5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045, 5046, 5047, 5048, 5049, 5050, 5051, 5052,
+    5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068,
+    5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084,
+    5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093, 5094, 5095, 5096, 5097, 5098, 5099, 5100,
+    5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108, 5109, 5110, 5111, 5112, 5113, 5114, 5115, 5116,
+    // block 46
+    5117, 5118, 5119, 5120, 5121, 5122, 5123, 5124, 5125, 5126, 5127, 5128, 5129, 5130, 5131, 5132,
+    5133, 5134, 5135, 5136, 5137, 5138, 5139, 5140, 5141, 5142, 5143, 5144, 5145, 5146, 5147, 5148,
+    5149, 5150, 5151, 5152, 5153, 5154, 5155, 5156, 5157, 5158, 5159, 5160, 5161, 5162, 5163, 5164,
+    5165, 5166, 5167, 5168, 5169, 5170, 5171, 5172, 5173, 5174, 5175, 5176, 5177, 5178, 5179, 5180,
+    5181, 5182, 5183, 5184, 5185, 5186, 5187, 5188, 5189, 5190, 5191, 5192, 5193, 5194, 5195, 5196,
+    5197, 5198, 5199, 5200, 5201, 5202, 5203, 5204, 5205, 5206, 5207, 5208, 5209, 5210, 5211, 5212,
+    5213, 5214, 5215, 5216, 5217, 5218, 5219, 5220, 5221, 5222, 5223, 5224, 5225, 5226, 5227, 5228,
+    5229, 5230, 5231, 5232, 5233, 5234, 5235, 5236, 5237, 5238, 5239, 5240, 5241, 5242, 5243, 5244,
+    5245, 5246, 5247, 5248, 5249, 5250, 5251, 5252, 5253, 5254, 5255, 5256, 5257, 5258, 5259, 5260,
+    5261, 5262, 5263, 5264, 5265, 5266, 5267, 5268, 5269, 5270, 5271, 5272, 5273, 5274, 5275, 5276,
+    5277, 5278, 5279, 5280, 5281, 5282, 5283, 5284, 5285, 5286, 5287, 5288, 5289, 5290, 5291, 5292,
+    5293, 5294, 5295, 5296, 5297, 5298, 5299, 5300, 5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308,
+    5309, 5310, 5311, 5312, 5313, 5314, 5315, 5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324,
+    5325, 5326, 5327, 5328, 5329, 5330, 5331, 5332, 5333, 5334, 5335, 5336, 5337, 5338, 5339, 5340,
+    5341, 5342, 5343, 5344, 5345, 5346, 5347, 5348, 5349, 5350, 5351, 5352, 5353, 5354, 5355, 5356,
+    5357, 5358, 5359, 5360, 5361, 5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369, 5370, 5371, 5372,
+    // block 47
+    5373, 5374, 5375, 5376, 5377, 5378, 5379, 5380, 5381, 5382, 5383, 5384, 5385, 5386, 5387, 5388,
+    5389, 5390, 5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398, 5399, 5400, 5401, 5402, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// full canonical and compatibility decompositions, sequences are in uc_decomposition_map
+const uc_decomposition uc_decompositions[] = {
+    {0, 0, 0, 0},
+    {0, 0, 0, 1}, {0, 1, 0, 2}, {0, 3, 0, 1}, {0, 4, 0, 2},
+    {0, 6, 0, 1}, {0, 7, 0, 1}, {0, 8, 0, 2}, {0, 10, 0, 1},
+    {0, 11, 0, 2}, {0, 13, 0, 1}, {0, 14, 0, 1}, {0, 15, 0, 3},
+    {0, 18, 0, 3}, {0, 21, 0, 3}, {24, 24, 2, 2}, {26, 26, 2, 2},
+    {28, 28, 2, 2}, {30, 30, 2, 2}, {32, 32, 2, 2}, {34, 34, 2, 2},
+    {36, 36, 2, 2}, {38, 38, 2, 2}, {40, 40, 2, 2}, {42, 42, 2, 2},
+    {44, 44, 2, 2}, {46, 46, 2, 2}, {48, 48, 2, 2}, {50, 50, 2, 2},
+    {52, 52, 2, 2}, {54, 54, 2, 2}, {56, 56, 2, 2}, {58, 58, 2, 2},
+    {60, 60, 2, 2}, {62, 62, 2, 2}, {64, 64, 2, 2}, {66, 66, 2, 2},
+    {68, 68, 2, 2}, {70, 70, 2, 2}, {72, 72, 2, 2}, {74, 74, 2, 2},
+    {76, 76, 2, 2}, {78, 78, 2, 2}, {80, 80, 2, 2}, {82, 82, 2, 2},
+    {84, 84, 2, 2}, {86, 86, 2, 2}, {88, 88, 2, 2}, {90, 90, 2, 2},
+    {92, 92, 2, 2}, {94, 94, 2, 2}, {96, 96, 2, 2}, {98, 98, 2, 2},
+    {100, 100, 2, 2}, {102, 102, 2, 2}, {104, 104, 2, 2}, {106, 106, 2, 2},
+    {108, 108, 2, 2}, {110, 110, 2, 2}, {112, 112, 2, 2}, {114, 114, 2, 2},
+    {116, 116, 2, 2}, {118, 118, 2, 2}, {120, 120, 2, 2}, {122, 122, 2, 2},
+    {124, 124, 2, 2}, {126, 126, 2, 2}, {128, 128, 2, 2}, {130, 130, 2, 2},
+    {132, 132, 2, 2}, {134, 134, 2, 2}, {136, 136, 2, 2}, {138, 138, 2, 2},
+    {140, 140, 2, 2}, {142, 142, 2, 2}, {144, 144, 2, 2}, {146, 146, 2, 2},
+    {148, 148, 2, 2}, {150, 150, 2, 2}, {152, 152, 2, 2}, {154, 154, 2, 2},
+    {156, 156, 2, 2}, {158, 158, 2, 2}, {160, 160, 2, 2}, {162, 162, 2, 2},
+    {164, 164, 2, 2}, {166, 166, 2, 2}, {168, 168, 2, 2}, {170, 170, 2, 2},
+    {172, 172, 2, 2}, {174, 174, 2, 2}, {176, 176, 2, 2}, {178, 178, 2, 2},
+    {180, 180, 2, 2}, {182, 182, 2, 2}, {184, 184, 2, 2}, {186, 186, 2, 2},
+    {188, 188, 2, 2}, {190, 190, 2, 2}, {192, 192, 2, 2}, {194, 194, 2, 2},
+    {196, 196, 2, 2}, {198, 198, 2, 2}, {200, 200, 2, 2}, {202, 202, 2, 2},
+    {204, 204, 2, 2}, {206, 206, 2, 2}, {208, 208, 2, 2}, {210, 210, 2, 2},
+    {212, 212, 2, 2}, {214, 214, 2, 2}, {216, 216, 2, 2}, {218, 218, 2, 2},
+    {0, 220, 0, 2}, {0, 222, 0, 2}, {224, 224, 2, 2}, {226, 226, 2, 2},
+    {228, 228, 2, 2}, {230, 230, 2, 2}, {232, 232, 2, 2}, {234, 234, 2, 2},
+    {236, 236, 2, 2}, {238, 238, 2, 2}, {240, 240, 2, 2}, {242, 242, 2, 2},
+    {0, 244, 0, 2}, {0, 246, 0, 2}, {248, 248, 2, 2}, {250, 250, 2, 2},
+    {252, 252, 2, 2}, {254, 254, 2, 2}, {256, 256, 2, 2}, {258, 258, 2, 2},
+    {0, 260, 0, 2}, {262, 262, 2, 2}, {264, 264, 2, 2}, {266, 266, 2, 2},
+    {268, 268, 2, 2}, {270, 270, 2, 2}, {272, 272, 2, 2}, {274, 274, 2, 2},
+    {276, 276, 2, 2}, {278, 278, 2, 2}, {280, 280, 2, 2}, {282, 282, 2, 2},
+    {284, 284, 2, 2}, {286, 286, 2, 2}, {288, 288, 2, 2}, {290, 290, 2, 2},
+    {292, 292, 2, 2}, {294, 294, 2, 2}, {296, 296, 2, 2}, {298, 298, 2, 2},
+    {300, 300, 2, 2}, {302, 302, 2, 2}, {304, 304, 2, 2}, {306, 306, 2, 2},
+    {308, 308, 2, 2}, {310, 310, 2, 2}, {312, 312, 2, 2}, {314, 314, 2, 2},
+    {316, 316, 2, 2}, {318, 318, 2, 2}, {320, 320, 2, 2}, {322, 322, 2, 2},
+    {324, 324, 2, 2}, {326, 326, 2, 2}, {328, 328, 2, 2}, {330, 330, 2, 2},
+    {332, 332, 2, 2}, {334, 334, 2, 2}, {336, 336, 2, 2}, {338, 338, 2, 2},
+    {340, 340, 2, 2}, {342, 342, 2, 2}, {344, 344, 2, 2}, {346, 346, 2, 2},
+    {348, 348, 2, 2}, {350, 350, 2, 2}, {352, 352, 2, 2}, {354, 354, 2, 2},
+    {0, 356, 0, 1}, {357, 357, 2, 2}, {359, 359, 2, 2}, {361, 361, 2, 2},
+    {363, 363, 2, 2}, {0, 365, 0, 3}, {0, 368, 0, 3}, {0, 371, 0, 3},
+    {0, 374, 0, 2}, {0, 376, 0, 2}, {0, 378, 0, 2}, {0, 380, 0, 2},
+    {0, 382, 0, 2}, {0, 384, 0, 2}, {386, 386, 2, 2}, {388, 388, 2, 2},
+    {390, 390, 2, 2}, {392, 392, 2, 2}, {394, 394, 2, 2}, {396, 396, 2, 2},
+    {398, 398, 2, 2}, {400, 400, 2, 2}, {402, 402, 3, 3}, {405, 405, 3, 3},
+    {408, 408, 3, 3}, {411, 411, 3, 3}, {414, 414, 3, 3}, {417, 417, 3, 3},
+    {420, 420, 3, 3}, {423, 423, 3, 3}, {426, 426, 3, 3}, {429, 429, 3, 3},
+    {432, 432, 3, 3}, {435, 435, 3, 3}, {438, 438, 2, 2}, {440, 440, 2, 2},
+    {442, 442, 2, 2}, {444, 444, 2, 2}, {446, 446, 2, 2}, {448, 448, 2, 2},
+    {450, 450, 2, 2}, {452, 452, 2, 2}, {454, 454, 3, 3}, {457, 457, 3, 3},
+    {460, 460, 2, 2}, {462, 462, 2, 2}, {464, 464, 2, 2}, {0, 466, 0, 2},
+    {0, 468, 0, 2}, {0, 470, 0, 2}, {472, 472, 2, 2}, {474, 474, 2, 2},
+    {476, 476, 2, 2}, {478, 478, 2, 2}, {480, 480, 3, 3}, {483, 483, 3, 3},
+    {486, 486, 2, 2}, {488, 488, 2, 2}, {490, 490, 2, 2}, {492, 492, 2, 2},
+    {494, 494, 2, 2}, {496, 496, 2, 2}, {498, 498, 2, 2}, {500, 500, 2, 2},
+    {502, 502, 2, 2}, {504, 504, 2, 2}, {506, 506, 2, 2}, {508, 508, 2, 2},
+    {510, 510, 2, 2}, {512, 512, 2, 2}, {514, 514, 2, 2}, {516, 516, 2, 2},
+    {518, 518, 2, 2}, {520, 520, 2, 2}, {522, 522, 2, 2}, {524, 524, 2, 2},
+    {526, 526, 2, 2}, {528, 528, 2, 2}, {530, 530, 2, 2}, {532, 532, 2, 2},
+    {534, 534, 2, 2}, {536, 536, 2, 2}, {538, 538, 2, 2}, {540, 540, 2, 2},
+    {542, 542, 2, 2}, {544, 544, 2, 2}, {546, 546, 2, 2}, {548, 548, 2, 2},
+    {550, 550, 2, 2}, {552, 552, 2, 2}, {554, 554, 2, 2}, {556, 556, 2, 2},
+    {558, 558, 2, 2}, {560, 560, 2, 2}, {562, 562, 3, 3}, {565, 565, 3, 3},
+    {568, 568, 3, 3}, {571, 571, 3, 3}, {574, 574, 2, 2}, {576, 576, 2, 2},
+    {578, 578, 3, 3}, {581, 581, 3, 3}, {584, 584, 2, 2}, {586, 586, 2, 2},
+    {0, 588, 0, 1}, {0, 589, 0, 1}, {0, 590, 0, 1}, {0, 591, 0, 1},
+    {0, 592, 0, 1}, {0, 593, 0, 1}, {0, 594, 0, 1}, {0, 595, 0, 1},
+    {0, 596, 0, 1}, {0, 597, 0, 2}, {0, 599, 0, 2}, {0, 601, 0, 2},
+    {0, 603, 0, 2}, {0, 605, 0, 2}, {0, 607, 0, 2}, {0, 609, 0, 1},
+    {0, 610, 0, 1}, {0, 356, 0, 1}, {0, 611, 0, 1}, {0, 612, 0, 1},
+    {613, 613, 1, 1}, {614, 614, 1, 1}, {615, 615, 1, 1}, {616, 616, 2, 2},
+    {618, 618, 1, 1}, {0, 619, 0, 2}, {621, 621, 1, 1}, {0, 8, 0, 2},
+    {622, 624, 2, 3}, {627, 627, 2, 2}, {629, 629, 1, 1}, {630, 630, 2, 2},
+    {632, 632, 2, 2}, {634, 634, 2, 2}, {636, 636, 2, 2}, {638, 638, 2, 2},
+    {640, 640, 2, 2}, {642, 642, 3, 3}, {645, 645, 2, 2}, {647, 647, 2, 2},
+    {649, 649, 2, 2}, {651, 651, 2, 2}, {653, 653, 2, 2}, {655, 655, 2, 2},
+    {657, 657, 3, 3}, {660, 660, 2, 2}, {662, 662, 2, 2}, {664, 664, 2, 2},
+    {666, 666, 2, 2}, {668, 668, 2, 2}, {0, 670, 0, 1}, {0, 671, 0, 1},
+    {0, 672, 0, 1}, {673, 638, 2, 2}, {675, 647, 2, 2}, {0, 677, 0, 1},
+    {0, 678, 0, 1}, {0, 679, 0, 1}, {0, 680, 0, 1}, {0, 681, 0, 1},
+    {0, 682, 0, 1}, {0, 683, 0, 1}, {0, 684, 0, 1}, {685, 685, 2, 2},
+    {687, 687, 2, 2}, {689, 689, 2, 2}, {691, 691, 2, 2}, {693, 693, 2, 2},
+    {695, 695, 2, 2}, {697, 697, 2, 2}, {699, 699, 2, 2}, {701, 701, 2, 2},
+    {703, 703, 2, 2}, {705, 705, 2, 2}, {707, 707, 2, 2}, {709, 709, 2, 2},
+    {711, 711, 2, 2}, {713, 713, 2, 2}, {715, 715, 2, 2}, {717, 717, 2, 2},
+    {719, 719, 2, 2}, {721, 721, 2, 2}, {723, 723, 2, 2}, {725, 725, 2, 2},
+    {727, 727, 2, 2}, {729, 729, 2, 2}, {731, 731, 2, 2}, {733, 733, 2, 2},
+    {735, 735, 2, 2}, {737, 737, 2, 2}, {739, 739, 2, 2}, {741, 741, 2, 2},
+    {743, 743, 2, 2}, {745, 745, 2, 2}, {747, 747, 2, 2}, {749, 749, 2, 2},
+    {751, 751, 2, 2}, {753, 753, 2, 2}, {755, 755, 2, 2}, {757, 757, 2, 2},
+    {759, 759, 2, 2}, {761, 761, 2, 2}, {763, 763, 2, 2}, {765, 765, 2, 2},
+    {767, 767, 2, 2}, {769, 769, 2, 2}, {771, 771, 2, 2}, {773, 773, 2, 2},
+    {775, 775, 2, 2}, {777, 777, 2, 2}, {779, 779, 2, 2}, {781, 781, 2, 2},
+    {783, 783, 2, 2}, {785, 785, 2, 2}, {787, 787, 2, 2}, {0, 789, 0, 2},
+    {791, 791, 2, 2}, {793, 793, 2, 2}, {795, 795, 2, 2}, {797, 797, 2, 2},
+    {799, 799, 2, 2}, {0, 801, 0, 2}, {0, 803, 0, 2}, {0, 805, 0, 2},
+    {0, 807, 0, 2}, {809, 809, 2, 2}, {811, 811, 2, 2}, {813, 813, 2, 2},
+    {815, 815, 2, 2}, {817, 817, 2, 2}, {819, 819, 2, 2}, {821, 821, 2, 2},
+    {823, 823, 2, 2}, {825, 825, 2, 2}, {827, 827, 2, 2}, {829, 829, 2, 2},
+    {831, 831, 2, 2}, {833, 833, 2, 2}, {835, 835, 2, 2}, {837, 837, 2, 2},
+    {839, 839, 2, 2}, {841, 841, 2, 2}, {843, 843, 2, 2}, {845, 845, 2, 2},
+    {847, 847, 2, 2}, {849, 849, 2, 2}, {851, 851, 2, 2}, {853, 853, 2, 2},
+    {855, 855, 2, 2}, {857, 857, 2, 2}, {859, 859, 2, 2}, {861, 861, 2, 2},
+    {863, 863, 2, 2}, {865, 865, 2, 2}, {867, 867, 2, 2}, {869, 869, 2, 2},
+    {871, 871, 2, 2}, {873, 873, 2, 2}, {875, 875, 2, 2}, {877, 877, 2, 2},
+    {879, 879, 2, 2}, {881, 881, 2, 2}, {883, 883, 2, 2}, {885, 885, 2, 2},
+    {887, 887, 3, 3}, {890, 890, 2, 2}, {892, 892, 2, 2}, {894, 894, 2, 2},
+    {896, 896, 2, 2}, {898, 898, 2, 2}, {900, 900, 3, 3}, {903, 903, 2, 2},
+    {0, 905, 0, 2}, {0, 907, 0, 2}, {0, 909, 0, 2}, {0, 911, 0, 2},
+    {0, 913, 0, 1}, {914, 914, 2, 2}, {916, 916, 2, 2}, {918, 918, 2, 2},
+    {920, 920, 2, 2}, {922, 922, 2, 2}, {924, 924, 2, 2}, {926, 926, 2, 2},
+    {928, 928, 2, 2}, {930, 930, 2, 2}, {0, 932, 0, 3}, {935, 935, 2, 2},
+    {0, 937, 0, 3}, {940, 940, 2, 2}, {942, 942, 2, 2}, {944, 944, 2, 2},
+    {946, 946, 2, 2}, {948, 948, 2, 2}, {950, 950, 2, 2}, {952, 952, 2, 2},
+    {954, 954, 2, 2}, {0, 956, 0, 1}, {957, 957, 2, 2}, {959, 959, 2, 2},
+    {961, 961, 2, 2}, {963, 963, 2, 2}, {965, 965, 2, 2}, {967, 967, 2, 2},
+    {969, 969, 2, 2}, {971, 971, 2, 2}, {973, 973, 2, 2}, {975, 975, 2, 2},
+    {977, 977, 2, 2}, {0, 979, 0, 1}, {0, 980, 0, 1}, {0, 981, 0, 1},
+    {0, 982, 0, 1}, {0, 983, 0, 1}, {0, 984, 0, 1}, {0, 985, 0, 1},
+    {0, 986, 0, 1}, {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1},
+    {0, 990, 0, 1}, {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1},
+    {0, 994, 0, 1}, {0, 995, 0, 1}, {0, 996, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 999, 0, 1}, {0, 3, 0, 1}, {0, 1000, 0, 1},
+    {0, 1001, 0, 1}, {0, 1002, 0, 1}, {0, 1003, 0, 1}, {0, 1004, 0, 1},
+    {0, 1005, 0, 1}, {0, 1006, 0, 1}, {0, 1007, 0, 1}, {0, 1008, 0, 1},
+    {0, 1009, 0, 1}, {0, 1010, 0, 1}, {0, 1011, 0, 1}, {0, 1012, 0, 1},
+    {0, 14, 0, 1}, {0, 1013, 0, 1}, {0, 1014, 0, 1}, {0, 1015, 0, 1},
+    {0, 1016, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1019, 0, 1},
+    {0, 1020, 0, 1}, {0, 1021, 0, 1}, {0, 1022, 0, 1}, {0, 670, 0, 1},
+    {0, 1023, 0, 1}, {0, 1024, 0, 1}, {0, 677, 0, 1}, {0, 1025, 0, 1},
+    {0, 1026, 0, 1}, {0, 591, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 670, 0, 1}, {0, 1023, 0, 1}, {0, 680, 0, 1}, {0, 677, 0, 1},
+    {0, 1025, 0, 1}, {0, 1027, 0, 1}, {0, 1028, 0, 1}, {0, 1029, 0, 1},
+    {0, 1030, 0, 1}, {0, 1031, 0, 1}, {0, 1008, 0, 1}, {0, 1032, 0, 1},
+    {0, 1033, 0, 1}, {0, 1034, 0, 1}, {0, 1035, 0, 1}, {0, 1036, 0, 1},
+    {0, 1037, 0, 1}, {0, 1038, 0, 1}, {0, 1039, 0, 1}, {0, 1040, 0, 1},
+    {0, 1041, 0, 1}, {0, 1042, 0, 1}, {0, 1043, 0, 1}, {0, 1044, 0, 1},
+    {0, 1045, 0, 1}, {0, 1046, 0, 1}, {0, 1047, 0, 1}, {0, 1048, 0, 1},
+    {0, 1049, 0, 1}, {0, 1050, 0, 1}, {0, 1051, 0, 1}, {0, 1052, 0, 1},
+    {0, 1053, 0, 1}, {0, 1054, 0, 1}, {0, 1055, 0, 1}, {0, 1056, 0, 1},
+    {0, 1057, 0, 1}, {0, 1058, 0, 1}, {0, 1059, 0, 1}, {0, 1060, 0, 1},
+    {0, 1061, 0, 1}, {0, 1062, 0, 1}, {0, 671, 0, 1}, {1063, 1063, 2, 2},
+    {1065, 1065, 2, 2}, {1067, 1067, 2, 2}, {1069, 1069, 2, 2}, {1071, 1071, 2, 2},
+    {1073, 1073, 2, 2}, {1075, 1075, 2, 2}, {1077, 1077, 2, 2}, {1079, 1079, 3, 3},
+    {1082, 1082, 3, 3}, {1085, 1085, 2, 2}, {1087, 1087, 2, 2}, {1089, 1089, 2, 2},
+    {1091, 1091, 2, 2}, {1093, 1093, 2, 2}, {1095, 1095, 2, 2}, {1097, 1097, 2, 2},
+    {1099, 1099, 2, 2}, {1101, 1101, 2, 2}, {1103, 1103, 2, 2}, {1105, 1105, 3, 3},
+    {1108, 1108, 3, 3}, {1111, 1111, 3, 3}, {1114, 1114, 3, 3}, {1117, 1117, 2, 2},
+    {1119, 1119, 2, 2}, {1121, 1121, 2, 2}, {1123, 1123, 2, 2}, {1125, 1125, 3, 3},
+    {1128, 1128, 3, 3}, {1131, 1131, 2, 2}, {1133, 1133, 2, 2}, {1135, 1135, 2, 2},
+    {1137, 1137, 2, 2}, {1139, 1139, 2, 2}, {1141, 1141, 2, 2}, {1143, 1143, 2, 2},
+    {1145, 1145, 2, 2}, {1147, 1147, 2, 2}, {1149, 1149, 2, 2}, {1151, 1151, 2, 2},
+    {1153, 1153, 2, 2}, {1155, 1155, 2, 2}, {1157, 1157, 2, 2}, {1159, 1159, 2, 2},
+    {1161, 1161, 2, 2}, {1163, 1163, 3, 3}, {1166, 1166, 3, 3}, {1169, 1169, 2, 2},
+    {1171, 1171, 2, 2}, {1173, 1173, 2, 2}, {1175, 1175, 2, 2}, {1177, 1177, 2, 2},
+    {1179, 1179, 2, 2}, {1181, 1181, 2, 2}, {1183, 1183, 2, 2}, {1185, 1185, 3, 3},
+    {1188, 1188, 3, 3}, {1191, 1191, 2, 2}, {1193, 1193, 2, 2}, {1195, 1195, 2, 2},
+    {1197, 1197, 2, 2}, {1199, 1199, 2, 2}, {1201, 1201, 2, 2}, {1203, 1203, 2, 2},
+    {1205, 1205, 2, 2}, {1207, 1207, 2, 2}, {1209, 1209, 2, 2}, {1211, 1211, 2, 2},
+    {1213, 1213, 2, 2}, {1215, 1215, 2, 2}, {1217, 1217, 2, 2}, {1219, 1219, 2, 2},
+    {1221, 1221, 2, 2}, {1223, 1223, 2, 2}, {1225, 1225, 2, 2}, {1227, 1227, 3, 3},
+    {1230, 1230, 3, 3}, {1233, 1233, 3, 3}, {1236, 1236, 3, 3}, {1239, 1239, 3, 3},
+    {1242, 1242, 3, 3}, {1245, 1245, 3, 3}, {1248, 1248, 3, 3}, {1251, 1251, 2, 2},
+    {1253, 1253, 2, 2}, {1255, 1255, 2, 2}, {1257, 1257, 2, 2}, {1259, 1259, 2, 2},
+    {1261, 1261, 2, 2}, {1263, 1263, 2, 2}, {1265, 1265, 2, 2}, {1267, 1267, 3, 3},
+    {1270, 1270, 3, 3}, {1273, 1273, 2, 2}, {1275, 1275, 2, 2}, {1277, 1277, 2, 2},
+    {1279, 1279, 2, 2}, {1281, 1281, 2, 2}, {1283, 1283, 2, 2}, {1285, 1285, 3, 3},
+    {1288, 1288, 3, 3}, {1291, 1291, 3, 3}, {1294, 1294, 3, 3}, {1297, 1297, 3, 3},
+    {1300, 1300, 3, 3}, {1303, 1303, 2, 2}, {1305, 1305, 2, 2}, {1307, 1307, 2, 2},
+    {1309, 1309, 2, 2}, {1311, 1311, 2, 2}, {1313, 1313, 2, 2}, {1315, 1315, 2, 2},
+    {1317, 1317, 2, 2}, {1319, 1319, 2, 2}, {1321, 1321, 2, 2}, {1323, 1323, 2, 2},
+    {1325, 1325, 2, 2}, {1327, 1327, 2, 2}, {1329, 1329, 2, 2}, {1331, 1331, 3, 3},
+    {1334, 1334, 3, 3}, {1337, 1337, 3, 3}, {1340, 1340, 3, 3}, {1343, 1343, 2, 2},
+    {1345, 1345, 2, 2}, {1347, 1347, 2, 2}, {1349, 1349, 2, 2}, {1351, 1351, 2, 2},
+    {1353, 1353, 2, 2}, {1355, 1355, 2, 2}, {1357, 1357, 2, 2}, {1359, 1359, 2, 2},
+    {1361, 1361, 2, 2}, {1363, 1363, 2, 2}, {1365, 1365, 2, 2}, {1367, 1367, 2, 2},
+    {1369, 1369, 2, 2}, {1371, 1371, 2, 2}, {1373, 1373, 2, 2}, {1375, 1375, 2, 2},
+    {1377, 1377, 2, 2}, {1379, 1379, 2, 2}, {1381, 1381, 2, 2}, {1383, 1383, 2, 2},
+    {1385, 1385, 2, 2}, {1387, 1387, 2, 2}, {1389, 1389, 2, 2}, {1391, 1391, 2, 2},
+    {1393, 1393, 2, 2}, {1395, 1395, 2, 2}, {1397, 1397, 2, 2}, {1399, 1399, 2, 2},
+    {1401, 1401, 2, 2}, {0, 1403, 0, 2}, {1405, 1279, 2, 2}, {1407, 1407, 2, 2},
+    {1409, 1409, 2, 2}, {1411, 1411, 2, 2}, {1413, 1413, 2, 2}, {1415, 1415, 3, 3},
+    {1418, 1418, 3, 3}, {1421, 1421, 3, 3}, {1424, 1424, 3, 3}, {1427, 1427, 3, 3},
+    {1430, 1430, 3, 3}, {1433, 1433, 3, 3}, {1436, 1436, 3, 3}, {1439, 1439, 3, 3},
+    {1442, 1442, 3, 3}, {1445, 1445, 3, 3}, {1448, 1448, 3, 3}, {1451, 1451, 3, 3},
+    {1454, 1454, 3, 3}, {1457, 1457, 3, 3}, {1460, 1460, 3, 3}, {1463, 1463, 3, 3},
+    {1466, 1466, 3, 3}, {1469, 1469, 3, 3}, {1472, 1472, 3, 3}, {1475, 1475, 2, 2},
+    {1477, 1477, 2, 2}, {1479, 1479, 2, 2}, {1481, 1481, 2, 2}, {1483, 1483, 2, 2},
+    {1485, 1485, 2, 2}, {1487, 1487, 3, 3}, {1490, 1490, 3, 3}, {1493, 1493, 3, 3},
+    {1496, 1496, 3, 3}, {1499, 1499, 3, 3}, {1502, 1502, 3, 3}, {1505, 1505, 3, 3},
+    {1508, 1508, 3, 3}, {1511, 1511, 3, 3}, {1514, 1514, 3, 3}, {1517, 1517, 2, 2},
+    {1519, 1519, 2, 2}, {1521, 1521, 2, 2}, {1523, 1523, 2, 2}, {1525, 1525, 2, 2},
+    {1527, 1527, 2, 2}, {1529, 1529, 2, 2}, {1531, 1531, 2, 2}, {1533, 1533, 3, 3},
+    {1536, 1536, 3, 3}, {1539, 1539, 3, 3}, {1542, 1542, 3, 3}, {1545, 1545, 3, 3},
+    {1548, 1548, 3, 3}, {1551, 1551, 3, 3}, {1554, 1554, 3, 3}, {1557, 1557, 3, 3},
+    {1560, 1560, 3, 3}, {1563, 1563, 3, 3}, {1566, 1566, 3, 3}, {1569, 1569, 3, 3},
+    {1572, 1572, 3, 3}, {1575, 1575, 3, 3}, {1578, 1578, 3, 3}, {1581, 1581, 3, 3},
+    {1584, 1584, 3, 3}, {1587, 1587, 3, 3}, {1590, 1590, 3, 3}, {1593, 1593, 2, 2},
+    {1595, 1595, 2, 2}, {1597, 1597, 2, 2}, {1599, 1599, 2, 2}, {1601, 1601, 3, 3},
+    {1604, 1604, 3, 3}, {1607, 1607, 3, 3}, {1610, 1610, 3, 3}, {1613, 1613, 3, 3},
+    {1616, 1616, 3, 3}, {1619, 1619, 3, 3}, {1622, 1622, 3, 3}, {1625, 1625, 3, 3},
+    {1628, 1628, 3, 3}, {1631, 1631, 2, 2}, {1633, 1633, 2, 2}, {1635, 1635, 2, 2},
+    {1637, 1637, 2, 2}, {1639, 1639, 2, 2}, {1641, 1641, 2, 2}, {1643, 1643, 2, 2},
+    {1645, 1645, 2, 2}, {1647, 1647, 2, 2}, {1649, 1649, 2, 2}, {1651, 1651, 3, 3},
+    {1654, 1654, 3, 3}, {1657, 1657, 3, 3}, {1660, 1660, 3, 3}, {1663, 1663, 3, 3},
+    {1666, 1666, 3, 3}, {1669, 1669, 2, 2}, {1671, 1671, 2, 2}, {1673, 1673, 3, 3},
+    {1676, 1676, 3, 3}, {1679, 1679, 3, 3}, {1682, 1682, 3, 3}, {1685, 1685, 3, 3},
+    {1688, 1688, 3, 3}, {1691, 1691, 2, 2}, {1693, 1693, 2, 2}, {1695, 1695, 3, 3},
+    {1698, 1698, 3, 3}, {1701, 1701, 3, 3}, {1704, 1704, 3, 3}, {1707, 1707, 2, 2},
+    {1709, 1709, 2, 2}, {1711, 1711, 3, 3}, {1714, 1714, 3, 3}, {1717, 1717, 3, 3},
+    {1720, 1720, 3, 3}, {1723, 1723, 2, 2}, {1725, 1725, 2, 2}, {1727, 1727, 3, 3},
+    {1730, 1730, 3, 3}, {1733, 1733, 3, 3}, {1736, 1736, 3, 3}, {1739, 1739, 3, 3},
+    {1742, 1742, 3, 3}, {1745, 1745, 2, 2}, {1747, 1747, 2, 2}, {1749, 1749, 3, 3},
+    {1752, 1752, 3, 3}, {1755, 1755, 3, 3}, {1758, 1758, 3, 3}, {1761, 1761, 3, 3},
+    {1764, 1764, 3, 3}, {1767, 1767, 2, 2}, {1769, 1769, 2, 2}, {1771, 1771, 3, 3},
+    {1774, 1774, 3, 3}, {1777, 1777, 3, 3}, {1780, 1780, 3, 3}, {1783, 1783, 3, 3},
+    {1786, 1786, 3, 3}, {1789, 1789, 2, 2}, {1791, 1791, 2, 2}, {1793, 1793, 3, 3},
+    {1796, 1796, 3, 3}, {1799, 1799, 3, 3}, {1802, 1802, 3, 3}, {1805, 1805, 3, 3},
+    {1808, 1808, 3, 3}, {1811, 1811, 2, 2}, {1813, 1813, 2, 2}, {1815, 1815, 3, 3},
+    {1818, 1818, 3, 3}, {1821, 1821, 3, 3}, {1824, 1824, 3, 3}, {1827, 1827, 2, 2},
+    {1829, 1829, 2, 2}, {1831, 1831, 3, 3}, {1834, 1834, 3, 3}, {1837, 1837, 3, 3},
+    {1840, 1840, 3, 3}, {1843, 1843, 2, 2}, {1845, 1845, 2, 2}, {1847, 1847, 3, 3},
+    {1850, 1850, 3, 3}, {1853, 1853, 3, 3}, {1856, 1856, 3, 3}, {1859, 1859, 3, 3},
+    {1862, 1862, 3, 3}, {1865, 1865, 2, 2}, {1867, 1867, 3, 3}, {1870, 1870, 3, 3},
+    {1873, 1873, 3, 3}, {1876, 1876, 2, 2}, {1878, 1878, 2, 2}, {1880, 1880, 3, 3},
+    {1883, 1883, 3, 3}, {1886, 1886, 3, 3}, {1889, 1889, 3, 3}, {1892, 1892, 3, 3},
+    {1895, 1895, 3, 3}, {1898, 1898, 2, 2}, {1900, 1900, 2, 2}, {1902, 1902, 3, 3},
+    {1905, 1905, 3, 3}, {1908, 1908, 3, 3}, {1911, 1911, 3, 3}, {1914, 1914, 3, 3},
+    {1917, 1917, 3, 3}, {1920, 1920, 2, 2}, {649, 649, 2, 2}, {1922, 1922, 2, 2},
+    {651, 651, 2, 2}, {1924, 1924, 2, 2}, {653, 653, 2, 2}, {1926, 1926, 2, 2},
+    {655, 655, 2, 2}, {1928, 1928, 2, 2}, {664, 664, 2, 2}, {1930, 1930, 2, 2},
+    {666, 666, 2, 2}, {1932, 1932, 2, 2}, {668, 668, 2, 2}, {1934, 1934, 3, 3},
+    {1937, 1937, 3, 3}, {1940, 1940, 4, 4}, {1944, 1944, 4, 4}, {1948, 1948, 4, 4},
+    {1952, 1952, 4, 4}, {1956, 1956, 4, 4}, {1960, 1960, 4, 4}, {1964, 1964, 3, 3},
+    {1967, 1967, 3, 3}, {1970, 1970, 4, 4}, {1974, 1974, 4, 4}, {1978, 1978, 4, 4},
+    {1982, 1982, 4, 4}, {1986, 1986, 4, 4}, {1990, 1990, 4, 4}, {1994, 1994, 3, 3},
+    {1997, 1997, 3, 3}, {2000, 2000, 4, 4}, {2004, 2004, 4, 4}, {2008, 2008, 4, 4},
+    {2012, 2012, 4, 4}, {2016, 2016, 4, 4}, {2020, 2020, 4, 4}, {2024, 2024, 3, 3},
+    {2027, 2027, 3, 3}, {2030, 2030, 4, 4}, {2034, 2034, 4, 4}, {2038, 2038, 4, 4},
+    {2042, 2042, 4, 4}, {2046, 2046, 4, 4}, {2050, 2050, 4, 4}, {2054, 2054, 3, 3},
+    {2057, 2057, 3, 3}, {2060, 2060, 4, 4}, {2064, 2064, 4, 4}, {2068, 2068, 4, 4},
+    {2072, 2072, 4, 4}, {2076, 2076, 4, 4}, {2080, 2080, 4, 4}, {2084, 2084, 3, 3},
+    {2087, 2087, 3, 3}, {2090, 2090, 4, 4}, {2094, 2094, 4, 4}, {2098, 2098, 4, 4},
+    {2102, 2102, 4, 4}, {2106, 2106, 4, 4}, {2110, 2110, 4, 4}, {2114, 2114, 2, 2},
+    {2116, 2116, 2, 2}, {2118, 2118, 3, 3}, {2121, 2121, 2, 2}, {2123, 2123, 3, 3},
+    {2126, 2126, 2, 2}, {2128, 2128, 3, 3}, {2131, 2131, 2, 2}, {2133, 2133, 2, 2},
+    {2135, 2135, 2, 2}, {627, 627, 2, 2}, {2137, 2137, 2, 2}, {0, 2139, 0, 2},
+    {2141, 2141, 1, 1}, {0, 2139, 0, 2}, {0, 2142, 0, 2}, {2144, 2146, 2, 3},
+    {2149, 2149, 3, 3}, {2152, 2152, 2, 2}, {2154, 2154, 3, 3}, {2157, 2157, 2, 2},
+    {2159, 2159, 3, 3}, {2162, 2162, 2, 2}, {630, 630, 2, 2}, {2164, 2164, 2, 2},
+    {632, 632, 2, 2}, {2166, 2166, 2, 2}, {2168, 2170, 2, 3}, {2173, 2175, 2, 3},
+    {2178, 2180, 2, 3}, {2183, 2183, 2, 2}, {2185, 2185, 2, 2}, {2187, 2187, 3, 3},
+    {642, 642, 3, 3}, {2190, 2190, 2, 2}, {2192, 2192, 3, 3}, {2195, 2195, 2, 2},
+    {2197, 2197, 2, 2}, {2199, 2199, 2, 2}, {634, 634, 2, 2}, {2201, 2203, 2, 3},
+    {2206, 2208, 2, 3}, {2211, 2213, 2, 3}, {2216, 2216, 2, 2}, {2218, 2218, 2, 2},
+    {2220, 2220, 3, 3}, {657, 657, 3, 3}, {2223, 2223, 2, 2}, {2225, 2225, 2, 2},
+    {2227, 2227, 2, 2}, {2229, 2229, 3, 3}, {2232, 2232, 2, 2}, {2234, 2234, 2, 2},
+    {2236, 2236, 2, 2}, {638, 638, 2, 2}, {2238, 2238, 2, 2}, {2240, 2242, 2, 3},
+    {622, 624, 2, 3}, {2245, 2245, 1, 1}, {2246, 2246, 3, 3}, {2249, 2249, 2, 2},
+    {2251, 2251, 3, 3}, {2254, 2254, 2, 2}, {2256, 2256, 3, 3}, {2259, 2259, 2, 2},
+    {636, 636, 2, 2}, {2261, 2261, 2, 2}, {640, 640, 2, 2}, {2263, 2263, 2, 2},
+    {2265, 8, 1, 2}, {0, 2266, 0, 2}, {2268, 0, 1, 1}, {2269, 0, 1, 1},
+    {0, 0, 0, 1}, {0, 0, 0, 1}, {0, 0, 0, 1}, {0, 0, 0, 1},
+    {0, 0, 0, 1}, {0, 0, 0, 1}, {0, 0, 0, 1}, {0, 0, 0, 1},
+    {0, 0, 0, 1}, {0, 2270, 0, 1}, {0, 2271, 0, 2}, {0, 2273, 0, 1},
+    {0, 2274, 0, 2}, {0, 2276, 0, 3}, {0, 0, 0, 1}, {0, 2279, 0, 2},
+    {0, 2281, 0, 3}, {0, 2284, 0, 2}, {0, 2286, 0, 3}, {0, 2289, 0, 2},
+    {0, 2291, 0, 2}, {0, 2293, 0, 2}, {0, 2295, 0, 2}, {0, 2297, 0, 2},
+    {0, 2299, 0, 4}, {0, 0, 0, 1}, {0, 2303, 0, 1}, {0, 1026, 0, 1},
+    {0, 2304, 0, 1}, {0, 2305, 0, 1}, {0, 2306, 0, 1}, {0, 2307, 0, 1},
+    {0, 2308, 0, 1}, {0, 2309, 0, 1}, {0, 2310, 0, 1}, {0, 2311, 0, 1},
+    {0, 2312, 0, 1}, {0, 2313, 0, 1}, {0, 2314, 0, 1}, {0, 2315, 0, 1},
+    {0, 2303, 0, 1}, {0, 13, 0, 1}, {0, 6, 0, 1}, {0, 7, 0, 1},
+    {0, 2304, 0, 1}, {0, 2305, 0, 1}, {0, 2306, 0, 1}, {0, 2307, 0, 1},
+    {0, 2308, 0, 1}, {0, 2309, 0, 1}, {0, 2310, 0, 1}, {0, 2311, 0, 1},
+    {0, 2312, 0, 1}, {0, 2313, 0, 1}, {0, 2314, 0, 1}, {0, 3, 0, 1},
+    {0, 1005, 0, 1}, {0, 14, 0, 1}, {0, 611, 0, 1}, {0, 1006, 0, 1},
+    {0, 2316, 0, 2}, {0, 2318, 0, 3}, {0, 2321, 0, 3}, {0, 2324, 0, 1},
+    {0, 2325, 0, 2}, {0, 2327, 0, 3}, {0, 2330, 0, 3}, {0, 2333, 0, 1},
+    {0, 2334, 0, 2}, {0, 1009, 0, 1}, {0, 986, 0, 1}, {0, 986, 0, 1},
+    {0, 986, 0, 1}, {0, 588, 0, 1}, {0, 2336, 0, 1}, {0, 987, 0, 1},
+    {0, 987, 0, 1}, {0, 990, 0, 1}, {0, 610, 0, 1}, {0, 992, 0, 1},
+    {0, 2337, 0, 2}, {0, 995, 0, 1}, {0, 2339, 0, 1}, {0, 996, 0, 1},
+    {0, 996, 0, 1}, {0, 996, 0, 1}, {0, 2340, 0, 2}, {0, 2342, 0, 3},
+    {0, 2345, 0, 2}, {0, 2347, 0, 1}, {2348, 2348, 1, 1}, {0, 2347, 0, 1},
+    {989, 989, 1, 1}, {34, 34, 2, 2}, {0, 981, 0, 1}, {0, 2324, 0, 1},
+    {0, 1005, 0, 1}, {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 991, 0, 1},
+    {0, 14, 0, 1}, {0, 2350, 0, 1}, {0, 2351, 0, 1}, {0, 2352, 0, 1},
+    {0, 2353, 0, 1}, {0, 1026, 0, 1}, {0, 2354, 0, 3}, {0, 678, 0, 1},
+    {0, 1023, 0, 1}, {0, 2357, 0, 1}, {0, 2358, 0, 1}, {0, 2359, 0, 1},
+    {0, 982, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1026, 0, 1},
+    {0, 590, 0, 1}, {0, 2360, 0, 3}, {0, 2363, 0, 3}, {0, 2366, 0, 3},
+    {0, 2369, 0, 3}, {0, 2372, 0, 3}, {0, 2375, 0, 3}, {0, 2378, 0, 3},
+    {0, 2381, 0, 3}, {0, 2384, 0, 3}, {0, 2387, 0, 3}, {0, 2390, 0, 3},
+    {0, 2393, 0, 3}, {0, 2396, 0, 2}, {0, 987, 0, 1}, {0, 2398, 0, 2},
+    {0, 2400, 0, 3}, {0, 2403, 0, 2}, {0, 2405, 0, 1}, {0, 2406, 0, 2},
+    {0, 2408, 0, 3}, {0, 2411, 0, 4}, {0, 2415, 0, 2}, {0, 2417, 0, 1},
+    {0, 2418, 0, 2}, {0, 2420, 0, 3}, {0, 990, 0, 1}, {0, 2324, 0, 1},
+    {0, 982, 0, 1}, {0, 991, 0, 1}, {0, 1026, 0, 1}, {0, 2423, 0, 2},
+    {0, 2425, 0, 3}, {0, 2428, 0, 2}, {0, 1021, 0, 1}, {0, 2430, 0, 2},
+    {0, 2432, 0, 3}, {0, 2435, 0, 4}, {0, 2439, 0, 2}, {0, 611, 0, 1},
+    {0, 2441, 0, 2}, {0, 2443, 0, 3}, {0, 610, 0, 1}, {0, 1029, 0, 1},
+    {0, 1004, 0, 1}, {0, 1011, 0, 1}, {2446, 2446, 2, 2}, {2448, 2448, 2, 2},
+    {2450, 2450, 2, 2}, {2452, 2452, 2, 2}, {2454, 2454, 2, 2}, {2456, 2456, 2, 2},
+    {2458, 2458, 2, 2}, {2460, 2460, 2, 2}, {2462, 2462, 2, 2}, {2464, 2464, 2, 2},
+    {2466, 2466, 2, 2}, {0, 2468, 0, 2}, {0, 2470, 0, 3}, {0, 2473, 0, 2},
+    {0, 2475, 0, 3}, {2478, 2478, 2, 2}, {2480, 2480, 2, 2}, {2482, 2482, 2, 2},
+    {2484, 2484, 2, 2}, {2486, 2486, 2, 2}, {2488, 2488, 2, 2}, {2490, 2490, 2, 2},
+    {2492, 2492, 2, 2}, {2494, 2494, 2, 2}, {2496, 2496, 2, 2}, {2498, 2498, 2, 2},
+    {2500, 2500, 2, 2}, {2502, 2502, 2, 2}, {2504, 2504, 2, 2}, {2506, 2506, 2, 2},
+    {2508, 2508, 2, 2}, {2510, 2510, 2, 2}, {2512, 2512, 2, 2}, {2514, 2514, 2, 2},
+    {2516, 2516, 2, 2}, {2518, 2518, 2, 2}, {2520, 2520, 2, 2}, {2522, 2522, 2, 2},
+    {2524, 2524, 2, 2}, {2526, 2526, 2, 2}, {2528, 2528, 2, 2}, {2530, 2530, 2, 2},
+    {2532, 2532, 2, 2}, {2534, 2534, 2, 2}, {2536, 2536, 2, 2}, {2538, 2538, 2, 2},
+    {2540, 2540, 2, 2}, {2542, 2542, 2, 2}, {2544, 2544, 1, 1}, {2545, 2545, 1, 1},
+    {0, 13, 0, 1}, {0, 6, 0, 1}, {0, 7, 0, 1}, {0, 2304, 0, 1},
+    {0, 2305, 0, 1}, {0, 2306, 0, 1}, {0, 2307, 0, 1}, {0, 2308, 0, 1},
+    {0, 2309, 0, 1}, {0, 2546, 0, 2}, {0, 2548, 0, 2}, {0, 2550, 0, 2},
+    {0, 2552, 0, 2}, {0, 2554, 0, 2}, {0, 2556, 0, 2}, {0, 2558, 0, 2},
+    {0, 2560, 0, 2}, {0, 2562, 0, 2}, {0, 2564, 0, 2}, {0, 2566, 0, 2},
+    {0, 2568, 0, 3}, {0, 2571, 0, 3}, {0, 2574, 0, 3}, {0, 2577, 0, 3},
+    {0, 2580, 0, 3}, {0, 2583, 0, 3}, {0, 2586, 0, 3}, {0, 2589, 0, 3},
+    {0, 2592, 0, 3}, {0, 2595, 0, 4}, {0, 2599, 0, 4}, {0, 2603, 0, 4},
+    {0, 2607, 0, 4}, {0, 2611, 0, 4}, {0, 2615, 0, 4}, {0, 2619, 0, 4},
+    {0, 2623, 0, 4}, {0, 2627, 0, 4}, {0, 2631, 0, 4}, {0, 2635, 0, 4},
+    {0, 2639, 0, 2}, {0, 2641, 0, 2}, {0, 2643, 0, 2}, {0, 2645, 0, 2},
+    {0, 2647, 0, 2}, {0, 2649, 0, 2}, {0, 2651, 0, 2}, {0, 2653, 0, 2},
+    {0, 2655, 0, 2}, {0, 2657, 0, 3}, {0, 2660, 0, 3}, {0, 2663, 0, 3},
+    {0, 2666, 0, 3}, {0, 2669, 0, 3}, {0, 2672, 0, 3}, {0, 2675, 0, 3},
+    {0, 2678, 0, 3}, {0, 2681, 0, 3}, {0, 2684, 0, 3}, {0, 2687, 0, 3},
+    {0, 2690, 0, 3}, {0, 2693, 0, 3}, {0, 2696, 0, 3}, {0, 2699, 0, 3},
+    {0, 2702, 0, 3}, {0, 2705, 0, 3}, {0, 2708, 0, 3}, {0, 2711, 0, 3},
+    {0, 2714, 0, 3}, {0, 2717, 0, 3}, {0, 2720, 0, 3}, {0, 2723, 0, 3},
+    {0, 2726, 0, 3}, {0, 2729, 0, 3}, {0, 2732, 0, 3}, {0, 2735, 0, 3},
+    {0, 2738, 0, 3}, {0, 2741, 0, 3}, {0, 2744, 0, 3}, {0, 2747, 0, 3},
+    {0, 2750, 0, 3}, {0, 2753, 0, 3}, {0, 2756, 0, 3}, {0, 2759, 0, 3},
+    {0, 2762, 0, 3}, {0, 2765, 0, 3}, {0, 979, 0, 1}, {0, 981, 0, 1},
+    {0, 2324, 0, 1}, {0, 982, 0, 1}, {0, 983, 0, 1}, {0, 2349, 0, 1},
+    {0, 985, 0, 1}, {0, 986, 0, 1}, {0, 987, 0, 1}, {0, 988, 0, 1},
+    {0, 989, 0, 1}, {0, 990, 0, 1}, {0, 991, 0, 1}, {0, 992, 0, 1},
+    {0, 993, 0, 1}, {0, 995, 0, 1}, {0, 2339, 0, 1}, {0, 996, 0, 1},
+    {0, 2768, 0, 1}, {0, 997, 0, 1}, {0, 998, 0, 1}, {0, 2405, 0, 1},
+    {0, 999, 0, 1}, {0, 2417, 0, 1}, {0, 2769, 0, 1}, {0, 2347, 0, 1},
+    {0, 3, 0, 1}, {0, 1003, 0, 1}, {0, 1029, 0, 1}, {0, 1004, 0, 1},
+    {0, 1005, 0, 1}, {0, 1032, 0, 1}, {0, 1009, 0, 1}, {0, 588, 0, 1},
+    {0, 1026, 0, 1}, {0, 590, 0, 1}, {0, 1010, 0, 1}, {0, 610, 0, 1},
+    {0, 1011, 0, 1}, {0, 2315, 0, 1}, {0, 14, 0, 1}, {0, 1016, 0, 1},
+    {0, 2770, 0, 1}, {0, 591, 0, 1}, {0, 356, 0, 1}, {0, 1017, 0, 1},
+    {0, 1018, 0, 1}, {0, 1021, 0, 1}, {0, 595, 0, 1}, {0, 611, 0, 1},
+    {0, 596, 0, 1}, {0, 1059, 0, 1}, {0, 2303, 0, 1}, {0, 2771, 0, 4},
+    {0, 2775, 0, 3}, {0, 2778, 0, 2}, {0, 2780, 0, 3}, {2783, 2783, 2, 2},
+    {0, 2785, 0, 1}, {0, 2786, 0, 1}, {0, 2787, 0, 1}, {0, 2788, 0, 1},
+    {0, 2789, 0, 1}, {0, 2790, 0, 1}, {0, 2791, 0, 1}, {0, 2792, 0, 1},
+    {0, 2793, 0, 1}, {0, 2794, 0, 1}, {0, 2795, 0, 1}, {0, 2796, 0, 1},
+    {0, 2797, 0, 1}, {0, 2798, 0, 1}, {0, 2799, 0, 1}, {0, 2800, 0, 1},
+    {0, 2801, 0, 1}, {0, 2802, 0, 1}, {0, 2803, 0, 1}, {0, 2804, 0, 1},
+    {0, 2805, 0, 1}, {0, 2806, 0, 1}, {0, 2807, 0, 1}, {0, 2808, 0, 1},
+    {0, 2809, 0, 1}, {0, 2810, 0, 1}, {0, 2811, 0, 1}, {0, 2812, 0, 1},
+    {0, 2813, 0, 1}, {0, 2814, 0, 1}, {0, 2815, 0, 1}, {0, 2816, 0, 1},
+    {0, 2817, 0, 1}, {0, 2818, 0, 1}, {0, 2819, 0, 1}, {0, 2820, 0, 1},
+    {0, 2821, 0, 1}, {0, 2822, 0, 1}, {0, 2823, 0, 1}, {0, 2824, 0, 1},
+    {0, 2825, 0, 1}, {0, 2826, 0, 1}, {0, 2827, 0, 1}, {0, 2828, 0, 1},
+    {0, 2829, 0, 1}, {0, 2830, 0, 1}, {0, 2831, 0, 1}, {0, 2832, 0, 1},
+    {0, 2833, 0, 1}, {0, 2834, 0, 1}, {0, 2835, 0, 1}, {0, 2836, 0, 1},
+    {0, 2837, 0, 1}, {0, 2838, 0, 1}, {0, 2839, 0, 1}, {0, 2840, 0, 1},
+    {0, 2841, 0, 1}, {0, 2842, 0, 1}, {0, 2843, 0, 1}, {0, 2844, 0, 1},
+    {0, 2845, 0, 1}, {0, 2846, 0, 1}, {0, 2847, 0, 1}, {0, 2848, 0, 1},
+    {0, 2849, 0, 1}, {0, 2850, 0, 1}, {0, 2851, 0, 1}, {0, 2852, 0, 1},
+    {0, 2853, 0, 1}, {0, 2854, 0, 1}, {0, 2855, 0, 1}, {0, 2856, 0, 1},
+    {0, 2857, 0, 1}, {0, 2858, 0, 1}, {0, 2859, 0, 1}, {0, 2860, 0, 1},
+    {0, 2861, 0, 1}, {0, 2862, 0, 1}, {0, 2863, 0, 1}, {0, 2864, 0, 1},
+    {0, 2865, 0, 1}, {0, 2866, 0, 1}, {0, 2867, 0, 1}, {0, 2868, 0, 1},
+    {0, 2869, 0, 1}, {0, 2870, 0, 1}, {0, 2871, 0, 1}, {0, 2872, 0, 1},
+    {0, 2873, 0, 1}, {0, 2874, 0, 1}, {0, 2875, 0, 1}, {0, 2876, 0, 1},
+    {0, 2877, 0, 1}, {0, 2878, 0, 1}, {0, 2879, 0, 1}, {0, 2880, 0, 1},
+    {0, 2881, 0, 1}, {0, 2882, 0, 1}, {0, 2883, 0, 1}, {0, 2884, 0, 1},
+    {0, 2885, 0, 1}, {0, 2886, 0, 1}, {0, 2887, 0, 1}, {0, 2888, 0, 1},
+    {0, 2889, 0, 1}, {0, 2890, 0, 1}, {0, 2891, 0, 1}, {0, 2892, 0, 1},
+    {0, 2893, 0, 1}, {0, 2894, 0, 1}, {0, 2895, 0, 1}, {0, 2896, 0, 1},
+    {0, 2897, 0, 1}, {0, 2898, 0, 1}, {0, 2899, 0, 1}, {0, 2900, 0, 1},
+    {0, 2901, 0, 1}, {0, 2902, 0, 1}, {0, 2903, 0, 1}, {0, 2904, 0, 1},
+    {0, 2905, 0, 1}, {0, 2906, 0, 1}, {0, 2907, 0, 1}, {0, 2908, 0, 1},
+    {0, 2909, 0, 1}, {0, 2910, 0, 1}, {0, 2911, 0, 1}, {0, 2912, 0, 1},
+    {0, 2913, 0, 1}, {0, 2914, 0, 1}, {0, 2915, 0, 1}, {0, 2916, 0, 1},
+    {0, 2917, 0, 1}, {0, 2918, 0, 1}, {0, 2919, 0, 1}, {0, 2920, 0, 1},
+    {0, 2921, 0, 1}, {0, 2922, 0, 1}, {0, 2923, 0, 1}, {0, 2924, 0, 1},
+    {0, 2925, 0, 1}, {0, 2926, 0, 1}, {0, 2927, 0, 1}, {0, 2928, 0, 1},
+    {0, 2929, 0, 1}, {0, 2930, 0, 1}, {0, 2931, 0, 1}, {0, 2932, 0, 1},
+    {0, 2933, 0, 1}, {0, 2934, 0, 1}, {0, 2935, 0, 1}, {0, 2936, 0, 1},
+    {0, 2937, 0, 1}, {0, 2938, 0, 1}, {0, 2939, 0, 1}, {0, 2940, 0, 1},
+    {0, 2941, 0, 1}, {0, 2942, 0, 1}, {0, 2943, 0, 1}, {0, 2944, 0, 1},
+    {0, 2945, 0, 1}, {0, 2946, 0, 1}, {0, 2947, 0, 1}, {0, 2948, 0, 1},
+    {0, 2949, 0, 1}, {0, 2950, 0, 1}, {0, 2951, 0, 1}, {0, 2952, 0, 1},
+    {0, 2953, 0, 1}, {0, 2954, 0, 1}, {0, 2955, 0, 1}, {0, 2956, 0, 1},
+    {0, 2957, 0, 1}, {0, 2958, 0, 1}, {0, 2959, 0, 1}, {0, 2960, 0, 1},
+    {0, 2961, 0, 1}, {0, 2962, 0, 1}, {0, 2963, 0, 1}, {0, 2964, 0, 1},
+    {0, 2965, 0, 1}, {0, 2966, 0, 1}, {0, 2967, 0, 1}, {0, 2968, 0, 1},
+    {0, 2969, 0, 1}, {0, 2970, 0, 1}, {0, 2971, 0, 1}, {0, 2972, 0, 1},
+    {0, 2973, 0, 1}, {0, 2974, 0, 1}, {0, 2975, 0, 1}, {0, 2976, 0, 1},
+    {0, 2977, 0, 1}, {0, 2978, 0, 1}, {0, 2979, 0, 1}, {0, 2980, 0, 1},
+    {0, 2981, 0, 1}, {0, 2982, 0, 1}, {0, 2983, 0, 1}, {0, 2984, 0, 1},
+    {0, 2985, 0, 1}, {0, 2986, 0, 1}, {0, 2987, 0, 1}, {0, 2988, 0, 1},
+    {0, 2989, 0, 1}, {0, 2990, 0, 1}, {0, 2991, 0, 1}, {0, 2992, 0, 1},
+    {0, 2993, 0, 1}, {0, 2994, 0, 1}, {0, 2995, 0, 1}, {0, 2996, 0, 1},
+    {0, 2997, 0, 1}, {0, 2998, 0, 1}, {0, 2999, 0, 1}, {0, 3000, 0, 1},
+    {0, 3001, 0, 1}, {0, 0, 0, 1}, {0, 3002, 0, 1}, {0, 2811, 0, 1},
+    {0, 3003, 0, 1}, {0, 3004, 0, 1}, {3005, 3005, 2, 2}, {3007, 3007, 2, 2},
+    {3009, 3009, 2, 2}, {3011, 3011, 2, 2}, {3013, 3013, 2, 2}, {3015, 3015, 2, 2},
+    {3017, 3017, 2, 2}, {3019, 3019, 2, 2}, {3021, 3021, 2, 2}, {3023, 3023, 2, 2},
+    {3025, 3025, 2, 2}, {3027, 3027, 2, 2}, {3029, 3029, 2, 2}, {3031, 3031, 2, 2},
+    {3033, 3033, 2, 2}, {3035, 3035, 2, 2}, {3037, 3037, 2, 2}, {3039, 3039, 2, 2},
+    {3041, 3041, 2, 2}, {3043, 3043, 2, 2}, {3045, 3045, 2, 2}, {3047, 3047, 2, 2},
+    {3049, 3049, 2, 2}, {3051, 3051, 2, 2}, {3053, 3053, 2, 2}, {3055, 3055, 2, 2},
+    {0, 3057, 0, 2}, {0, 3059, 0, 2}, {3061, 3061, 2, 2}, {0, 3063, 0, 2},
+    {3065, 3065, 2, 2}, {3067, 3067, 2, 2}, {3069, 3069, 2, 2}, {3071, 3071, 2, 2},
+    {3073, 3073, 2, 2}, {3075, 3075, 2, 2}, {3077, 3077, 2, 2}, {3079, 3079, 2, 2},
+    {3081, 3081, 2, 2}, {3083, 3083, 2, 2}, {3085, 3085, 2, 2}, {3087, 3087, 2, 2},
+    {3089, 3089, 2, 2}, {3091, 3091, 2, 2}, {3093, 3093, 2, 2}, {3095, 3095, 2, 2},
+    {3097, 3097, 2, 2}, {3099, 3099, 2, 2}, {3101, 3101, 2, 2}, {3103, 3103, 2, 2},
+    {3105, 3105, 2, 2}, {3107, 3107, 2, 2}, {3109, 3109, 2, 2}, {3111, 3111, 2, 2},
+    {3113, 3113, 2, 2}, {3115, 3115, 2, 2}, {3117, 3117, 2, 2}, {3119, 3119, 2, 2},
+    {3121, 3121, 2, 2}, {3123, 3123, 2, 2}, {3125, 3125, 2, 2}, {0, 3127, 0, 2},
+    {0, 3129, 0, 1}, {0, 3130, 0, 1}, {0, 3131, 0, 1}, {0, 3132, 0, 1},
+    {0, 3133, 0, 1}, {0, 3134, 0, 1}, {0, 3135, 0, 1}, {0, 3136, 0, 1},
+    {0, 3137, 0, 1}, {0, 3138, 0, 1}, {0, 3139, 0, 1}, {0, 3140, 0, 1},
+    {0, 3141, 0, 1}, {0, 3142, 0, 1}, {0, 3143, 0, 1}, {0, 3144, 0, 1},
+    {0, 3145, 0, 1}, {0, 3146, 0, 1}, {0, 3147, 0, 1}, {0, 3148, 0, 1},
+    {0, 3149, 0, 1}, {0, 3150, 0, 1}, {0, 3151, 0, 1}, {0, 3152, 0, 1},
+    {0, 3153, 0, 1}, {0, 3154, 0, 1}, {0, 3155, 0, 1}, {0, 3156, 0, 1},
+    {0, 3157, 0, 1}, {0, 3158, 0, 1}, {0, 3159, 0, 1}, {0, 3160, 0, 1},
+    {0, 3161, 0, 1}, {0, 3162, 0, 1}, {0, 3163, 0, 1}, {0, 3164, 0, 1},
+    {0, 3165, 0, 1}, {0, 3166, 0, 1}, {0, 3167, 0, 1}, {0, 3168, 0, 1},
+    {0, 3169, 0, 1}, {0, 3170, 0, 1}, {0, 3171, 0, 1}, {0, 3172, 0, 1},
+    {0, 3173, 0, 1}, {0, 3174, 0, 1}, {0, 3175, 0, 1}, {0, 3176, 0, 1},
+    {0, 3177, 0, 1}, {0, 3178, 0, 1}, {0, 3179, 0, 1}, {0, 3180, 0, 1},
+    {0, 3181, 0, 1}, {0, 3182, 0, 1}, {0, 3183, 0, 1}, {0, 3184, 0, 1},
+    {0, 3185, 0, 1}, {0, 3186, 0, 1}, {0, 3187, 0, 1}, {0, 3188, 0, 1},
+    {0, 3189, 0, 1}, {0, 3190, 0, 1}, {0, 3191, 0, 1}, {0, 3192, 0, 1},
+    {0, 3193, 0, 1}, {0, 3194, 0, 1}, {0, 3195, 0, 1}, {0, 3196, 0, 1},
+    {0, 3197, 0, 1}, {0, 3198, 0, 1}, {0, 3199, 0, 1}, {0, 3200, 0, 1},
+    {0, 3201, 0, 1}, {0, 3202, 0, 1}, {0, 3203, 0, 1}, {0, 3204, 0, 1},
+    {0, 3205, 0, 1}, {0, 3206, 0, 1}, {0, 3207, 0, 1}, {0, 3208, 0, 1},
+    {0, 3209, 0, 1}, {0, 3210, 0, 1}, {0, 3211, 0, 1}, {0, 3212, 0, 1},
+    {0, 3213, 0, 1}, {0, 3214, 0, 1}, {0, 3215, 0, 1}, {0, 3216, 0, 1},
+    {0, 3217, 0, 1}, {0, 3218, 0, 1}, {0, 3219, 0, 1}, {0, 3220, 0, 1},
+    {0, 3221, 0, 1}, {0, 3222, 0, 1}, {0, 2788, 0, 1}, {0, 2794, 0, 1},
+    {0, 3223, 0, 1}, {0, 3224, 0, 1}, {0, 3225, 0, 1}, {0, 3226, 0, 1},
+    {0, 3227, 0, 1}, {0, 3228, 0, 1}, {0, 2792, 0, 1}, {0, 3229, 0, 1},
+    {0, 3230, 0, 1}, {0, 3231, 0, 1}, {0, 3232, 0, 1}, {0, 2796, 0, 1},
+    {0, 3233, 0, 3}, {0, 3236, 0, 3}, {0, 3239, 0, 3}, {0, 3242, 0, 3},
+    {0, 3245, 0, 3}, {0, 3248, 0, 3}, {0, 3251, 0, 3}, {0, 3254, 0, 3},
+    {0, 3257, 0, 3}, {0, 3260, 0, 3}, {0, 3263, 0, 3}, {0, 3266, 0, 3},
+    {0, 3269, 0, 3}, {0, 3272, 0, 3}, {0, 3275, 0, 4}, {0, 3279, 0, 4},
+    {0, 3283, 0, 4}, {0, 3287, 0, 4}, {0, 3291, 0, 4}, {0, 3295, 0, 4},
+    {0, 3299, 0, 4}, {0, 3303, 0, 4}, {0, 3307, 0, 4}, {0, 3311, 0, 4},
+    {0, 3315, 0, 4}, {0, 3319, 0, 4}, {0, 3323, 0, 4}, {0, 3327, 0, 4},
+    {0, 3331, 0, 4}, {0, 3335, 0, 7}, {0, 3342, 0, 6}, {0, 3348, 0, 3},
+    {0, 3351, 0, 3}, {0, 3354, 0, 3}, {0, 3357, 0, 3}, {0, 3360, 0, 3},
+    {0, 3363, 0, 3}, {0, 3366, 0, 3}, {0, 3369, 0, 3}, {0, 3372, 0, 3},
+    {0, 3375, 0, 3}, {0, 3378, 0, 3}, {0, 3381, 0, 3}, {0, 3384, 0, 3},
+    {0, 3387, 0, 3}, {0, 3390, 0, 3}, {0, 3393, 0, 3}, {0, 3396, 0, 3},
+    {0, 3399, 0, 3}, {0, 3402, 0, 3}, {0, 3405, 0, 3}, {0, 3408, 0, 3},
+    {0, 3411, 0, 3}, {0, 3414, 0, 3}, {0, 3417, 0, 3}, {0, 3420, 0, 3},
+    {0, 3423, 0, 3}, {0, 3426, 0, 3}, {0, 3429, 0, 3}, {0, 3432, 0, 3},
+    {0, 3435, 0, 3}, {0, 3438, 0, 3}, {0, 3441, 0, 3}, {0, 3444, 0, 3},
+    {0, 3447, 0, 3}, {0, 3450, 0, 3}, {0, 3453, 0, 3}, {0, 3456, 0, 3},
+    {0, 3459, 0, 2}, {0, 3461, 0, 2}, {0, 3463, 0, 2}, {0, 3465, 0, 2},
+    {0, 3467, 0, 2}, {0, 3469, 0, 2}, {0, 3471, 0, 2}, {0, 3473, 0, 2},
+    {0, 3475, 0, 2}, {0, 3477, 0, 2}, {0, 3479, 0, 2}, {0, 3481, 0, 2},
+    {0, 3483, 0, 2}, {0, 3485, 0, 2}, {0, 3487, 0, 2}, {0, 3129, 0, 1},
+    {0, 3132, 0, 1}, {0, 3135, 0, 1}, {0, 3137, 0, 1}, {0, 3145, 0, 1},
+    {0, 3146, 0, 1}, {0, 3149, 0, 1}, {0, 3151, 0, 1}, {0, 3152, 0, 1},
+    {0, 3154, 0, 1}, {0, 3155, 0, 1}, {0, 3156, 0, 1}, {0, 3157, 0, 1},
+    {0, 3158, 0, 1}, {0, 3489, 0, 2}, {0, 3491, 0, 2}, {0, 3493, 0, 2},
+    {0, 3495, 0, 2}, {0, 3497, 0, 2}, {0, 3499, 0, 2}, {0, 3501, 0, 2},
+    {0, 3503, 0, 2}, {0, 3505, 0, 2}, {0, 3507, 0, 2}, {0, 3509, 0, 2},
+    {0, 3511, 0, 2}, {0, 3513, 0, 2}, {0, 3515, 0, 2}, {0, 3517, 0, 5},
+    {0, 3522, 0, 4}, {0, 3526, 0, 2}, {0, 2788, 0, 1}, {0, 2794, 0, 1},
+    {0, 3223, 0, 1}, {0, 3224, 0, 1}, {0, 3528, 0, 1}, {0, 3529, 0, 1},
+    {0, 3530, 0, 1}, {0, 2799, 0, 1}, {0, 3531, 0, 1}, {0, 2811, 0, 1},
+    {0, 2861, 0, 1}, {0, 2873, 0, 1}, {0, 2872, 0, 1}, {0, 2862, 0, 1},
+    {0, 2954, 0, 1}, {0, 2819, 0, 1}, {0, 2859, 0, 1}, {0, 3532, 0, 1},
+    {0, 3533, 0, 1}, {0, 3534, 0, 1}, {0, 3535, 0, 1}, {0, 3536, 0, 1},
+    {0, 3537, 0, 1}, {0, 3538, 0, 1}, {0, 3539, 0, 1}, {0, 3540, 0, 1},
+    {0, 3541, 0, 1}, {0, 2825, 0, 1}, {0, 3542, 0, 1}, {0, 3543, 0, 1},
+    {0, 3544, 0, 1}, {0, 3545, 0, 1}, {0, 3546, 0, 1}, {0, 3547, 0, 1},
+    {0, 3548, 0, 1}, {0, 3549, 0, 1}, {0, 3225, 0, 1}, {0, 3226, 0, 1},
+    {0, 3227, 0, 1}, {0, 3550, 0, 1}, {0, 3551, 0, 1}, {0, 3552, 0, 1},
+    {0, 3553, 0, 1}, {0, 3554, 0, 1}, {0, 3555, 0, 1}, {0, 3556, 0, 1},
+    {0, 3557, 0, 1}, {0, 3558, 0, 1}, {0, 3559, 0, 1}, {0, 3560, 0, 2},
+    {0, 3562, 0, 2}, {0, 3564, 0, 2}, {0, 3566, 0, 2}, {0, 3568, 0, 2},
+    {0, 3570, 0, 2}, {0, 3572, 0, 2}, {0, 3574, 0, 2}, {0, 3576, 0, 2},
+    {0, 3578, 0, 2}, {0, 3580, 0, 2}, {0, 3582, 0, 2}, {0, 3584, 0, 2},
+    {0, 3586, 0, 2}, {0, 3588, 0, 2}, {0, 3590, 0, 2}, {0, 3592, 0, 2},
+    {0, 3594, 0, 2}, {0, 3596, 0, 2}, {0, 3598, 0, 2}, {0, 3600, 0, 2},
+    {0, 3602, 0, 2}, {0, 3604, 0, 2}, {0, 3606, 0, 2}, {0, 3608, 0, 3},
+    {0, 3611, 0, 3}, {0, 3614, 0, 3}, {0, 3617, 0, 2}, {0, 3619, 0, 3},
+    {0, 3622, 0, 2}, {0, 3624, 0, 3}, {0, 3627, 0, 1}, {0, 3628, 0, 1},
+    {0, 3629, 0, 1}, {0, 3630, 0, 1}, {0, 3631, 0, 1}, {0, 3632, 0, 1},
+    {0, 3633, 0, 1}, {0, 3634, 0, 1}, {0, 3635, 0, 1}, {0, 3636, 0, 1},
+    {0, 3637, 0, 1}, {0, 3638, 0, 1}, {0, 3639, 0, 1}, {0, 3640, 0, 1},
+    {0, 3641, 0, 1}, {0, 3642, 0, 1}, {0, 3643, 0, 1}, {0, 3644, 0, 1},
+    {0, 3645, 0, 1}, {0, 3646, 0, 1}, {0, 3647, 0, 1}, {0, 3648, 0, 1},
+    {0, 3649, 0, 1}, {0, 3650, 0, 1}, {0, 3651, 0, 1}, {0, 3652, 0, 1},
+    {0, 3653, 0, 1}, {0, 3654, 0, 1}, {0, 3655, 0, 1}, {0, 3656, 0, 1},
+    {0, 3657, 0, 1}, {0, 3658, 0, 1}, {0, 3659, 0, 1}, {0, 3660, 0, 1},
+    {0, 3661, 0, 1}, {0, 3662, 0, 1}, {0, 3663, 0, 1}, {0, 3664, 0, 1},
+    {0, 3665, 0, 1}, {0, 3666, 0, 1}, {0, 3667, 0, 1}, {0, 3668, 0, 1},
+    {0, 3669, 0, 1}, {0, 3670, 0, 1}, {0, 3671, 0, 1}, {0, 3672, 0, 1},
+    {0, 3673, 0, 1}, {0, 3674, 0, 5}, {0, 3679, 0, 4}, {0, 3683, 0, 5},
+    {0, 3688, 0, 3}, {0, 3691, 0, 5}, {0, 3696, 0, 3}, {0, 3699, 0, 3},
+    {0, 3702, 0, 6}, {0, 3708, 0, 4}, {0, 3712, 0, 3}, {0, 3715, 0, 3},
+    {0, 3718, 0, 3}, {0, 3721, 0, 4}, {0, 3725, 0, 4}, {0, 3729, 0, 4},
+    {0, 3733, 0, 4}, {0, 3737, 0, 4}, {0, 3741, 0, 4}, {0, 3745, 0, 4},
+    {0, 3749, 0, 6}, {0, 3755, 0, 2}, {0, 3757, 0, 6}, {0, 3763, 0, 6},
+    {0, 3769, 0, 5}, {0, 3774, 0, 4}, {0, 3778, 0, 6}, {0, 3784, 0, 6},
+    {0, 3790, 0, 4}, {0, 3794, 0, 3}, {0, 3797, 0, 3}, {0, 3800, 0, 4},
+    {0, 3804, 0, 4}, {0, 3808, 0, 5}, {0, 3813, 0, 5}, {0, 3818, 0, 3},
+    {0, 3821, 0, 3}, {0, 3824, 0, 4}, {0, 3828, 0, 3}, {0, 3831, 0, 3},
+    {0, 3834, 0, 2}, {0, 3836, 0, 2}, {0, 3838, 0, 3}, {0, 3841, 0, 3},
+    {0, 3844, 0, 6}, {0, 3850, 0, 4}, {0, 3854, 0, 5}, {0, 3859, 0, 6},
+    {0, 3865, 0, 4}, {0, 3869, 0, 3}, {0, 3872, 0, 3}, {0, 3875, 0, 6},
+    {0, 3881, 0, 4}, {0, 3885, 0, 6}, {0, 3891, 0, 3}, {0, 3894, 0, 5},
+    {0, 3899, 0, 3}, {0, 3902, 0, 4}, {0, 3906, 0, 3}, {0, 3909, 0, 4},
+    {0, 3913, 0, 5}, {0, 3918, 0, 4}, {0, 3922, 0, 5}, {0, 3927, 0, 4},
+    {0, 3931, 0, 2}, {0, 3933, 0, 5}, {0, 3938, 0, 3}, {0, 3941, 0, 3},
+    {0, 3944, 0, 4}, {0, 3948, 0, 3}, {0, 3951, 0, 3}, {0, 3954, 0, 3},
+    {0, 3957, 0, 5}, {0, 3962, 0, 4}, {0, 3966, 0, 2}, {0, 3968, 0, 6},
+    {0, 3974, 0, 3}, {0, 3977, 0, 5}, {0, 3982, 0, 4}, {0, 3986, 0, 4},
+    {0, 3990, 0, 3}, {0, 3993, 0, 3}, {0, 3996, 0, 4}, {0, 4000, 0, 2},
+    {0, 4002, 0, 4}, {0, 4006, 0, 5}, {0, 4011, 0, 2}, {0, 4013, 0, 6},
+    {0, 4019, 0, 3}, {0, 4022, 0, 2}, {0, 4024, 0, 2}, {0, 4026, 0, 2},
+    {0, 4028, 0, 2}, {0, 4030, 0, 2}, {0, 4032, 0, 2}, {0, 4034, 0, 2},
+    {0, 4036, 0, 2}, {0, 4038, 0, 2}, {0, 4040, 0, 2}, {0, 4042, 0, 3},
+    {0, 4045, 0, 3}, {0, 4048, 0, 3}, {0, 4051, 0, 3}, {0, 4054, 0, 3},
+    {0, 4057, 0, 3}, {0, 4060, 0, 3}, {0, 4063, 0, 3}, {0, 4066, 0, 3},
+    {0, 4069, 0, 3}, {0, 4072, 0, 3}, {0, 4075, 0, 3}, {0, 4078, 0, 3},
+    {0, 4081, 0, 3}, {0, 4084, 0, 3}, {0, 4087, 0, 3}, {0, 4090, 0, 2},
+    {0, 4092, 0, 2}, {0, 4094, 0, 3}, {0, 4097, 0, 2}, {0, 4099, 0, 2},
+    {0, 4101, 0, 2}, {0, 4103, 0, 3}, {0, 4106, 0, 3}, {0, 4109, 0, 2},
+    {0, 4111, 0, 2}, {0, 4113, 0, 2}, {0, 4115, 0, 2}, {0, 4117, 0, 2},
+    {0, 4119, 0, 4}, {0, 4123, 0, 2}, {0, 4125, 0, 2}, {0, 4127, 0, 2},
+    {0, 4129, 0, 2}, {0, 4131, 0, 2}, {0, 4133, 0, 2}, {0, 4135, 0, 2},
+    {0, 4137, 0, 2}, {0, 4139, 0, 3}, {0, 4142, 0, 4}, {0, 4146, 0, 2},
+    {0, 4148, 0, 2}, {0, 4150, 0, 2}, {0, 4152, 0, 2}, {0, 4154, 0, 2},
+    {0, 4156, 0, 2}, {0, 4158, 0, 2}, {0, 4160, 0, 3}, {0, 4163, 0, 3},
+    {0, 4166, 0, 3}, {0, 4169, 0, 3}, {0, 4172, 0, 2}, {0, 4174, 0, 2},
+    {0, 4176, 0, 2}, {0, 4178, 0, 2}, {0, 4180, 0, 2}, {0, 4182, 0, 2},
+    {0, 4184, 0, 2}, {0, 4186, 0, 2}, {0, 4188, 0, 2}, {0, 4190, 0, 2},
+    {0, 4192, 0, 3}, {0, 4195, 0, 3}, {0, 4198, 0, 2}, {0, 4200, 0, 3},
+    {0, 4203, 0, 3}, {0, 4206, 0, 3}, {0, 4209, 0, 2}, {0, 4211, 0, 3},
+    {0, 4214, 0, 3}, {0, 4217, 0, 4}, {0, 4221, 0, 2}, {0, 4223, 0, 3},
+    {0, 4226, 0, 3}, {0, 4229, 0, 3}, {0, 4232, 0, 3}, {0, 4235, 0, 5},
+    {0, 4240, 0, 6}, {0, 4246, 0, 2}, {0, 4248, 0, 2}, {0, 4250, 0, 2},
+    {0, 4252, 0, 2}, {0, 4254, 0, 2}, {0, 4256, 0, 2}, {0, 4258, 0, 2},
+    {0, 4260, 0, 2}, {0, 4262, 0, 2}, {0, 4264, 0, 2}, {0, 4266, 0, 2},
+    {0, 4268, 0, 2}, {0, 4270, 0, 2}, {0, 4272, 0, 2}, {0, 4274, 0, 2},
+    {0, 4276, 0, 2}, {0, 4278, 0, 2}, {0, 4280, 0, 2}, {0, 4282, 0, 4},
+    {0, 4286, 0, 2}, {0, 4288, 0, 2}, {0, 4290, 0, 2}, {0, 4292, 0, 4},
+    {0, 4296, 0, 3}, {0, 4299, 0, 2}, {0, 4301, 0, 2}, {0, 4303, 0, 2},
+    {0, 4305, 0, 2}, {0, 4307, 0, 2}, {0, 4309, 0, 2}, {0, 4311, 0, 2},
+    {0, 4313, 0, 2}, {0, 4315, 0, 2}, {0, 4317, 0, 2}, {0, 4319, 0, 3},
+    {0, 4322, 0, 2}, {0, 4324, 0, 2}, {0, 4326, 0, 3}, {0, 4329, 0, 3},
+    {0, 4332, 0, 2}, {0, 4334, 0, 4}, {0, 4338, 0, 3}, {0, 4341, 0, 2},
+    {0, 4343, 0, 2}, {0, 4345, 0, 2}, {0, 4347, 0, 2}, {0, 4349, 0, 3},
+    {0, 4352, 0, 3}, {0, 4355, 0, 2}, {0, 4357, 0, 2}, {0, 4359, 0, 2},
+    {0, 4361, 0, 2}, {0, 4363, 0, 2}, {0, 4365, 0, 2}, {0, 4367, 0, 2},
+    {0, 4369, 0, 2}, {0, 4371, 0, 2}, {0, 4373, 0, 3}, {0, 4376, 0, 3},
+    {0, 4379, 0, 3}, {0, 4382, 0, 3}, {0, 4385, 0, 3}, {0, 4388, 0, 3},
+    {0, 4391, 0, 3}, {0, 4394, 0, 3}, {0, 4397, 0, 3}, {0, 4400, 0, 3},
+    {0, 4403, 0, 3}, {0, 4406, 0, 3}, {0, 4409, 0, 3}, {0, 4412, 0, 3},
+    {0, 4415, 0, 3}, {0, 4418, 0, 3}, {0, 4421, 0, 3}, {0, 4424, 0, 3},
+    {0, 4427, 0, 3}, {0, 4430, 0, 3}, {0, 4433, 0, 3}, {0, 4436, 0, 3},
+    {0, 4439, 0, 3}, {4442, 4442, 1, 1}, {4443, 4443, 1, 1}, {2946, 2946, 1, 1},
+    {4444, 4444, 1, 1}, {4445, 4445, 1, 1}, {4446, 4446, 1, 1}, {4447, 4447, 1, 1},
+    {3000, 3000, 1, 1}, {3000, 3000, 1, 1}, {4448, 4448, 1, 1}, {2954, 2954, 1, 1},
+    {4449, 4449, 1, 1}, {4450, 4450, 1, 1}, {4451, 4451, 1, 1}, {4452, 4452, 1, 1},
+    {4453, 4453, 1, 1}, {4454, 4454, 1, 1}, {4455, 4455, 1, 1}, {4456, 4456, 1, 1},
+    {4457, 4457, 1, 1}, {4458, 4458, 1, 1}, {4459, 4459, 1, 1}, {4460, 4460, 1, 1},
+    {4461, 4461, 1, 1}, {4462, 4462, 1, 1}, {4463, 4463, 1, 1}, {4464, 4464, 1, 1},
+    {4465, 4465, 1, 1}, {4466, 4466, 1, 1}, {4467, 4467, 1, 1}, {4468, 4468, 1, 1},
+    {4469, 4469, 1, 1}, {4470, 4470, 1, 1}, {4471, 4471, 1, 1}, {4472, 4472, 1, 1},
+    {4473, 4473, 1, 1}, {4474, 4474, 1, 1}, {4475, 4475, 1, 1}, {4476, 4476, 1, 1},
+    {4477, 4477, 1, 1}, {4478, 4478, 1, 1}, {4479, 4479, 1, 1}, {4480, 4480, 1, 1},
+    {4481, 4481, 1, 1}, {4482, 4482, 1, 1}, {4483, 4483, 1, 1}, {4484, 4484, 1, 1},
+    {4485, 4485, 1, 1}, {4486, 4486, 1, 1}, {4487, 4487, 1, 1}, {4488, 4488, 1, 1},
+    {4489, 4489, 1, 1}, {2912, 2912, 1, 1}, {4490, 4490, 1, 1}, {4491, 4491, 1, 1},
+    {4492, 4492, 1, 1}, {4493, 4493, 1, 1}, {4494, 4494, 1, 1}, {4495, 4495, 1, 1},
+    {4496, 4496, 1, 1}, {4497, 4497, 1, 1}, {4498, 4498, 1, 1}, {4499, 4499, 1, 1},
+    {4500, 4500, 1, 1}, {2985, 2985, 1, 1}, {4501, 4501, 1, 1}, {4502, 4502, 1, 1},
+    {4503, 4503, 1, 1}, {4504, 4504, 1, 1}, {4505, 4505, 1, 1}, {4506, 4506, 1, 1},
+    {4507, 4507, 1, 1}, {4508, 4508, 1, 1}, {4509, 4509, 1, 1}, {4510, 4510, 1, 1},
+    {4511, 4511, 1, 1}, {4512, 4512, 1, 1}, {4513, 4513, 1, 1}, {4514, 4514, 1, 1},
+    {4515, 4515, 1, 1}, {4516, 4516, 1, 1}, {4517, 4517, 1, 1}, {4518, 4518, 1, 1},
+    {4519, 4519, 1, 1}, {4520, 4520, 1, 1}, {4521, 4521, 1, 1}, {4522, 4522, 1, 1},
+    {4523, 4523, 1, 1}, {4524, 4524, 1, 1}, {4525, 4525, 1, 1}, {4526, 4526, 1, 1},
+    {4527, 4527, 1, 1}, {4458, 4458, 1, 1}, {4528, 4528, 1, 1}, {4529, 4529, 1, 1},
+    {4530, 4530, 1, 1}, {4531, 4531, 1, 1}, {4532, 4532, 1, 1}, {4533, 4533, 1, 1},
+    {4534, 4534, 1, 1}, {4535, 4535, 1, 1}, {4536, 4536, 1, 1}, {4537, 4537, 1, 1},
+    {4538, 4538, 1, 1}, {4539, 4539, 1, 1}, {4540, 4540, 1, 1}, {4541, 4541, 1, 1},
+    {4542, 4542, 1, 1}, {4543, 4543, 1, 1}, {4544, 4544, 1, 1}, {4545, 4545, 1, 1},
+    {4546, 4546, 1, 1}, {4547, 4547, 1, 1}, {2948, 2948, 1, 1}, {4548, 4548, 1, 1},
+    {4549, 4549, 1, 1}, {4550, 4550, 1, 1}, {4551, 4551, 1, 1}, {4552, 4552, 1, 1},
+    {4553, 4553, 1, 1}, {4554, 4554, 1, 1}, {4555, 4555, 1, 1}, {4556, 4556, 1, 1},
+    {4557, 4557, 1, 1}, {4558, 4558, 1, 1}, {4559, 4559, 1, 1}, {4560, 4560, 1, 1},
+    {4561, 4561, 1, 1}, {4562, 4562, 1, 1}, {2825, 2825, 1, 1}, {4563, 4563, 1, 1},
+    {4564, 4564, 1, 1}, {4565, 4565, 1, 1}, {4566, 4566, 1, 1}, {4567, 4567, 1, 1},
+    {4568, 4568, 1, 1}, {4569, 4569, 1, 1}, {4570, 4570, 1, 1}, {2806, 2806, 1, 1},
+    {4571, 4571, 1, 1}, {4572, 4572, 1, 1}, {4573, 4573, 1, 1}, {4574, 4574, 1, 1},
+    {4575, 4575, 1, 1}, {4576, 4576, 1, 1}, {4577, 4577, 1, 1}, {4578, 4578, 1, 1},
+    {4579, 4579, 1, 1}, {4580, 4580, 1, 1}, {4581, 4581, 1, 1}, {4582, 4582, 1, 1},
+    {4583, 4583, 1, 1}, {4584, 4584, 1, 1}, {4585, 4585, 1, 1}, {4586, 4586, 1, 1},
+    {4587, 4587, 1, 1}, {4588, 4588, 1, 1}, {4589, 4589, 1, 1}, {4590, 4590, 1, 1},
+    {4591, 4591, 1, 1}, {4592, 4592, 1, 1}, {4546, 4546, 1, 1}, {4593, 4593, 1, 1},
+    {4594, 4594, 1, 1}, {4595, 4595, 1, 1}, {4596, 4596, 1, 1}, {4597, 4597, 1, 1},
+    {4598, 4598, 1, 1}, {4599, 4599, 1, 1}, {4600, 4600, 1, 1}, {4530, 4530, 1, 1},
+    {4601, 4601, 1, 1}, {4602, 4602, 1, 1}, {4603, 4603, 1, 1}, {4604, 4604, 1, 1},
+    {4605, 4605, 1, 1}, {4606, 4606, 1, 1}, {4607, 4607, 1, 1}, {4608, 4608, 1, 1},
+    {4609, 4609, 1, 1}, {4610, 4610, 1, 1}, {4611, 4611, 1, 1}, {4612, 4612, 1, 1},
+    {4613, 4613, 1, 1}, {4614, 4614, 1, 1}, {4615, 4615, 1, 1}, {4616, 4616, 1, 1},
+    {4617, 4617, 1, 1}, {4618, 4618, 1, 1}, {4619, 4619, 1, 1}, {4620, 4620, 1, 1},
+    {4458, 4458, 1, 1}, {4621, 4621, 1, 1}, {4622, 4622, 1, 1}, {4623, 4623, 1, 1},
+    {4624, 4624, 1, 1}, {2999, 2999, 1, 1}, {4625, 4625, 1, 1}, {4626, 4626, 1, 1},
+    {4627, 4627, 1, 1}, {4628, 4628, 1, 1}, {4629, 4629, 1, 1}, {4630, 4630, 1, 1},
+    {4631, 4631, 1, 1}, {4632, 4632, 1, 1}, {4633, 4633, 1, 1}, {4634, 4634, 1, 1},
+    {4635, 4635, 1, 1}, {4636, 4636, 1, 1}, {3529, 3529, 1, 1}, {4637, 4637, 1, 1},
+    {4638, 4638, 1, 1}, {4639, 4639, 1, 1}, {4640, 4640, 1, 1}, {4641, 4641, 1, 1},
+    {4642, 4642, 1, 1}, {4643, 4643, 1, 1}, {4644, 4644, 1, 1}, {4645, 4645, 1, 1},
+    {4532, 4532, 1, 1}, {4646, 4646, 1, 1}, {4647, 4647, 1, 1}, {4648, 4648, 1, 1},
+    {4649, 4649, 1, 1}, {4650, 4650, 1, 1}, {4651, 4651, 1, 1}, {4652, 4652, 1, 1},
+    {4653, 4653, 1, 1}, {4654, 4654, 1, 1}, {4655, 4655, 1, 1}, {4656, 4656, 1, 1},
+    {4657, 4657, 1, 1}, {4658, 4658, 1, 1}, {2953, 2953, 1, 1}, {4659, 4659, 1, 1},
+    {4660, 4660, 1, 1}, {4661, 4661, 1, 1}, {4662, 4662, 1, 1}, {4663, 4663, 1, 1},
+    {4664, 4664, 1, 1}, {4665, 4665, 1, 1}, {4666, 4666, 1, 1}, {4667, 4667, 1, 1},
+    {4668, 4668, 1, 1}, {4669, 4669, 1, 1}, {4670, 4670, 1, 1}, {4671, 4671, 1, 1},
+    {2904, 2904, 1, 1}, {4672, 4672, 1, 1}, {4673, 4673, 1, 1}, {4674, 4674, 1, 1},
+    {4675, 4675, 1, 1}, {4676, 4676, 1, 1}, {4677, 4677, 1, 1}, {4678, 4678, 1, 1},
+    {4679, 4679, 1, 1}, {4680, 4680, 1, 1}, {4681, 4681, 1, 1}, {4682, 4682, 1, 1},
+    {4683, 4683, 1, 1}, {4684, 4684, 1, 1}, {4685, 4685, 1, 1}, {4686, 4686, 1, 1},
+    {4687, 4687, 1, 1}, {2931, 2931, 1, 1}, {4688, 4688, 1, 1}, {2934, 2934, 1, 1},
+    {4689, 4689, 1, 1}, {4690, 4690, 1, 1}, {4691, 4691, 1, 1}, {4692, 4692, 1, 1},
+    {4693, 4693, 1, 1}, {4694, 4694, 1, 1}, {4695, 4695, 1, 1}, {4696, 4696, 1, 1},
+    {4697, 4697, 1, 1}, {4698, 4698, 1, 1}, {4699, 4699, 1, 1}, {4700, 4700, 1, 1},
+    {4701, 4701, 1, 1}, {4702, 4702, 1, 1}, {2911, 2911, 1, 1}, {4703, 4703, 1, 1},
+    {4704, 4704, 1, 1}, {4705, 4705, 1, 1}, {4706, 4706, 1, 1}, {4707, 4707, 1, 1},
+    {4708, 4708, 1, 1}, {4709, 4709, 1, 1}, {4710, 4710, 1, 1}, {4711, 4711, 1, 1},
+    {4712, 4712, 1, 1}, {4713, 4713, 1, 1}, {4714, 4714, 1, 1}, {4715, 4715, 1, 1},
+    {4716, 4716, 1, 1}, {4717, 4717, 1, 1}, {4718, 4718, 1, 1}, {4719, 4719, 1, 1},
+    {4720, 4720, 1, 1}, {4721, 4721, 1, 1}, {4722, 4722, 1, 1}, {2832, 2832, 1, 1},
+    {4723, 4723, 1, 1}, {4724, 4724, 1, 1}, {4725, 4725, 1, 1}, {4726, 4726, 1, 1},
+    {4727, 4727, 1, 1}, {4728, 4728, 1, 1}, {4729, 4729, 1, 1}, {4730, 4730, 1, 1},
+    {4731, 4731, 1, 1}, {4732, 4732, 1, 1}, {4733, 4733, 1, 1}, {4734, 4734, 1, 1},
+    {4735, 4735, 1, 1}, {4736, 4736, 1, 1}, {4737, 4737, 1, 1}, {3534, 3534, 1, 1},
+    {4738, 4738, 1, 1}, {4739, 4739, 1, 1}, {4740, 4740, 1, 1}, {4741, 4741, 1, 1},
+    {3538, 3538, 1, 1}, {4742, 4742, 1, 1}, {4743, 4743, 1, 1}, {4744, 4744, 1, 1},
+    {4745, 4745, 1, 1}, {4746, 4746, 1, 1}, {4582, 4582, 1, 1}, {4747, 4747, 1, 1},
+    {4748, 4748, 1, 1}, {4749, 4749, 1, 1}, {4750, 4750, 1, 1}, {4751, 4751, 1, 1},
+    {4752, 4752, 1, 1}, {4752, 4752, 1, 1}, {4753, 4753, 1, 1}, {4754, 4754, 1, 1},
+    {4755, 4755, 1, 1}, {4756, 4756, 1, 1}, {4757, 4757, 1, 1}, {4758, 4758, 1, 1},
+    {4759, 4759, 1, 1}, {4760, 4760, 1, 1}, {4705, 4705, 1, 1}, {4761, 4761, 1, 1},
+    {4762, 4762, 1, 1}, {4763, 4763, 1, 1}, {4764, 4764, 1, 1}, {4765, 4765, 1, 1},
+    {4766, 4766, 1, 1}, {4767, 4767, 1, 1}, {4768, 4768, 1, 1}, {4769, 4769, 1, 1},
+    {4770, 4770, 1, 1}, {4771, 4771, 1, 1}, {4717, 4717, 1, 1}, {4772, 4772, 1, 1},
+    {4773, 4773, 1, 1}, {4774, 4774, 1, 1}, {4692, 4692, 1, 1}, {4775, 4775, 1, 1},
+    {4776, 4776, 1, 1}, {4777, 4777, 1, 1}, {4778, 4778, 1, 1}, {4779, 4779, 1, 1},
+    {4780, 4780, 1, 1}, {4781, 4781, 1, 1}, {4782, 4782, 1, 1}, {4783, 4783, 1, 1},
+    {4784, 4784, 1, 1}, {4785, 4785, 1, 1}, {4786, 4786, 1, 1}, {4725, 4725, 1, 1},
+    {4787, 4787, 1, 1}, {4726, 4726, 1, 1}, {4788, 4788, 1, 1}, {4789, 4789, 1, 1},
+    {4790, 4790, 1, 1}, {4791, 4791, 1, 1}, {4792, 4792, 1, 1}, {4693, 4693, 1, 1},
+    {4479, 4479, 1, 1}, {4793, 4793, 1, 1}, {4794, 4794, 1, 1}, {2865, 2865, 1, 1},
+    {4547, 4547, 1, 1}, {4630, 4630, 1, 1}, {4795, 4795, 1, 1}, {4796, 4796, 1, 1},
+    {4733, 4733, 1, 1}, {4797, 4797, 1, 1}, {4734, 4734, 1, 1}, {4798, 4798, 1, 1},
+    {4799, 4799, 1, 1}, {4800, 4800, 1, 1}, {4695, 4695, 1, 1}, {4801, 4801, 1, 1},
+    {4802, 4802, 1, 1}, {4803, 4803, 1, 1}, {4804, 4804, 1, 1}, {4805, 4805, 1, 1},
+    {4696, 4696, 1, 1}, {4806, 4806, 1, 1}, {4807, 4807, 1, 1}, {4808, 4808, 1, 1},
+    {4809, 4809, 1, 1}, {4810, 4810, 1, 1}, {4811, 4811, 1, 1}, {4746, 4746, 1, 1},
+    {4812, 4812, 1, 1}, {4813, 4813, 1, 1}, {4582, 4582, 1, 1}, {4814, 4814, 1, 1},
+    {4750, 4750, 1, 1}, {4815, 4815, 1, 1}, {4816, 4816, 1, 1}, {4817, 4817, 1, 1},
+    {4818, 4818, 1, 1}, {4819, 4819, 1, 1}, {4755, 4755, 1, 1}, {4820, 4820, 1, 1},
+    {4704, 4704, 1, 1}, {4821, 4821, 1, 1}, {4756, 4756, 1, 1}, {4528, 4528, 1, 1},
+    {4822, 4822, 1, 1}, {4757, 4757, 1, 1}, {4823, 4823, 1, 1}, {4759, 4759, 1, 1},
+    {4824, 4824, 1, 1}, {4825, 4825, 1, 1}, {4826, 4826, 1, 1}, {4827, 4827, 1, 1},
+    {4828, 4828, 1, 1}, {4761, 4761, 1, 1}, {4701, 4701, 1, 1}, {4829, 4829, 1, 1},
+    {4762, 4762, 1, 1}, {4830, 4830, 1, 1}, {4763, 4763, 1, 1}, {4831, 4831, 1, 1},
+    {3000, 3000, 1, 1}, {4832, 4832, 1, 1}, {4833, 4833, 1, 1}, {4834, 4834, 1, 1},
+    {4835, 4835, 1, 1}, {4836, 4836, 1, 1}, {4837, 4837, 1, 1}, {4838, 4838, 1, 1},
+    {4839, 4839, 1, 1}, {4840, 4840, 1, 1}, {4841, 4841, 1, 1}, {4842, 4842, 1, 1},
+    {0, 4843, 0, 2}, {0, 4845, 0, 2}, {0, 4847, 0, 2}, {0, 4849, 0, 3},
+    {0, 4852, 0, 3}, {0, 4855, 0, 2}, {0, 4855, 0, 2}, {0, 4857, 0, 2},
+    {0, 4859, 0, 2}, {0, 4861, 0, 2}, {0, 4863, 0, 2}, {0, 4865, 0, 2},
+    {4867, 4867, 2, 2}, {4869, 4869, 2, 2}, {0, 4871, 0, 1}, {0, 2350, 0, 1},
+    {0, 2353, 0, 1}, {0, 4872, 0, 1}, {0, 4873, 0, 1}, {0, 4874, 0, 1},
+    {0, 4875, 0, 1}, {0, 4876, 0, 1}, {0, 4877, 0, 1}, {0, 2310, 0, 1},
+    {4878, 4878, 2, 2}, {4880, 4880, 2, 2}, {4882, 4882, 3, 3}, {4885, 4885, 3, 3},
+    {4888, 4888, 2, 2}, {4890, 4890, 2, 2}, {4892, 4892, 2, 2}, {4894, 4894, 2, 2},
+    {4896, 4896, 2, 2}, {4898, 4898, 2, 2}, {4900, 4900, 2, 2}, {4902, 4902, 2, 2},
+    {4904, 4904, 2, 2}, {4906, 4906, 2, 2}, {4908, 4908, 2, 2}, {4910, 4910, 2, 2},
+    {4912, 4912, 2, 2}, {4914, 4914, 2, 2}, {4916, 4916, 2, 2}, {4918, 4918, 2, 2},
+    {4920, 4920, 2, 2}, {4922, 4922, 2, 2}, {4924, 4924, 2, 2}, {4926, 4926, 2, 2},
+    {4928, 4928, 2, 2}, {4930, 4930, 2, 2}, {4932, 4932, 2, 2}, {4934, 4934, 2, 2},
+    {4936, 4936, 2, 2}, {4938, 4938, 2, 2}, {4940, 4940, 2, 2}, {4942, 4942, 2, 2},
+    {0, 4944, 0, 2}, {0, 4946, 0, 1}, {0, 4946, 0, 1}, {0, 4947, 0, 1},
+    {0, 4947, 0, 1}, {0, 4947, 0, 1}, {0, 4947, 0, 1}, {0, 4948, 0, 1},
+    {0, 4948, 0, 1}, {0, 4948, 0, 1}, {0, 4948, 0, 1}, {0, 4949, 0, 1},
+    {0, 4949, 0, 1}, {0, 4949, 0, 1}, {0, 4949, 0, 1}, {0, 4950, 0, 1},
+    {0, 4950, 0, 1}, {0, 4950, 0, 1}, {0, 4950, 0, 1}, {0, 4951, 0, 1},
+    {0, 4951, 0, 1}, {0, 4951, 0, 1}, {0, 4951, 0, 1}, {0, 4952, 0, 1},
+    {0, 4952, 0, 1}, {0, 4952, 0, 1}, {0, 4952, 0, 1}, {0, 4953, 0, 1},
+    {0, 4953, 0, 1}, {0, 4953, 0, 1}, {0, 4953, 0, 1}, {0, 4954, 0, 1},
+    {0, 4954, 0, 1}, {0, 4954, 0, 1}, {0, 4954, 0, 1}, {0, 4955, 0, 1},
+    {0, 4955, 0, 1}, {0, 4955, 0, 1}, {0, 4955, 0, 1}, {0, 4956, 0, 1},
+    {0, 4956, 0, 1}, {0, 4956, 0, 1}, {0, 4956, 0, 1}, {0, 4957, 0, 1},
+    {0, 4957, 0, 1}, {0, 4957, 0, 1}, {0, 4957, 0, 1}, {0, 4958, 0, 1},
+    {0, 4958, 0, 1}, {0, 4958, 0, 1}, {0, 4958, 0, 1}, {0, 4959, 0, 1},
+    {0, 4959, 0, 1}, {0, 4960, 0, 1}, {0, 4960, 0, 1}, {0, 4961, 0, 1},
+    {0, 4961, 0, 1}, {0, 4962, 0, 1}, {0, 4962, 0, 1}, {0, 4963, 0, 1},
+    {0, 4963, 0, 1}, {0, 4964, 0, 1}, {0, 4964, 0, 1}, {0, 4965, 0, 1},
+    {0, 4965, 0, 1}, {0, 4965, 0, 1}, {0, 4965, 0, 1}, {0, 4966, 0, 1},
+    {0, 4966, 0, 1}, {0, 4966, 0, 1}, {0, 4966, 0, 1}, {0, 4967, 0, 1},
+    {0, 4967, 0, 1}, {0, 4967, 0, 1}, {0, 4967, 0, 1}, {0, 4968, 0, 1},
+    {0, 4968, 0, 1}, {0, 4968, 0, 1}, {0, 4968, 0, 1}, {0, 4969, 0, 1},
+    {0, 4969, 0, 1}, {0, 4970, 0, 1}, {0, 4970, 0, 1}, {0, 4970, 0, 1},
+    {0, 4970, 0, 1}, {0, 809, 0, 2}, {0, 809, 0, 2}, {0, 4971, 0, 1},
+    {0, 4971, 0, 1}, {0, 4971, 0, 1}, {0, 4971, 0, 1}, {0, 4972, 0, 1},
+    {0, 4972, 0, 1}, {0, 4972, 0, 1}, {0, 4972, 0, 1}, {0, 4973, 0, 1},
+    {0, 4973, 0, 1}, {0, 813, 0, 2}, {0, 813, 0, 2}, {0, 4974, 0, 1},
+    {0, 4974, 0, 1}, {0, 4974, 0, 1}, {0, 4974, 0, 1}, {0, 4975, 0, 1},
+    {0, 4975, 0, 1}, {0, 4976, 0, 1}, {0, 4976, 0, 1}, {0, 4977, 0, 1},
+    {0, 4977, 0, 1}, {0, 805, 0, 2}, {0, 4978, 0, 1}, {0, 4978, 0, 1},
+    {0, 4979, 0, 1}, {0, 4979, 0, 1}, {0, 4980, 0, 1}, {0, 4980, 0, 1},
+    {0, 4981, 0, 1}, {0, 4981, 0, 1}, {0, 4981, 0, 1}, {0, 4981, 0, 1},
+    {0, 4982, 0, 1}, {0, 4982, 0, 1}, {0, 4983, 0, 3}, {0, 4983, 0, 3},
+    {0, 4986, 0, 3}, {0, 4986, 0, 3}, {0, 4989, 0, 3}, {0, 4989, 0, 3},
+    {0, 4992, 0, 3}, {0, 4992, 0, 3}, {0, 4995, 0, 3}, {0, 4995, 0, 3},
+    {0, 4998, 0, 3}, {0, 4998, 0, 3}, {0, 5001, 0, 3}, {0, 5001, 0, 3},
+    {0, 5001, 0, 3}, {0, 5004, 0, 3}, {0, 5004, 0, 3}, {0, 5004, 0, 3},
+    {0, 5007, 0, 1}, {0, 5007, 0, 1}, {0, 5007, 0, 1}, {0, 5007, 0, 1},
+    {0, 5008, 0, 3}, {0, 5011, 0, 3}, {0, 5014, 0, 3}, {0, 5004, 0, 3},
+    {0, 5017, 0, 3}, {0, 5020, 0, 2}, {0, 5022, 0, 2}, {0, 5024, 0, 2},
+    {0, 5026, 0, 2}, {0, 5028, 0, 2}, {0, 5030, 0, 2}, {0, 5032, 0, 2},
+    {0, 5034, 0, 2}, {0, 5036, 0, 2}, {0, 5038, 0, 2}, {0, 5040, 0, 2},
+    {0, 5042, 0, 2}, {0, 5044, 0, 2}, {0, 5046, 0, 2}, {0, 5048, 0, 2},
+    {0, 5050, 0, 2}, {0, 5052, 0, 2}, {0, 5054, 0, 2}, {0, 5056, 0, 2},
+    {0, 5058, 0, 2}, {0, 5060, 0, 2}, {0, 5062, 0, 2}, {0, 5064, 0, 2},
+    {0, 5066, 0, 2}, {0, 5068, 0, 2}, {0, 5070, 0, 2}, {0, 5072, 0, 2},
+    {0, 5074, 0, 2}, {0, 5076, 0, 2}, {0, 5078, 0, 2}, {0, 5080, 0, 2},
+    {0, 5082, 0, 2}, {0, 5084, 0, 2}, {0, 5086, 0, 2}, {0, 5088, 0, 2},
+    {0, 5090, 0, 2}, {0, 5092, 0, 2}, {0, 5094, 0, 2}, {0, 5096, 0, 2},
+    {0, 5098, 0, 2}, {0, 5100, 0, 2}, {0, 5102, 0, 2}, {0, 5104, 0, 2},
+    {0, 5106, 0, 2}, {0, 5108, 0, 2}, {0, 5110, 0, 2}, {0, 5112, 0, 2},
+    {0, 5114, 0, 2}, {0, 5116, 0, 2}, {0, 5118, 0, 2}, {0, 5120, 0, 2},
+    {0, 5122, 0, 2}, {0, 5124, 0, 2}, {0, 5126, 0, 2}, {0, 5128, 0, 2},
+    {0, 5130, 0, 2}, {0, 5132, 0, 2}, {0, 5134, 0, 2}, {0, 5136, 0, 2},
+    {0, 5138, 0, 2}, {0, 5140, 0, 2}, {0, 5142, 0, 2}, {0, 5144, 0, 2},
+    {0, 5146, 0, 2}, {0, 5148, 0, 2}, {0, 5150, 0, 2}, {0, 5152, 0, 2},
+    {0, 5154, 0, 2}, {0, 5156, 0, 2}, {0, 5158, 0, 2}, {0, 5160, 0, 2},
+    {0, 5162, 0, 2}, {0, 5164, 0, 2}, {0, 5166, 0, 2}, {0, 5168, 0, 2},
+    {0, 5170, 0, 2}, {0, 5172, 0, 2}, {0, 5174, 0, 2}, {0, 5176, 0, 2},
+    {0, 5178, 0, 2}, {0, 5180, 0, 2}, {0, 5182, 0, 2}, {0, 5184, 0, 2},
+    {0, 5186, 0, 2}, {0, 5188, 0, 2}, {0, 5190, 0, 2}, {0, 5192, 0, 2},
+    {0, 5194, 0, 2}, {0, 5196, 0, 2}, {0, 5198, 0, 3}, {0, 5201, 0, 3},
+    {0, 5204, 0, 3}, {0, 5207, 0, 3}, {0, 5210, 0, 3}, {0, 5213, 0, 3},
+    {0, 5216, 0, 3}, {0, 5219, 0, 3}, {0, 5014, 0, 3}, {0, 5222, 0, 3},
+    {0, 5004, 0, 3}, {0, 5017, 0, 3}, {0, 5225, 0, 2}, {0, 5227, 0, 2},
+    {0, 5026, 0, 2}, {0, 5229, 0, 2}, {0, 5028, 0, 2}, {0, 5030, 0, 2},
+    {0, 5231, 0, 2}, {0, 5233, 0, 2}, {0, 5038, 0, 2}, {0, 5235, 0, 2},
+    {0, 5040, 0, 2}, {0, 5042, 0, 2}, {0, 5237, 0, 2}, {0, 5239, 0, 2},
+    {0, 5046, 0, 2}, {0, 5241, 0, 2}, {0, 5048, 0, 2}, {0, 5050, 0, 2},
+    {0, 5108, 0, 2}, {0, 5110, 0, 2}, {0, 5116, 0, 2}, {0, 5118, 0, 2},
+    {0, 5120, 0, 2}, {0, 5128, 0, 2}, {0, 5130, 0, 2}, {0, 5132, 0, 2},
+    {0, 5134, 0, 2}, {0, 5142, 0, 2}, {0, 5144, 0, 2}, {0, 5146, 0, 2},
+    {0, 5243, 0, 2}, {0, 5154, 0, 2}, {0, 5245, 0, 2}, {0, 5247, 0, 2},
+    {0, 5166, 0, 2}, {0, 5249, 0, 2}, {0, 5168, 0, 2}, {0, 5170, 0, 2},
+    {0, 5196, 0, 2}, {0, 5251, 0, 2}, {0, 5253, 0, 2}, {0, 5186, 0, 2},
+    {0, 5255, 0, 2}, {0, 5188, 0, 2}, {0, 5190, 0, 2}, {0, 5008, 0, 3},
+    {0, 5011, 0, 3}, {0, 5257, 0, 3}, {0, 5014, 0, 3}, {0, 5260, 0, 3},
+    {0, 5020, 0, 2}, {0, 5022, 0, 2}, {0, 5024, 0, 2}, {0, 5026, 0, 2},
+    {0, 5263, 0, 2}, {0, 5032, 0, 2}, {0, 5034, 0, 2}, {0, 5036, 0, 2},
+    {0, 5038, 0, 2}, {0, 5265, 0, 2}, {0, 5046, 0, 2}, {0, 5052, 0, 2},
+    {0, 5054, 0, 2}, {0, 5056, 0, 2}, {0, 5058, 0, 2}, {0, 5060, 0, 2},
+    {0, 5064, 0, 2}, {0, 5066, 0, 2}, {0, 5068, 0, 2}, {0, 5070, 0, 2},
+    {0, 5072, 0, 2}, {0, 5074, 0, 2}, {0, 5267, 0, 2}, {0, 5076, 0, 2},
+    {0, 5078, 0, 2}, {0, 5080, 0, 2}, {0, 5082, 0, 2}, {0, 5084, 0, 2},
+    {0, 5086, 0, 2}, {0, 5090, 0, 2}, {0, 5092, 0, 2}, {0, 5094, 0, 2},
+    {0, 5096, 0, 2}, {0, 5098, 0, 2}, {0, 5100, 0, 2}, {0, 5102, 0, 2},
+    {0, 5104, 0, 2}, {0, 5106, 0, 2}, {0, 5112, 0, 2}, {0, 5114, 0, 2},
+    {0, 5122, 0, 2}, {0, 5124, 0, 2}, {0, 5126, 0, 2}, {0, 5128, 0, 2},
+    {0, 5130, 0, 2}, {0, 5136, 0, 2}, {0, 5138, 0, 2}, {0, 5140, 0, 2},
+    {0, 5142, 0, 2}, {0, 5269, 0, 2}, {0, 5148, 0, 2}, {0, 5150, 0, 2},
+    {0, 5152, 0, 2}, {0, 5154, 0, 2}, {0, 5160, 0, 2}, {0, 5162, 0, 2},
+    {0, 5164, 0, 2}, {0, 5166, 0, 2}, {0, 5271, 0, 2}, {0, 5172, 0, 2},
+    {0, 5174, 0, 2}, {0, 5273, 0, 2}, {0, 5180, 0, 2}, {0, 5182, 0, 2},
+    {0, 5184, 0, 2}, {0, 5186, 0, 2}, {0, 5275, 0, 2}, {0, 5014, 0, 3},
+    {0, 5260, 0, 3}, {0, 5026, 0, 2}, {0, 5263, 0, 2}, {0, 5038, 0, 2},
+    {0, 5265, 0, 2}, {0, 5046, 0, 2}, {0, 5277, 0, 2}, {0, 5072, 0, 2},
+    {0, 5279, 0, 2}, {0, 5281, 0, 2}, {0, 5283, 0, 2}, {0, 5128, 0, 2},
+    {0, 5130, 0, 2}, {0, 5142, 0, 2}, {0, 5166, 0, 2}, {0, 5271, 0, 2},
+    {0, 5186, 0, 2}, {0, 5275, 0, 2}, {0, 5285, 0, 3}, {0, 5288, 0, 3},
+    {0, 5291, 0, 3}, {0, 5294, 0, 2}, {0, 5296, 0, 2}, {0, 5298, 0, 2},
+    {0, 5300, 0, 2}, {0, 5302, 0, 2}, {0, 5304, 0, 2}, {0, 5306, 0, 2},
+    {0, 5308, 0, 2}, {0, 5310, 0, 2}, {0, 5312, 0, 2}, {0, 5314, 0, 2},
+    {0, 5316, 0, 2}, {0, 5318, 0, 2}, {0, 5320, 0, 2}, {0, 5322, 0, 2},
+    {0, 5324, 0, 2}, {0, 5326, 0, 2}, {0, 5328, 0, 2}, {0, 5330, 0, 2},
+    {0, 5332, 0, 2}, {0, 5334, 0, 2}, {0, 5336, 0, 2}, {0, 5338, 0, 2},
+    {0, 5281, 0, 2}, {0, 5340, 0, 2}, {0, 5342, 0, 2}, {0, 5344, 0, 2},
+    {0, 5346, 0, 2}, {0, 5294, 0, 2}, {0, 5296, 0, 2}, {0, 5298, 0, 2},
+    {0, 5300, 0, 2}, {0, 5302, 0, 2}, {0, 5304, 0, 2}, {0, 5306, 0, 2},
+    {0, 5308, 0, 2}, {0, 5310, 0, 2}, {0, 5312, 0, 2}, {0, 5314, 0, 2},
+    {0, 5316, 0, 2}, {0, 5318, 0, 2}, {0, 5320, 0, 2}, {0, 5322, 0, 2},
+    {0, 5324, 0, 2}, {0, 5326, 0, 2}, {0, 5328, 0, 2}, {0, 5330, 0, 2},
+    {0, 5332, 0, 2}, {0, 5334, 0, 2}, {0, 5336, 0, 2}, {0, 5338, 0, 2},
+    {0, 5281, 0, 2}, {0, 5340, 0, 2}, {0, 5342, 0, 2}, {0, 5344, 0, 2},
+    {0, 5346, 0, 2}, {0, 5334, 0, 2}, {0, 5336, 0, 2}, {0, 5338, 0, 2},
+    {0, 5281, 0, 2}, {0, 5279, 0, 2}, {0, 5283, 0, 2}, {0, 5088, 0, 2},
+    {0, 5066, 0, 2}, {0, 5068, 0, 2}, {0, 5070, 0, 2}, {0, 5334, 0, 2},
+    {0, 5336, 0, 2}, {0, 5338, 0, 2}, {0, 5088, 0, 2}, {0, 5090, 0, 2},
+    {0, 5348, 0, 2}, {0, 5348, 0, 2}, {0, 5350, 0, 3}, {0, 5353, 0, 3},
+    {0, 5353, 0, 3}, {0, 5356, 0, 3}, {0, 5359, 0, 3}, {0, 5362, 0, 3},
+    {0, 5365, 0, 3}, {0, 5368, 0, 3}, {0, 5371, 0, 3}, {0, 5371, 0, 3},
+    {0, 5374, 0, 3}, {0, 5377, 0, 3}, {0, 5380, 0, 3}, {0, 5383, 0, 3},
+    {0, 5386, 0, 3}, {0, 5389, 0, 3}, {0, 5389, 0, 3}, {0, 5392, 0, 3},
+    {0, 5395, 0, 3}, {0, 5395, 0, 3}, {0, 5398, 0, 3}, {0, 5398, 0, 3},
+    {0, 5401, 0, 3}, {0, 5404, 0, 3}, {0, 5404, 0, 3}, {0, 5407, 0, 3},
+    {0, 5410, 0, 3}, {0, 5410, 0, 3}, {0, 5413, 0, 3}, {0, 5413, 0, 3},
+    {0, 5416, 0, 3}, {0, 5419, 0, 3}, {0, 5419, 0, 3}, {0, 5422, 0, 3},
+    {0, 5422, 0, 3}, {0, 5425, 0, 3}, {0, 5428, 0, 3}, {0, 5431, 0, 3},
+    {0, 5434, 0, 3}, {0, 5434, 0, 3}, {0, 5437, 0, 3}, {0, 5440, 0, 3},
+    {0, 5443, 0, 3}, {0, 5446, 0, 3}, {0, 5449, 0, 3}, {0, 5449, 0, 3},
+    {0, 5452, 0, 3}, {0, 5455, 0, 3}, {0, 5458, 0, 3}, {0, 5461, 0, 3},
+    {0, 5464, 0, 3}, {0, 5467, 0, 3}, {0, 5467, 0, 3}, {0, 5470, 0, 3},
+    {0, 5470, 0, 3}, {0, 5473, 0, 3}, {0, 5473, 0, 3}, {0, 5476, 0, 3},
+    {0, 5479, 0, 3}, {0, 5482, 0, 3}, {0, 5485, 0, 3}, {0, 5488, 0, 3},
+    {0, 5491, 0, 3}, {0, 5494, 0, 3}, {0, 5497, 0, 3}, {0, 5500, 0, 3},
+    {0, 5503, 0, 3}, {0, 5506, 0, 3}, {0, 5509, 0, 3}, {0, 5512, 0, 3},
+    {0, 5512, 0, 3}, {0, 5515, 0, 3}, {0, 5518, 0, 3}, {0, 5521, 0, 3},
+    {0, 5524, 0, 3}, {0, 5524, 0, 3}, {0, 5527, 0, 3}, {0, 5530, 0, 3},
+    {0, 5533, 0, 3}, {0, 5536, 0, 3}, {0, 5539, 0, 3}, {0, 5542, 0, 3},
+    {0, 5545, 0, 3}, {0, 5548, 0, 3}, {0, 5551, 0, 3}, {0, 5554, 0, 3},
+    {0, 5557, 0, 3}, {0, 5560, 0, 3}, {0, 5563, 0, 3}, {0, 5566, 0, 3},
+    {0, 5569, 0, 3}, {0, 5572, 0, 3}, {0, 5575, 0, 3}, {0, 5578, 0, 3},
+    {0, 5581, 0, 3}, {0, 5584, 0, 3}, {0, 5587, 0, 3}, {0, 5590, 0, 3},
+    {0, 5452, 0, 3}, {0, 5458, 0, 3}, {0, 5593, 0, 3}, {0, 5596, 0, 3},
+    {0, 5599, 0, 3}, {0, 5602, 0, 3}, {0, 5605, 0, 3}, {0, 5608, 0, 3},
+    {0, 5605, 0, 3}, {0, 5599, 0, 3}, {0, 5611, 0, 3}, {0, 5614, 0, 3},
+    {0, 5617, 0, 3}, {0, 5620, 0, 3}, {0, 5623, 0, 3}, {0, 5608, 0, 3},
+    {0, 5431, 0, 3}, {0, 5401, 0, 3}, {0, 5626, 0, 3}, {0, 5629, 0, 3},
+    {0, 5632, 0, 3}, {0, 5635, 0, 3}, {0, 5638, 0, 4}, {0, 5642, 0, 4},
+    {0, 5646, 0, 4}, {0, 5650, 0, 4}, {0, 5654, 0, 4}, {0, 5658, 0, 4},
+    {0, 5662, 0, 4}, {0, 5666, 0, 3}, {0, 5669, 0, 18}, {0, 5687, 0, 8},
+    {0, 5695, 0, 4}, {0, 5699, 0, 1}, {0, 5700, 0, 1}, {0, 5701, 0, 1},
+    {0, 5702, 0, 1}, {0, 621, 0, 1}, {0, 5703, 0, 1}, {0, 5704, 0, 1},
+    {0, 5705, 0, 1}, {0, 5706, 0, 1}, {0, 2276, 0, 3}, {0, 2274, 0, 2},
+    {0, 5707, 0, 1}, {0, 5708, 0, 1}, {0, 5709, 0, 1}, {0, 5709, 0, 1},
+    {0, 2313, 0, 1}, {0, 2314, 0, 1}, {0, 5710, 0, 1}, {0, 5711, 0, 1},
+    {0, 5712, 0, 1}, {0, 5713, 0, 1}, {0, 5714, 0, 1}, {0, 5715, 0, 1},
+    {0, 5716, 0, 1}, {0, 5717, 0, 1}, {0, 2544, 0, 1}, {0, 2545, 0, 1},
+    {0, 5718, 0, 1}, {0, 5719, 0, 1}, {0, 5720, 0, 1}, {0, 5721, 0, 1},
+    {0, 5722, 0, 1}, {0, 5723, 0, 1}, {0, 2291, 0, 2}, {0, 2291, 0, 2},
+    {0, 2291, 0, 2}, {0, 2291, 0, 2}, {0, 5709, 0, 1}, {0, 5709, 0, 1},
+    {0, 5709, 0, 1}, {0, 5699, 0, 1}, {0, 5700, 0, 1}, {0, 2273, 0, 1},
+    {0, 621, 0, 1}, {0, 5702, 0, 1}, {0, 5704, 0, 1}, {0, 5703, 0, 1},
+    {0, 5707, 0, 1}, {0, 2313, 0, 1}, {0, 2314, 0, 1}, {0, 5710, 0, 1},
+    {0, 5711, 0, 1}, {0, 5712, 0, 1}, {0, 5713, 0, 1}, {0, 5724, 0, 1},
+    {0, 5725, 0, 1}, {0, 5726, 0, 1}, {0, 2310, 0, 1}, {0, 5727, 0, 1},
+    {0, 5728, 0, 1}, {0, 5729, 0, 1}, {0, 2312, 0, 1}, {0, 5730, 0, 1},
+    {0, 5731, 0, 1}, {0, 5732, 0, 1}, {0, 5733, 0, 1}, {0, 5734, 0, 2},
+    {0, 5736, 0, 2}, {0, 5738, 0, 2}, {0, 5740, 0, 2}, {0, 5742, 0, 2},
+    {0, 5744, 0, 2}, {0, 5746, 0, 2}, {0, 5748, 0, 2}, {0, 5750, 0, 2},
+    {0, 5752, 0, 2}, {0, 5754, 0, 2}, {0, 5756, 0, 2}, {0, 5758, 0, 2},
+    {0, 5760, 0, 2}, {0, 5762, 0, 1}, {0, 791, 0, 2}, {0, 791, 0, 2},
+    {0, 793, 0, 2}, {0, 793, 0, 2}, {0, 795, 0, 2}, {0, 795, 0, 2},
+    {0, 797, 0, 2}, {0, 797, 0, 2}, {0, 799, 0, 2}, {0, 799, 0, 2},
+    {0, 799, 0, 2}, {0, 799, 0, 2}, {0, 5763, 0, 1}, {0, 5763, 0, 1},
+    {0, 5764, 0, 1}, {0, 5764, 0, 1}, {0, 5764, 0, 1}, {0, 5764, 0, 1},
+    {0, 5765, 0, 1}, {0, 5765, 0, 1}, {0, 5766, 0, 1}, {0, 5766, 0, 1},
+    {0, 5766, 0, 1}, {0, 5766, 0, 1}, {0, 5767, 0, 1}, {0, 5767, 0, 1},
+    {0, 5767, 0, 1}, {0, 5767, 0, 1}, {0, 5768, 0, 1}, {0, 5768, 0, 1},
+    {0, 5768, 0, 1}, {0, 5768, 0, 1}, {0, 5769, 0, 1}, {0, 5769, 0, 1},
+    {0, 5769, 0, 1}, {0, 5769, 0, 1}, {0, 5770, 0, 1}, {0, 5770, 0, 1},
+    {0, 5770, 0, 1}, {0, 5770, 0, 1}, {0, 5771, 0, 1}, {0, 5771, 0, 1},
+    {0, 5772, 0, 1}, {0, 5772, 0, 1}, {0, 5773, 0, 1}, {0, 5773, 0, 1},
+    {0, 5774, 0, 1}, {0, 5774, 0, 1}, {0, 5775, 0, 1}, {0, 5775, 0, 1},
+    {0, 5775, 0, 1}, {0, 5775, 0, 1}, {0, 5776, 0, 1}, {0, 5776, 0, 1},
+    {0, 5776, 0, 1}, {0, 5776, 0, 1}, {0, 5777, 0, 1}, {0, 5777, 0, 1},
+    {0, 5777, 0, 1}, {0, 5777, 0, 1}, {0, 5778, 0, 1}, {0, 5778, 0, 1},
+    {0, 5778, 0, 1}, {0, 5778, 0, 1}, {0, 5779, 0, 1}, {0, 5779, 0, 1},
+    {0, 5779, 0, 1}, {0, 5779, 0, 1}, {0, 5780, 0, 1}, {0, 5780, 0, 1},
+    {0, 5780, 0, 1}, {0, 5780, 0, 1}, {0, 5781, 0, 1}, {0, 5781, 0, 1},
+    {0, 5781, 0, 1}, {0, 5781, 0, 1}, {0, 5782, 0, 1}, {0, 5782, 0, 1},
+    {0, 5782, 0, 1}, {0, 5782, 0, 1}, {0, 5783, 0, 1}, {0, 5783, 0, 1},
+    {0, 5783, 0, 1}, {0, 5783, 0, 1}, {0, 5784, 0, 1}, {0, 5784, 0, 1},
+    {0, 5784, 0, 1}, {0, 5784, 0, 1}, {0, 5785, 0, 1}, {0, 5785, 0, 1},
+    {0, 5785, 0, 1}, {0, 5785, 0, 1}, {0, 5786, 0, 1}, {0, 5786, 0, 1},
+    {0, 5786, 0, 1}, {0, 5786, 0, 1}, {0, 5787, 0, 1}, {0, 5787, 0, 1},
+    {0, 5787, 0, 1}, {0, 5787, 0, 1}, {0, 5788, 0, 1}, {0, 5788, 0, 1},
+    {0, 5788, 0, 1}, {0, 5788, 0, 1}, {0, 5789, 0, 1}, {0, 5789, 0, 1},
+    {0, 5789, 0, 1}, {0, 5789, 0, 1}, {0, 5790, 0, 1}, {0, 5790, 0, 1},
+    {0, 4982, 0, 1}, {0, 4982, 0, 1}, {0, 5791, 0, 1}, {0, 5791, 0, 1},
+    {0, 5791, 0, 1}, {0, 5791, 0, 1}, {0, 5792, 0, 3}, {0, 5792, 0, 3},
+    {0, 5795, 0, 3}, {0, 5795, 0, 3}, {0, 5798, 0, 3}, {0, 5798, 0, 3},
+    {0, 5801, 0, 2}, {0, 5801, 0, 2}, {0, 5703, 0, 1}, {0, 5803, 0, 1},
+    {0, 5724, 0, 1}, {0, 5731, 0, 1}, {0, 5732, 0, 1}, {0, 5725, 0, 1},
+    {0, 5804, 0, 1}, {0, 2313, 0, 1}, {0, 2314, 0, 1}, {0, 5726, 0, 1},
+    {0, 2310, 0, 1}, {0, 5699, 0, 1}, {0, 5727, 0, 1}, {0, 2273, 0, 1},
+    {0, 5805, 0, 1}, {0, 2303, 0, 1}, {0, 13, 0, 1}, {0, 6, 0, 1},
+    {0, 7, 0, 1}, {0, 2304, 0, 1}, {0, 2305, 0, 1}, {0, 2306, 0, 1},
+    {0, 2307, 0, 1}, {0, 2308, 0, 1}, {0, 2309, 0, 1}, {0, 5702, 0, 1},
+    {0, 621, 0, 1}, {0, 5728, 0, 1}, {0, 2312, 0, 1}, {0, 5729, 0, 1},
+    {0, 5704, 0, 1}, {0, 5733, 0, 1}, {0, 979, 0, 1}, {0, 981, 0, 1},
+    {0, 2324, 0, 1}, {0, 982, 0, 1}, {0, 983, 0, 1}, {0, 2349, 0, 1},
+    {0, 985, 0, 1}, {0, 986, 0, 1}, {0, 987, 0, 1}, {0, 988, 0, 1},
+    {0, 989, 0, 1}, {0, 990, 0, 1}, {0, 991, 0, 1}, {0, 992, 0, 1},
+    {0, 993, 0, 1}, {0, 995, 0, 1}, {0, 2339, 0, 1}, {0, 996, 0, 1},
+    {0, 2768, 0, 1}, {0, 997, 0, 1}, {0, 998, 0, 1}, {0, 2405, 0, 1},
+    {0, 999, 0, 1}, {0, 2417, 0, 1}, {0, 2769, 0, 1}, {0, 2347, 0, 1},
+    {0, 5722, 0, 1}, {0, 5730, 0, 1}, {0, 5723, 0, 1}, {0, 5806, 0, 1},
+    {0, 5709, 0, 1}, {0, 2245, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 5710, 0, 1}, {0, 5807, 0, 1}, {0, 5711, 0, 1}, {0, 5808, 0, 1},
+    {0, 5809, 0, 1}, {0, 5810, 0, 1}, {0, 5701, 0, 1}, {0, 5718, 0, 1},
+    {0, 5719, 0, 1}, {0, 5700, 0, 1}, {0, 5811, 0, 1}, {0, 3673, 0, 1},
+    {0, 5812, 0, 1}, {0, 5813, 0, 1}, {0, 5814, 0, 1}, {0, 5815, 0, 1},
+    {0, 5816, 0, 1}, {0, 5817, 0, 1}, {0, 5818, 0, 1}, {0, 5819, 0, 1},
+    {0, 5820, 0, 1}, {0, 5821, 0, 1}, {0, 3627, 0, 1}, {0, 3628, 0, 1},
+    {0, 3629, 0, 1}, {0, 3630, 0, 1}, {0, 3631, 0, 1}, {0, 3632, 0, 1},
+    {0, 3633, 0, 1}, {0, 3634, 0, 1}, {0, 3635, 0, 1}, {0, 3636, 0, 1},
+    {0, 3637, 0, 1}, {0, 3638, 0, 1}, {0, 3639, 0, 1}, {0, 3640, 0, 1},
+    {0, 3641, 0, 1}, {0, 3642, 0, 1}, {0, 3643, 0, 1}, {0, 3644, 0, 1},
+    {0, 3645, 0, 1}, {0, 3646, 0, 1}, {0, 3647, 0, 1}, {0, 3648, 0, 1},
+    {0, 3649, 0, 1}, {0, 3650, 0, 1}, {0, 3651, 0, 1}, {0, 3652, 0, 1},
+    {0, 3653, 0, 1}, {0, 3654, 0, 1}, {0, 3655, 0, 1}, {0, 3656, 0, 1},
+    {0, 3657, 0, 1}, {0, 3658, 0, 1}, {0, 3659, 0, 1}, {0, 3660, 0, 1},
+    {0, 3661, 0, 1}, {0, 3662, 0, 1}, {0, 3663, 0, 1}, {0, 3664, 0, 1},
+    {0, 3665, 0, 1}, {0, 3666, 0, 1}, {0, 3667, 0, 1}, {0, 3668, 0, 1},
+    {0, 3669, 0, 1}, {0, 3670, 0, 1}, {0, 5822, 0, 1}, {0, 5823, 0, 1},
+    {0, 5824, 0, 1}, {0, 3180, 0, 1}, {0, 3129, 0, 1}, {0, 3130, 0, 1},
+    {0, 3131, 0, 1}, {0, 3132, 0, 1}, {0, 3133, 0, 1}, {0, 3134, 0, 1},
+    {0, 3135, 0, 1}, {0, 3136, 0, 1}, {0, 3137, 0, 1}, {0, 3138, 0, 1},
+    {0, 3139, 0, 1}, {0, 3140, 0, 1}, {0, 3141, 0, 1}, {0, 3142, 0, 1},
+    {0, 3143, 0, 1}, {0, 3144, 0, 1}, {0, 3145, 0, 1}, {0, 3146, 0, 1},
+    {0, 3147, 0, 1}, {0, 3148, 0, 1}, {0, 3149, 0, 1}, {0, 3150, 0, 1},
+    {0, 3151, 0, 1}, {0, 3152, 0, 1}, {0, 3153, 0, 1}, {0, 3154, 0, 1},
+    {0, 3155, 0, 1}, {0, 3156, 0, 1}, {0, 3157, 0, 1}, {0, 3158, 0, 1},
+    {0, 3159, 0, 1}, {0, 3160, 0, 1}, {0, 3161, 0, 1}, {0, 3162, 0, 1},
+    {0, 3163, 0, 1}, {0, 3164, 0, 1}, {0, 3165, 0, 1}, {0, 3166, 0, 1},
+    {0, 3167, 0, 1}, {0, 3168, 0, 1}, {0, 3169, 0, 1}, {0, 3170, 0, 1},
+    {0, 3171, 0, 1}, {0, 3172, 0, 1}, {0, 3173, 0, 1}, {0, 3174, 0, 1},
+    {0, 3175, 0, 1}, {0, 3176, 0, 1}, {0, 3177, 0, 1}, {0, 3178, 0, 1},
+    {0, 3179, 0, 1}, {0, 5825, 0, 1}, {0, 5826, 0, 1}, {0, 5827, 0, 1},
+    {0, 4, 0, 2}, {0, 5828, 0, 1}, {0, 5829, 0, 1}, {0, 5830, 0, 1},
+    {0, 5831, 0, 1}, {0, 5832, 0, 1}, {0, 5833, 0, 1}, {0, 5834, 0, 1},
+    {0, 5835, 0, 1}, {0, 5836, 0, 1}, {0, 5837, 0, 1}, {5838, 5838, 2, 2},
+    {5840, 5840, 2, 2}, {5842, 5842, 3, 3}, {5845, 5845, 3, 3}, {5848, 5848, 3, 3},
+    {5851, 5851, 3, 3}, {5854, 5854, 3, 3}, {5857, 5857, 2, 2}, {5859, 5859, 2, 2},
+    {5861, 5861, 3, 3}, {5864, 5864, 3, 3}, {5867, 5867, 3, 3}, {5870, 5870, 3, 3},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1}, {0, 1010, 0, 1},
+    {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1}, {0, 14, 0, 1},
+    {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1}, {0, 356, 0, 1},
+    {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1}, {0, 595, 0, 1},
+    {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1}, {0, 979, 0, 1},
+    {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1}, {0, 983, 0, 1},
+    {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1}, {0, 987, 0, 1},
+    {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1}, {0, 991, 0, 1},
+    {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1}, {0, 2339, 0, 1},
+    {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1}, {0, 998, 0, 1},
+    {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1}, {0, 2769, 0, 1},
+    {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1}, {0, 1029, 0, 1},
+    {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1}, {0, 1009, 0, 1},
+    {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1}, {0, 1010, 0, 1},
+    {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1}, {0, 14, 0, 1},
+    {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1}, {0, 356, 0, 1},
+    {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1}, {0, 595, 0, 1},
+    {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1}, {0, 979, 0, 1},
+    {0, 2324, 0, 1}, {0, 982, 0, 1}, {0, 985, 0, 1}, {0, 988, 0, 1},
+    {0, 989, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1}, {0, 998, 0, 1},
+    {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1}, {0, 2769, 0, 1},
+    {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1}, {0, 1029, 0, 1},
+    {0, 1004, 0, 1}, {0, 1032, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1},
+    {0, 590, 0, 1}, {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1},
+    {0, 2315, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 982, 0, 1}, {0, 983, 0, 1},
+    {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1},
+    {0, 990, 0, 1}, {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1},
+    {0, 995, 0, 1}, {0, 2339, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1}, {0, 1029, 0, 1},
+    {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1}, {0, 1009, 0, 1},
+    {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1}, {0, 1010, 0, 1},
+    {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1}, {0, 14, 0, 1},
+    {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1}, {0, 356, 0, 1},
+    {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1}, {0, 595, 0, 1},
+    {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1}, {0, 979, 0, 1},
+    {0, 981, 0, 1}, {0, 982, 0, 1}, {0, 983, 0, 1}, {0, 2349, 0, 1},
+    {0, 985, 0, 1}, {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1},
+    {0, 990, 0, 1}, {0, 991, 0, 1}, {0, 993, 0, 1}, {0, 2768, 0, 1},
+    {0, 997, 0, 1}, {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1},
+    {0, 2417, 0, 1}, {0, 2769, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 979, 0, 1}, {0, 981, 0, 1}, {0, 2324, 0, 1}, {0, 982, 0, 1},
+    {0, 983, 0, 1}, {0, 2349, 0, 1}, {0, 985, 0, 1}, {0, 986, 0, 1},
+    {0, 987, 0, 1}, {0, 988, 0, 1}, {0, 989, 0, 1}, {0, 990, 0, 1},
+    {0, 991, 0, 1}, {0, 992, 0, 1}, {0, 993, 0, 1}, {0, 995, 0, 1},
+    {0, 2339, 0, 1}, {0, 996, 0, 1}, {0, 2768, 0, 1}, {0, 997, 0, 1},
+    {0, 998, 0, 1}, {0, 2405, 0, 1}, {0, 999, 0, 1}, {0, 2417, 0, 1},
+    {0, 2769, 0, 1}, {0, 2347, 0, 1}, {0, 3, 0, 1}, {0, 1003, 0, 1},
+    {0, 1029, 0, 1}, {0, 1004, 0, 1}, {0, 1005, 0, 1}, {0, 1032, 0, 1},
+    {0, 1009, 0, 1}, {0, 588, 0, 1}, {0, 1026, 0, 1}, {0, 590, 0, 1},
+    {0, 1010, 0, 1}, {0, 610, 0, 1}, {0, 1011, 0, 1}, {0, 2315, 0, 1},
+    {0, 14, 0, 1}, {0, 1016, 0, 1}, {0, 2770, 0, 1}, {0, 591, 0, 1},
+    {0, 356, 0, 1}, {0, 1017, 0, 1}, {0, 1018, 0, 1}, {0, 1021, 0, 1},
+    {0, 595, 0, 1}, {0, 611, 0, 1}, {0, 596, 0, 1}, {0, 1059, 0, 1},
+    {0, 5873, 0, 1}, {0, 5874, 0, 1}, {0, 5875, 0, 1}, {0, 5876, 0, 1},
+    {0, 2357, 0, 1}, {0, 5877, 0, 1}, {0, 5878, 0, 1}, {0, 5879, 0, 1},
+    {0, 5880, 0, 1}, {0, 682, 0, 1}, {0, 5881, 0, 1}, {0, 5882, 0, 1},
+    {0, 5883, 0, 1}, {0, 5884, 0, 1}, {0, 5885, 0, 1}, {0, 5886, 0, 1},
+    {0, 5887, 0, 1}, {0, 2358, 0, 1}, {0, 5888, 0, 1}, {0, 682, 0, 1},
+    {0, 684, 0, 1}, {0, 5889, 0, 1}, {0, 672, 0, 1}, {0, 5890, 0, 1},
+    {0, 5891, 0, 1}, {0, 5892, 0, 1}, {0, 2348, 0, 1}, {0, 5893, 0, 1},
+    {0, 5894, 0, 1}, {0, 670, 0, 1}, {0, 1023, 0, 1}, {0, 1024, 0, 1},
+    {0, 683, 0, 1}, {0, 5895, 0, 1}, {0, 5896, 0, 1}, {0, 671, 0, 1},
+    {0, 2141, 0, 1}, {0, 679, 0, 1}, {0, 5897, 0, 1}, {0, 10, 0, 1},
+    {0, 5898, 0, 1}, {0, 5899, 0, 1}, {0, 5900, 0, 1}, {0, 678, 0, 1},
+    {0, 680, 0, 1}, {0, 681, 0, 1}, {0, 5901, 0, 1}, {0, 5902, 0, 1},
+    {0, 5903, 0, 1}, {0, 677, 0, 1}, {0, 1025, 0, 1}, {0, 5904, 0, 1},
+    {0, 5905, 0, 1}, {0, 5906, 0, 1}, {0, 683, 0, 1}, {0, 671, 0, 1},
+    {0, 679, 0, 1}, {0, 677, 0, 1}, {0, 680, 0, 1}, {0, 678, 0, 1},
+    {0, 5875, 0, 1}, {0, 5876, 0, 1}, {0, 2357, 0, 1}, {0, 5877, 0, 1},
+    {0, 5878, 0, 1}, {0, 5879, 0, 1}, {0, 5880, 0, 1}, {0, 682, 0, 1},
+    {0, 5881, 0, 1}, {0, 5882, 0, 1}, {0, 5883, 0, 1}, {0, 5884, 0, 1},
+    {0, 5885, 0, 1}, {0, 5886, 0, 1}, {0, 5887, 0, 1}, {0, 2358, 0, 1},
+    {0, 5888, 0, 1}, {0, 682, 0, 1}, {0, 684, 0, 1}, {0, 5889, 0, 1},
+    {0, 672, 0, 1}, {0, 5890, 0, 1}, {0, 5891, 0, 1}, {0, 5892, 0, 1},
+    {0, 2348, 0, 1}, {0, 5893, 0, 1}, {0, 5894, 0, 1}, {0, 670, 0, 1},
+    {0, 1023, 0, 1}, {0, 1024, 0, 1}, {0, 683, 0, 1}, {0, 5895, 0, 1},
+    {0, 5896, 0, 1}, {0, 671, 0, 1}, {0, 2141, 0, 1}, {0, 679, 0, 1},
+    {0, 5897, 0, 1}, {0, 10, 0, 1}, {0, 5898, 0, 1}, {0, 5899, 0, 1},
+    {0, 5900, 0, 1}, {0, 678, 0, 1}, {0, 680, 0, 1}, {0, 681, 0, 1},
+    {0, 5901, 0, 1}, {0, 5902, 0, 1}, {0, 5903, 0, 1}, {0, 677, 0, 1},
+    {0, 1025, 0, 1}, {0, 5904, 0, 1}, {0, 5905, 0, 1}, {0, 5906, 0, 1},
+    {0, 683, 0, 1}, {0, 671, 0, 1}, {0, 679, 0, 1}, {0, 677, 0, 1},
+    {0, 680, 0, 1}, {0, 678, 0, 1}, {0, 5875, 0, 1}, {0, 5876, 0, 1},
+    {0, 2357, 0, 1}, {0, 5877, 0, 1}, {0, 5878, 0, 1}, {0, 5879, 0, 1},
+    {0, 5880, 0, 1}, {0, 682, 0, 1}, {0, 5881, 0, 1}, {0, 5882, 0, 1},
+    {0, 5883, 0, 1}, {0, 5884, 0, 1}, {0, 5885, 0, 1}, {0, 5886, 0, 1},
+    {0, 5887, 0, 1}, {0, 2358, 0, 1}, {0, 5888, 0, 1}, {0, 682, 0, 1},
+    {0, 684, 0, 1}, {0, 5889, 0, 1}, {0, 672, 0, 1}, {0, 5890, 0, 1},
+    {0, 5891, 0, 1}, {0, 5892, 0, 1}, {0, 2348, 0, 1}, {0, 5893, 0, 1},
+    {0, 5894, 0, 1}, {0, 670, 0, 1}, {0, 1023, 0, 1}, {0, 1024, 0, 1},
+    {0, 683, 0, 1}, {0, 5895, 0, 1}, {0, 5896, 0, 1}, {0, 671, 0, 1},
+    {0, 2141, 0, 1}, {0, 679, 0, 1}, {0, 5897, 0, 1}, {0, 10, 0, 1},
+    {0, 5898, 0, 1}, {0, 5899, 0, 1}, {0, 5900, 0, 1}, {0, 678, 0, 1},
+    {0, 680, 0, 1}, {0, 681, 0, 1}, {0, 5901, 0, 1}, {0, 5902, 0, 1},
+    {0, 5903, 0, 1}, {0, 677, 0, 1}, {0, 1025, 0, 1}, {0, 5904, 0, 1},
+    {0, 5905, 0, 1}, {0, 5906, 0, 1}, {0, 683, 0, 1}, {0, 671, 0, 1},
+    {0, 679, 0, 1}, {0, 677, 0, 1}, {0, 680, 0, 1}, {0, 678, 0, 1},
+    {0, 5875, 0, 1}, {0, 5876, 0, 1}, {0, 2357, 0, 1}, {0, 5877, 0, 1},
+    {0, 5878, 0, 1}, {0, 5879, 0, 1}, {0, 5880, 0, 1}, {0, 682, 0, 1},
+    {0, 5881, 0, 1}, {0, 5882, 0, 1}, {0, 5883, 0, 1}, {0, 5884, 0, 1},
+    {0, 5885, 0, 1}, {0, 5886, 0, 1}, {0, 5887, 0, 1}, {0, 2358, 0, 1},
+    {0, 5888, 0, 1}, {0, 682, 0, 1}, {0, 684, 0, 1}, {0, 5889, 0, 1},
+    {0, 672, 0, 1}, {0, 5890, 0, 1}, {0, 5891, 0, 1}, {0, 5892, 0, 1},
+    {0, 2348, 0, 1}, {0, 5893, 0, 1}, {0, 5894, 0, 1}, {0, 670, 0, 1},
+    {0, 1023, 0, 1}, {0, 1024, 0, 1}, {0, 683, 0, 1}, {0, 5895, 0, 1},
+    {0, 5896, 0, 1}, {0, 671, 0, 1}, {0, 2141, 0, 1}, {0, 679, 0, 1},
+    {0, 5897, 0, 1}, {0, 10, 0, 1}, {0, 5898, 0, 1}, {0, 5899, 0, 1},
+    {0, 5900, 0, 1}, {0, 678, 0, 1}, {0, 680, 0, 1}, {0, 681, 0, 1},
+    {0, 5901, 0, 1}, {0, 5902, 0, 1}, {0, 5903, 0, 1}, {0, 677, 0, 1},
+    {0, 1025, 0, 1}, {0, 5904, 0, 1}, {0, 5905, 0, 1}, {0, 5906, 0, 1},
+    {0, 683, 0, 1}, {0, 671, 0, 1}, {0, 679, 0, 1}, {0, 677, 0, 1},
+    {0, 680, 0, 1}, {0, 678, 0, 1}, {0, 5875, 0, 1}, {0, 5876, 0, 1},
+    {0, 2357, 0, 1}, {0, 5877, 0, 1}, {0, 5878, 0, 1}, {0, 5879, 0, 1},
+    {0, 5880, 0, 1}, {0, 682, 0, 1}, {0, 5881, 0, 1}, {0, 5882, 0, 1},
+    {0, 5883, 0, 1}, {0, 5884, 0, 1}, {0, 5885, 0, 1}, {0, 5886, 0, 1},
+    {0, 5887, 0, 1}, {0, 2358, 0, 1}, {0, 5888, 0, 1}, {0, 682, 0, 1},
+    {0, 684, 0, 1}, {0, 5889, 0, 1}, {0, 672, 0, 1}, {0, 5890, 0, 1},
+    {0, 5891, 0, 1}, {0, 5892, 0, 1}, {0, 2348, 0, 1}, {0, 5893, 0, 1},
+    {0, 5894, 0, 1}, {0, 670, 0, 1}, {0, 1023, 0, 1}, {0, 1024, 0, 1},
+    {0, 683, 0, 1}, {0, 5895, 0, 1}, {0, 5896, 0, 1}, {0, 671, 0, 1},
+    {0, 2141, 0, 1}, {0, 679, 0, 1}, {0, 5897, 0, 1}, {0, 10, 0, 1},
+    {0, 5898, 0, 1}, {0, 5899, 0, 1}, {0, 5900, 0, 1}, {0, 678, 0, 1},
+    {0, 680, 0, 1}, {0, 681, 0, 1}, {0, 5901, 0, 1}, {0, 5902, 0, 1},
+    {0, 5903, 0, 1}, {0, 677, 0, 1}, {0, 1025, 0, 1}, {0, 5904, 0, 1},
+    {0, 5905, 0, 1}, {0, 5906, 0, 1}, {0, 683, 0, 1}, {0, 671, 0, 1},
+    {0, 679, 0, 1}, {0, 677, 0, 1}, {0, 680, 0, 1}, {0, 678, 0, 1},
+    {0, 5907, 0, 1}, {0, 5908, 0, 1}, {0, 2303, 0, 1}, {0, 13, 0, 1},
+    {0, 6, 0, 1}, {0, 7, 0, 1}, {0, 2304, 0, 1}, {0, 2305, 0, 1},
+    {0, 2306, 0, 1}, {0, 2307, 0, 1}, {0, 2308, 0, 1}, {0, 2309, 0, 1},
+    {0, 2303, 0, 1}, {0, 13, 0, 1}, {0, 6, 0, 1}, {0, 7, 0, 1},
+    {0, 2304, 0, 1}, {0, 2305, 0, 1}, {0, 2306, 0, 1}, {0, 2307, 0, 1},
+    {0, 2308, 0, 1}, {0, 2309, 0, 1}, {0, 2303, 0, 1}, {0, 13, 0, 1},
+    {0, 6, 0, 1}, {0, 7, 0, 1}, {0, 2304, 0, 1}, {0, 2305, 0, 1},
+    {0, 2306, 0, 1}, {0, 2307, 0, 1}, {0, 2308, 0, 1}, {0, 2309, 0, 1},
+    {0, 2303, 0, 1}, {0, 13, 0, 1}, {0, 6, 0, 1}, {0, 7, 0, 1},
+    {0, 2304, 0, 1}, {0, 2305, 0, 1}, {0, 2306, 0, 1}, {0, 2307, 0, 1},
+    {0, 2308, 0, 1}, {0, 2309, 0, 1}, {0, 2303, 0, 1}, {0, 13, 0, 1},
+    {0, 6, 0, 1}, {0, 7, 0, 1}, {0, 2304, 0, 1}, {0, 2305, 0, 1},
+    {0, 2306, 0, 1}, {0, 2307, 0, 1}, {0, 2308, 0, 1}, {0, 2309, 0, 1},
+    {5909, 5909, 1, 1}, {5910, 5910, 1, 1}, {5911, 5911, 1, 1}, {5912, 5912, 1, 1},
+    {5913, 5913, 1, 1}, {4711, 4711, 1, 1}, {5914, 5914, 1, 1}, {5915, 5915, 1, 1},
+    {5916, 5916, 1, 1}, {5917, 5917, 1, 1}, {4712, 4712, 1, 1}, {5918, 5918, 1, 1},
+    {5919, 5919, 1, 1}, {5920, 5920, 1, 1}, {4713, 4713, 1, 1}, {5921, 5921, 1, 1},
+    {5922, 5922, 1, 1}, {5923, 5923, 1, 1}, {5924, 5924, 1, 1}, {5925, 5925, 1, 1},
+    {5926, 5926, 1, 1}, {5927, 5927, 1, 1}, {5928, 5928, 1, 1}, {5929, 5929, 1, 1},
+    {5930, 5930, 1, 1}, {5931, 5931, 1, 1}, {5932, 5932, 1, 1}, {4765, 4765, 1, 1},
+    {5933, 5933, 1, 1}, {2804, 2804, 1, 1}, {5934, 5934, 1, 1}, {5935, 5935, 1, 1},
+    {5936, 5936, 1, 1}, {5937, 5937, 1, 1}, {5938, 5938, 1, 1}, {5939, 5939, 1, 1},
+    {5940, 5940, 1, 1}, {4770, 4770, 1, 1}, {4714, 4714, 1, 1}, {4715, 4715, 1, 1},
+    {4771, 4771, 1, 1}, {5941, 5941, 1, 1}, {5942, 5942, 1, 1}, {4534, 4534, 1, 1},
+    {5943, 5943, 1, 1}, {4716, 4716, 1, 1}, {5944, 5944, 1, 1}, {5945, 5945, 1, 1},
+    {5946, 5946, 1, 1}, {5947, 5947, 1, 1}, {5947, 5947, 1, 1}, {5947, 5947, 1, 1},
+    {5948, 5948, 1, 1}, {5949, 5949, 1, 1}, {5950, 5950, 1, 1}, {5951, 5951, 1, 1},
+    {5952, 5952, 1, 1}, {5953, 5953, 1, 1}, {5954, 5954, 1, 1}, {5955, 5955, 1, 1},
+    {5956, 5956, 1, 1}, {5957, 5957, 1, 1}, {5958, 5958, 1, 1}, {5959, 5959, 1, 1},
+    {5960, 5960, 1, 1}, {5961, 5961, 1, 1}, {5962, 5962, 1, 1}, {5963, 5963, 1, 1},
+    {5964, 5964, 1, 1}, {5965, 5965, 1, 1}, {5965, 5965, 1, 1}, {4773, 4773, 1, 1},
+    {5966, 5966, 1, 1}, {5967, 5967, 1, 1}, {5968, 5968, 1, 1}, {5969, 5969, 1, 1},
+    {4718, 4718, 1, 1}, {5970, 5970, 1, 1}, {5971, 5971, 1, 1}, {5972, 5972, 1, 1},
+    {4680, 4680, 1, 1}, {5973, 5973, 1, 1}, {5974, 5974, 1, 1}, {5975, 5975, 1, 1},
+    {5976, 5976, 1, 1}, {5977, 5977, 1, 1}, {5978, 5978, 1, 1}, {5979, 5979, 1, 1},
+    {5980, 5980, 1, 1}, {5981, 5981, 1, 1}, {5982, 5982, 1, 1}, {5983, 5983, 1, 1},
+    {5984, 5984, 1, 1}, {5985, 5985, 1, 1}, {5986, 5986, 1, 1}, {5987, 5987, 1, 1},
+    {5988, 5988, 1, 1}, {5989, 5989, 1, 1}, {5990, 5990, 1, 1}, {5991, 5991, 1, 1},
+    {5992, 5992, 1, 1}, {5993, 5993, 1, 1}, {5994, 5994, 1, 1}, {5995, 5995, 1, 1},
+    {5996, 5996, 1, 1}, {5997, 5997, 1, 1}, {5998, 5998, 1, 1}, {5998, 5998, 1, 1},
+    {5999, 5999, 1, 1}, {6000, 6000, 1, 1}, {6001, 6001, 1, 1}, {4530, 4530, 1, 1},
+    {6002, 6002, 1, 1}, {6003, 6003, 1, 1}, {6004, 6004, 1, 1}, {6005, 6005, 1, 1},
+    {6006, 6006, 1, 1}, {2830, 2830, 1, 1}, {6007, 6007, 1, 1}, {6008, 6008, 1, 1},
+    {2832, 2832, 1, 1}, {6009, 6009, 1, 1}, {6010, 6010, 1, 1}, {6011, 6011, 1, 1},
+    {6012, 6012, 1, 1}, {6013, 6013, 1, 1}, {6014, 6014, 1, 1}, {6015, 6015, 1, 1},
+    {6016, 6016, 1, 1}, {6017, 6017, 1, 1}, {6018, 6018, 1, 1}, {6019, 6019, 1, 1},
+    {6020, 6020, 1, 1}, {6021, 6021, 1, 1}, {6022, 6022, 1, 1}, {6023, 6023, 1, 1},
+    {6024, 6024, 1, 1}, {6025, 6025, 1, 1}, {6026, 6026, 1, 1}, {6027, 6027, 1, 1},
+    {6028, 6028, 1, 1}, {6029, 6029, 1, 1}, {4478, 4478, 1, 1}, {6030, 6030, 1, 1},
+    {2842, 2842, 1, 1}, {6031, 6031, 1, 1}, {6031, 6031, 1, 1}, {6032, 6032, 1, 1},
+    {6033, 6033, 1, 1}, {6033, 6033, 1, 1}, {6034, 6034, 1, 1}, {6035, 6035, 1, 1},
+    {6036, 6036, 1, 1}, {6037, 6037, 1, 1}, {6038, 6038, 1, 1}, {6039, 6039, 1, 1},
+    {6040, 6040, 1, 1}, {6041, 6041, 1, 1}, {6042, 6042, 1, 1}, {6043, 6043, 1, 1},
+    {6044, 6044, 1, 1}, {6045, 6045, 1, 1}, {6046, 6046, 1, 1}, {4723, 4723, 1, 1},
+    {6047, 6047, 1, 1}, {6048, 6048, 1, 1}, {6049, 6049, 1, 1}, {6050, 6050, 1, 1},
+    {4785, 4785, 1, 1}, {6050, 6050, 1, 1}, {6051, 6051, 1, 1}, {4725, 4725, 1, 1},
+    {6052, 6052, 1, 1}, {6053, 6053, 1, 1}, {6054, 6054, 1, 1}, {6055, 6055, 1, 1},
+    {4726, 4726, 1, 1}, {4451, 4451, 1, 1}, {6056, 6056, 1, 1}, {6057, 6057, 1, 1},
+    {6058, 6058, 1, 1}, {6059, 6059, 1, 1}, {6060, 6060, 1, 1}, {6061, 6061, 1, 1},
+    {6062, 6062, 1, 1}, {6063, 6063, 1, 1}, {6064, 6064, 1, 1}, {6065, 6065, 1, 1},
+    {6066, 6066, 1, 1}, {6067, 6067, 1, 1}, {6068, 6068, 1, 1}, {6069, 6069, 1, 1},
+    {6070, 6070, 1, 1}, {6071, 6071, 1, 1}, {6072, 6072, 1, 1}, {6073, 6073, 1, 1},
+    {6074, 6074, 1, 1}, {6075, 6075, 1, 1}, {6076, 6076, 1, 1}, {6077, 6077, 1, 1},
+    {4727, 4727, 1, 1}, {6078, 6078, 1, 1}, {6079, 6079, 1, 1}, {6080, 6080, 1, 1},
+    {6081, 6081, 1, 1}, {6082, 6082, 1, 1}, {6083, 6083, 1, 1}, {4729, 4729, 1, 1},
+    {6084, 6084, 1, 1}, {6085, 6085, 1, 1}, {6086, 6086, 1, 1}, {6087, 6087, 1, 1},
+    {6088, 6088, 1, 1}, {6089, 6089, 1, 1}, {6090, 6090, 1, 1}, {6091, 6091, 1, 1},
+    {4479, 4479, 1, 1}, {4793, 4793, 1, 1}, {6092, 6092, 1, 1}, {6093, 6093, 1, 1},
+    {6094, 6094, 1, 1}, {6095, 6095, 1, 1}, {6096, 6096, 1, 1}, {6097, 6097, 1, 1},
+    {6098, 6098, 1, 1}, {6099, 6099, 1, 1}, {4730, 4730, 1, 1}, {6100, 6100, 1, 1},
+    {6101, 6101, 1, 1}, {6102, 6102, 1, 1}, {6103, 6103, 1, 1}, {4835, 4835, 1, 1},
+    {6104, 6104, 1, 1}, {6105, 6105, 1, 1}, {6106, 6106, 1, 1}, {6107, 6107, 1, 1},
+    {6108, 6108, 1, 1}, {6109, 6109, 1, 1}, {6110, 6110, 1, 1}, {6111, 6111, 1, 1},
+    {6112, 6112, 1, 1}, {6113, 6113, 1, 1}, {6114, 6114, 1, 1}, {6115, 6115, 1, 1},
+    {6116, 6116, 1, 1}, {4547, 4547, 1, 1}, {6117, 6117, 1, 1}, {6118, 6118, 1, 1},
+    {6119, 6119, 1, 1}, {6120, 6120, 1, 1}, {6121, 6121, 1, 1}, {6122, 6122, 1, 1},
+    {6123, 6123, 1, 1}, {6124, 6124, 1, 1}, {6125, 6125, 1, 1}, {6126, 6126, 1, 1},
+    {6127, 6127, 1, 1}, {4731, 4731, 1, 1}, {4630, 4630, 1, 1}, {6128, 6128, 1, 1},
+    {6129, 6129, 1, 1}, {6130, 6130, 1, 1}, {6131, 6131, 1, 1}, {6132, 6132, 1, 1},
+    {6133, 6133, 1, 1}, {6134, 6134, 1, 1}, {6135, 6135, 1, 1}, {4796, 4796, 1, 1},
+    {6136, 6136, 1, 1}, {6137, 6137, 1, 1}, {6138, 6138, 1, 1}, {6139, 6139, 1, 1},
+    {6140, 6140, 1, 1}, {6141, 6141, 1, 1}, {6142, 6142, 1, 1}, {6143, 6143, 1, 1},
+    {4797, 4797, 1, 1}, {6144, 6144, 1, 1}, {6145, 6145, 1, 1}, {6146, 6146, 1, 1},
+    {6147, 6147, 1, 1}, {6148, 6148, 1, 1}, {6149, 6149, 1, 1}, {6150, 6150, 1, 1},
+    {6151, 6151, 1, 1}, {6152, 6152, 1, 1}, {6153, 6153, 1, 1}, {6154, 6154, 1, 1},
+    {6155, 6155, 1, 1}, {4799, 4799, 1, 1}, {6156, 6156, 1, 1}, {6157, 6157, 1, 1},
+    {6158, 6158, 1, 1}, {6159, 6159, 1, 1}, {6160, 6160, 1, 1}, {6161, 6161, 1, 1},
+    {6162, 6162, 1, 1}, {6163, 6163, 1, 1}, {6164, 6164, 1, 1}, {6165, 6165, 1, 1},
+    {6166, 6166, 1, 1}, {6166, 6166, 1, 1}, {6167, 6167, 1, 1}, {6168, 6168, 1, 1},
+    {4801, 4801, 1, 1}, {6169, 6169, 1, 1}, {6170, 6170, 1, 1}, {6171, 6171, 1, 1},
+    {6172, 6172, 1, 1}, {6173, 6173, 1, 1}, {6174, 6174, 1, 1}, {6175, 6175, 1, 1},
+    {4533, 4533, 1, 1}, {6176, 6176, 1, 1}, {6177, 6177, 1, 1}, {6178, 6178, 1, 1},
+    {6179, 6179, 1, 1}, {6180, 6180, 1, 1}, {6181, 6181, 1, 1}, {6182, 6182, 1, 1},
+    {4807, 4807, 1, 1}, {6183, 6183, 1, 1}, {6184, 6184, 1, 1}, {6185, 6185, 1, 1},
+    {6186, 6186, 1, 1}, {6187, 6187, 1, 1}, {6188, 6188, 1, 1}, {6188, 6188, 1, 1},
+    {4808, 4808, 1, 1}, {4837, 4837, 1, 1}, {6189, 6189, 1, 1}, {6190, 6190, 1, 1},
+    {6191, 6191, 1, 1}, {6192, 6192, 1, 1}, {6193, 6193, 1, 1}, {4496, 4496, 1, 1},
+    {4810, 4810, 1, 1}, {6194, 6194, 1, 1}, {6195, 6195, 1, 1}, {4741, 4741, 1, 1},
+    {6196, 6196, 1, 1}, {6197, 6197, 1, 1}, {4700, 4700, 1, 1}, {6198, 6198, 1, 1},
+    {6199, 6199, 1, 1}, {4744, 4744, 1, 1}, {6200, 6200, 1, 1}, {6201, 6201, 1, 1},
+    {6202, 6202, 1, 1}, {6203, 6203, 1, 1}, {6203, 6203, 1, 1}, {6204, 6204, 1, 1},
+    {6205, 6205, 1, 1}, {6206, 6206, 1, 1}, {6207, 6207, 1, 1}, {6208, 6208, 1, 1},
+    {6209, 6209, 1, 1}, {6210, 6210, 1, 1}, {6211, 6211, 1, 1}, {6212, 6212, 1, 1},
+    {6213, 6213, 1, 1}, {6214, 6214, 1, 1}, {6215, 6215, 1, 1}, {6216, 6216, 1, 1},
+    {6217, 6217, 1, 1}, {6218, 6218, 1, 1}, {6219, 6219, 1, 1}, {6220, 6220, 1, 1},
+    {6221, 6221, 1, 1}, {6222, 6222, 1, 1}, {6223, 6223, 1, 1}, {6224, 6224, 1, 1},
+    {6225, 6225, 1, 1}, {6226, 6226, 1, 1}, {6227, 6227, 1, 1}, {6228, 6228, 1, 1},
+    {6229, 6229, 1, 1}, {6230, 6230, 1, 1}, {4750, 4750, 1, 1}, {6231, 6231, 1, 1},
+    {6232, 6232, 1, 1}, {6233, 6233, 1, 1}, {6234, 6234, 1, 1}, {6235, 6235, 1, 1},
+    {6236, 6236, 1, 1}, {6237, 6237, 1, 1}, {6238, 6238, 1, 1}, {6239, 6239, 1, 1},
+    {6240, 6240, 1, 1}, {6241, 6241, 1, 1}, {6242, 6242, 1, 1}, {6243, 6243, 1, 1},
+    {6244, 6244, 1, 1}, {6245, 6245, 1, 1}, {6246, 6246, 1, 1}, {6032, 6032, 1, 1},
+    {6247, 6247, 1, 1}, {6248, 6248, 1, 1}, {6249, 6249, 1, 1}, {6250, 6250, 1, 1},
+    {6251, 6251, 1, 1}, {6252, 6252, 1, 1}, {6253, 6253, 1, 1}, {6254, 6254, 1, 1},
+    {6255, 6255, 1, 1}, {6256, 6256, 1, 1}, {6257, 6257, 1, 1}, {6258, 6258, 1, 1},
+    {4550, 4550, 1, 1}, {6259, 6259, 1, 1}, {6260, 6260, 1, 1}, {6261, 6261, 1, 1},
+    {6262, 6262, 1, 1}, {6263, 6263, 1, 1}, {6264, 6264, 1, 1}, {4753, 4753, 1, 1},
+    {6265, 6265, 1, 1}, {6266, 6266, 1, 1}, {6267, 6267, 1, 1}, {6268, 6268, 1, 1},
+    {6269, 6269, 1, 1}, {6270, 6270, 1, 1}, {6271, 6271, 1, 1}, {6272, 6272, 1, 1},
+    {6273, 6273, 1, 1}, {6274, 6274, 1, 1}, {6275, 6275, 1, 1}, {6276, 6276, 1, 1},
+    {6277, 6277, 1, 1}, {6278, 6278, 1, 1}, {6279, 6279, 1, 1}, {6280, 6280, 1, 1},
+    {6281, 6281, 1, 1}, {6282, 6282, 1, 1}, {6283, 6283, 1, 1}, {6284, 6284, 1, 1},
+    {4491, 4491, 1, 1}, {6285, 6285, 1, 1}, {6286, 6286, 1, 1}, {6287, 6287, 1, 1},
+    {6288, 6288, 1, 1}, {6289, 6289, 1, 1}, {6290, 6290, 1, 1}, {4817, 4817, 1, 1},
+    {6291, 6291, 1, 1}, {6292, 6292, 1, 1}, {6293, 6293, 1, 1}, {6294, 6294, 1, 1},
+    {6295, 6295, 1, 1}, {6296, 6296, 1, 1}, {6297, 6297, 1, 1}, {6298, 6298, 1, 1},
+    {2932, 2932, 1, 1}, {6299, 6299, 1, 1}, {6300, 6300, 1, 1}, {6301, 6301, 1, 1},
+    {6302, 6302, 1, 1}, {6303, 6303, 1, 1}, {6304, 6304, 1, 1}, {6305, 6305, 1, 1},
+    {6306, 6306, 1, 1}, {6307, 6307, 1, 1}, {6308, 6308, 1, 1}, {6309, 6309, 1, 1},
+    {4822, 4822, 1, 1}, {4823, 4823, 1, 1}, {2939, 2939, 1, 1}, {6310, 6310, 1, 1},
+    {6311, 6311, 1, 1}, {6312, 6312, 1, 1}, {6313, 6313, 1, 1}, {6314, 6314, 1, 1},
+    {6315, 6315, 1, 1}, {6316, 6316, 1, 1}, {6317, 6317, 1, 1}, {6318, 6318, 1, 1},
+    {6319, 6319, 1, 1}, {6320, 6320, 1, 1}, {6321, 6321, 1, 1}, {4824, 4824, 1, 1},
+    {6322, 6322, 1, 1}, {6323, 6323, 1, 1}, {6324, 6324, 1, 1}, {6325, 6325, 1, 1},
+    {6326, 6326, 1, 1}, {6327, 6327, 1, 1}, {6328, 6328, 1, 1}, {6329, 6329, 1, 1},
+    {6330, 6330, 1, 1}, {6331, 6331, 1, 1}, {6332, 6332, 1, 1}, {6333, 6333, 1, 1},
+    {6334, 6334, 1, 1}, {6335, 6335, 1, 1}, {6336, 6336, 1, 1}, {6337, 6337, 1, 1},
+    {6338, 6338, 1, 1}, {6339, 6339, 1, 1}, {6340, 6340, 1, 1}, {6341, 6341, 1, 1},
+    {6342, 6342, 1, 1}, {6343, 6343, 1, 1}, {6344, 6344, 1, 1}, {6345, 6345, 1, 1},
+    {6346, 6346, 1, 1}, {6347, 6347, 1, 1}, {6348, 6348, 1, 1}, {6349, 6349, 1, 1},
+    {6350, 6350, 1, 1}, {6351, 6351, 1, 1}, {4830, 4830, 1, 1}, {4830, 4830, 1, 1},
+    {6352, 6352, 1, 1}, {6353, 6353, 1, 1}, {6354, 6354, 1, 1}, {6355, 6355, 1, 1},
+    {6356, 6356, 1, 1}, {6357, 6357, 1, 1}, {6358, 6358, 1, 1}, {6359, 6359, 1, 1},
+    {6360, 6360, 1, 1}, {6361, 6361, 1, 1}, {4831, 4831, 1, 1}, {6362, 6362, 1, 1},
+    {6363, 6363, 1, 1}, {6364, 6364, 1, 1}, {6365, 6365, 1, 1}, {6366, 6366, 1, 1},
+    {6367, 6367, 1, 1}, {6368, 6368, 1, 1}, {6369, 6369, 1, 1}, {6370, 6370, 1, 1},
+    {6371, 6371, 1, 1}, {2987, 2987, 1, 1}, {6372, 6372, 1, 1}, {2991, 2991, 1, 1},
+    {6373, 6373, 1, 1}, {6374, 6374, 1, 1}, {6375, 6375, 1, 1}, {6376, 6376, 1, 1},
+    {2996, 2996, 1, 1}, {6377, 6377, 1, 1},
+};
+
+const wq::uint32 uc_decomposition_map[] = {
+    0x20, 0x20, 0x308, 0x61, 0x20, 0x304, 0x32, 0x33,
+    0x20, 0x301, 0x3bc, 0x20, 0x327, 0x31, 0x6f, 0x31,
+    0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34,
+    0x41, 0x300, 0x41, 0x301, 0x41, 0x302, 0x41, 0x303,
+    0x41, 0x308, 0x41, 0x30a, 0x43, 0x327, 0x45, 0x300,
+    0x45, 0x301, 0x45, 0x302, 0x45, 0x308, 0x49, 0x300,
+    0x49, 0x301, 0x49, 0x302, 0x49, 0x308, 0x4e, 0x303,
+    0x4f, 0x300, 0x4f, 0x301, 0x4f, 0x302, 0x4f, 0x303,
+    0x4f, 0x308, 0x55, 0x300, 0x55, 0x301, 0x55, 0x302,
+    0x55, 0x308, 0x59, 0x301, 0x61, 0x300, 0x61, 0x301,
+    0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30a,
+    0x63, 0x327, 0x65, 0x300, 0x65, 0x301, 0x65, 0x302,
+    0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302,
+    0x69, 0x308, 0x6e, 0x303, 0x6f, 0x300, 0x6f, 0x301,
+    0x6f, 0x302, 0x6f, 0x303, 0x6f, 0x308, 0x75, 0x300,
+    0x75, 0x301, 0x75, 0x302, 0x75, 0x308, 0x79, 0x301,
+    0x79, 0x308, 0x41, 0x304, 0x61, 0x304, 0x41, 0x306,
+    0x61, 0x306, 0x41, 0x328, 0x61, 0x328, 0x43, 0x301,
+    0x63, 0x301, 0x43, 0x302, 0x63, 0x302, 0x43, 0x307,
+    0x63, 0x307, 0x43, 0x30c, 0x63, 0x30c, 0x44, 0x30c,
+    0x64, 0x30c, 0x45, 0x304, 0x65, 0x304, 0x45, 0x306,
+    0x65, 0x306, 0x45, 0x307, 0x65, 0x307, 0x45, 0x328,
+    0x65, 0x328, 0x45, 0x30c, 0x65, 0x30c, 0x47, 0x302,
+    0x67, 0x302, 0x47, 0x306, 0x67, 0x306, 0x47, 0x307,
+    0x67, 0x307, 0x47, 0x327, 0x67, 0x327, 0x48, 0x302,
+    0x68, 0x302, 0x49, 0x303, 0x69, 0x303, 0x49, 0x304,
+    0x69, 0x304, 0x49, 0x306, 0x69, 0x306, 0x49, 0x328,
+    0x69, 0x328, 0x49, 0x307, 0x49, 0x4a, 0x69, 0x6a,
+    0x4a, 0x302, 0x6a, 0x302, 0x4b, 0x327, 0x6b, 0x327,
+    0x4c, 0x301, 0x6c, 0x301, 0x4c, 0x327, 0x6c, 0x327,
+    0x4c, 0x30c, 0x6c, 0x30c, 0x4c, 0xb7, 0x6c, 0xb7,
+    0x4e, 0x301, 0x6e, 0x301, 0x4e, 0x327, 0x6e, 0x327,
+    0x4e, 0x30c, 0x6e, 0x30c, 0x2bc, 0x6e, 0x4f, 0x304,
+    0x6f, 0x304, 0x4f, 0x306, 0x6f, 0x306, 0x4f, 0x30b,
+    0x6f, 0x30b, 0x52, 0x301, 0x72, 0x301, 0x52, 0x327,
+    0x72, 0x327, 0x52, 0x30c, 0x72, 0x30c, 0x53, 0x301,
+    0x73, 0x301, 0x53, 0x302, 0x73, 0x302, 0x53, 0x327,
+    0x73, 0x327, 0x53, 0x30c, 0x73, 0x30c, 0x54, 0x327,
+    0x74, 0x327, 0x54, 0x30c, 0x74, 0x30c, 0x55, 0x303,
+    0x75, 0x303, 0x55, 0x304, 0x75, 0x304, 0x55, 0x306,
+    0x75, 0x306, 0x55, 0x30a, 0x75, 0x30a, 0x55, 0x30b,
+    0x75, 0x30b, 0x55, 0x328, 0x75, 0x328, 0x57, 0x302,
+    0x77, 0x302, 0x59, 0x302, 0x79, 0x302, 0x59, 0x308,
+    0x5a, 0x301, 0x7a, 0x301, 0x5a, 0x307, 0x7a, 0x307,
+    0x5a, 0x30c, 0x7a, 0x30c, 0x73, 0x4f, 0x31b, 0x6f,
+    0x31b, 0x55, 0x31b, 0x75, 0x31b, 0x44, 0x5a, 0x30c,
+    0x44, 0x7a, 0x30c, 0x64, 0x7a, 0x30c, 0x4c, 0x4a,
+    0x4c, 0x6a, 0x6c, 0x6a, 0x4e, 0x4a, 0x4e, 0x6a,
+    0x6e, 0x6a, 0x41, 0x30c, 0x61, 0x30c, 0x49, 0x30c,
+    0x69, 0x30c, 0x4f, 0x30c, 0x6f, 0x30c, 0x55, 0x30c,
+    0x75, 0x30c, 0x55, 0x308, 0x304, 0x75, 0x308, 0x304,
+    0x55, 0x308, 0x301, 0x75, 0x308, 0x301, 0x55, 0x308,
+    0x30c, 0x75, 0x308, 0x30c, 0x55, 0x308, 0x300, 0x75,
+    0x308, 0x300, 0x41, 0x308, 0x304, 0x61, 0x308, 0x304,
+    0x41, 0x307, 0x304, 0x61, 0x307, 0x304, 0xc6, 0x304,
+    0xe6, 0x304, 0x47, 0x30c, 0x67, 0x30c, 0x4b, 0x30c,
+    0x6b, 0x30c, 0x4f, 0x328, 0x6f, 0x328, 0x4f, 0x328,
+    0x304, 0x6f, 0x328, 0x304, 0x1b7, 0x30c, 0x292, 0x30c,
+    0x6a, 0x30c, 0x44, 0x5a, 0x44, 0x7a, 0x64, 0x7a,
+    0x47, 0x301, 0x67, 0x301, 0x4e, 0x300, 0x6e, 0x300,
+    0x41, 0x30a, 0x301, 0x61, 0x30a, 0x301, 0xc6, 0x301,
+    0xe6, 0x301, 0xd8, 0x301, 0xf8, 0x301, 0x41, 0x30f,
+    0x61, 0x30f, 0x41, 0x311, 0x61, 0x311, 0x45, 0x30f,
+    0x65, 0x30f, 0x45, 0x311, 0x65, 0x311, 0x49, 0x30f,
+    0x69, 0x30f, 0x49, 0x311, 0x69, 0x311, 0x4f, 0x30f,
+    0x6f, 0x30f, 0x4f, 0x311, 0x6f, 0x311, 0x52, 0x30f,
+    0x72, 0x30f, 0x52, 0x311, 0x72, 0x311, 0x55, 0x30f,
+    0x75, 0x30f, 0x55, 0x311, 0x75, 0x311, 0x53, 0x326,
+    0x73, 0x326, 0x54, 0x326, 0x74, 0x326, 0x48, 0x30c,
+    0x68, 0x30c, 0x41, 0x307, 0x61, 0x307, 0x45, 0x327,
+    0x65, 0x327, 0x4f, 0x308, 0x304, 0x6f, 0x308, 0x304,
+    0x4f, 0x303, 0x304, 0x6f, 0x303, 0x304, 0x4f, 0x307,
+    0x6f, 0x307, 0x4f, 0x307, 0x304, 0x6f, 0x307, 0x304,
+    0x59, 0x304, 0x79, 0x304, 0x68, 0x266, 0x6a, 0x72,
+    0x279, 0x27b, 0x281, 0x77, 0x79, 0x20, 0x306, 0x20,
+    0x307, 0x20, 0x30a, 0x20, 0x328, 0x20, 0x303, 0x20,
+    0x30b, 0x263, 0x6c, 0x78, 0x295, 0x300, 0x301, 0x313,
+    0x308, 0x301, 0x2b9, 0x20, 0x345, 0x3b, 0xa8, 0x301,
+    0x20, 0x308, 0x301, 0x391, 0x301, 0xb7, 0x395, 0x301,
+    0x397, 0x301, 0x399, 0x301, 0x39f, 0x301, 0x3a5, 0x301,
+    0x3a9, 0x301, 0x3b9, 0x308, 0x301, 0x399, 0x308, 0x3a5,
+    0x308, 0x3b1, 0x301, 0x3b5, 0x301, 0x3b7, 0x301, 0x3b9,
+    0x301, 0x3c5, 0x308, 0x301, 0x3b9, 0x308, 0x3c5, 0x308,
+    0x3bf, 0x301, 0x3c5, 0x301, 0x3c9, 0x301, 0x3b2, 0x3b8,
+    0x3a5, 0x3d2, 0x301, 0x3d2, 0x308, 0x3c6, 0x3c0, 0x3ba,
+    0x3c1, 0x3c2, 0x398, 0x3b5, 0x3a3, 0x415, 0x300, 0x415,
+    0x308, 0x413, 0x301, 0x406, 0x308, 0x41a, 0x301, 0x418,
+    0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306, 0x435,
+    0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308, 0x43a,
+    0x301, 0x438, 0x300, 0x443, 0x306, 0x474, 0x30f, 0x475,
+    0x30f, 0x416, 0x306, 0x436, 0x306, 0x410, 0x306, 0x430,
+    0x306, 0x410, 0x308, 0x430, 0x308, 0x415, 0x306, 0x435,
+    0x306, 0x4d8, 0x308, 0x4d9, 0x308, 0x416, 0x308, 0x436,
+    0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304, 0x438,
+    0x304, 0x418, 0x308, 0x438, 0x308, 0x41e, 0x308, 0x43e,
+    0x308, 0x4e8, 0x308, 0x4e9, 0x308, 0x42d, 0x308, 0x44d,
+    0x308, 0x423, 0x304, 0x443, 0x304, 0x423, 0x308, 0x443,
+    0x308, 0x423, 0x30b, 0x443, 0x30b, 0x427, 0x308, 0x447,
+    0x308, 0x42b, 0x308, 0x44b, 0x308, 0x565, 0x582, 0x627,
+    0x653, 0x627, 0x654, 0x648, 0x654, 0x627, 0x655, 0x64a,
+    0x654, 0x627, 0x674, 0x648, 0x674, 0x6c7, 0x674, 0x64a,
+    0x674, 0x6d5, 0x654, 0x6c1, 0x654, 0x6d2, 0x654, 0x928,
+    0x93c, 0x930, 0x93c, 0x933, 0x93c, 0x915, 0x93c, 0x916,
+    0x93c, 0x917, 0x93c, 0x91c, 0x93c, 0x921, 0x93c, 0x922,
+    0x93c, 0x92b, 0x93c, 0x92f, 0x93c, 0x9c7, 0x9be, 0x9c7,
+    0x9d7, 0x9a1, 0x9bc, 0x9a2, 0x9bc, 0x9af, 0x9bc, 0xa32,
+    0xa3c, 0xa38, 0xa3c, 0xa16, 0xa3c, 0xa17, 0xa3c, 0xa1c,
+    0xa3c, 0xa2b, 0xa3c, 0xb47, 0xb56, 0xb47, 0xb3e, 0xb47,
+    0xb57, 0xb21, 0xb3c, 0xb22, 0xb3c, 0xb92, 0xbd7, 0xbc6,
+    0xbbe, 0xbc7, 0xbbe, 0xbc6, 0xbd7, 0xc46, 0xc56, 0xcbf,
+    0xcd5, 0xcc6, 0xcd5, 0xcc6, 0xcd6, 0xcc6, 0xcc2, 0xcc6,
+    0xcc2, 0xcd5, 0xd46, 0xd3e, 0xd47, 0xd3e, 0xd46, 0xd57,
+    0xdd9, 0xdca, 0xdd9, 0xdcf, 0xdd9, 0xdcf, 0xdca, 0xdd9,
+    0xddf, 0xe4d, 0xe32, 0xecd, 0xeb2, 0xeab, 0xe99, 0xeab,
+    0xea1, 0xf0b, 0xf42, 0xfb7, 0xf4c, 0xfb7, 0xf51, 0xfb7,
+    0xf56, 0xfb7, 0xf5b, 0xfb7, 0xf40, 0xfb5, 0xf71, 0xf72,
+    0xf71, 0xf74, 0xfb2, 0xf80, 0xfb2, 0xf71, 0xf80, 0xfb3,
+    0xf80, 0xfb3, 0xf71, 0xf80, 0xf71, 0xf80, 0xf92, 0xfb7,
+    0xf9c, 0xfb7, 0xfa1, 0xfb7, 0xfa6, 0xfb7, 0xfab, 0xfb7,
+    0xf90, 0xfb5, 0x1025, 0x102e, 0x10dc, 0x1b05, 0x1b35, 0x1b07,
+    0x1b35, 0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11,
+    0x1b35, 0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f,
+    0x1b35, 0x1b42, 0x1b35, 0x41, 0xc6, 0x42, 0x44, 0x45,
+    0x18e, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d,
+    0x4e, 0x4f, 0x222, 0x50, 0x52, 0x54, 0x55, 0x57,
+    0x250, 0x251, 0x1d02, 0x62, 0x64, 0x65, 0x259, 0x25b,
+    0x25c, 0x67, 0x6b, 0x6d, 0x14b, 0x254, 0x1d16, 0x1d17,
+    0x70, 0x74, 0x75, 0x1d1d, 0x26f, 0x76, 0x1d25, 0x3b3,
+    0x3b4, 0x3c7, 0x69, 0x43d, 0x252, 0x63, 0x255, 0xf0,
+    0x66, 0x25f, 0x261, 0x265, 0x268, 0x269, 0x26a, 0x1d7b,
+    0x29d, 0x26d, 0x1d85, 0x29f, 0x271, 0x270, 0x272, 0x273,
+    0x274, 0x275, 0x278, 0x282, 0x283, 0x1ab, 0x289, 0x28a,
+    0x1d1c, 0x28b, 0x28c, 0x7a, 0x290, 0x291, 0x292, 0x41,
+    0x325, 0x61, 0x325, 0x42, 0x307, 0x62, 0x307, 0x42,
+    0x323, 0x62, 0x323, 0x42, 0x331, 0x62, 0x331, 0x43,
+    0x327, 0x301, 0x63, 0x327, 0x301, 0x44, 0x307, 0x64,
+    0x307, 0x44, 0x323, 0x64, 0x323, 0x44, 0x331, 0x64,
+    0x331, 0x44, 0x327, 0x64, 0x327, 0x44, 0x32d, 0x64,
+    0x32d, 0x45, 0x304, 0x300, 0x65, 0x304, 0x300, 0x45,
+    0x304, 0x301, 0x65, 0x304, 0x301, 0x45, 0x32d, 0x65,
+    0x32d, 0x45, 0x330, 0x65, 0x330, 0x45, 0x327, 0x306,
+    0x65, 0x327, 0x306, 0x46, 0x307, 0x66, 0x307, 0x47,
+    0x304, 0x67, 0x304, 0x48, 0x307, 0x68, 0x307, 0x48,
+    0x323, 0x68, 0x323, 0x48, 0x308, 0x68, 0x308, 0x48,
+    0x327, 0x68, 0x327, 0x48, 0x32e, 0x68, 0x32e, 0x49,
+    0x330, 0x69, 0x330, 0x49, 0x308, 0x301, 0x69, 0x308,
+    0x301, 0x4b, 0x301, 0x6b, 0x301, 0x4b, 0x323, 0x6b,
+    0x323, 0x4b, 0x331, 0x6b, 0x331, 0x4c, 0x323, 0x6c,
+    0x323, 0x4c, 0x323, 0x304, 0x6c, 0x323, 0x304, 0x4c,
+    0x331, 0x6c, 0x331, 0x4c, 0x32d, 0x6c, 0x32d, 0x4d,
+    0x301, 0x6d, 0x301, 0x4d, 0x307, 0x6d, 0x307, 0x4d,
+    0x323, 0x6d, 0x323, 0x4e, 0x307, 0x6e, 0x307, 0x4e,
+    0x323, 0x6e, 0x323, 0x4e, 0x331, 0x6e, 0x331, 0x4e,
+    0x32d, 0x6e, 0x32d, 0x4f, 0x303, 0x301, 0x6f, 0x303,
+    0x301, 0x4f, 0x303, 0x308, 0x6f, 0x303, 0x308, 0x4f,
+    0x304, 0x300, 0x6f, 0x304, 0x300, 0x4f, 0x304, 0x301,
+    0x6f, 0x304, 0x301, 0x50, 0x301, 0x70, 0x301, 0x50,
+    0x307, 0x70, 0x307, 0x52, 0x307, 0x72, 0x307, 0x52,
+    0x323, 0x72, 0x323, 0x52, 0x323, 0x304, 0x72, 0x323,
+    0x304, 0x52, 0x331, 0x72, 0x331, 0x53, 0x307, 0x73,
+    0x307, 0x53, 0x323, 0x73, 0x323, 0x53, 0x301, 0x307,
+    0x73, 0x301, 0x307, 0x53, 0x30c, 0x307, 0x73, 0x30c,
+    0x307, 0x53, 0x323, 0x307, 0x73, 0x323, 0x307, 0x54,
+    0x307, 0x74, 0x307, 0x54, 0x323, 0x74, 0x323, 0x54,
+    0x331, 0x74, 0x331, 0x54, 0x32d, 0x74, 0x32d, 0x55,
+    0x324, 0x75, 0x324, 0x55, 0x330, 0x75, 0x330, 0x55,
+    0x32d, 0x75, 0x32d, 0x55, 0x303, 0x301, 0x75, 0x303,
+    0x301, 0x55, 0x304, 0x308, 0x75, 0x304, 0x308, 0x56,
+    0x303, 0x76, 0x303, 0x56, 0x323, 0x76, 0x323, 0x57,
+    0x300, 0x77, 0x300, 0x57, 0x301, 0x77, 0x301, 0x57,
+    0x308, 0x77, 0x308, 0x57, 0x307, 0x77, 0x307, 0x57,
+    0x323, 0x77, 0x323, 0x58, 0x307, 0x78, 0x307, 0x58,
+    0x308, 0x78, 0x308, 0x59, 0x307, 0x79, 0x307, 0x5a,
+    0x302, 0x7a, 0x302, 0x5a, 0x323, 0x7a, 0x323, 0x5a,
+    0x331, 0x7a, 0x331, 0x68, 0x331, 0x74, 0x308, 0x77,
+    0x30a, 0x79, 0x30a, 0x61, 0x2be, 0x17f, 0x307, 0x41,
+    0x323, 0x61, 0x323, 0x41, 0x309, 0x61, 0x309, 0x41,
+    0x302, 0x301, 0x61, 0x302, 0x301, 0x41, 0x302, 0x300,
+    0x61, 0x302, 0x300, 0x41, 0x302, 0x309, 0x61, 0x302,
+    0x309, 0x41, 0x302, 0x303, 0x61, 0x302, 0x303, 0x41,
+    0x323, 0x302, 0x61, 0x323, 0x302, 0x41, 0x306, 0x301,
+    0x61, 0x306, 0x301, 0x41, 0x306, 0x300, 0x61, 0x306,
+    0x300, 0x41, 0x306, 0x309, 0x61, 0x306, 0x309, 0x41,
+    0x306, 0x303, 0x61, 0x306, 0x303, 0x41, 0x323, 0x306,
+    0x61, 0x323, 0x306, 0x45, 0x323, 0x65, 0x323, 0x45,
+    0x309, 0x65, 0x309, 0x45, 0x303, 0x65, 0x303, 0x45,
+    0x302, 0x301, 0x65, 0x302, 0x301, 0x45, 0x302, 0x300,
+    0x65, 0x302, 0x300, 0x45, 0x302, 0x309, 0x65, 0x302,
+    0x309, 0x45, 0x302, 0x303, 0x65, 0x302, 0x303, 0x45,
+    0x323, 0x302, 0x65, 0x323, 0x302, 0x49, 0x309, 0x69,
+    0x309, 0x49, 0x323, 0x69, 0x323, 0x4f, 0x323, 0x6f,
+    0x323, 0x4f, 0x309, 0x6f, 0x309, 0x4f, 0x302, 0x301,
+    0x6f, 0x302, 0x301, 0x4f, 0x302, 0x300, 0x6f, 0x302,
+    0x300, 0x4f, 0x302, 0x309, 0x6f, 0x302, 0x309, 0x4f,
+    0x302, 0x303, 0x6f, 0x302, 0x303, 0x4f, 0x323, 0x302,
+    0x6f, 0x323, 0x302, 0x4f, 0x31b, 0x301, 0x6f, 0x31b,
+    0x301, 0x4f, 0x31b, 0x300, 0x6f, 0x31b, 0x300, 0x4f,
+    0x31b, 0x309, 0x6f, 0x31b, 0x309, 0x4f, 0x31b, 0x303,
+    0x6f, 0x31b, 0x303, 0x4f, 0x31b, 0x323, 0x6f, 0x31b,
+    0x323, 0x55, 0x323, 0x75, 0x323, 0x55, 0x309, 0x75,
+    0x309, 0x55, 0x31b, 0x301, 0x75, 0x31b, 0x301, 0x55,
+    0x31b, 0x300, 0x75, 0x31b, 0x300, 0x55, 0x31b, 0x309,
+    0x75, 0x31b, 0x309, 0x55, 0x31b, 0x303, 0x75, 0x31b,
+    0x303, 0x55, 0x31b, 0x323, 0x75, 0x31b, 0x323, 0x59,
+    0x300, 0x79, 0x300, 0x59, 0x323, 0x79, 0x323, 0x59,
+    0x309, 0x79, 0x309, 0x59, 0x303, 0x79, 0x303, 0x3b1,
+    0x313, 0x3b1, 0x314, 0x3b1, 0x313, 0x300, 0x3b1, 0x314,
+    0x300, 0x3b1, 0x313, 0x301, 0x3b1, 0x314, 0x301, 0x3b1,
+    0x313, 0x342, 0x3b1, 0x314, 0x342, 0x391, 0x313, 0x391,
+    0x314, 0x391, 0x313, 0x300, 0x391, 0x314, 0x300, 0x391,
+    0x313, 0x301, 0x391, 0x314, 0x301, 0x391, 0x313, 0x342,
+    0x391, 0x314, 0x342, 0x3b5, 0x313, 0x3b5, 0x314, 0x3b5,
+    0x313, 0x300, 0x3b5, 0x314, 0x300, 0x3b5, 0x313, 0x301,
+    0x3b5, 0x314, 0x301, 0x395, 0x313, 0x395, 0x314, 0x395,
+    0x313, 0x300, 0x395, 0x314, 0x300, 0x395, 0x313, 0x301,
+    0x395, 0x314, 0x301, 0x3b7, 0x313, 0x3b7, 0x314, 0x3b7,
+    0x313, 0x300, 0x3b7, 0x314, 0x300, 0x3b7, 0x313, 0x301,
+    0x3b7, 0x314, 0x301, 0x3b7, 0x313, 0x342, 0x3b7, 0x314,
+    0x342, 0x397, 0x313, 0x397, 0x314, 0x397, 0x313, 0x300,
+    0x397, 0x314, 0x300, 0x397, 0x313, 0x301, 0x397, 0x314,
+    0x301, 0x397, 0x313, 0x342, 0x397, 0x314, 0x342, 0x3b9,
+    0x313, 0x3b9, 0x314, 0x3b9, 0x313, 0x300, 0x3b9, 0x314,
+    0x300, 0x3b9, 0x313, 0x301, 0x3b9, 0x314, 0x301, 0x3b9,
+    0x313, 0x342, 0x3b9, 0x314, 0x342, 0x399, 0x313, 0x399,
+    0x314, 0x399, 0x313, 0x300, 0x399, 0x314, 0x300, 0x399,
+    0x313, 0x301, 0x399, 0x314, 0x301, 0x399, 0x313, 0x342,
+    0x399, 0x314, 0x342, 0x3bf, 0x313, 0x3bf, 0x314, 0x3bf,
+    0x313, 0x300, 0x3bf, 0x314, 0x300, 0x3bf, 0x313, 0x301,
+    0x3bf, 0x314, 0x301, 0x39f, 0x313, 0x39f, 0x314, 0x39f,
+    0x313, 0x300, 0x39f, 0x314, 0x300, 0x39f, 0x313, 0x301,
+    0x39f, 0x314, 0x301, 0x3c5, 0x313, 0x3c5, 0x314, 0x3c5,
+    0x313, 0x300, 0x3c5, 0x314, 0x300, 0x3c5, 0x313, 0x301,
+    0x3c5, 0x314, 0x301, 0x3c5, 0x313, 0x342, 0x3c5, 0x314,
+    0x342, 0x3a5, 0x314, 0x3a5, 0x314, 0x300, 0x3a5, 0x314,
+    0x301, 0x3a5, 0x314, 0x342, 0x3c9, 0x313, 0x3c9, 0x314,
+    0x3c9, 0x313, 0x300, 0x3c9, 0x314, 0x300, 0x3c9, 0x313,
+    0x301, 0x3c9, 0x314, 0x301, 0x3c9, 0x313, 0x342, 0x3c9,
+    0x314, 0x342, 0x3a9, 0x313, 0x3a9, 0x314, 0x3a9, 0x313,
+    0x300, 0x3a9, 0x314, 0x300, 0x3a9, 0x313, 0x301, 0x3a9,
+    0x314, 0x301, 0x3a9, 0x313, 0x342, 0x3a9, 0x314, 0x342,
+    0x3b1, 0x300, 0x3b5, 0x300, 0x3b7, 0x300, 0x3b9, 0x300,
+    0x3bf, 0x300, 0x3c5, 0x300, 0x3c9, 0x300, 0x3b1, 0x313,
+    0x345, 0x3b1, 0x314, 0x345, 0x3b1, 0x313, 0x300, 0x345,
+    0x3b1, 0x314, 0x300, 0x345, 0x3b1, 0x313, 0x301, 0x345,
+    0x3b1, 0x314, 0x301, 0x345, 0x3b1, 0x313, 0x342, 0x345,
+    0x3b1, 0x314, 0x342, 0x345, 0x391, 0x313, 0x345, 0x391,
+    0x314, 0x345, 0x391, 0x313, 0x300, 0x345, 0x391, 0x314,
+    0x300, 0x345, 0x391, 0x313, 0x301, 0x345, 0x391, 0x314,
+    0x301, 0x345, 0x391, 0x313, 0x342, 0x345, 0x391, 0x314,
+    0x342, 0x345, 0x3b7, 0x313, 0x345, 0x3b7, 0x314, 0x345,
+    0x3b7, 0x313, 0x300, 0x345, 0x3b7, 0x314, 0x300, 0x345,
+    0x3b7, 0x313, 0x301, 0x345, 0x3b7, 0x314, 0x301, 0x345,
+    0x3b7, 0x313, 0x342, 0x345, 0x3b7, 0x314, 0x342, 0x345,
+    0x397, 0x313, 0x345, 0x397, 0x314, 0x345, 0x397, 0x313,
+    0x300, 0x345, 0x397, 0x314, 0x300, 0x345, 0x397, 0x313,
+    0x301, 0x345, 0x397, 0x314, 0x301, 0x345, 0x397, 0x313,
+    0x342, 0x345, 0x397, 0x314, 0x342, 0x345, 0x3c9, 0x313,
+    0x345, 0x3c9, 0x314, 0x345, 0x3c9, 0x313, 0x300, 0x345,
+    0x3c9, 0x314, 0x300, 0x345, 0x3c9, 0x313, 0x301, 0x345,
+    0x3c9, 0x314, 0x301, 0x345, 0x3c9, 0x313, 0x342, 0x345,
+    0x3c9, 0x314, 0x342, 0x345, 0x3a9, 0x313, 0x345, 0x3a9,
+    0x314, 0x345, 0x3a9, 0x313, 0x300, 0x345, 0x3a9, 0x314,
+    0x300, 0x345, 0x3a9, 0x313, 0x301, 0x345, 0x3a9, 0x314,
+    0x301, 0x345, 0x3a9, 0x313, 0x342, 0x345, 0x3a9, 0x314,
+    0x342, 0x345, 0x3b1, 0x306, 0x3b1, 0x304, 0x3b1, 0x300,
+    0x345, 0x3b1, 0x345, 0x3b1, 0x301, 0x345, 0x3b1, 0x342,
+    0x3b1, 0x342, 0x345, 0x391, 0x306, 0x391, 0x304, 0x391,
+    0x300, 0x391, 0x345, 0x20, 0x313, 0x3b9, 0x20, 0x342,
+    0xa8, 0x342, 0x20, 0x308, 0x342, 0x3b7, 0x300, 0x345,
+    0x3b7, 0x345, 0x3b7, 0x301, 0x345, 0x3b7, 0x342, 0x3b7,
+    0x342, 0x345, 0x395, 0x300, 0x397, 0x300, 0x397, 0x345,
+    0x1fbf, 0x300, 0x20, 0x313, 0x300, 0x1fbf, 0x301, 0x20,
+    0x313, 0x301, 0x1fbf, 0x342, 0x20, 0x313, 0x342, 0x3b9,
+    0x306, 0x3b9, 0x304, 0x3b9, 0x308, 0x300, 0x3b9, 0x342,
+    0x3b9, 0x308, 0x342, 0x399, 0x306, 0x399, 0x304, 0x399,
+    0x300, 0x1ffe, 0x300, 0x20, 0x314, 0x300, 0x1ffe, 0x301,
+    0x20, 0x314, 0x301, 0x1ffe, 0x342, 0x20, 0x314, 0x342,
+    0x3c5, 0x306, 0x3c5, 0x304, 0x3c5, 0x308, 0x300, 0x3c1,
+    0x313, 0x3c1, 0x314, 0x3c5, 0x342, 0x3c5, 0x308, 0x342,
+    0x3a5, 0x306, 0x3a5, 0x304, 0x3a5, 0x300, 0x3a1, 0x314,
+    0xa8, 0x300, 0x20, 0x308, 0x300, 0x60, 0x3c9, 0x300,
+    0x345, 0x3c9, 0x345, 0x3c9, 0x301, 0x345, 0x3c9, 0x342,
+    0x3c9, 0x342, 0x345, 0x39f, 0x300, 0x3a9, 0x300, 0x3a9,
+    0x345, 0xb4, 0x20, 0x314, 0x2002, 0x2003, 0x2010, 0x20,
+    0x333, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2032,
+    0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035,
+    0x2035, 0x21, 0x21, 0x20, 0x305, 0x3f, 0x3f, 0x3f,
+    0x21, 0x21, 0x3f, 0x2032, 0x2032, 0x2032, 0x2032, 0x30,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2b, 0x2212,
+    0x3d, 0x28, 0x29, 0x6e, 0x52, 0x73, 0x61, 0x2f,
+    0x63, 0x61, 0x2f, 0x73, 0x43, 0xb0, 0x43, 0x63,
+    0x2f, 0x6f, 0x63, 0x2f, 0x75, 0x190, 0xb0, 0x46,
+    0x127, 0x4e, 0x6f, 0x51, 0x53, 0x4d, 0x54, 0x45,
+    0x4c, 0x54, 0x4d, 0x5a, 0x3a9, 0x46, 0x5d0, 0x5d1,
+    0x5d2, 0x5d3, 0x46, 0x41, 0x58, 0x393, 0x3a0, 0x2211,
+    0x31, 0x2044, 0x33, 0x32, 0x2044, 0x33, 0x31, 0x2044,
+    0x35, 0x32, 0x2044, 0x35, 0x33, 0x2044, 0x35, 0x34,
+    0x2044, 0x35, 0x31, 0x2044, 0x36, 0x35, 0x2044, 0x36,
+    0x31, 0x2044, 0x38, 0x33, 0x2044, 0x38, 0x35, 0x2044,
+    0x38, 0x37, 0x2044, 0x38, 0x31, 0x2044, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x56, 0x56, 0x56, 0x49,
+    0x56, 0x49, 0x49, 0x56, 0x49, 0x49, 0x49, 0x49,
+    0x58, 0x58, 0x58, 0x49, 0x58, 0x49, 0x49, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x69,
+    0x76, 0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69,
+    0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x2190, 0x338,
+    0x2192, 0x338, 0x2194, 0x338, 0x21d0, 0x338, 0x21d4, 0x338,
+    0x21d2, 0x338, 0x2203, 0x338, 0x2208, 0x338, 0x220b, 0x338,
+    0x2223, 0x338, 0x2225, 0x338, 0x222b, 0x222b, 0x222b, 0x222b,
+    0x222b, 0x222e, 0x222e, 0x222e, 0x222e, 0x222e, 0x223c, 0x338,
+    0x2243, 0x338, 0x2245, 0x338, 0x2248, 0x338, 0x3d, 0x338,
+    0x2261, 0x338, 0x224d, 0x338, 0x3c, 0x338, 0x3e, 0x338,
+    0x2264, 0x338, 0x2265, 0x338, 0x2272, 0x338, 0x2273, 0x338,
+    0x2276, 0x338, 0x2277, 0x338, 0x227a, 0x338, 0x227b, 0x338,
+    0x2282, 0x338, 0x2283, 0x338, 0x2286, 0x338, 0x2287, 0x338,
+    0x22a2, 0x338, 0x22a8, 0x338, 0x22a9, 0x338, 0x22ab, 0x338,
+    0x227c, 0x338, 0x227d, 0x338, 0x2291, 0x338, 0x2292, 0x338,
+    0x22b2, 0x338, 0x22b3, 0x338, 0x22b4, 0x338, 0x22b5, 0x338,
+    0x3008, 0x3009, 0x31, 0x30, 0x31, 0x31, 0x31, 0x32,
+    0x31, 0x33, 0x31, 0x34, 0x31, 0x35, 0x31, 0x36,
+    0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32, 0x30,
+    0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28, 0x33,
+    0x29, 0x28, 0x34, 0x29, 0x28, 0x35, 0x29, 0x28,
+    0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29,
+    0x28, 0x39, 0x29, 0x28, 0x31, 0x30, 0x29, 0x28,
+    0x31, 0x31, 0x29, 0x28, 0x31, 0x32, 0x29, 0x28,
+    0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28,
+    0x31, 0x35, 0x29, 0x28, 0x31, 0x36, 0x29, 0x28,
+    0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29, 0x28,
+    0x31, 0x39, 0x29, 0x28, 0x32, 0x30, 0x29, 0x31,
+    0x2e, 0x32, 0x2e, 0x33, 0x2e, 0x34, 0x2e, 0x35,
+    0x2e, 0x36, 0x2e, 0x37, 0x2e, 0x38, 0x2e, 0x39,
+    0x2e, 0x31, 0x30, 0x2e, 0x31, 0x31, 0x2e, 0x31,
+    0x32, 0x2e, 0x31, 0x33, 0x2e, 0x31, 0x34, 0x2e,
+    0x31, 0x35, 0x2e, 0x31, 0x36, 0x2e, 0x31, 0x37,
+    0x2e, 0x31, 0x38, 0x2e, 0x31, 0x39, 0x2e, 0x32,
+    0x30, 0x2e, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29,
+    0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65,
+    0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28,
+    0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6a, 0x29,
+    0x28, 0x6b, 0x29, 0x28, 0x6c, 0x29, 0x28, 0x6d,
+    0x29, 0x28, 0x6e, 0x29, 0x28, 0x6f, 0x29, 0x28,
+    0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72, 0x29,
+    0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75,
+    0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29, 0x28,
+    0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7a, 0x29,
+    0x53, 0x59, 0x71, 0x222b, 0x222b, 0x222b, 0x222b, 0x3a,
+    0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x2add,
+    0x338, 0x2d61, 0x6bcd, 0x9f9f, 0x4e00, 0x4e28, 0x4e36, 0x4e3f,
+    0x4e59, 0x4e85, 0x4e8c, 0x4ea0, 0x4eba, 0x513f, 0x5165, 0x516b,
+    0x5182, 0x5196, 0x51ab, 0x51e0, 0x51f5, 0x5200, 0x529b, 0x52f9,
+    0x5315, 0x531a, 0x5338, 0x5341, 0x535c, 0x5369, 0x5382, 0x53b6,
+    0x53c8, 0x53e3, 0x56d7, 0x571f, 0x58eb, 0x5902, 0x590a, 0x5915,
+    0x5927, 0x5973, 0x5b50, 0x5b80, 0x5bf8, 0x5c0f, 0x5c22, 0x5c38,
+    0x5c6e, 0x5c71, 0x5ddb, 0x5de5, 0x5df1, 0x5dfe, 0x5e72, 0x5e7a,
+    0x5e7f, 0x5ef4, 0x5efe, 0x5f0b, 0x5f13, 0x5f50, 0x5f61, 0x5f73,
+    0x5fc3, 0x6208, 0x6236, 0x624b, 0x652f, 0x6534, 0x6587, 0x6597,
+    0x65a4, 0x65b9, 0x65e0, 0x65e5, 0x66f0, 0x6708, 0x6728, 0x6b20,
+    0x6b62, 0x6b79, 0x6bb3, 0x6bcb, 0x6bd4, 0x6bdb, 0x6c0f, 0x6c14,
+    0x6c34, 0x706b, 0x722a, 0x7236, 0x723b, 0x723f, 0x7247, 0x7259,
+    0x725b, 0x72ac, 0x7384, 0x7389, 0x74dc, 0x74e6, 0x7518, 0x751f,
+    0x7528, 0x7530, 0x758b, 0x7592, 0x7676, 0x767d, 0x76ae, 0x76bf,
+    0x76ee, 0x77db, 0x77e2, 0x77f3, 0x793a, 0x79b8, 0x79be, 0x7a74,
+    0x7acb, 0x7af9, 0x7c73, 0x7cf8, 0x7f36, 0x7f51, 0x7f8a, 0x7fbd,
+    0x8001, 0x800c, 0x8012, 0x8033, 0x807f, 0x8089, 0x81e3, 0x81ea,
+    0x81f3, 0x81fc, 0x820c, 0x821b, 0x821f, 0x826e, 0x8272, 0x8278,
+    0x864d, 0x866b, 0x8840, 0x884c, 0x8863, 0x897e, 0x898b, 0x89d2,
+    0x8a00, 0x8c37, 0x8c46, 0x8c55, 0x8c78, 0x8c9d, 0x8d64, 0x8d70,
+    0x8db3, 0x8eab, 0x8eca, 0x8f9b, 0x8fb0, 0x8fb5, 0x9091, 0x9149,
+    0x91c6, 0x91cc, 0x91d1, 0x9577, 0x9580, 0x961c, 0x96b6, 0x96b9,
+    0x96e8, 0x9751, 0x975e, 0x9762, 0x9769, 0x97cb, 0x97ed, 0x97f3,
+    0x9801, 0x98a8, 0x98db, 0x98df, 0x9996, 0x9999, 0x99ac, 0x9aa8,
+    0x9ad8, 0x9adf, 0x9b25, 0x9b2f, 0x9b32, 0x9b3c, 0x9b5a, 0x9ce5,
+    0x9e75, 0x9e7f, 0x9ea5, 0x9ebb, 0x9ec3, 0x9ecd, 0x9ed1, 0x9ef9,
+    0x9efd, 0x9f0e, 0x9f13, 0x9f20, 0x9f3b, 0x9f4a, 0x9f52, 0x9f8d,
+    0x9f9c, 0x9fa0, 0x3012, 0x5344, 0x5345, 0x304b, 0x3099, 0x304d,
+    0x3099, 0x304f, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+    0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305b, 0x3099, 0x305d,
+    0x3099, 0x305f, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+    0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f, 0x309a, 0x3072,
+    0x3099, 0x3072, 0x309a, 0x3075, 0x3099, 0x3075, 0x309a, 0x3078,
+    0x3099, 0x3078, 0x309a, 0x307b, 0x3099, 0x307b, 0x309a, 0x3046,
+    0x3099, 0x20, 0x3099, 0x20, 0x309a, 0x309d, 0x3099, 0x3088,
+    0x308a, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30af, 0x3099, 0x30b1,
+    0x3099, 0x30b3, 0x3099, 0x30b5, 0x3099, 0x30b7, 0x3099, 0x30b9,
+    0x3099, 0x30bb, 0x3099, 0x30bd, 0x3099, 0x30bf, 0x3099, 0x30c1,
+    0x3099, 0x30c4, 0x3099, 0x30c6, 0x3099, 0x30c8, 0x3099, 0x30cf,
+    0x3099, 0x30cf, 0x309a, 0x30d2, 0x3099, 0x30d2, 0x309a, 0x30d5,
+    0x3099, 0x30d5, 0x309a, 0x30d8, 0x3099, 0x30d8, 0x309a, 0x30db,
+    0x3099, 0x30db, 0x309a, 0x30a6, 0x3099, 0x30ef, 0x3099, 0x30f0,
+    0x3099, 0x30f1, 0x3099, 0x30f2, 0x3099, 0x30fd, 0x3099, 0x30b3,
+    0x30c8, 0x1100, 0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103,
+    0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5,
+    0x111a, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110a, 0x110b,
+    0x110c, 0x110d, 0x110e, 0x110f, 0x1110, 0x1111, 0x1112, 0x1161,
+    0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+    0x116a, 0x116b, 0x116c, 0x116d, 0x116e, 0x116f, 0x1170, 0x1171,
+    0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11c7,
+    0x11c8, 0x11cc, 0x11ce, 0x11d3, 0x11d7, 0x11d9, 0x111c, 0x11dd,
+    0x11df, 0x111d, 0x111e, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129,
+    0x112b, 0x112c, 0x112d, 0x112e, 0x112f, 0x1132, 0x1136, 0x1140,
+    0x1147, 0x114c, 0x11f1, 0x11f2, 0x1157, 0x1158, 0x1159, 0x1184,
+    0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119e, 0x11a1, 0x4e09,
+    0x56db, 0x4e0a, 0x4e2d, 0x4e0b, 0x7532, 0x4e19, 0x4e01, 0x5929,
+    0x5730, 0x28, 0x1100, 0x29, 0x28, 0x1102, 0x29, 0x28,
+    0x1103, 0x29, 0x28, 0x1105, 0x29, 0x28, 0x1106, 0x29,
+    0x28, 0x1107, 0x29, 0x28, 0x1109, 0x29, 0x28, 0x110b,
+    0x29, 0x28, 0x110c, 0x29, 0x28, 0x110e, 0x29, 0x28,
+    0x110f, 0x29, 0x28, 0x1110, 0x29, 0x28, 0x1111, 0x29,
+    0x28, 0x1112, 0x29, 0x28, 0x1100, 0x1161, 0x29, 0x28,
+    0x1102, 0x1161, 0x29, 0x28, 0x1103, 0x1161, 0x29, 0x28,
+    0x1105, 0x1161, 0x29, 0x28, 0x1106, 0x1161, 0x29, 0x28,
+    0x1107, 0x1161, 0x29, 0x28, 0x1109, 0x1161, 0x29, 0x28,
+    0x110b, 0x1161, 0x29, 0x28, 0x110c, 0x1161, 0x29, 0x28,
+    0x110e, 0x1161, 0x29, 0x28, 0x110f, 0x1161, 0x29, 0x28,
+    0x1110, 0x1161, 0x29, 0x28, 0x1111, 0x1161, 0x29, 0x28,
+    0x1112, 0x1161, 0x29, 0x28, 0x110c, 0x116e, 0x29, 0x28,
+    0x110b, 0x1169, 0x110c, 0x1165, 0x11ab, 0x29, 0x28, 0x110b,
+    0x1169, 0x1112, 0x116e, 0x29, 0x28, 0x4e00, 0x29, 0x28,
+    0x4e8c, 0x29, 0x28, 0x4e09, 0x29, 0x28, 0x56db, 0x29,
+    0x28, 0x4e94, 0x29, 0x28, 0x516d, 0x29, 0x28, 0x4e03,
+    0x29, 0x28, 0x516b, 0x29, 0x28, 0x4e5d, 0x29, 0x28,
+    0x5341, 0x29, 0x28, 0x6708, 0x29, 0x28, 0x706b, 0x29,
+    0x28, 0x6c34, 0x29, 0x28, 0x6728, 0x29, 0x28, 0x91d1,
+    0x29, 0x28, 0x571f, 0x29, 0x28, 0x65e5, 0x29, 0x28,
+    0x682a, 0x29, 0x28, 0x6709, 0x29, 0x28, 0x793e, 0x29,
+    0x28, 0x540d, 0x29, 0x28, 0x7279, 0x29, 0x28, 0x8ca1,
+    0x29, 0x28, 0x795d, 0x29, 0x28, 0x52b4, 0x29, 0x28,
+    0x4ee3, 0x29, 0x28, 0x547c, 0x29, 0x28, 0x5b66, 0x29,
+    0x28, 0x76e3, 0x29, 0x28, 0x4f01, 0x29, 0x28, 0x8cc7,
+    0x29, 0x28, 0x5354, 0x29, 0x28, 0x796d, 0x29, 0x28,
+    0x4f11, 0x29, 0x28, 0x81ea, 0x29, 0x28, 0x81f3, 0x29,
+    0x50, 0x54, 0x45, 0x32, 0x31, 0x32, 0x32, 0x32,
+    0x33, 0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32,
+    0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33,
+    0x31, 0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x33,
+    0x35, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105,
+    0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110b,
+    0x1161, 0x110c, 0x1161, 0x110e, 0x1161, 0x110f, 0x1161, 0x1110,
+    0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110e, 0x1161, 0x11b7,
+    0x1100, 0x1169, 0x110c, 0x116e, 0x110b, 0x1174, 0x110b, 0x116e,
+    0x4e94, 0x516d, 0x4e03, 0x4e5d, 0x682a, 0x6709, 0x793e, 0x540d,
+    0x7279, 0x8ca1, 0x795d, 0x52b4, 0x79d8, 0x7537, 0x9069, 0x512a,
+    0x5370, 0x6ce8, 0x9805, 0x4f11, 0x5199, 0x6b63, 0x5de6, 0x53f3,
+    0x533b, 0x5b97, 0x5b66, 0x76e3, 0x4f01, 0x8cc7, 0x5354, 0x591c,
+    0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39,
+    0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34, 0x33,
+    0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37,
+    0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0x6708,
+    0x32, 0x6708, 0x33, 0x6708, 0x34, 0x6708, 0x35, 0x6708,
+    0x36, 0x6708, 0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708,
+    0x31, 0x30, 0x6708, 0x31, 0x31, 0x6708, 0x31, 0x32,
+    0x6708, 0x48, 0x67, 0x65, 0x72, 0x67, 0x65, 0x56,
+    0x4c, 0x54, 0x44, 0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa,
+    0x30ab, 0x30ad, 0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7, 0x30b9,
+    0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4, 0x30c6, 0x30c8, 0x30ca,
+    0x30cb, 0x30cc, 0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8,
+    0x30db, 0x30de, 0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4, 0x30e6,
+    0x30e8, 0x30e9, 0x30ea, 0x30eb, 0x30ec, 0x30ed, 0x30ef, 0x30f0,
+    0x30f1, 0x30f2, 0x30a2, 0x30cf, 0x309a, 0x30fc, 0x30c8, 0x30a2,
+    0x30eb, 0x30d5, 0x30a1, 0x30a2, 0x30f3, 0x30d8, 0x309a, 0x30a2,
+    0x30a2, 0x30fc, 0x30eb, 0x30a4, 0x30cb, 0x30f3, 0x30af, 0x3099,
+    0x30a4, 0x30f3, 0x30c1, 0x30a6, 0x30a9, 0x30f3, 0x30a8, 0x30b9,
+    0x30af, 0x30fc, 0x30c8, 0x3099, 0x30a8, 0x30fc, 0x30ab, 0x30fc,
+    0x30aa, 0x30f3, 0x30b9, 0x30aa, 0x30fc, 0x30e0, 0x30ab, 0x30a4,
+    0x30ea, 0x30ab, 0x30e9, 0x30c3, 0x30c8, 0x30ab, 0x30ed, 0x30ea,
+    0x30fc, 0x30ab, 0x3099, 0x30ed, 0x30f3, 0x30ab, 0x3099, 0x30f3,
+    0x30de, 0x30ad, 0x3099, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30cb,
+    0x30fc, 0x30ad, 0x30e5, 0x30ea, 0x30fc, 0x30ad, 0x3099, 0x30eb,
+    0x30bf, 0x3099, 0x30fc, 0x30ad, 0x30ed, 0x30ad, 0x30ed, 0x30af,
+    0x3099, 0x30e9, 0x30e0, 0x30ad, 0x30ed, 0x30e1, 0x30fc, 0x30c8,
+    0x30eb, 0x30ad, 0x30ed, 0x30ef, 0x30c3, 0x30c8, 0x30af, 0x3099,
+    0x30e9, 0x30e0, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30c8, 0x30f3,
+    0x30af, 0x30eb, 0x30bb, 0x3099, 0x30a4, 0x30ed, 0x30af, 0x30ed,
+    0x30fc, 0x30cd, 0x30b1, 0x30fc, 0x30b9, 0x30b3, 0x30eb, 0x30ca,
+    0x30b3, 0x30fc, 0x30db, 0x309a, 0x30b5, 0x30a4, 0x30af, 0x30eb,
+    0x30b5, 0x30f3, 0x30c1, 0x30fc, 0x30e0, 0x30b7, 0x30ea, 0x30f3,
+    0x30af, 0x3099, 0x30bb, 0x30f3, 0x30c1, 0x30bb, 0x30f3, 0x30c8,
+    0x30bf, 0x3099, 0x30fc, 0x30b9, 0x30c6, 0x3099, 0x30b7, 0x30c8,
+    0x3099, 0x30eb, 0x30c8, 0x30f3, 0x30ca, 0x30ce, 0x30ce, 0x30c3,
+    0x30c8, 0x30cf, 0x30a4, 0x30c4, 0x30cf, 0x309a, 0x30fc, 0x30bb,
+    0x30f3, 0x30c8, 0x30cf, 0x309a, 0x30fc, 0x30c4, 0x30cf, 0x3099,
+    0x30fc, 0x30ec, 0x30eb, 0x30d2, 0x309a, 0x30a2, 0x30b9, 0x30c8,
+    0x30eb, 0x30d2, 0x309a, 0x30af, 0x30eb, 0x30d2, 0x309a, 0x30b3,
+    0x30d2, 0x3099, 0x30eb, 0x30d5, 0x30a1, 0x30e9, 0x30c3, 0x30c8,
+    0x3099, 0x30d5, 0x30a3, 0x30fc, 0x30c8, 0x30d5, 0x3099, 0x30c3,
+    0x30b7, 0x30a7, 0x30eb, 0x30d5, 0x30e9, 0x30f3, 0x30d8, 0x30af,
+    0x30bf, 0x30fc, 0x30eb, 0x30d8, 0x309a, 0x30bd, 0x30d8, 0x309a,
+    0x30cb, 0x30d2, 0x30d8, 0x30eb, 0x30c4, 0x30d8, 0x309a, 0x30f3,
+    0x30b9, 0x30d8, 0x309a, 0x30fc, 0x30b7, 0x3099, 0x30d8, 0x3099,
+    0x30fc, 0x30bf, 0x30db, 0x309a, 0x30a4, 0x30f3, 0x30c8, 0x30db,
+    0x3099, 0x30eb, 0x30c8, 0x30db, 0x30f3, 0x30db, 0x309a, 0x30f3,
+    0x30c8, 0x3099, 0x30db, 0x30fc, 0x30eb, 0x30db, 0x30fc, 0x30f3,
+    0x30de, 0x30a4, 0x30af, 0x30ed, 0x30de, 0x30a4, 0x30eb, 0x30de,
+    0x30c3, 0x30cf, 0x30de, 0x30eb, 0x30af, 0x30de, 0x30f3, 0x30b7,
+    0x30e7, 0x30f3, 0x30df, 0x30af, 0x30ed, 0x30f3, 0x30df, 0x30ea,
+    0x30df, 0x30ea, 0x30cf, 0x3099, 0x30fc, 0x30eb, 0x30e1, 0x30ab,
+    0x3099, 0x30e1, 0x30ab, 0x3099, 0x30c8, 0x30f3, 0x30e1, 0x30fc,
+    0x30c8, 0x30eb, 0x30e4, 0x30fc, 0x30c8, 0x3099, 0x30e4, 0x30fc,
+    0x30eb, 0x30e6, 0x30a2, 0x30f3, 0x30ea, 0x30c3, 0x30c8, 0x30eb,
+    0x30ea, 0x30e9, 0x30eb, 0x30d2, 0x309a, 0x30fc, 0x30eb, 0x30fc,
+    0x30d5, 0x3099, 0x30eb, 0x30ec, 0x30e0, 0x30ec, 0x30f3, 0x30c8,
+    0x30b1, 0x3099, 0x30f3, 0x30ef, 0x30c3, 0x30c8, 0x30, 0x70b9,
+    0x31, 0x70b9, 0x32, 0x70b9, 0x33, 0x70b9, 0x34, 0x70b9,
+    0x35, 0x70b9, 0x36, 0x70b9, 0x37, 0x70b9, 0x38, 0x70b9,
+    0x39, 0x70b9, 0x31, 0x30, 0x70b9, 0x31, 0x31, 0x70b9,
+    0x31, 0x32, 0x70b9, 0x31, 0x33, 0x70b9, 0x31, 0x34,
+    0x70b9, 0x31, 0x35, 0x70b9, 0x31, 0x36, 0x70b9, 0x31,
+    0x37, 0x70b9, 0x31, 0x38, 0x70b9, 0x31, 0x39, 0x70b9,
+    0x32, 0x30, 0x70b9, 0x32, 0x31, 0x70b9, 0x32, 0x32,
+    0x70b9, 0x32, 0x33, 0x70b9, 0x32, 0x34, 0x70b9, 0x68,
+    0x50, 0x61, 0x64, 0x61, 0x41, 0x55, 0x62, 0x61,
+    0x72, 0x6f, 0x56, 0x70, 0x63, 0x64, 0x6d, 0x64,
+    0x6d, 0x32, 0x64, 0x6d, 0x33, 0x49, 0x55, 0x5e73,
+    0x6210, 0x662d, 0x548c, 0x5927, 0x6b63, 0x660e, 0x6cbb, 0x682a,
+    0x5f0f, 0x4f1a, 0x793e, 0x70, 0x41, 0x6e, 0x41, 0x3bc,
+    0x41, 0x6d, 0x41, 0x6b, 0x41, 0x4b, 0x42, 0x4d,
+    0x42, 0x47, 0x42, 0x63, 0x61, 0x6c, 0x6b, 0x63,
+    0x61, 0x6c, 0x70, 0x46, 0x6e, 0x46, 0x3bc, 0x46,
+    0x3bc, 0x67, 0x6d, 0x67, 0x6b, 0x67, 0x48, 0x7a,
+    0x6b, 0x48, 0x7a, 0x4d, 0x48, 0x7a, 0x47, 0x48,
+    0x7a, 0x54, 0x48, 0x7a, 0x3bc, 0x6c, 0x6d, 0x6c,
+    0x64, 0x6c, 0x6b, 0x6c, 0x66, 0x6d, 0x6e, 0x6d,
+    0x3bc, 0x6d, 0x6d, 0x6d, 0x63, 0x6d, 0x6b, 0x6d,
+    0x6d, 0x6d, 0x32, 0x63, 0x6d, 0x32, 0x6d, 0x32,
+    0x6b, 0x6d, 0x32, 0x6d, 0x6d, 0x33, 0x63, 0x6d,
+    0x33, 0x6d, 0x33, 0x6b, 0x6d, 0x33, 0x6d, 0x2215,
+    0x73, 0x6d, 0x2215, 0x73, 0x32, 0x50, 0x61, 0x6b,
+    0x50, 0x61, 0x4d, 0x50, 0x61, 0x47, 0x50, 0x61,
+    0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0x2215, 0x73,
+    0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x70, 0x73,
+    0x6e, 0x73, 0x3bc, 0x73, 0x6d, 0x73, 0x70, 0x56,
+    0x6e, 0x56, 0x3bc, 0x56, 0x6d, 0x56, 0x6b, 0x56,
+    0x4d, 0x56, 0x70, 0x57, 0x6e, 0x57, 0x3bc, 0x57,
+    0x6d, 0x57, 0x6b, 0x57, 0x4d, 0x57, 0x6b, 0x3a9,
+    0x4d, 0x3a9, 0x61, 0x2e, 0x6d, 0x2e, 0x42, 0x71,
+    0x63, 0x63, 0x63, 0x64, 0x43, 0x2215, 0x6b, 0x67,
+    0x43, 0x6f, 0x2e, 0x64, 0x42, 0x47, 0x79, 0x68,
+    0x61, 0x48, 0x50, 0x69, 0x6e, 0x4b, 0x4b, 0x4b,
+    0x4d, 0x6b, 0x74, 0x6c, 0x6d, 0x6c, 0x6e, 0x6c,
+    0x6f, 0x67, 0x6c, 0x78, 0x6d, 0x62, 0x6d, 0x69,
+    0x6c, 0x6d, 0x6f, 0x6c, 0x50, 0x48, 0x70, 0x2e,
+    0x6d, 0x2e, 0x50, 0x50, 0x4d, 0x50, 0x52, 0x73,
+    0x72, 0x53, 0x76, 0x57, 0x62, 0x56, 0x2215, 0x6d,
+    0x41, 0x2215, 0x6d, 0x31, 0x65e5, 0x32, 0x65e5, 0x33,
+    0x65e5, 0x34, 0x65e5, 0x35, 0x65e5, 0x36, 0x65e5, 0x37,
+    0x65e5, 0x38, 0x65e5, 0x39, 0x65e5, 0x31, 0x30, 0x65e5,
+    0x31, 0x31, 0x65e5, 0x31, 0x32, 0x65e5, 0x31, 0x33,
+    0x65e5, 0x31, 0x34, 0x65e5, 0x31, 0x35, 0x65e5, 0x31,
+    0x36, 0x65e5, 0x31, 0x37, 0x65e5, 0x31, 0x38, 0x65e5,
+    0x31, 0x39, 0x65e5, 0x32, 0x30, 0x65e5, 0x32, 0x31,
+    0x65e5, 0x32, 0x32, 0x65e5, 0x32, 0x33, 0x65e5, 0x32,
+    0x34, 0x65e5, 0x32, 0x35, 0x65e5, 0x32, 0x36, 0x65e5,
+    0x32, 0x37, 0x65e5, 0x32, 0x38, 0x65e5, 0x32, 0x39,
+    0x65e5, 0x33, 0x30, 0x65e5, 0x33, 0x31, 0x65e5, 0x67,
+    0x61, 0x6c, 0x8c48, 0x66f4, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5,
+    0x5951, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f, 0x87ba,
+    0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d, 0x916a,
+    0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b, 0x862d, 0x9e1e, 0x5d50,
+    0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8, 0x881f, 0x5eca, 0x6717,
+    0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7, 0x52de, 0x64c4, 0x6ad3,
+    0x7210, 0x76e7, 0x8606, 0x865c, 0x8def, 0x9732, 0x9b6f, 0x9dfa,
+    0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304, 0x8ad6, 0x58df, 0x5f04,
+    0x7c60, 0x807e, 0x7262, 0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62,
+    0x6a13, 0x6dda, 0x6f0f, 0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b,
+    0x51dc, 0x51cc, 0x7a1c, 0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf,
+    0x8afe, 0x4e39, 0x5be7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78fb,
+    0x4fbf, 0x5fa9, 0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e,
+    0x7701, 0x8449, 0x8aaa, 0x6bba, 0x6c88, 0x62fe, 0x82e5, 0x63a0,
+    0x7565, 0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2,
+    0x91cf, 0x52f5, 0x5442, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad,
+    0x9a6a, 0x9e97, 0x9ece, 0x66c6, 0x6b77, 0x8f62, 0x5e74, 0x6190,
+    0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4, 0x806f,
+    0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd, 0x70c8,
+    0x88c2, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375, 0x4ee4,
+    0x56f9, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046, 0x9234,
+    0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8, 0x60e1,
+    0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599, 0x71ce, 0x7642, 0x84fc,
+    0x907c, 0x6688, 0x962e, 0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c,
+    0x7409, 0x7559, 0x786b, 0x7d10, 0x985e, 0x622e, 0x9678, 0x502b,
+    0x5d19, 0x6dea, 0x8f2a, 0x5f8b, 0x6144, 0x6817, 0x9686, 0x5229,
+    0x540f, 0x5c65, 0x6613, 0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2,
+    0x7f79, 0x88cf, 0x88e1, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0,
+    0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+    0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a,
+    0x5207, 0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b,
+    0x964d, 0x5ed3, 0x5140, 0x55c0, 0x585a, 0x6674, 0x51de, 0x732a,
+    0x76ca, 0x793c, 0x795e, 0x7965, 0x798f, 0x9756, 0x7cbe, 0x8612,
+    0x8af8, 0x9038, 0x90fd, 0x98ef, 0x98fc, 0x9928, 0x9db4, 0x4fae,
+    0x50e7, 0x514d, 0x52c9, 0x52e4, 0x5351, 0x559d, 0x5606, 0x5668,
+    0x5840, 0x58a8, 0x5c64, 0x6094, 0x6168, 0x618e, 0x61f2, 0x654f,
+    0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b,
+    0x7422, 0x7891, 0x7949, 0x7948, 0x7950, 0x7956, 0x798d, 0x798e,
+    0x7a40, 0x7a81, 0x7bc0, 0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed,
+    0x8279, 0x8457, 0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08,
+    0x8fb6, 0x96e3, 0x97ff, 0x983b, 0x4e26, 0x51b5, 0x5168, 0x4f80,
+    0x5145, 0x5180, 0x52c7, 0x52fa, 0x5555, 0x5599, 0x55e2, 0x58b3,
+    0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad,
+    0x60d8, 0x614e, 0x6108, 0x6160, 0x6234, 0x63c4, 0x641c, 0x6452,
+    0x6556, 0x671b, 0x6756, 0x6edb, 0x6ecb, 0x701e, 0x77a7, 0x7235,
+    0x72af, 0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76db, 0x76f4,
+    0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7c7b, 0x7d5b, 0x7f3e, 0x8352,
+    0x83ef, 0x8779, 0x8941, 0x8986, 0x8abf, 0x8acb, 0x8aed, 0x8b8a,
+    0x8f38, 0x9072, 0x9199, 0x9276, 0x967c, 0x97db, 0x980b, 0x9b12,
+    0x2284a, 0x22844, 0x233d5, 0x3b9d, 0x4018, 0x4039, 0x25249, 0x25cd0,
+    0x27ed3, 0x9f43, 0x9f8e, 0x66, 0x66, 0x66, 0x69, 0x66,
+    0x6c, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6c, 0x73,
+    0x74, 0x574, 0x576, 0x574, 0x565, 0x574, 0x56b, 0x57e,
+    0x576, 0x574, 0x56d, 0x5d9, 0x5b4, 0x5f2, 0x5b7, 0x5e2,
+    0x5d4, 0x5db, 0x5dc, 0x5dd, 0x5e8, 0x5ea, 0x5e9, 0x5c1,
+    0x5e9, 0x5c2, 0x5e9, 0x5bc, 0x5c1, 0x5e9, 0x5bc, 0x5c2,
+    0x5d0, 0x5b7, 0x5d0, 0x5b8, 0x5d0, 0x5bc, 0x5d1, 0x5bc,
+    0x5d2, 0x5bc, 0x5d3, 0x5bc, 0x5d4, 0x5bc, 0x5d5, 0x5bc,
+    0x5d6, 0x5bc, 0x5d8, 0x5bc, 0x5d9, 0x5bc, 0x5da, 0x5bc,
+    0x5db, 0x5bc, 0x5dc, 0x5bc, 0x5de, 0x5bc, 0x5e0, 0x5bc,
+    0x5e1, 0x5bc, 0x5e3, 0x5bc, 0x5e4, 0x5bc, 0x5e6, 0x5bc,
+    0x5e7, 0x5bc, 0x5e8, 0x5bc, 0x5e9, 0x5bc, 0x5ea, 0x5bc,
+    0x5d5, 0x5b9, 0x5d1, 0x5bf, 0x5db, 0x5bf, 0x5e4, 0x5bf,
+    0x5d0, 0x5dc, 0x671, 0x67b, 0x67e, 0x680, 0x67a, 0x67f,
+    0x679, 0x6a4, 0x6a6, 0x684, 0x683, 0x686, 0x687, 0x68d,
+    0x68c, 0x68e, 0x688, 0x698, 0x691, 0x6a9, 0x6af, 0x6b3,
+    0x6b1, 0x6ba, 0x6bb, 0x6c1, 0x6be, 0x6d2, 0x6ad, 0x6c7,
+    0x6c6, 0x6c8, 0x6cb, 0x6c5, 0x6c9, 0x6d0, 0x649, 0x64a,
+    0x654, 0x627, 0x64a, 0x654, 0x6d5, 0x64a, 0x654, 0x648,
+    0x64a, 0x654, 0x6c7, 0x64a, 0x654, 0x6c6, 0x64a, 0x654,
+    0x6c8, 0x64a, 0x654, 0x6d0, 0x64a, 0x654, 0x649, 0x6cc,
+    0x64a, 0x654, 0x62c, 0x64a, 0x654, 0x62d, 0x64a, 0x654,
+    0x645, 0x64a, 0x654, 0x64a, 0x628, 0x62c, 0x628, 0x62d,
+    0x628, 0x62e, 0x628, 0x645, 0x628, 0x649, 0x628, 0x64a,
+    0x62a, 0x62c, 0x62a, 0x62d, 0x62a, 0x62e, 0x62a, 0x645,
+    0x62a, 0x649, 0x62a, 0x64a, 0x62b, 0x62c, 0x62b, 0x645,
+    0x62b, 0x649, 0x62b, 0x64a, 0x62c, 0x62d, 0x62c, 0x645,
+    0x62d, 0x62c, 0x62d, 0x645, 0x62e, 0x62c, 0x62e, 0x62d,
+    0x62e, 0x645, 0x633, 0x62c, 0x633, 0x62d, 0x633, 0x62e,
+    0x633, 0x645, 0x635, 0x62d, 0x635, 0x645, 0x636, 0x62c,
+    0x636, 0x62d, 0x636, 0x62e, 0x636, 0x645, 0x637, 0x62d,
+    0x637, 0x645, 0x638, 0x645, 0x639, 0x62c, 0x639, 0x645,
+    0x63a, 0x62c, 0x63a, 0x645, 0x641, 0x62c, 0x641, 0x62d,
+    0x641, 0x62e, 0x641, 0x645, 0x641, 0x649, 0x641, 0x64a,
+    0x642, 0x62d, 0x642, 0x645, 0x642, 0x649, 0x642, 0x64a,
+    0x643, 0x627, 0x643, 0x62c, 0x643, 0x62d, 0x643, 0x62e,
+    0x643, 0x644, 0x643, 0x645, 0x643, 0x649, 0x643, 0x64a,
+    0x644, 0x62c, 0x644, 0x62d, 0x644, 0x62e, 0x644, 0x645,
+    0x644, 0x649, 0x644, 0x64a, 0x645, 0x62c, 0x645, 0x62d,
+    0x645, 0x62e, 0x645, 0x645, 0x645, 0x649, 0x645, 0x64a,
+    0x646, 0x62c, 0x646, 0x62d, 0x646, 0x62e, 0x646, 0x645,
+    0x646, 0x649, 0x646, 0x64a, 0x647, 0x62c, 0x647, 0x645,
+    0x647, 0x649, 0x647, 0x64a, 0x64a, 0x62c, 0x64a, 0x62d,
+    0x64a, 0x62e, 0x64a, 0x645, 0x64a, 0x649, 0x64a, 0x64a,
+    0x630, 0x670, 0x631, 0x670, 0x649, 0x670, 0x20, 0x64c,
+    0x651, 0x20, 0x64d, 0x651, 0x20, 0x64e, 0x651, 0x20,
+    0x64f, 0x651, 0x20, 0x650, 0x651, 0x20, 0x651, 0x670,
+    0x64a, 0x654, 0x631, 0x64a, 0x654, 0x632, 0x64a, 0x654,
+    0x646, 0x628, 0x631, 0x628, 0x632, 0x628, 0x646, 0x62a,
+    0x631, 0x62a, 0x632, 0x62a, 0x646, 0x62b, 0x631, 0x62b,
+    0x632, 0x62b, 0x646, 0x645, 0x627, 0x646, 0x631, 0x646,
+    0x632, 0x646, 0x646, 0x64a, 0x631, 0x64a, 0x632, 0x64a,
+    0x646, 0x64a, 0x654, 0x62e, 0x64a, 0x654, 0x647, 0x628,
+    0x647, 0x62a, 0x647, 0x635, 0x62e, 0x644, 0x647, 0x646,
+    0x647, 0x647, 0x670, 0x64a, 0x647, 0x62b, 0x647, 0x633,
+    0x647, 0x634, 0x645, 0x634, 0x647, 0x640, 0x64e, 0x651,
+    0x640, 0x64f, 0x651, 0x640, 0x650, 0x651, 0x637, 0x649,
+    0x637, 0x64a, 0x639, 0x649, 0x639, 0x64a, 0x63a, 0x649,
+    0x63a, 0x64a, 0x633, 0x649, 0x633, 0x64a, 0x634, 0x649,
+    0x634, 0x64a, 0x62d, 0x649, 0x62d, 0x64a, 0x62c, 0x649,
+    0x62c, 0x64a, 0x62e, 0x649, 0x62e, 0x64a, 0x635, 0x649,
+    0x635, 0x64a, 0x636, 0x649, 0x636, 0x64a, 0x634, 0x62c,
+    0x634, 0x62d, 0x634, 0x62e, 0x634, 0x631, 0x633, 0x631,
+    0x635, 0x631, 0x636, 0x631, 0x627, 0x64b, 0x62a, 0x62c,
+    0x645, 0x62a, 0x62d, 0x62c, 0x62a, 0x62d, 0x645, 0x62a,
+    0x62e, 0x645, 0x62a, 0x645, 0x62c, 0x62a, 0x645, 0x62d,
+    0x62a, 0x645, 0x62e, 0x62c, 0x645, 0x62d, 0x62d, 0x645,
+    0x64a, 0x62d, 0x645, 0x649, 0x633, 0x62d, 0x62c, 0x633,
+    0x62c, 0x62d, 0x633, 0x62c, 0x649, 0x633, 0x645, 0x62d,
+    0x633, 0x645, 0x62c, 0x633, 0x645, 0x645, 0x635, 0x62d,
+    0x62d, 0x635, 0x645, 0x645, 0x634, 0x62d, 0x645, 0x634,
+    0x62c, 0x64a, 0x634, 0x645, 0x62e, 0x634, 0x645, 0x645,
+    0x636, 0x62d, 0x649, 0x636, 0x62e, 0x645, 0x637, 0x645,
+    0x62d, 0x637, 0x645, 0x645, 0x637, 0x645, 0x64a, 0x639,
+    0x62c, 0x645, 0x639, 0x645, 0x645, 0x639, 0x645, 0x649,
+    0x63a, 0x645, 0x645, 0x63a, 0x645, 0x64a, 0x63a, 0x645,
+    0x649, 0x641, 0x62e, 0x645, 0x642, 0x645, 0x62d, 0x642,
+    0x645, 0x645, 0x644, 0x62d, 0x645, 0x644, 0x62d, 0x64a,
+    0x644, 0x62d, 0x649, 0x644, 0x62c, 0x62c, 0x644, 0x62e,
+    0x645, 0x644, 0x645, 0x62d, 0x645, 0x62d, 0x62c, 0x645,
+    0x62d, 0x645, 0x645, 0x62d, 0x64a, 0x645, 0x62c, 0x62d,
+    0x645, 0x62c, 0x645, 0x645, 0x62e, 0x62c, 0x645, 0x62e,
+    0x645, 0x645, 0x62c, 0x62e, 0x647, 0x645, 0x62c, 0x647,
+    0x645, 0x645, 0x646, 0x62d, 0x645, 0x646, 0x62d, 0x649,
+    0x646, 0x62c, 0x645, 0x646, 0x62c, 0x649, 0x646, 0x645,
+    0x64a, 0x646, 0x645, 0x649, 0x64a, 0x645, 0x645, 0x628,
+    0x62e, 0x64a, 0x62a, 0x62c, 0x64a, 0x62a, 0x62c, 0x649,
+    0x62a, 0x62e, 0x64a, 0x62a, 0x62e, 0x649, 0x62a, 0x645,
+    0x64a, 0x62a, 0x645, 0x649, 0x62c, 0x645, 0x64a, 0x62c,
+    0x62d, 0x649, 0x62c, 0x645, 0x649, 0x633, 0x62e, 0x649,
+    0x635, 0x62d, 0x64a, 0x634, 0x62d, 0x64a, 0x636, 0x62d,
+    0x64a, 0x644, 0x62c, 0x64a, 0x644, 0x645, 0x64a, 0x64a,
+    0x62d, 0x64a, 0x64a, 0x62c, 0x64a, 0x64a, 0x645, 0x64a,
+    0x645, 0x645, 0x64a, 0x642, 0x645, 0x64a, 0x646, 0x62d,
+    0x64a, 0x639, 0x645, 0x64a, 0x643, 0x645, 0x64a, 0x646,
+    0x62c, 0x62d, 0x645, 0x62e, 0x64a, 0x644, 0x62c, 0x645,
+    0x643, 0x645, 0x645, 0x62c, 0x62d, 0x64a, 0x62d, 0x62c,
+    0x64a, 0x645, 0x62c, 0x64a, 0x641, 0x645, 0x64a, 0x628,
+    0x62d, 0x64a, 0x633, 0x62e, 0x64a, 0x646, 0x62c, 0x64a,
+    0x635, 0x644, 0x6d2, 0x642, 0x644, 0x6d2, 0x627, 0x644,
+    0x644, 0x647, 0x627, 0x643, 0x628, 0x631, 0x645, 0x62d,
+    0x645, 0x62f, 0x635, 0x644, 0x639, 0x645, 0x631, 0x633,
+    0x648, 0x644, 0x639, 0x644, 0x64a, 0x647, 0x648, 0x633,
+    0x644, 0x645, 0x635, 0x644, 0x649, 0x635, 0x644, 0x649,
+    0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639, 0x644,
+    0x64a, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x62c,
+    0x644, 0x20, 0x62c, 0x644, 0x627, 0x644, 0x647, 0x631,
+    0x6cc, 0x627, 0x644, 0x2c, 0x3001, 0x3002, 0x3a, 0x21,
+    0x3f, 0x3016, 0x3017, 0x2014, 0x2013, 0x5f, 0x7b, 0x7d,
+    0x3014, 0x3015, 0x3010, 0x3011, 0x300a, 0x300b, 0x300c, 0x300d,
+    0x300e, 0x300f, 0x5b, 0x5d, 0x23, 0x26, 0x2a, 0x2d,
+    0x3c, 0x3e, 0x5c, 0x24, 0x25, 0x40, 0x20, 0x64b,
+    0x640, 0x64b, 0x20, 0x64c, 0x20, 0x64d, 0x20, 0x64e,
+    0x640, 0x64e, 0x20, 0x64f, 0x640, 0x64f, 0x20, 0x650,
+    0x640, 0x650, 0x20, 0x651, 0x640, 0x651, 0x20, 0x652,
+    0x640, 0x652, 0x621, 0x627, 0x628, 0x629, 0x62a, 0x62b,
+    0x62c, 0x62d, 0x62e, 0x62f, 0x630, 0x631, 0x632, 0x633,
+    0x634, 0x635, 0x636, 0x637, 0x638, 0x639, 0x63a, 0x641,
+    0x642, 0x643, 0x644, 0x645, 0x646, 0x647, 0x648, 0x64a,
+    0x644, 0x627, 0x653, 0x644, 0x627, 0x654, 0x644, 0x627,
+    0x655, 0x644, 0x627, 0x22, 0x27, 0x2f, 0x5e, 0x7c,
+    0x7e, 0x2985, 0x2986, 0x30fb, 0x30a1, 0x30a3, 0x30a5, 0x30a7,
+    0x30a9, 0x30e3, 0x30e5, 0x30e7, 0x30c3, 0x30fc, 0x30f3, 0x3099,
+    0x309a, 0xa2, 0xa3, 0xac, 0xa6, 0xa5, 0x20a9, 0x2502,
+    0x2190, 0x2191, 0x2192, 0x2193, 0x25a0, 0x25cb, 0x1d157, 0x1d165,
+    0x1d158, 0x1d165, 0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f,
+    0x1d158, 0x1d165, 0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165,
+    0x1d172, 0x1d1b9, 0x1d165, 0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e,
+    0x1d1ba, 0x1d165, 0x1d16e, 0x1d1b9, 0x1d165, 0x1d16f, 0x1d1ba, 0x1d165,
+    0x1d16f, 0x131, 0x237, 0x391, 0x392, 0x394, 0x395, 0x396,
+    0x397, 0x399, 0x39a, 0x39b, 0x39c, 0x39d, 0x39e, 0x39f,
+    0x3a1, 0x3a4, 0x3a6, 0x3a7, 0x3a8, 0x2207, 0x3b1, 0x3b6,
+    0x3b7, 0x3bb, 0x3bd, 0x3be, 0x3bf, 0x3c3, 0x3c4, 0x3c5,
+    0x3c8, 0x3c9, 0x2202, 0x3dc, 0x3dd, 0x4e3d, 0x4e38, 0x4e41,
+    0x20122, 0x4f60, 0x4fbb, 0x5002, 0x507a, 0x5099, 0x50cf, 0x349e,
+    0x2063a, 0x5154, 0x5164, 0x5177, 0x2051c, 0x34b9, 0x5167, 0x518d,
+    0x2054b, 0x5197, 0x51a4, 0x4ecc, 0x51ac, 0x291df, 0x5203, 0x34df,
+    0x523b, 0x5246, 0x5272, 0x5277, 0x3515, 0x5305, 0x5306, 0x5349,
+    0x535a, 0x5373, 0x537d, 0x537f, 0x20a2c, 0x7070, 0x53ca, 0x53df,
+    0x20b63, 0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448, 0x5468,
+    0x54a2, 0x54f6, 0x5510, 0x5553, 0x5563, 0x5584, 0x55ab, 0x55b3,
+    0x55c2, 0x5716, 0x5717, 0x5651, 0x5674, 0x58ee, 0x57ce, 0x57f4,
+    0x580d, 0x578b, 0x5832, 0x5831, 0x58ac, 0x214e4, 0x58f2, 0x58f7,
+    0x5906, 0x591a, 0x5922, 0x5962, 0x216a8, 0x216ea, 0x59ec, 0x5a1b,
+    0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc, 0x5b08, 0x5b3e, 0x219c8,
+    0x5bc3, 0x5bd8, 0x5bf3, 0x21b18, 0x5bff, 0x5c06, 0x5f53, 0x3781,
+    0x5c60, 0x5cc0, 0x5c8d, 0x21de4, 0x5d43, 0x21de6, 0x5d6e, 0x5d6b,
+    0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69,
+    0x3862, 0x22183, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x2a392, 0x22331,
+    0x8201, 0x5f22, 0x38c7, 0x232b8, 0x261da, 0x5f62, 0x5f6b, 0x38e3,
+    0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a, 0x391c, 0x226d4,
+    0x60c7, 0x6148, 0x614c, 0x617a, 0x61b2, 0x61a4, 0x61af, 0x61de,
+    0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350, 0x22b0c, 0x633d,
+    0x62fc, 0x6368, 0x6383, 0x63e4, 0x22bf1, 0x6422, 0x63c5, 0x63a9,
+    0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477, 0x3a6c, 0x656c, 0x2300a,
+    0x65e3, 0x66f8, 0x6649, 0x3b19, 0x3b08, 0x3ae4, 0x5192, 0x5195,
+    0x6700, 0x669c, 0x80ad, 0x43d9, 0x6721, 0x675e, 0x6753, 0x233c3,
+    0x3b49, 0x67fa, 0x6785, 0x6852, 0x2346d, 0x688e, 0x681f, 0x6914,
+    0x6942, 0x69a3, 0x69ea, 0x6aa8, 0x236a3, 0x6adb, 0x3c18, 0x6b21,
+    0x238a7, 0x6b54, 0x3c4e, 0x6b72, 0x6b9f, 0x6bbb, 0x23a8d, 0x21d0b,
+    0x23afa, 0x6c4e, 0x23cbc, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16, 0x6d3e,
+    0x6d69, 0x6d78, 0x6d85, 0x23d1e, 0x6d34, 0x6e2f, 0x6e6e, 0x3d33,
+    0x6ec7, 0x23ed1, 0x6df9, 0x6f6e, 0x23f5e, 0x23f8e, 0x6fc6, 0x7039,
+    0x701b, 0x3d96, 0x704a, 0x707d, 0x7077, 0x70ad, 0x20525, 0x7145,
+    0x24263, 0x719c, 0x243ab, 0x7228, 0x7250, 0x24608, 0x7280, 0x7295,
+    0x24735, 0x24814, 0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x7447,
+    0x745c, 0x7485, 0x74ca, 0x3f1b, 0x7524, 0x24c36, 0x753e, 0x24c92,
+    0x2219f, 0x7610, 0x24fa1, 0x24fb8, 0x25044, 0x3ffc, 0x4008, 0x250f3,
+    0x250f2, 0x25119, 0x25133, 0x771e, 0x771f, 0x778b, 0x4046, 0x4096,
+    0x2541d, 0x784e, 0x40e3, 0x25626, 0x2569a, 0x256c5, 0x79eb, 0x412f,
+    0x7a4a, 0x7a4f, 0x2597c, 0x25aa7, 0x7aee, 0x4202, 0x25bab, 0x7bc6,
+    0x7bc9, 0x4227, 0x25c80, 0x7cd2, 0x42a0, 0x7ce8, 0x7ce3, 0x7d00,
+    0x25f86, 0x7d63, 0x4301, 0x7dc7, 0x7e02, 0x7e45, 0x4334, 0x26228,
+    0x26247, 0x4359, 0x262d9, 0x7f7a, 0x2633e, 0x7f95, 0x7ffa, 0x264da,
+    0x26523, 0x8060, 0x265a8, 0x8070, 0x2335f, 0x43d5, 0x80b2, 0x8103,
+    0x440b, 0x813e, 0x5ab5, 0x267a7, 0x267b5, 0x23393, 0x2339c, 0x8204,
+    0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3,
+    0x82bd, 0x82e6, 0x26b3c, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd,
+    0x83e7, 0x8353, 0x83ca, 0x83cc, 0x83dc, 0x26c36, 0x26d6b, 0x26cd5,
+    0x452b, 0x84f1, 0x84f3, 0x8516, 0x273ca, 0x8564, 0x26f2c, 0x455d,
+    0x4561, 0x26fb1, 0x270d2, 0x456b, 0x8650, 0x8667, 0x8669, 0x86a9,
+    0x8688, 0x870e, 0x86e2, 0x8728, 0x876b, 0x8786, 0x45d7, 0x87e1,
+    0x8801, 0x45f9, 0x8860, 0x27667, 0x88d7, 0x88de, 0x4635, 0x88fa,
+    0x34bb, 0x278ae, 0x27966, 0x46be, 0x46c7, 0x8aa0, 0x27ca8, 0x8cab,
+    0x8cc1, 0x8d1b, 0x8d77, 0x27f2f, 0x20804, 0x8dcb, 0x8dbc, 0x8df0,
+    0x208de, 0x8ed4, 0x285d2, 0x285ed, 0x9094, 0x90f1, 0x9111, 0x2872e,
+    0x911b, 0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0x28bfa,
+    0x958b, 0x4995, 0x95b7, 0x28d77, 0x49e6, 0x96c3, 0x5db2, 0x9723,
+    0x29145, 0x2921a, 0x4a6e, 0x4a76, 0x97e0, 0x2940a, 0x4ab2, 0x29496,
+    0x9829, 0x295b6, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2, 0x99fe,
+    0x4bce, 0x29b30, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67, 0x2a0ce,
+    0x4cf8, 0x2a105, 0x2a20e, 0x2a291, 0x4d56, 0x9efe, 0x9f05, 0x9f0f,
+    0x9f16, 0x2a600,
+};
+
+// primary composites sorted by their canonical decompositions
+const uc_composition uc_compositions[] = {
+    {0x3c, 0x338, 0x226e}, {0x3d, 0x338, 0x2260}, {0x3e, 0x338, 0x226f}, {0x41, 0x300, 0xc0},
+    {0x41, 0x301, 0xc1}, {0x41, 0x302, 0xc2}, {0x41, 0x303, 0xc3}, {0x41, 0x304, 0x100},
+    {0x41, 0x306, 0x102}, {0x41, 0x307, 0x226}, {0x41, 0x308, 0xc4}, {0x41, 0x309, 0x1ea2},
+    {0x41, 0x30a, 0xc5}, {0x41, 0x30c, 0x1cd}, {0x41, 0x30f, 0x200}, {0x41, 0x311, 0x202},
+    {0x41, 0x323, 0x1ea0}, {0x41, 0x325, 0x1e00}, {0x41, 0x328, 0x104}, {0x42, 0x307, 0x1e02},
+    {0x42, 0x323, 0x1e04}, {0x42, 0x331, 0x1e06}, {0x43, 0x301, 0x106}, {0x43, 0x302, 0x108},
+    {0x43, 0x307, 0x10a}, {0x43, 0x30c, 0x10c}, {0x43, 0x327, 0xc7}, {0x44, 0x307, 0x1e0a},
+    {0x44, 0x30c, 0x10e}, {0x44, 0x323, 0x1e0c}, {0x44, 0x327, 0x1e10}, {0x44, 0x32d, 0x1e12},
+    {0x44, 0x331, 0x1e0e}, {0x45, 0x300, 0xc8}, {0x45, 0x301, 0xc9}, {0x45, 0x302, 0xca},
+    {0x45, 0x303, 0x1ebc}, {0x45, 0x304, 0x112}, {0x45, 0x306, 0x114}, {0x45, 0x307, 0x116},
+    {0x45, 0x308, 0xcb}, {0x45, 0x309, 0x1eba}, {0x45, 0x30c, 0x11a}, {0x45, 0x30f, 0x204},
+    {0x45, 0x311, 0x206}, {0x45, 0x323, 0x1eb8}, {0x45, 0x327, 0x228}, {0x45, 0x328, 0x118},
+    {0x45, 0x32d, 0x1e18}, {0x45, 0x330, 0x1e1a}, {0x46, 0x307, 0x1e1e}, {0x47, 0x301, 0x1f4},
+    {0x47, 0x302, 0x11c}, {0x47, 0x304, 0x1e20}, {0x47, 0x306, 0x11e}, {0x47, 0x307, 0x120},
+    {0x47, 0x30c, 0x1e6}, {0x47, 0x327, 0x122}, {0x48, 0x302, 0x124}, {0x48, 0x307, 0x1e22},
+    {0x48, 0x308, 0x1e26}, {0x48, 0x30c, 0x21e}, {0x48, 0x323, 0x1e24}, {0x48, 0x327, 0x1e28},
+    {0x48, 0x32e, 0x1e2a}, {0x49, 0x300, 0xcc}, {0x49, 0x301, 0xcd}, {0x49, 0x302, 0xce},
+    {0x49, 0x303, 0x128}, {0x49, 0x304, 0x12a}, {0x49, 0x306, 0x12c}, {0x49, 0x307, 0x130},
+    {0x49, 0x308, 0xcf}, {0x49, 0x309, 0x1ec8}, {0x49, 0x30c, 0x1cf}, {0x49, 0x30f, 0x208},
+    {0x49, 0x311, 0x20a}, {0x49, 0x323, 0x1eca}, {0x49, 0x328, 0x12e}, {0x49, 0x330, 0x1e2c},
+    {0x4a, 0x302, 0x134}, {0x4b, 0x301, 0x1e30}, {0x4b, 0x30c, 0x1e8}, {0x4b, 0x323, 0x1e32},
+    {0x4b, 0x327, 0x136}, {0x4b, 0x331, 0x1e34}, {0x4c, 0x301, 0x139}, {0x4c, 0x30c, 0x13d},
+    {0x4c, 0x323, 0x1e36}, {0x4c, 0x327, 0x13b}, {0x4c, 0x32d, 0x1e3c}, {0x4c, 0x331, 0x1e3a},
+    {0x4d, 0x301, 0x1e3e}, {0x4d, 0x307, 0x1e40}, {0x4d, 0x323, 0x1e42}, {0x4e, 0x300, 0x1f8},
+    {0x4e, 0x301, 0x143}, {0x4e, 0x303, 0xd1}, {0x4e, 0x307, 0x1e44}, {0x4e, 0x30c, 0x147},
+    {0x4e, 0x323, 0x1e46}, {0x4e, 0x327, 0x145}, {0x4e, 0x32d, 0x1e4a}, {0x4e, 0x331, 0x1e48},
+    {0x4f, 0x300, 0xd2}, {0x4f, 0x301, 0xd3}, {0x4f, 0x302, 0xd4}, {0x4f, 0x303, 0xd5},
+    {0x4f, 0x304, 0x14c}, {0x4f, 0x306, 0x14e}, {0x4f, 0x307, 0x22e}, {0x4f, 0x308, 0xd6},
+    {0x4f, 0x309, 0x1ece}, {0x4f, 0x30b, 0x150}, {0x4f, 0x30c, 0x1d1}, {0x4f, 0x30f, 0x20c},
+    {0x4f, 0x311, 0x20e}, {0x4f, 0x31b, 0x1a0}, {0x4f, 0x323, 0x1ecc}, {0x4f, 0x328, 0x1ea},
+    {0x50, 0x301, 0x1e54}, {0x50, 0x307, 0x1e56}, {0x52, 0x301, 0x154}, {0x52, 0x307, 0x1e58},
+    {0x52, 0x30c, 0x158}, {0x52, 0x30f, 0x210}, {0x52, 0x311, 0x212}, {0x52, 0x323, 0x1e5a},
+    {0x52, 0x327, 0x156}, {0x52, 0x331, 0x1e5e}, {0x53, 0x301, 0x15a}, {0x53, 0x302, 0x15c},
+    {0x53, 0x307, 0x1e60}, {0x53, 0x30c, 0x160}, {0x53, 0x323, 0x1e62}, {0x53, 0x326, 0x218},
+    {0x53, 0x327, 0x15e}, {0x54, 0x307, 0x1e6a}, {0x54, 0x30c, 0x164}, {0x54, 0x323, 0x1e6c},
+    {0x54, 0x326, 0x21a}, {0x54, 0x327, 0x162}, {0x54, 0x32d, 0x1e70}, {0x54, 0x331, 0x1e6e},
+    {0x55, 0x300, 0xd9}, {0x55, 0x301, 0xda}, {0x55, 0x302, 0xdb}, {0x55, 0x303, 0x168},
+    {0x55, 0x304, 0x16a}, {0x55, 0x306, 0x16c}, {0x55, 0x308, 0xdc}, {0x55, 0x309, 0x1ee6},
+    {0x55, 0x30a, 0x16e}, {0x55, 0x30b, 0x170}, {0x55, 0x30c, 0x1d3}, {0x55, 0x30f, 0x214},
+    {0x55, 0x311, 0x216}, {0x55, 0x31b, 0x1af}, {0x55, 0x323, 0x1ee4}, {0x55, 0x324, 0x1e72},
+    {0x55, 0x328, 0x172}, {0x55, 0x32d, 0x1e76}, {0x55, 0x330, 0x1e74}, {0x56, 0x303, 0x1e7c},
+    {0x56, 0x323, 0x1e7e}, {0x57, 0x300, 0x1e80}, {0x57, 0x301, 0x1e82}, {0x57, 0x302, 0x174},
+    {0x57, 0x307, 0x1e86}, {0x57, 0x308, 0x1e84}, {0x57, 0x323, 0x1e88}, {0x58, 0x307, 0x1e8a},
+    {0x58, 0x308, 0x1e8c}, {0x59, 0x300, 0x1ef2}, {0x59, 0x301, 0xdd}, {0x59, 0x302, 0x176},
+    {0x59, 0x303, 0x1ef8}, {0x59, 0x304, 0x232}, {0x59, 0x307, 0x1e8e}, {0x59, 0x308, 0x178},
+    {0x59, 0x309, 0x1ef6}, {0x59, 0x323, 0x1ef4}, {0x5a, 0x301, 0x179}, {0x5a, 0x302, 0x1e90},
+    {0x5a, 0x307, 0x17b}, {0x5a, 0x30c, 0x17d}, {0x5a, 0x323, 0x1e92}, {0x5a, 0x331, 0x1e94},
+    {0x61, 0x300, 0xe0}, {0x61, 0x301, 0xe1}, {0x61, 0x302, 0xe2}, {0x61, 0x303, 0xe3},
+    {0x61, 0x304, 0x101}, {0x61, 0x306, 0x103}, {0x61, 0x307, 0x227}, {0x61, 0x308, 0xe4},
+    {0x61, 0x309, 0x1ea3}, {0x61, 0x30a, 0xe5}, {0x61, 0x30c, 0x1ce}, {0x61, 0x30f, 0x201},
+    {0x61, 0x311, 0x203}, {0x61, 0x323, 0x1ea1}, {0x61, 0x325, 0x1e01}, {0x61, 0x328, 0x105},
+    {0x62, 0x307, 0x1e03}, {0x62, 0x323, 0x1e05}, {0x62, 0x331, 0x1e07}, {0x63, 0x301, 0x107},
+    {0x63, 0x302, 0x109}, {0x63, 0x307, 0x10b}, {0x63, 0x30c, 0x10d}, {0x63, 0x327, 0xe7},
+    {0x64, 0x307, 0x1e0b}, {0x64, 0x30c, 0x10f}, {0x64, 0x323, 0x1e0d}, {0x64, 0x327, 0x1e11},
+    {0x64, 0x32d, 0x1e13}, {0x64, 0x331, 0x1e0f}, {0x65, 0x300, 0xe8}, {0x65, 0x301, 0xe9},
+    {0x65, 0x302, 0xea}, {0x65, 0x303, 0x1ebd}, {0x65, 0x304, 0x113}, {0x65, 0x306, 0x115},
+    {0x65, 0x307, 0x117}, {0x65, 0x308, 0xeb}, {0x65, 0x309, 0x1ebb}, {0x65, 0x30c, 0x11b},
+    {0x65, 0x30f, 0x205}, {0x65, 0x311, 0x207}, {0x65, 0x323, 0x1eb9}, {0x65, 0x327, 0x229},
+    {0x65, 0x328, 0x119}, {0x65, 0x32d, 0x1e19}, {0x65, 0x330, 0x1e1b}, {0x66, 0x307, 0x1e1f},
+    {0x67, 0x301, 0x1f5}, {0x67, 0x302, 0x11d}, {0x67, 0x304, 0x1e21}, {0x67, 0x306, 0x11f},
+    {0x67, 0x307, 0x121}, {0x67, 0x30c, 0x1e7}, {0x67, 0x327, 0x123}, {0x68, 0x302, 0x125},
+    {0x68, 0x307, 0x1e23}, {0x68, 0x308, 0x1e27}, {0x68, 0x30c, 0x21f}, {0x68, 0x323, 0x1e25},
+    {0x68, 0x327, 0x1e29}, {0x68, 0x32e, 0x1e2b}, {0x68, 0x331, 0x1e96}, {0x69, 0x300, 0xec},
+    {0x69, 0x301, 0xed}, {0x69, 0x302, 0xee}, {0x69, 0x303, 0x129}, {0x69, 0x304, 0x12b},
+    {0x69, 0x306, 0x12d}, {0x69, 0x308, 0xef}, {0x69, 0x309, 0x1ec9}, {0x69, 0x30c, 0x1d0},
+    {0x69, 0x30f, 0x209}, {0x69, 0x311, 0x20b}, {0x69, 0x323, 0x1ecb}, {0x69, 0x328, 0x12f},
+    {0x69, 0x330, 0x1e2d}, {0x6a, 0x302, 0x135}, {0x6a, 0x30c, 0x1f0}, {0x6b, 0x301, 0x1e31},
+    {0x6b, 0x30c, 0x1e9}, {0x6b, 0x323, 0x1e33}, {0x6b, 0x327, 0x137}, {0x6b, 0x331, 0x1e35},
+    {0x6c, 0x301, 0x13a}, {0x6c, 0x30c, 0x13e}, {0x6c, 0x323, 0x1e37}, {0x6c, 0x327, 0x13c},
+    {0x6c, 0x32d, 0x1e3d}, {0x6c, 0x331, 0x1e3b}, {0x6d, 0x301, 0x1e3f}, {0x6d, 0x307, 0x1e41},
+    {0x6d, 0x323, 0x1e43}, {0x6e, 0x300, 0x1f9}, {0x6e, 0x301, 0x144}, {0x6e, 0x303, 0xf1},
+    {0x6e, 0x307, 0x1e45}, {0x6e, 0x30c, 0x148}, {0x6e, 0x323, 0x1e47}, {0x6e, 0x327, 0x146},
+    {0x6e, 0x32d, 0x1e4b}, {0x6e, 0x331, 0x1e49}, {0x6f, 0x300, 0xf2}, {0x6f, 0x301, 0xf3},
+    {0x6f, 0x302, 0xf4}, {0x6f, 0x303, 0xf5}, {0x6f, 0x304, 0x14d}, {0x6f, 0x306, 0x14f},
+    {0x6f, 0x307, 0x22f}, {0x6f, 0x308, 0xf6}, {0x6f, 0x309, 0x1ecf}, {0x6f, 0x30b, 0x151},
+    {0x6f, 0x30c, 0x1d2}, {0x6f, 0x30f, 0x20d}, {0x6f, 0x311, 0x20f}, {0x6f, 0x31b, 0x1a1},
+    {0x6f, 0x323, 0x1ecd}, {0x6f, 0x328, 0x1eb}, {0x70, 0x301, 0x1e55}, {0x70, 0x307, 0x1e57},
+    {0x72, 0x301, 0x155}, {0x72, 0x307, 0x1e59}, {0x72, 0x30c, 0x159}, {0x72, 0x30f, 0x211},
+    {0x72, 0x311, 0x213}, {0x72, 0x323, 0x1e5b}, {0x72, 0x327, 0x157}, {0x72, 0x331, 0x1e5f},
+    {0x73, 0x301, 0x15b}, {0x73, 0x302, 0x15d}, {0x73, 0x307, 0x1e61}, {0x73, 0x30c, 0x161},
+    {0x73, 0x323, 0x1e63}, {0x73, 0x326, 0x219}, {0x73, 0x327, 0x15f}, {0x74, 0x307, 0x1e6b},
+    {0x74, 0x308, 0x1e97}, {0x74, 0x30c, 0x165}, {0x74, 0x323, 0x1e6d}, {0x74, 0x326, 0x21b},
+    {0x74, 0x327, 0x163}, {0x74, 0x32d, 0x1e71}, {0x74, 0x331, 0x1e6f}, {0x75, 0x300, 0xf9},
+    {0x75, 0x301, 0xfa}, {0x75, 0x302, 0xfb}, {0x75, 0x303, 0x169}, {0x75, 0x304, 0x16b},
+    {0x75, 0x306, 0x16d}, {0x75, 0x308, 0xfc}, {0x75, 0x309, 0x1ee7}, {0x75, 0x30a, 0x16f},
+    {0x75, 0x30b, 0x171}, {0x75, 0x30c, 0x1d4}, {0x75, 0x30f, 0x215}, {0x75, 0x311, 0x217},
+    {0x75, 0x31b, 0x1b0}, {0x75, 0x323, 0x1ee5}, {0x75, 0x324, 0x1e73}, {0x75, 0x328, 0x173},
+    {0x75, 0x32d, 0x1e77}, {0x75, 0x330, 0x1e75}, {0x76, 0x303, 0x1e7d}, {0x76, 0x323, 0x1e7f},
+    {0x77, 0x300, 0x1e81}, {0x77, 0x301, 0x1e83}, {0x77, 0x302, 0x175}, {0x77, 0x307, 0x1e87},
+    {0x77, 0x308, 0x1e85}, {0x77, 0x30a, 0x1e98}, {0x77, 0x323, 0x1e89}, {0x78, 0x307, 0x1e8b},
+    {0x78, 0x308, 0x1e8d}, {0x79, 0x300, 0x1ef3}, {0x79, 0x301, 0xfd}, {0x79, 0x302, 0x177},
+    {0x79, 0x303, 0x1ef9}, {0x79, 0x304, 0x233}, {0x79, 0x307, 0x1e8f}, {0x79, 0x308, 0xff},
+    {0x79, 0x309, 0x1ef7}, {0x79, 0x30a, 0x1e99}, {0x79, 0x323, 0x1ef5}, {0x7a, 0x301, 0x17a},
+    {0x7a, 0x302, 0x1e91}, {0x7a, 0x307, 0x17c}, {0x7a, 0x30c, 0x17e}, {0x7a, 0x323, 0x1e93},
+    {0x7a, 0x331, 0x1e95}, {0xa8, 0x300, 0x1fed}, {0xa8, 0x301, 0x385}, {0xa8, 0x342, 0x1fc1},
+    {0xc2, 0x300, 0x1ea6}, {0xc2, 0x301, 0x1ea4}, {0xc2, 0x303, 0x1eaa}, {0xc2, 0x309, 0x1ea8},
+    {0xc4, 0x304, 0x1de}, {0xc5, 0x301, 0x1fa}, {0xc6, 0x301, 0x1fc}, {0xc6, 0x304, 0x1e2},
+    {0xc7, 0x301, 0x1e08}, {0xca, 0x300, 0x1ec0}, {0xca, 0x301, 0x1ebe}, {0xca, 0x303, 0x1ec4},
+    {0xca, 0x309, 0x1ec2}, {0xcf, 0x301, 0x1e2e}, {0xd4, 0x300, 0x1ed2}, {0xd4, 0x301, 0x1ed0},
+    {0xd4, 0x303, 0x1ed6}, {0xd4, 0x309, 0x1ed4}, {0xd5, 0x301, 0x1e4c}, {0xd5, 0x304, 0x22c},
+    {0xd5, 0x308, 0x1e4e}, {0xd6, 0x304, 0x22a}, {0xd8, 0x301, 0x1fe}, {0xdc, 0x300, 0x1db},
+    {0xdc, 0x301, 0x1d7}, {0xdc, 0x304, 0x1d5}, {0xdc, 0x30c, 0x1d9}, {0xe2, 0x300, 0x1ea7},
+    {0xe2, 0x301, 0x1ea5}, {0xe2, 0x303, 0x1eab}, {0xe2, 0x309, 0x1ea9}, {0xe4, 0x304, 0x1df},
+    {0xe5, 0x301, 0x1fb}, {0xe6, 0x301, 0x1fd}, {0xe6, 0x304, 0x1e3}, {0xe7, 0x301, 0x1e09},
+    {0xea, 0x300, 0x1ec1}, {0xea, 0x301, 0x1ebf}, {0xea, 0x303, 0x1ec5}, {0xea, 0x309, 0x1ec3},
+    {0xef, 0x301, 0x1e2f}, {0xf4, 0x300, 0x1ed3}, {0xf4, 0x301, 0x1ed1}, {0xf4, 0x303, 0x1ed7},
+    {0xf4, 0x309, 0x1ed5}, {0xf5, 0x301, 0x1e4d}, {0xf5, 0x304, 0x22d}, {0xf5, 0x308, 0x1e4f},
+    {0xf6, 0x304, 0x22b}, {0xf8, 0x301, 0x1ff}, {0xfc, 0x300, 0x1dc}, {0xfc, 0x301, 0x1d8},
+    {0xfc, 0x304, 0x1d6}, {0xfc, 0x30c, 0x1da}, {0x102, 0x300, 0x1eb0}, {0x102, 0x301, 0x1eae},
+    {0x102, 0x303, 0x1eb4}, {0x102, 0x309, 0x1eb2}, {0x103, 0x300, 0x1eb1}, {0x103, 0x301, 0x1eaf},
+    {0x103, 0x303, 0x1eb5}, {0x103, 0x309, 0x1eb3}, {0x112, 0x300, 0x1e14}, {0x112, 0x301, 0x1e16},
+    {0x113, 0x300, 0x1e15}, {0x113, 0x301, 0x1e17}, {0x14c, 0x300, 0x1e50}, {0x14c, 0x301, 0x1e52},
+    {0x14d, 0x300, 0x1e51}, {0x14d, 0x301, 0x1e53}, {0x15a, 0x307, 0x1e64}, {0x15b, 0x307, 0x1e65},
+    {0x160, 0x307, 0x1e66}, {0x161, 0x307, 0x1e67}, {0x168, 0x301, 0x1e78}, {0x169, 0x301, 0x1e79},
+    {0x16a, 0x308, 0x1e7a}, {0x16b, 0x308, 0x1e7b}, {0x17f, 0x307, 0x1e9b}, {0x1a0, 0x300, 0x1edc},
+    {0x1a0, 0x301, 0x1eda}, {0x1a0, 0x303, 0x1ee0}, {0x1a0, 0x309, 0x1ede}, {0x1a0, 0x323, 0x1ee2},
+    {0x1a1, 0x300, 0x1edd}, {0x1a1, 0x301, 0x1edb}, {0x1a1, 0x303, 0x1ee1}, {0x1a1, 0x309, 0x1edf},
+    {0x1a1, 0x323, 0x1ee3}, {0x1af, 0x300, 0x1eea}, {0x1af, 0x301, 0x1ee8}, {0x1af, 0x303, 0x1eee},
+    {0x1af, 0x309, 0x1eec}, {0x1af, 0x323, 0x1ef0}, {0x1b0, 0x300, 0x1eeb}, {0x1b0, 0x301, 0x1ee9},
+    {0x1b0, 0x303, 0x1eef}, {0x1b0, 0x309, 0x1eed}, {0x1b0, 0x323, 0x1ef1}, {0x1b7, 0x30c, 0x1ee},
+    {0x1ea, 0x304, 0x1ec}, {0x1eb, 0x304, 0x1ed}, {0x226, 0x304, 0x1e0}, {0x227, 0x304, 0x1e1},
+    {0x228, 0x306, 0x1e1c}, {0x229, 0x306, 0x1e1d}, {0x22e, 0x304, 0x230}, {0x22f, 0x304, 0x231},
+    {0x292, 0x30c, 0x1ef}, {0x391, 0x300, 0x1fba}, {0x391, 0x301, 0x386}, {0x391, 0x304, 0x1fb9},
+    {0x391, 0x306, 0x1fb8}, {0x391, 0x313, 0x1f08}, {0x391, 0x314, 0x1f09}, {0x391, 0x345, 0x1fbc},
+    {0x395, 0x300, 0x1fc8}, {0x395, 0x301, 0x388}, {0x395, 0x313, 0x1f18}, {0x395, 0x314, 0x1f19},
+    {0x397, 0x300, 0x1fca}, {0x397, 0x301, 0x389}, {0x397, 0x313, 0x1f28}, {0x397, 0x314, 0x1f29},
+    {0x397, 0x345, 0x1fcc}, {0x399, 0x300, 0x1fda}, {0x399, 0x301, 0x38a}, {0x399, 0x304, 0x1fd9},
+    {0x399, 0x306, 0x1fd8}, {0x399, 0x308, 0x3aa}, {0x399, 0x313, 0x1f38}, {0x399, 0x314, 0x1f39},
+    {0x39f, 0x300, 0x1ff8}, {0x39f, 0x301, 0x38c}, {0x39f, 0x313, 0x1f48}, {0x39f, 0x314, 0x1f49},
+    {0x3a1, 0x314, 0x1fec}, {0x3a5, 0x300, 0x1fea}, {0x3a5, 0x301, 0x38e}, {0x3a5, 0x304, 0x1fe9},
+    {0x3a5, 0x306, 0x1fe8}, {0x3a5, 0x308, 0x3ab}, {0x3a5, 0x314, 0x1f59}, {0x3a9, 0x300, 0x1ffa},
+    {0x3a9, 0x301, 0x38f}, {0x3a9, 0x313, 0x1f68}, {0x3a9, 0x314, 0x1f69}, {0x3a9, 0x345, 0x1ffc},
+    {0x3ac, 0x345, 0x1fb4}, {0x3ae, 0x345, 0x1fc4}, {0x3b1, 0x300, 0x1f70}, {0x3b1, 0x301, 0x3ac},
+    {0x3b1, 0x304, 0x1fb1}, {0x3b1, 0x306, 0x1fb0}, {0x3b1, 0x313, 0x1f00}, {0x3b1, 0x314, 0x1f01},
+    {0x3b1, 0x342, 0x1fb6}, {0x3b1, 0x345, 0x1fb3}, {0x3b5, 0x300, 0x1f72}, {0x3b5, 0x301, 0x3ad},
+    {0x3b5, 0x313, 0x1f10}, {0x3b5, 0x314, 0x1f11}, {0x3b7, 0x300, 0x1f74}, {0x3b7, 0x301, 0x3ae},
+    {0x3b7, 0x313, 0x1f20}, {0x3b7, 0x314, 0x1f21}, {0x3b7, 0x342, 0x1fc6}, {0x3b7, 0x345, 0x1fc3},
+    {0x3b9, 0x300, 0x1f76}, {0x3b9, 0x301, 0x3af}, {0x3b9, 0x304, 0x1fd1}, {0x3b9, 0x306, 0x1fd0},
+    {0x3b9, 0x308, 0x3ca}, {0x3b9, 0x313, 0x1f30}, {0x3b9, 0x314, 0x1f31}, {0x3b9, 0x342, 0x1fd6},
+    {0x3bf, 0x300, 0x1f78}, {0x3bf, 0x301, 0x3cc}, {0x3bf, 0x313, 0x1f40}, {0x3bf, 0x314, 0x1f41},
+    {0x3c1, 0x313, 0x1fe4}, {0x3c1, 0x314, 0x1fe5}, {0x3c5, 0x300, 0x1f7a}, {0x3c5, 0x301, 0x3cd},
+    {0x3c5, 0x304, 0x1fe1}, {0x3c5, 0x306, 0x1fe0}, {0x3c5, 0x308, 0x3cb}, {0x3c5, 0x313, 0x1f50},
+    {0x3c5, 0x314, 0x1f51}, {0x3c5, 0x342, 0x1fe6}, {0x3c9, 0x300, 0x1f7c}, {0x3c9, 0x301, 0x3ce},
+    {0x3c9, 0x313, 0x1f60}, {0x3c9, 0x314, 0x1f61}, {0x3c9, 0x342, 0x1ff6}, {0x3c9, 0x345, 0x1ff3},
+    {0x3ca, 0x300, 0x1fd2}, {0x3ca, 0x301, 0x390}, {0x3ca, 0x342, 0x1fd7}, {0x3cb, 0x300, 0x1fe2},
+    {0x3cb, 0x301, 0x3b0}, {0x3cb, 0x342, 0x1fe7}, {0x3ce, 0x345, 0x1ff4}, {0x3d2, 0x301, 0x3d3},
+    {0x3d2, 0x308, 0x3d4}, {0x406, 0x308, 0x407}, {0x410, 0x306, 0x4d0}, {0x410, 0x308, 0x4d2},
+    {0x413, 0x301, 0x403}, {0x415, 0x300, 0x400}, {0x415, 0x306, 0x4d6}, {0x415, 0x308, 0x401},
+    {0x416, 0x306, 0x4c1}, {0x416, 0x308, 0x4dc}, {0x417, 0x308, 0x4de}, {0x418, 0x300, 0x40d},
+    {0x418, 0x304, 0x4e2}, {0x418, 0x306, 0x419}, {0x418, 0x308, 0x4e4}, {0x41a, 0x301, 0x40c},
+    {0x41e, 0x308, 0x4e6}, {0x423, 0x304, 0x4ee}, {0x423, 0x306, 0x40e}, {0x423, 0x308, 0x4f0},
+    {0x423, 0x30b, 0x4f2}, {0x427, 0x308, 0x4f4}, {0x42b, 0x308, 0x4f8}, {0x42d, 0x308, 0x4ec},
+    {0x430, 0x306, 0x4d1}, {0x430, 0x308, 0x4d3}, {0x433, 0x301, 0x453}, {0x435, 0x300, 0x450},
+    {0x435, 0x306, 0x4d7}, {0x435, 0x308, 0x451}, {0x436, 0x306, 0x4c2}, {0x436, 0x308, 0x4dd},
+    {0x437, 0x308, 0x4df}, {0x438, 0x300, 0x45d}, {0x438, 0x304, 0x4e3}, {0x438, 0x306, 0x439},
+    {0x438, 0x308, 0x4e5}, {0x43a, 0x301, 0x45c}, {0x43e, 0x308, 0x4e7}, {0x443, 0x304, 0x4ef},
+    {0x443, 0x306, 0x45e}, {0x443, 0x308, 0x4f1}, {0x443, 0x30b, 0x4f3}, {0x447, 0x308, 0x4f5},
+    {0x44b, 0x308, 0x4f9}, {0x44d, 0x308, 0x4ed}, {0x456, 0x308, 0x457}, {0x474, 0x30f, 0x476},
+    {0x475, 0x30f, 0x477}, {0x4d8, 0x308, 0x4da}, {0x4d9, 0x308, 0x4db}, {0x4e8, 0x308, 0x4ea},
+    {0x4e9, 0x308, 0x4eb}, {0x627, 0x653, 0x622}, {0x627, 0x654, 0x623}, {0x627, 0x655, 0x625},
+    {0x648, 0x654, 0x624}, {0x64a, 0x654, 0x626}, {0x6c1, 0x654, 0x6c2}, {0x6d2, 0x654, 0x6d3},
+    {0x6d5, 0x654, 0x6c0}, {0x928, 0x93c, 0x929}, {0x930, 0x93c, 0x931}, {0x933, 0x93c, 0x934},
+    {0x9c7, 0x9be, 0x9cb}, {0x9c7, 0x9d7, 0x9cc}, {0xb47, 0xb3e, 0xb4b}, {0xb47, 0xb56, 0xb48},
+    {0xb47, 0xb57, 0xb4c}, {0xb92, 0xbd7, 0xb94}, {0xbc6, 0xbbe, 0xbca}, {0xbc6, 0xbd7, 0xbcc},
+    {0xbc7, 0xbbe, 0xbcb}, {0xc46, 0xc56, 0xc48}, {0xcbf, 0xcd5, 0xcc0}, {0xcc6, 0xcc2, 0xcca},
+    {0xcc6, 0xcd5, 0xcc7}, {0xcc6, 0xcd6, 0xcc8}, {0xcca, 0xcd5, 0xccb}, {0xd46, 0xd3e, 0xd4a},
+    {0xd46, 0xd57, 0xd4c}, {0xd47, 0xd3e, 0xd4b}, {0xdd9, 0xdca, 0xdda}, {0xdd9, 0xdcf, 0xddc},
+    {0xdd9, 0xddf, 0xdde}, {0xddc, 0xdca, 0xddd}, {0x1025, 0x102e, 0x1026}, {0x1b05, 0x1b35, 0x1b06},
+    {0x1b07, 0x1b35, 0x1b08}, {0x1b09, 0x1b35, 0x1b0a}, {0x1b0b, 0x1b35, 0x1b0c}, {0x1b0d, 0x1b35, 0x1b0e},
+    {0x1b11, 0x1b35, 0x1b12}, {0x1b3a, 0x1b35, 0x1b3b}, {0x1b3c, 0x1b35, 0x1b3d}, {0x1b3e, 0x1b35, 0x1b40},
+    {0x1b3f, 0x1b35, 0x1b41}, {0x1b42, 0x1b35, 0x1b43}, {0x1e36, 0x304, 0x1e38}, {0x1e37, 0x304, 0x1e39},
+    {0x1e5a, 0x304, 0x1e5c}, {0x1e5b, 0x304, 0x1e5d}, {0x1e62, 0x307, 0x1e68}, {0x1e63, 0x307, 0x1e69},
+    {0x1ea0, 0x302, 0x1eac}, {0x1ea0, 0x306, 0x1eb6}, {0x1ea1, 0x302, 0x1ead}, {0x1ea1, 0x306, 0x1eb7},
+    {0x1eb8, 0x302, 0x1ec6}, {0x1eb9, 0x302, 0x1ec7}, {0x1ecc, 0x302, 0x1ed8}, {0x1ecd, 0x302, 0x1ed9},
+    {0x1f00, 0x300, 0x1f02}, {0x1f00, 0x301, 0x1f04}, {0x1f00, 0x342, 0x1f06}, {0x1f00, 0x345, 0x1f80},
+    {0x1f01, 0x300, 0x1f03}, {0x1f01, 0x301, 0x1f05}, {0x1f01, 0x342, 0x1f07}, {0x1f01, 0x345, 0x1f81},
+    {0x1f02, 0x345, 0x1f82}, {0x1f03, 0x345, 0x1f83}, {0x1f04, 0x345, 0x1f84}, {0x1f05, 0x345, 0x1f85},
+    {0x1f06, 0x345, 0x1f86}, {0x1f07, 0x345, 0x1f87}, {0x1f08, 0x300, 0x1f0a}, {0x1f08, 0x301, 0x1f0c},
+    {0x1f08, 0x342, 0x1f0e}, {0x1f08, 0x345, 0x1f88}, {0x1f09, 0x300, 0x1f0b}, {0x1f09, 0x301, 0x1f0d},
+    {0x1f09, 0x342, 0x1f0f}, {0x1f09, 0x345, 0x1f89}, {0x1f0a, 0x345, 0x1f8a}, {0x1f0b, 0x345, 0x1f8b},
+    {0x1f0c, 0x345, 0x1f8c}, {0x1f0d, 0x345, 0x1f8d}, {0x1f0e, 0x345, 0x1f8e}, {0x1f0f, 0x345, 0x1f8f},
+    {0x1f10, 0x300, 0x1f12}, {0x1f10, 0x301, 0x1f14}, {0x1f11, 0x300, 0x1f13}, {0x1f11, 0x301, 0x1f15},
+    {0x1f18, 0x300, 0x1f1a}, {0x1f18, 0x301, 0x1f1c}, {0x1f19, 0x300, 0x1f1b}, {0x1f19, 0x301, 0x1f1d},
+    {0x1f20, 0x300, 0x1f22}, {0x1f20, 0x301, 0x1f24}, {0x1f20, 0x342, 0x1f26}, {0x1f20, 0x345, 0x1f90},
+    {0x1f21, 0x300, 0x1f23}, {0x1f21, 0x301, 0x1f25}, {0x1f21, 0x342, 0x1f27}, {0x1f21, 0x345, 0x1f91},
+    {0x1f22, 0x345, 0x1f92}, {0x1f23, 0x345, 0x1f93}, {0x1f24, 0x345, 0x1f94}, {0x1f25, 0x345, 0x1f95},
+    {0x1f26, 0x345, 0x1f96}, {0x1f27, 0x345, 0x1f97}, {0x1f28, 0x300, 0x1f2a}, {0x1f28, 0x301, 0x1f2c},
+    {0x1f28, 0x342, 0x1f2e}, {0x1f28, 0x345, 0x1f98}, {0x1f29, 0x300, 0x1f2b}, {0x1f29, 0x301, 0x1f2d},
+    {0x1f29, 0x342, 0x1f2f}, {0x1f29, 0x345, 0x1f99}, {0x1f2a, 0x345, 0x1f9a}, {0x1f2b, 0x345, 0x1f9b},
+    {0x1f2c, 0x345, 0x1f9c}, {0x1f2d, 0x345, 0x1f9d}, {0x1f2e, 0x345, 0x1f9e}, {0x1f2f, 0x345, 0x1f9f},
+    {0x1f30, 0x300, 0x1f32}, {0x1f30, 0x301, 0x1f34}, {0x1f30, 0x342, 0x1f36}, {0x1f31, 0x300, 0x1f33},
+    {0x1f31, 0x301, 0x1f35}, {0x1f31, 0x342, 0x1f37}, {0x1f38, 0x300, 0x1f3a}, {0x1f38, 0x301, 0x1f3c},
+    {0x1f38, 0x342, 0x1f3e}, {0x1f39, 0x300, 0x1f3b}, {0x1f39, 0x301, 0x1f3d}, {0x1f39, 0x342, 0x1f3f},
+    {0x1f40, 0x300, 0x1f42}, {0x1f40, 0x301, 0x1f44}, {0x1f41, 0x300, 0x1f43}, {0x1f41, 0x301, 0x1f45},
+    {0x1f48, 0x300, 0x1f4a}, {0x1f48, 0x301, 0x1f4c}, {0x1f49, 0x300, 0x1f4b}, {0x1f49, 0x301, 0x1f4d},
+    {0x1f50, 0x300, 0x1f52}, {0x1f50, 0x301, 0x1f54}, {0x1f50, 0x342, 0x1f56}, {0x1f51, 0x300, 0x1f53},
+    {0x1f51, 0x301, 0x1f55}, {0x1f51, 0x342, 0x1f57}, {0x1f59, 0x300, 0x1f5b}, {0x1f59, 0x301, 0x1f5d},
+    {0x1f59, 0x342, 0x1f5f}, {0x1f60, 0x300, 0x1f62}, {0x1f60, 0x301, 0x1f64}, {0x1f60, 0x342, 0x1f66},
+    {0x1f60, 0x345, 0x1fa0}, {0x1f61, 0x300, 0x1f63}, {0x1f61, 0x301, 0x1f65}, {0x1f61, 0x342, 0x1f67},
+    {0x1f61, 0x345, 0x1fa1}, {0x1f62, 0x345, 0x1fa2}, {0x1f63, 0x345, 0x1fa3}, {0x1f64, 0x345, 0x1fa4},
+    {0x1f65, 0x345, 0x1fa5}, {0x1f66, 0x345, 0x1fa6}, {0x1f67, 0x345, 0x1fa7}, {0x1f68, 0x300, 0x1f6a},
+    {0x1f68, 0x301, 0x1f6c}, {0x1f68, 0x342, 0x1f6e}, {0x1f68, 0x345, 0x1fa8}, {0x1f69, 0x300, 0x1f6b},
+    {0x1f69, 0x301, 0x1f6d}, {0x1f69, 0x342, 0x1f6f}, {0x1f69, 0x345, 0x1fa9}, {0x1f6a, 0x345, 0x1faa},
+    {0x1f6b, 0x345, 0x1fab}, {0x1f6c, 0x345, 0x1fac}, {0x1f6d, 0x345, 0x1fad}, {0x1f6e, 0x345, 0x1fae},
+    {0x1f6f, 0x345, 0x1faf}, {0x1f70, 0x345, 0x1fb2}, {0x1f74, 0x345, 0x1fc2}, {0x1f7c, 0x345, 0x1ff2},
+    {0x1fb6, 0x345, 0x1fb7}, {0x1fbf, 0x300, 0x1fcd}, {0x1fbf, 0x301, 0x1fce}, {0x1fbf, 0x342, 0x1fcf},
+    {0x1fc6, 0x345, 0x1fc7}, {0x1ff6, 0x345, 0x1ff7}, {0x1ffe, 0x300, 0x1fdd}, {0x1ffe, 0x301, 0x1fde},
+    {0x1ffe, 0x342, 0x1fdf}, {0x2190, 0x338, 0x219a}, {0x2192, 0x338, 0x219b}, {0x2194, 0x338, 0x21ae},
+    {0x21d0, 0x338, 0x21cd}, {0x21d2, 0x338, 0x21cf}, {0x21d4, 0x338, 0x21ce}, {0x2203, 0x338, 0x2204},
+    {0x2208, 0x338, 0x2209}, {0x220b, 0x338, 0x220c}, {0x2223, 0x338, 0x2224}, {0x2225, 0x338, 0x2226},
+    {0x223c, 0x338, 0x2241}, {0x2243, 0x338, 0x2244}, {0x2245, 0x338, 0x2247}, {0x2248, 0x338, 0x2249},
+    {0x224d, 0x338, 0x226d}, {0x2261, 0x338, 0x2262}, {0x2264, 0x338, 0x2270}, {0x2265, 0x338, 0x2271},
+    {0x2272, 0x338, 0x2274}, {0x2273, 0x338, 0x2275}, {0x2276, 0x338, 0x2278}, {0x2277, 0x338, 0x2279},
+    {0x227a, 0x338, 0x2280}, {0x227b, 0x338, 0x2281}, {0x227c, 0x338, 0x22e0}, {0x227d, 0x338, 0x22e1},
+    {0x2282, 0x338, 0x2284}, {0x2283, 0x338, 0x2285}, {0x2286, 0x338, 0x2288}, {0x2287, 0x338, 0x2289},
+    {0x2291, 0x338, 0x22e2}, {0x2292, 0x338, 0x22e3}, {0x22a2, 0x338, 0x22ac}, {0x22a8, 0x338, 0x22ad},
+    {0x22a9, 0x338, 0x22ae}, {0x22ab, 0x338, 0x22af}, {0x22b2, 0x338, 0x22ea}, {0x22b3, 0x338, 0x22eb},
+    {0x22b4, 0x338, 0x22ec}, {0x22b5, 0x338, 0x22ed}, {0x3046, 0x3099, 0x3094}, {0x304b, 0x3099, 0x304c},
+    {0x304d, 0x3099, 0x304e}, {0x304f, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305a}, {0x305b, 0x3099, 0x305c},
+    {0x305d, 0x3099, 0x305e}, {0x305f, 0x3099, 0x3060}, {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069}, {0x306f, 0x3099, 0x3070}, {0x306f, 0x309a, 0x3071},
+    {0x3072, 0x3099, 0x3073}, {0x3072, 0x309a, 0x3074}, {0x3075, 0x3099, 0x3076}, {0x3075, 0x309a, 0x3077},
+    {0x3078, 0x3099, 0x3079}, {0x3078, 0x309a, 0x307a}, {0x307b, 0x3099, 0x307c}, {0x307b, 0x309a, 0x307d},
+    {0x309d, 0x3099, 0x309e}, {0x30a6, 0x3099, 0x30f4}, {0x30ab, 0x3099, 0x30ac}, {0x30ad, 0x3099, 0x30ae},
+    {0x30af, 0x3099, 0x30b0}, {0x30b1, 0x3099, 0x30b2}, {0x30b3, 0x3099, 0x30b4}, {0x30b5, 0x3099, 0x30b6},
+    {0x30b7, 0x3099, 0x30b8}, {0x30b9, 0x3099, 0x30ba}, {0x30bb, 0x3099, 0x30bc}, {0x30bd, 0x3099, 0x30be},
+    {0x30bf, 0x3099, 0x30c0}, {0x30c1, 0x3099, 0x30c2}, {0x30c4, 0x3099, 0x30c5}, {0x30c6, 0x3099, 0x30c7},
+    {0x30c8, 0x3099, 0x30c9}, {0x30cf, 0x3099, 0x30d0}, {0x30cf, 0x309a, 0x30d1}, {0x30d2, 0x3099, 0x30d3},
+    {0x30d2, 0x309a, 0x30d4}, {0x30d5, 0x3099, 0x30d6}, {0x30d5, 0x309a, 0x30d7}, {0x30d8, 0x3099, 0x30d9},
+    {0x30d8, 0x309a, 0x30da}, {0x30db, 0x3099, 0x30dc}, {0x30db, 0x309a, 0x30dd}, {0x30ef, 0x3099, 0x30f7},
+    {0x30f0, 0x3099, 0x30f8}, {0x30f1, 0x3099, 0x30f9}, {0x30f2, 0x3099, 0x30fa}, {0x30fd, 0x3099, 0x30fe},
+};
+const string::size_type uc_compositions_count = sizeof(uc_compositions) / sizeof(uc_compositions[0]);
+
+}  // namespace core
+}  // namespace wq
@@ -0,0 +1,1363 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/regex.h"
+#include "wq/core/hash.h"
+#include "wq/core/vector.h"
+#include "wq/core/p/utf8.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace wq {
+namespace core {
+
+typedef regex::size_type size_type;
+
+// regex_error class
+/*!
+    \class regex_error
+    \brief Exception which is thrown for invalid or unsupported pattern.
+
+    what() describes what is wrong with pattern.
+*/
+
+/*!
+    \brief Constructs exception with description \a what, which must be static text.
+*/
+regex_error::regex_error(const char* what) throw() : wq::core::exception(), m_what(what) {
+
+}
+
+/*!
+    \brief Returns description of error.
+*/
+const char* regex_error::what() const throw() {
+    return m_what;
+}
+
+// sets of characters
+// inclusive range of characters
+struct cp_range {
+    wq::uint32 m_first;
+    wq::uint32 m_last;
+
+    bool operator< (const cp_range& r) const {
+        return m_first < r.m_first;
+    };
+};
+typedef vector<cp_range> cp_ranges;
+
+static const wq::uint32 sm_last_char = 0x10FFFF;
+
+static void add_range(cp_ranges& set, wq::uint32 first, wq::uint32 last) {
+    cp_range r = { first, last };
+    set.push_back(r);
+}
+
+// sorts ranges and merges overlapping and adjacent ones
+static void normalize(cp_ranges& set) {
+    std::sort(set.begin(), set.end());
+    size_type n = 0;
+    for(size_type i = 0; i != set.size(); i++) {
+        if(n != 0 && set[i].m_first <= set[n - 1].m_last + 1) {
+            set[n - 1].m_last = std::max(set[n - 1].m_last, set[i].m_last);
+            continue;
+        }
+        set[n++] = set[i];
+    }
+    set.resize(n);
+}
+
+static void negate(cp_ranges& set) {
+    normalize(set);
+    cp_ranges ret_set;
+    wq::uint32 next = 0;
+    for(size_type i = 0; i != set.size(); i++) {
+        if(set[i].m_first > next) {
+            add_range(ret_set, next, set[i].m_first - 1);
+        }
+        next = set[i].m_last + 1;
+    }
+    if(next <= sm_last_char) {
+        add_range(ret_set, next, sm_last_char);
+    }
+    set.swap(ret_set);
+}
+
+// adds all characters with the same case folding as some character of set
+static void add_case_variants(cp_ranges& set) {
+    size_type n = set.size();
+    wq::uint32 last_cased = utf8_last_cased();
+    for(size_type i = 0; i != n; i++) {
+        for(wq::uint32 c = set[i].m_first; c <= set[i].m_last && c <= last_cased; c++) {
+            wq::uint32 variants[8];
+            size_type count = utf8_case_variants(c, variants, 8);
+            for(size_type v = 0; v != count; v++) {
+                add_range(set, variants[v], variants[v]);
+            }
+        }
+    }
+    normalize(set);
+}
+
+// ranges of characters of every category, it is built on first use from
+// Unicode properties and lives until end of process
+struct category_table {
+    cp_ranges m_ranges[32];
+};
+
+static const category_table* new_category_table() {
+    category_table* table = new category_table;
+    wq::uint32 first = 0;
+    int category = string::value_type::get_uc_properties(0)->category;
+    for(wq::uint32 c = 1; c <= sm_last_char + 1; c++) {
+        int next = c <= sm_last_char ? int(string::value_type::get_uc_properties(c)->category) : -1;
+        if(next != category) {
+            add_range(table->m_ranges[category & 31], first, c - 1);
+            first = c;
+            category = next;
+        }
+    }
+    return table;
+}
+
+static const category_table& get_category_table() {
+    static const category_table* table = new_category_table();
+    return *table;
+}
+
+struct category_name {
+    const char* m_name;
+    string::value_type::uc_category m_category;
+};
+
+static const category_name sm_category_names[] = {
+    { "Mn", string::value_type::mark_non_spacing },
+    { "Mc", string::value_type::mark_spacing_combining },
+    { "Me", string::value_type::mark_enclosing },
+    { "Nd", string::value_type::number_decimalDigit },
+    { "Nl", string::value_type::number_letter },
+    { "No", string::value_type::number_other },
+    { "Zs", string::value_type::separator_space },
+    { "Zl", string::value_type::separator_line },
+    { "Zp", string::value_type::separator_paragraph },
+    { "Cc", string::value_type::other_control },
+    { "Cf", string::value_type::other_format },
+    { "Cs", string::value_type::other_surrogate },
+    { "Co", string::value_type::other_privateUse },
+    { "Cn", string::value_type::other_not_assigned },
+    { "Cn", string::value_type::no_category },
+    { "Lu", string::value_type::letter_uppercase },
+    { "Ll", string::value_type::letter_lowercase },
+    { "Lt", string::value_type::letter_titlecase },
+    { "Lm", string::value_type::letter_modifier },
+    { "Lo", string::value_type::letter_other },
+    { "Pc", string::value_type::punctuation_connector },
+    { "Pd", string::value_type::punctuation_dash },
+    { "Ps", string::value_type::punctuation_open },
+    { "Pe", string::value_type::punctuation_close },
+    { "Pi", string::value_type::punctuation_initial_quote },
+    { "Pf", string::value_type::punctuation_final_quote },
+    { "Po", string::value_type::punctuation_other },
+    { "Sm", string::value_type::symbol_math },
+    { "Sc", string::value_type::symbol_currency },
+    { "Sk", string::value_type::symbol_modifier },
+    { "So", string::value_type::symbol_other }
+};
+
+// adds characters of category with given name (like "Lu"), one letter
+// names (like "L") mean all categories starting with it
+static bool add_category(cp_ranges& set, const char* name) {
+    const category_table& table = get_category_table();
+    size_type len = strlen(name);
+    bool found = false;
+    for(size_type i = 0; i != sizeof(sm_category_names) / sizeof(sm_category_names[0]); i++) {
+        if(len == 0 || len > 2 || strncmp(sm_category_names[i].m_name, name, len) != 0) {
+            continue;
+        }
+        const cp_ranges& ranges = table.m_ranges[ sm_category_names[i].m_category ];
+        set.insert(set.end(), ranges.begin(), ranges.end());
+        found = true;
+    }
+    return found;
+}
+
+// parsed pattern
+enum node_type {
+    node_empty,
+    node_chars,
+    node_concat,
+    node_alternation,
+    node_repeat,
+    node_begin,
+    node_end
+};
+
+struct regex_node {
+    node_type m_type;
+    cp_ranges m_chars;
+    vector<size_type> m_children;
+    wq::uint32 m_min;
+    wq::uint32 m_max;
+    bool m_greedy;
+};
+
+static const wq::uint32 sm_infinite = 0xFFFFFFFFu;
+static const wq::uint32 sm_max_repeat = 1000;
+
+// recursive descent parser of patterns, nodes are stored to vector and refer
+// to their children by indexes
+class regex_parser {
+    public:
+        regex_parser(const string_ref& pattern, bool cs, vector<regex_node>& nodes) :
+            m_cs(cs), m_pos(0), m_nodes(nodes) {
+            for(string::cp_iterator iter = pattern.cp_begin(); !iter.at_end(); ++iter) {
+                m_chars.push_back( iter.utf32() );
+            }
+        };
+
+        size_type parse() {
+            size_type root = parse_alternation();
+            if(m_pos != m_chars.size()) {
+                throw regex_error("unmatched ) in pattern");
+            }
+            return root;
+        };
+
+    private:
+        bool at(wq::uint32 c) const {
+            return m_pos != m_chars.size() && m_chars[m_pos] == c;
+        };
+        wq::uint32 next_char(const char* error) {
+            if(m_pos == m_chars.size()) {
+                throw regex_error(error);
+            }
+            return m_chars[m_pos++];
+        };
+        size_type add_node(node_type type) {
+            regex_node node;
+            node.m_type = type;
+            node.m_min = 0;
+            node.m_max = 0;
+            node.m_greedy = true;
+            m_nodes.push_back(node);
+            return m_nodes.size() - 1;
+        };
+        size_type add_chars(cp_ranges& set) {
+            size_type node = add_node(node_chars);
+            normalize(set);
+            m_nodes[node].m_chars.swap(set);
+            return node;
+        };
+
+        size_type parse_alternation();
+        size_type parse_concat();
+        size_type parse_repeat();
+        size_type parse_atom();
+        size_type parse_class();
+        bool parse_class_char(cp_ranges&, wq::uint32&);
+        bool parse_counts(wq::uint32&, wq::uint32&);
+        bool parse_escape(cp_ranges&, wq::uint32&, bool);
+        wq::uint32 parse_hex(size_type);
+
+        bool m_cs;
+        vector<wq::uint32> m_chars;
+        size_type m_pos;
+        vector<regex_node>& m_nodes;
+};
+
+size_type regex_parser::parse_alternation() {
+    size_type first = parse_concat();
+    if(!at('|')) {
+        return first;
+    }
+    size_type node = add_node(node_alternation);
+    m_nodes[node].m_children.push_back(first);
+    while(at('|')) {
+        m_pos++;
+        size_type next = parse_concat();
+        m_nodes[node].m_children.push_back(next);
+    }
+    return node;
+}
+
+size_type regex_parser::parse_concat() {
+    vector<size_type> items;
+    while(m_pos != m_chars.size() && !at('|') && !at(')')) {
+        items.push_back( parse_repeat() );
+    }
+    if(items.size() == 1) {
+        return items[0];
+    }
+    size_type node = add_node(items.empty() ? node_empty : node_concat);
+    m_nodes[node].m_children.swap(items);
+    return node;
+}
+
+size_type regex_parser::parse_repeat() {
+    size_type node = parse_atom();
+    while(m_pos != m_chars.size()) {
+        wq::uint32 min = 0;
+        wq::uint32 max = sm_infinite;
+        if(at('*') || at('+') || at('?')) {
+            min = at('+') ? 1 : 0;
+            max = at('?') ? 1 : sm_infinite;
+            m_pos++;
+        }
+        else if( !at('{') || !parse_counts(min, max) ) {
+            // brace which does not start counts is ordinary character
+            break;
+        }
+
+        size_type repeat = add_node(node_repeat);
+        m_nodes[repeat].m_children.push_back(node);
+        m_nodes[repeat].m_min = min;
+        m_nodes[repeat].m_max = max;
+        m_nodes[repeat].m_greedy = !at('?');
+        m_pos += at('?') ? 1 : 0;
+        node = repeat;
+    }
+    return node;
+}
+
+// parses {n}, {n,} or {n,m}, returns false if there are no counts at position
+bool regex_parser::parse_counts(wq::uint32& min, wq::uint32& max) {
+    size_type pos = m_pos + 1;
+    wq::uint32 counts[2] = { 0, sm_infinite };
+    for(int k = 0; k != 2; k++) {
+        size_type digits = pos;
+        wq::uint32 value = 0;
+        for( ; pos != m_chars.size() && m_chars[pos] >= '0' && m_chars[pos] <= '9'; pos++) {
+            value = value > sm_max_repeat ? value : value * 10 + (m_chars[pos] - '0');
+        }
+        if(pos == m_chars.size() || (digits == pos && k == 0)) {
+            return false;
+        }
+        counts[k] = digits == pos ? sm_infinite : value;
+        if(k == 0 && m_chars[pos] == '}') {
+            counts[1] = counts[0];
+            pos++;
+            break;
+        }
+        if(m_chars[pos] != (k == 0 ? ',' : '}')) {
+            return false;
+        }
+        pos++;
+    }
+    m_pos = pos;
+    min = counts[0];
+    max = counts[1];
+    if(min > sm_max_repeat || (max != sm_infinite && max > sm_max_repeat)) {
+        throw regex_error("too many repetitions in pattern");
+    }
+    if(min > max) {
+        throw regex_error("invalid repetition counts in pattern");
+    }
+    return true;
+}
+
+size_type regex_parser::parse_atom() {
+    wq::uint32 c = m_chars[m_pos++];
+    cp_ranges set;
+    switch(c) {
+        case '(': {
+            if(at('?')) {
+                if(m_pos + 1 == m_chars.size() || m_chars[m_pos + 1] != ':') {
+                    throw regex_error("unsupported kind of group in pattern");
+                }
+                m_pos += 2;
+            }
+            size_type node = parse_alternation();
+            if(!at(')')) {
+                throw regex_error("missing ) in pattern");
+            }
+            m_pos++;
+            return node;
+        }
+        case '[':
+            return parse_class();
+        case '.':
+            // all characters except line terminators
+            add_range(set, 0, '\n' - 1);
+            add_range(set, '\n' + 1, '\r' - 1);
+            add_range(set, '\r' + 1, 0x2027);
+            add_range(set, 0x202A, sm_last_char);
+            return add_chars(set);
+        case '^':
+            return add_node(node_begin);
+        case '$':
+            return add_node(node_end);
+        case '*':
+        case '+':
+        case '?':
+            throw regex_error("nothing to repeat in pattern");
+        case '\\':
+            if( parse_escape(set, c, false) ) {
+                return add_chars(set);
+            }
+            break;
+    }
+    add_range(set, c, c);
+    if(!m_cs) {
+        add_case_variants(set);
+    }
+    return add_chars(set);
+}
+
+// parses class after [, ranges of characters are folded before negating
+size_type regex_parser::parse_class() {
+    bool negated = at('^');
+    m_pos += negated ? 1 : 0;
+    cp_ranges set;
+    while(!at(']')) {
+        if(m_pos == m_chars.size()) {
+            throw regex_error("missing ] in pattern");
+        }
+        wq::uint32 first;
+        if( parse_class_char(set, first) ) {
+            continue;
+        }
+        if(!at('-') || m_pos + 1 == m_chars.size() || m_chars[m_pos + 1] == ']') {
+            add_range(set, first, first);
+            continue;
+        }
+        m_pos++;
+        wq::uint32 last;
+        if(parse_class_char(set, last) || last < first) {
+            throw regex_error("invalid range in character class");
+        }
+        add_range(set, first, last);
+    }
+    m_pos++;
+    if(!m_cs) {
+        add_case_variants(set);
+    }
+    if(negated) {
+        negate(set);
+    }
+    return add_chars(set);
+}
+
+// returns true if escaped class was added to set, otherwise c is set to character
+bool regex_parser::parse_class_char(cp_ranges& set, wq::uint32& c) {
+    c = m_chars[m_pos++];
+    return c == '\\' && parse_escape(set, c, true);
+}
+
+// parses escape sequence after backslash, returns true if it is class which is
+// added to set, otherwise c is set to escaped character
+bool regex_parser::parse_escape(cp_ranges& set, wq::uint32& c, bool in_class) {
+    wq::uint32 e = next_char("pattern ends with \\");
+    cp_ranges escaped;
+    switch(e) {
+        case 'd':
+        case 'D':
+            add_category(escaped, "Nd");
+            break;
+        case 'w':
+        case 'W':
+            add_category(escaped, "L");
+            add_category(escaped, "M");
+            add_category(escaped, "Nd");
+            add_category(escaped, "Pc");
+            break;
+        case 's':
+        case 'S':
+            add_range(escaped, '\t', '\r');
+            add_range(escaped, 0x85, 0x85);
+            add_category(escaped, "Z");
+            break;
+        case 'p':
+        case 'P': {
+            char name[3] = { 0, 0, 0 };
+            size_type len = 0;
+            if(next_char("missing { after \\p") != '{') {
+                throw regex_error("missing { after \\p");
+            }
+            for(wq::uint32 n = next_char("missing } after \\p"); n != '}'; n = next_char("missing } after \\p")) {
+                if(len == 2 || n >= 0x80) {
+                    throw regex_error("unknown category in pattern");
+                }
+                name[len++] = char(n);
+            }
+            if( !add_category(escaped, name) ) {
+                throw regex_error("unknown category in pattern");
+            }
+            break;
+        }
+        case 'n':
+            c = '\n';
+            return false;
+        case 't':
+            c = '\t';
+            return false;
+        case 'r':
+            c = '\r';
+            return false;
+        case 'f':
+            c = '\f';
+            return false;
+        case 'v':
+            c = '\v';
+            return false;
+        case '0':
+            c = 0;
+            return false;
+        case 'x':
+            c = parse_hex(2);
+            return false;
+        case 'u':
+            c = parse_hex(4);
+            return false;
+        case 'b':
+            if(in_class) {
+                c = '\b';
+                return false;
+            }
+            throw regex_error("word boundaries are not supported");
+        case 'B':
+            throw regex_error("word boundaries are not supported");
+        default:
+            if((e >= '1' && e <= '9')) {
+                throw regex_error("back references are not supported");
+            }
+            if((e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z')) {
+                throw regex_error("unknown escape sequence in pattern");
+            }
+            c = e;
+            return false;
+    }
+
+    // upper case escapes are negated classes
+    if(e >= 'A' && e <= 'Z') {
+        negate(escaped);
+    }
+    set.insert(set.end(), escaped.begin(), escaped.end());
+    return true;
+}
+
+// parses n hexadecimal digits or any count of them in braces
+wq::uint32 regex_parser::parse_hex(size_type n) {
+    bool braces = at('{');
+    m_pos += braces ? 1 : 0;
+    wq::uint32 value = 0;
+    size_type count = 0;
+    for( ; braces ? !at('}') : count != n; count++) {
+        wq::uint32 d = next_char("invalid hexadecimal escape in pattern");
+        d = (d >= '0' && d <= '9') ? d - '0' : ( (d | 0x20) >= 'a' && (d | 0x20) <= 'f' ? (d | 0x20) - 'a' + 10 : 16 );
+        if(d == 16 || count == 6) {
+            throw regex_error("invalid hexadecimal escape in pattern");
+        }
+        value = value * 16 + d;
+    }
+    if(count == 0 || value > sm_last_char || (value >= 0xD800 && value <= 0xDFFF)) {
+        throw regex_error("invalid hexadecimal escape in pattern");
+    }
+    m_pos += braces ? 1 : 0;
+    return value;
+}
+
+// nondeterministic automaton over UTF-8 bytes
+enum nfa_type {
+    nfa_byte,
+    nfa_split,
+    nfa_begin,
+    nfa_end,
+    nfa_enter,
+    nfa_check,
+    nfa_match
+};
+
+// byte states go to m_out by bytes from m_lo to m_hi, split states go to both
+// m_out and m_out2 (m_out has higher priority), enter states start optional
+// repetition and check states stop threads which repeated it without reading
+// of any byte (like ECMAScript does)
+struct nfa_state {
+    wq::uint8 m_type;
+    wq::uint8 m_lo;
+    wq::uint8 m_hi;
+    wq::uint32 m_out;
+    wq::uint32 m_out2;
+};
+
+static const size_type sm_max_nfa_states = 200000;
+
+class regex_nfa {
+    public:
+        wq::uint32 add(nfa_type type, wq::uint32 out, wq::uint32 out2 = 0, wq::uint8 lo = 0, wq::uint8 hi = 0) {
+            if(m_states.size() == sm_max_nfa_states) {
+                throw regex_error("pattern is too large");
+            }
+            nfa_state state = { wq::uint8(type), lo, hi, out, out2 };
+            m_states.push_back(state);
+            return wq::uint32(m_states.size() - 1);
+        };
+
+        vector<nfa_state> m_states;
+};
+
+// sequence of byte ranges which encodes range of characters
+struct byte_ranges {
+    size_type m_count;
+    char m_lo[4];
+    char m_hi[4];
+};
+
+// splits range of characters with n bytes long encoding, so every part is
+// encoded by sequence of byte ranges
+static void split_range(wq::uint32 first, wq::uint32 last, size_type n, vector<byte_ranges>& out) {
+    for(size_type i = 1; i < n; i++) {
+        wq::uint32 mask = (wq::uint32(1) << (6 * i)) - 1;
+        if((first & ~mask) == (last & ~mask)) {
+            continue;
+        }
+        if((first & mask) != 0) {
+            split_range(first, first | mask, n, out);
+            split_range((first | mask) + 1, last, n, out);
+            return;
+        }
+        if((last & mask) != mask) {
+            split_range(first, (last & ~mask) - 1, n, out);
+            split_range(last & ~mask, last, n, out);
+            return;
+        }
+    }
+    byte_ranges ranges;
+    ranges.m_count = utf8_encode(first, ranges.m_lo);
+    utf8_encode(last, ranges.m_hi);
+    out.push_back(ranges);
+}
+
+// byte sequences of all characters from first to last except surrogates
+static void utf8_ranges(wq::uint32 first, wq::uint32 last, vector<byte_ranges>& out) {
+    static const wq::uint32 limits[] = { 0, 0x80, 0x800, 0x10000, sm_last_char + 1 };
+    for(size_type n = 1; n != 5; n++) {
+        wq::uint32 lo = std::max(first, limits[n - 1]);
+        wq::uint32 hi = std::min(last, limits[n] - 1);
+        if(n == 3 && lo <= hi && lo <= 0xDFFF && hi >= 0xD800) {
+            if(lo < 0xD800) {
+                split_range(lo, 0xD7FF, n, out);
+            }
+            lo = 0xE000;
+        }
+        if(lo <= hi) {
+            split_range(lo, hi, n, out);
+        }
+    }
+}
+
+// returns true if node can match empty text
+static bool is_nullable(const vector<regex_node>& nodes, size_type index) {
+    const regex_node& node = nodes[index];
+    const vector<size_type>& children = node.m_children;
+    switch(node.m_type) {
+        case node_chars:
+            return false;
+        case node_concat:
+            for(size_type i = 0; i != children.size(); i++) {
+                if(!is_nullable(nodes, children[i])) {
+                    return false;
+                }
+            }
+            return true;
+        case node_alternation:
+            for(size_type i = 0; i != children.size(); i++) {
+                if(is_nullable(nodes, children[i])) {
+                    return true;
+                }
+            }
+            return false;
+        case node_repeat:
+            return node.m_min == 0 || is_nullable(nodes, children[0]);
+        default:
+            return true;
+    }
+}
+
+// compiles nodes to automaton which continues by given state, reversed
+// automaton reads text from its end (it only finds beginnings of matches,
+// so it does not need checks of optional repetitions)
+class nfa_compiler {
+    public:
+        nfa_compiler(const vector<regex_node>& nodes, bool reverse, regex_nfa& nfa) :
+            m_nodes(nodes), m_reverse(reverse), m_nfa(nfa) { };
+
+        wq::uint32 compile(size_type, wq::uint32);
+
+    private:
+        // trie of byte ranges, its alternatives are compiled to split states
+        struct trie_node {
+            char m_lo;
+            char m_hi;
+            vector<wq::uint32> m_children;
+        };
+
+        wq::uint32 compile_optional(size_type, wq::uint32);
+        wq::uint32 compile_chars(const cp_ranges&, wq::uint32);
+        wq::uint32 compile_trie(const vector<trie_node>&, wq::uint32, wq::uint32);
+
+        const vector<regex_node>& m_nodes;
+        bool m_reverse;
+        regex_nfa& m_nfa;
+};
+
+wq::uint32 nfa_compiler::compile(size_type index, wq::uint32 next) {
+    const regex_node& node = m_nodes[index];
+    const vector<size_type>& children = node.m_children;
+    switch(node.m_type) {
+        case node_empty:
+            return next;
+        case node_chars:
+            return compile_chars(node.m_chars, next);
+        case node_concat:
+            for(size_type i = 0; i != children.size(); i++) {
+                next = compile(children[m_reverse ? i : children.size() - 1 - i], next);
+            }
+            return next;
+        case node_alternation: {
+            // the first alternative has the highest priority
+            wq::uint32 entry = compile(children.back(), next);
+            for(size_type i = children.size() - 1; i != 0; i--) {
+                entry = m_nfa.add(nfa_split, compile(children[i - 1], next), entry);
+            }
+            return entry;
+        }
+        case node_repeat: {
+            wq::uint32 tail = next;
+            if(node.m_max == sm_infinite) {
+                wq::uint32 loop = m_nfa.add(nfa_split, 0);
+                wq::uint32 body = compile_optional(children[0], loop);
+                m_nfa.m_states[loop].m_out = node.m_greedy ? body : next;
+                m_nfa.m_states[loop].m_out2 = node.m_greedy ? next : body;
+                tail = loop;
+            }
+            for(wq::uint32 k = node.m_min; node.m_max != sm_infinite && k != node.m_max; k++) {
+                // optional copies, every one can skip all following ones
+                wq::uint32 body = compile_optional(children[0], tail);
+                tail = node.m_greedy ? m_nfa.add(nfa_split, body, next) : m_nfa.add(nfa_split, next, body);
+            }
+            for(wq::uint32 k = 0; k != node.m_min; k++) {
+                tail = compile(children[0], tail);
+            }
+            return tail;
+        }
+        case node_begin:
+            return m_nfa.add(m_reverse ? nfa_end : nfa_begin, next);
+        case node_end:
+            return m_nfa.add(m_reverse ? nfa_begin : nfa_end, next);
+    }
+    return next;
+}
+
+// compiles repetition which is not required, it ends without match if it
+// does not read any byte
+wq::uint32 nfa_compiler::compile_optional(size_type index, wq::uint32 next) {
+    if(m_reverse || !is_nullable(m_nodes, index)) {
+        return compile(index, next);
+    }
+    return m_nfa.add( nfa_enter, compile(index, m_nfa.add(nfa_check, next)) );
+}
+
+// characters are compiled to byte ranges of their UTF-8 sequences, sequences
+// with the same beginning share states
+wq::uint32 nfa_compiler::compile_chars(const cp_ranges& set, wq::uint32 next) {
+    vector<byte_ranges> sequences;
+    for(size_type i = 0; i != set.size(); i++) {
+        utf8_ranges(set[i].m_first, set[i].m_last, sequences);
+    }
+
+    vector<trie_node> trie(1);
+    for(size_type s = 0; s != sequences.size(); s++) {
+        wq::uint32 node = 0;
+        for(size_type k = 0; k != sequences[s].m_count; k++) {
+            size_type b = m_reverse ? sequences[s].m_count - 1 - k : k;
+            char lo = sequences[s].m_lo[b];
+            char hi = sequences[s].m_hi[b];
+            const vector<wq::uint32>& children = trie[node].m_children;
+            wq::uint32 child = 0;
+            for(size_type i = 0; i != children.size() && child == 0; i++) {
+                child = (trie[ children[i] ].m_lo == lo && trie[ children[i] ].m_hi == hi) ? children[i] : 0;
+            }
+            if(child == 0) {
+                trie_node new_node;
+                new_node.m_lo = lo;
+                new_node.m_hi = hi;
+                child = wq::uint32( trie.size() );
+                trie.push_back(new_node);
+                trie[node].m_children.push_back(child);
+            }
+            node = child;
+        }
+    }
+    return compile_trie(trie, 0, next);
+}
+
+// every path of trie is one sequence, so nodes with children never end sequences
+wq::uint32 nfa_compiler::compile_trie(const vector<trie_node>& trie, wq::uint32 node, wq::uint32 next) {
+    const vector<wq::uint32>& children = trie[node].m_children;
+    if(children.empty()) {
+        // empty set never matches
+        return m_nfa.add(nfa_byte, next, 0, 1, 0);
+    }
+    wq::uint32 entry = 0;
+    for(size_type i = children.size(); i != 0; i--) {
+        const trie_node& child = trie[ children[i - 1] ];
+        wq::uint32 target = child.m_children.empty() ? next : compile_trie(trie, children[i - 1], next);
+        wq::uint32 state = m_nfa.add(nfa_byte, target, 0, wq::uint8(child.m_lo), wq::uint8(child.m_hi));
+        entry = i == children.size() ? state : m_nfa.add(nfa_split, state, entry);
+    }
+    return entry;
+}
+
+// deterministic automaton which is built lazily from nondeterministic one,
+// its states are ordered lists of states of nondeterministic automaton (threads
+// ordered by priority) - if lists are cut after matching thread, leftmost-first
+// match is found, otherwise all matches are found
+class lazy_dfa {
+    public:
+        // transitions are offsets of rows of target states with flags of target
+        static const wq::uint32 match_bit = 0x40000000u;
+        static const wq::uint32 dead_bit = 0x80000000u;
+        static const wq::uint32 flags = match_bit | dead_bit;
+        static const wq::uint32 unknown = 0xFFFFFFFFu;
+
+        void init(const regex_nfa&, wq::uint32, bool, wq::uint32);
+
+        const wq::uint32* table() const {
+            return &m_table[0];
+        };
+        wq::uint32 start(const regex_nfa&, bool);
+        wq::uint32 next(const regex_nfa&, wq::uint32&, wq::uint32, char);
+        bool match_at_end(wq::uint32 row) const {
+            return m_at_end[row / m_class_count] != 0;
+        };
+
+    private:
+        void reset();
+        void next_mark();
+        bool closure(const regex_nfa&, wq::uint32, bool, bool, vector<wq::uint32>&);
+        wq::uint32 add_state(const regex_nfa&, const vector<wq::uint32>&);
+        void rehash();
+
+        wq::uint32 m_entry;
+        bool m_cut;
+        wq::uint32 m_class_count;
+        wq::uint32 m_starts[2];
+
+        // rows of transitions and keys of states (flag of text beginning and list of threads)
+        vector<wq::uint32> m_table;
+        vector<wq::uint32> m_keys;
+        vector<wq::uint32> m_keys_begin;
+        vector<wq::uint32> m_flags;
+        vector<wq::uint8> m_at_end;
+
+        // open addressing table of states by their keys, 0 is empty slot
+        vector<wq::uint32> m_slots;
+
+        // temporary data of closures, states are marked separately for
+        // threads which started optional repetition after the last byte
+        vector<wq::uint32> m_marks;
+        vector<wq::uint32> m_started_marks;
+        wq::uint32 m_mark;
+        vector<wq::uint32> m_stack;
+        vector<wq::uint32> m_key;
+};
+
+const wq::uint32 lazy_dfa::match_bit;
+const wq::uint32 lazy_dfa::dead_bit;
+const wq::uint32 lazy_dfa::flags;
+const wq::uint32 lazy_dfa::unknown;
+
+// states are dropped when table grows over this number of transitions
+static const size_type sm_max_transitions = 1 << 19;
+
+void lazy_dfa::init(const regex_nfa& nfa, wq::uint32 entry, bool cut, wq::uint32 class_count) {
+    m_entry = entry;
+    m_cut = cut;
+    m_class_count = class_count;
+    m_marks.assign(nfa.m_states.size(), 0);
+    m_started_marks.assign(nfa.m_states.size(), 0);
+    m_mark = 0;
+    reset();
+}
+
+void lazy_dfa::reset() {
+    m_starts[0] = unknown;
+    m_starts[1] = unknown;
+    m_table.clear();
+    m_keys.clear();
+    m_keys_begin.assign(1, 0);
+    m_flags.clear();
+    m_at_end.clear();
+    m_slots.assign(64, 0);
+}
+
+void lazy_dfa::next_mark() {
+    if(++m_mark == 0) {
+        std::fill(m_marks.begin(), m_marks.end(), 0);
+        std::fill(m_started_marks.begin(), m_started_marks.end(), 0);
+        m_mark = 1;
+    }
+}
+
+// flag of threads on stack of closure which started optional repetition
+// after the last byte, nfa states are never so many to use it
+static const wq::uint32 sm_started_bit = 0x80000000u;
+
+// appends threads reachable from s without reading bytes, returns true if
+// list was cut after matching thread
+bool lazy_dfa::closure(const regex_nfa& nfa, wq::uint32 s, bool at_begin, bool at_end, vector<wq::uint32>& items) {
+    m_stack.push_back(s);
+    while(!m_stack.empty()) {
+        wq::uint32 i = m_stack.back() & ~sm_started_bit;
+        wq::uint32 started = m_stack.back() & sm_started_bit;
+        m_stack.pop_back();
+        const nfa_state& state = nfa.m_states[i];
+
+        // threads waiting for bytes continue the same way in both cases
+        if(state.m_type == nfa_byte || state.m_type == nfa_match || (state.m_type == nfa_end && !at_end)) {
+            started = 0;
+        }
+        vector<wq::uint32>& marks = started != 0 ? m_started_marks : m_marks;
+        if(marks[i] == m_mark) {
+            continue;
+        }
+        marks[i] = m_mark;
+
+        switch(state.m_type) {
+            case nfa_split:
+                m_stack.push_back(state.m_out2 | started);
+                m_stack.push_back(state.m_out | started);
+                break;
+            case nfa_begin:
+                if(at_begin) {
+                    m_stack.push_back(state.m_out | started);
+                }
+                break;
+            case nfa_end:
+                if(at_end) {
+                    m_stack.push_back(state.m_out | started);
+                    break;
+                }
+                items.push_back(i);
+                break;
+            case nfa_enter:
+                m_stack.push_back(state.m_out | sm_started_bit);
+                break;
+            case nfa_check:
+                // repetition which was started after the last byte is empty
+                if(started == 0) {
+                    m_stack.push_back(state.m_out);
+                }
+                break;
+            case nfa_match:
+                items.push_back(i);
+                if(m_cut) {
+                    m_stack.clear();
+                    return true;
+                }
+                break;
+            default:
+                items.push_back(i);
+        }
+    }
+    return false;
+}
+
+wq::uint32 lazy_dfa::start(const regex_nfa& nfa, bool at_begin) {
+    if(m_starts[at_begin] == unknown) {
+        vector<wq::uint32> key(1, at_begin);
+        next_mark();
+        closure(nfa, m_entry, at_begin, false, key);
+        if(m_table.size() + m_class_count > sm_max_transitions) {
+            reset();
+        }
+        m_starts[at_begin] = add_state(nfa, key);
+    }
+    return m_starts[at_begin];
+}
+
+// computes transition from state at row by byte b of class c, row is changed
+// if states were dropped
+wq::uint32 lazy_dfa::next(const regex_nfa& nfa, wq::uint32& row, wq::uint32 c, char b) {
+    wq::uint32 state = row / m_class_count;
+    m_key.assign(1, 0);
+    next_mark();
+    for(wq::uint32 k = m_keys_begin[state] + 1; k != m_keys_begin[state + 1]; k++) {
+        const nfa_state& item = nfa.m_states[ m_keys[k] ];
+        if(item.m_type == nfa_byte && wq::uint8(b) >= item.m_lo && wq::uint8(b) <= item.m_hi &&
+                closure(nfa, item.m_out, false, false, m_key)) {
+            break;
+        }
+    }
+
+    if(m_table.size() + m_class_count > sm_max_transitions) {
+        // cache is full, it starts again from current state
+        vector<wq::uint32> current(m_keys.begin() + m_keys_begin[state], m_keys.begin() + m_keys_begin[state + 1]);
+        reset();
+        row = add_state(nfa, current) & ~flags;
+    }
+    wq::uint32 target = add_state(nfa, m_key);
+    m_table[row + c] = target;
+    return target;
+}
+
+// returns row of state with given key with its flags, state is created if it does not exist
+wq::uint32 lazy_dfa::add_state(const regex_nfa& nfa, const vector<wq::uint32>& key) {
+    size_type mask = m_slots.size() - 1;
+    size_type slot = hash_bytes(&key[0], key.size() * sizeof(wq::uint32)) & mask;
+    for( ; m_slots[slot] != 0; slot = (slot + 1) & mask) {
+        wq::uint32 state = m_slots[slot] - 1;
+        wq::uint32 begin = m_keys_begin[state];
+        if(m_keys_begin[state + 1] - begin == key.size() && std::equal(key.begin(), key.end(), m_keys.begin() + begin)) {
+            return state * m_class_count | m_flags[state];
+        }
+    }
+
+    wq::uint32 state = wq::uint32(m_flags.size());
+    m_keys.insert(m_keys.end(), key.begin(), key.end());
+    m_keys_begin.push_back( wq::uint32(m_keys.size()) );
+    m_table.resize(m_table.size() + m_class_count, unknown);
+    m_slots[slot] = state + 1;
+
+    // matching at end of text needs closure of threads waiting for it
+    wq::uint32 state_flags = key.size() == 1 ? dead_bit : 0;
+    bool at_end = false;
+    for(size_type i = 1; i != key.size(); i++) {
+        const nfa_state& item = nfa.m_states[ key[i] ];
+        if(item.m_type == nfa_match) {
+            state_flags |= match_bit;
+            at_end = true;
+        }
+        else if(item.m_type == nfa_end && !at_end) {
+            vector<wq::uint32> items;
+            next_mark();
+            closure(nfa, item.m_out, key[0] != 0, true, items);
+            for(size_type k = 0; k != items.size(); k++) {
+                at_end = at_end || nfa.m_states[ items[k] ].m_type == nfa_match;
+            }
+        }
+    }
+    m_flags.push_back(state_flags);
+    m_at_end.push_back(at_end);
+    if(m_flags.size() * 2 > m_slots.size()) {
+        rehash();
+    }
+    return state * m_class_count | state_flags;
+}
+
+void lazy_dfa::rehash() {
+    m_slots.assign(m_slots.size() * 2, 0);
+    size_type mask = m_slots.size() - 1;
+    for(wq::uint32 state = 0; state != m_flags.size(); state++) {
+        const wq::uint32* key = &m_keys[0] + m_keys_begin[state];
+        size_type slot = hash_bytes(key, (m_keys_begin[state + 1] - m_keys_begin[state]) * sizeof(wq::uint32)) & mask;
+        while(m_slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        m_slots[slot] = state + 1;
+    }
+}
+
+// compiled pattern - automata for searching, matching whole text and searching
+// of beginning of match from its end
+class regex::program {
+    public:
+        program(const string_ref&, bool);
+
+        const char* search(const char*, const char*, const char*, bool);
+        const char* search_back(const char*, const char*, const char*, const char*);
+        bool matches(const char*, const char*);
+
+    private:
+        regex_nfa m_forward;
+        regex_nfa m_reverse;
+        wq::uint8 m_classes[256];
+        lazy_dfa m_search;
+        lazy_dfa m_whole;
+        lazy_dfa m_back;
+};
+
+regex::program::program(const string_ref& pattern, bool cs) {
+    vector<regex_node> nodes;
+    size_type root = regex_parser(pattern, cs, nodes).parse();
+
+    wq::uint32 entry = nfa_compiler(nodes, false, m_forward).compile(root, m_forward.add(nfa_match, 0));
+    wq::uint32 back_entry = nfa_compiler(nodes, true, m_reverse).compile(root, m_reverse.add(nfa_match, 0));
+
+    // searching starts by lowest priority loop over all bytes in front of pattern
+    wq::uint32 loop = m_forward.add(nfa_split, entry);
+    m_forward.m_states[loop].m_out2 = m_forward.add(nfa_byte, loop, 0, 0x00, 0xFF);
+
+    // bytes which behave the same in all byte states share class
+    bool bounds[257];
+    std::fill(bounds, bounds + 257, false);
+    for(size_type i = 0; i != m_forward.m_states.size(); i++) {
+        const nfa_state& state = m_forward.m_states[i];
+        if(state.m_type == nfa_byte && state.m_lo <= state.m_hi) {
+            bounds[state.m_lo] = true;
+            bounds[state.m_hi + 1] = true;
+        }
+    }
+    wq::uint32 count = 0;
+    for(int b = 0; b != 256; b++) {
+        count += (bounds[b] && b != 0) ? 1 : 0;
+        m_classes[b] = wq::uint8(count);
+    }
+
+    m_search.init(m_forward, loop, true, count + 1);
+    m_whole.init(m_forward, entry, false, count + 1);
+    m_back.init(m_reverse, back_entry, false, count + 1);
+}
+
+// finds end of leftmost-first match which starts at ptr or after it, or
+// end of any match if shortest is true, returns NULL if there is no match
+const char* regex::program::search(const char* first, const char* ptr, const char* last, bool shortest) {
+    const char* end = NULL;
+    wq::uint32 row = m_search.start(m_forward, ptr == first);
+    if(row & lazy_dfa::match_bit) {
+        end = ptr;
+    }
+    if((row & lazy_dfa::dead_bit) || (end != NULL && shortest)) {
+        return end;
+    }
+    row &= ~lazy_dfa::flags;
+
+    const wq::uint32* table = m_search.table();
+    const wq::uint8* classes = m_classes;
+    while(ptr != last) {
+        wq::uint32 c = classes[wq::uint8(*ptr)];
+        wq::uint32 next = table[row + c];
+        if(next < lazy_dfa::match_bit) {
+            row = next;
+            ptr++;
+            continue;
+        }
+        if(next == lazy_dfa::unknown) {
+            next = m_search.next(m_forward, row, c, *ptr);
+            table = m_search.table();
+        }
+        if(next & lazy_dfa::dead_bit) {
+            return end;
+        }
+        ptr++;
+        row = next & ~lazy_dfa::flags;
+        if(next & lazy_dfa::match_bit) {
+            end = ptr;
+            if(shortest) {
+                return end;
+            }
+        }
+    }
+    return m_search.match_at_end(row) ? last : end;
+}
+
+// finds the first byte from which text to end matches, text before stop is not read
+const char* regex::program::search_back(const char* first, const char* stop, const char* end, const char* last) {
+    const char* start = NULL;
+    wq::uint32 row = m_back.start(m_reverse, end == last);
+    if(row & lazy_dfa::match_bit) {
+        start = end;
+    }
+    if(row & lazy_dfa::dead_bit) {
+        return start;
+    }
+    row &= ~lazy_dfa::flags;
+
+    const wq::uint32* table = m_back.table();
+    const char* ptr = end;
+    while(ptr != stop) {
+        wq::uint32 c = m_classes[ wq::uint8(ptr[-1]) ];
+        wq::uint32 next = table[row + c];
+        if(next == lazy_dfa::unknown) {
+            next = m_back.next(m_reverse, row, c, ptr[-1]);
+            table = m_back.table();
+        }
+        if(next & lazy_dfa::dead_bit) {
+            return start;
+        }
+        ptr--;
+        row = next & ~lazy_dfa::flags;
+        if(next & lazy_dfa::match_bit) {
+            start = ptr;
+        }
+    }
+    return (stop == first && m_back.match_at_end(row)) ? first : start;
+}
+
+bool regex::program::matches(const char* ptr, const char* last) {
+    wq::uint32 row = m_whole.start(m_forward, true);
+    if(row & lazy_dfa::dead_bit) {
+        return false;
+    }
+    row &= ~lazy_dfa::flags;
+
+    const wq::uint32* table = m_whole.table();
+    for( ; ptr != last; ptr++) {
+        wq::uint32 c = m_classes[ wq::uint8(*ptr) ];
+        wq::uint32 next = table[row + c];
+        if(next == lazy_dfa::unknown) {
+            next = m_whole.next(m_forward, row, c, *ptr);
+            table = m_whole.table();
+        }
+        if(next & lazy_dfa::dead_bit) {
+            return false;
+        }
+        row = next & ~lazy_dfa::flags;
+    }
+    return m_whole.match_at_end(row);
+}
+
+// regex class
+/*!
+    \class regex
+    \brief Regular expression.
+
+    Pattern is compiled to nondeterministic automaton over UTF-8 bytes and
+    deterministic automaton is built from it lazily - only states which are
+    reached by matched texts are created and remembered. So every byte of
+    text is read once (twice for found matches) and matching takes linear
+    time, there is no backtracking. Texts are matched directly in their
+    UTF-8 bytes:
+    \code
+        wq::regex date("\\d{4}-\\d{2}-\\d{2}");
+        wq::size_t len;
+        wq::size_t pos = date.find(line, 0, &len);
+        if(pos != wq::string::npos) {
+            wq::string day = line.substr(pos, len);
+        }
+    \endcode
+
+    Supported syntax:
+    \li characters, \c . (any character except line terminators), escapes
+    \c \\n, \c \\t, \c \\r, \c \\f, \c \\v, \c \\0, \c \\xHH, \c \\uHHHH,
+    \c \\u{H...} and escaped special characters
+    \li classes \c [abc], \c [^a-z], \c \\d, \c \\w, \c \\s (and negated
+    \c \\D, \c \\W, \c \\S), which are Unicode aware
+    \li Unicode categories \c \\p{Lu}, \c \\p{L} and negated \c \\P{Lu} from
+    string::value_type::uc_properties
+    \li groups \c (...) and \c (?:...), which do not capture, alternatives \c |
+    \li repeating \c *, \c +, \c ?, \c {n}, \c {n,}, \c {n,m} and their lazy
+    versions with \c ?
+    \li beginning \c ^ and end \c $ of text
+
+    Back references, lookarounds and word boundaries are not supported,
+    because they can not be matched by deterministic automaton.
+
+    Matches are leftmost-first like in ECMAScript, so alternatives and
+    repetitions are preferred in the same order as by backtracking matchers.
+    Optional repetition (every one of \c *, \c ? or repetition after
+    minimal count) which does not match any character fails like in
+    ECMAScript, so \c (?:|a)* matches \c "aaa" whole. Found position and
+    length are the same as of ECMAScript \c RegExp.exec(), Perl ends such
+    repetitions differently.
+
+    Matching functions build states of automaton, so one object must not be
+    used by more threads at once, copies are independent.
+*/
+
+/*!
+    \brief Constructs regex with empty pattern, which matches empty text.
+*/
+regex::regex() : m_pattern(), m_cs(true), m_program( new program(string_ref(), true) ) {
+
+}
+
+/*!
+    \brief Compiles \a pattern.
+
+    If \a cs is \b false characters are matched case insensitively
+    (by simple case folding). regex_error is thrown for invalid pattern.
+*/
+regex::regex(const string_ref& pattern, bool cs) : m_pattern(pattern), m_cs(cs), m_program( new program(pattern, cs) ) {
+
+}
+
+/*!
+    \brief Constructs copy of \a from, states of automaton are copied too.
+*/
+regex::regex(const regex& from) : m_pattern(from.m_pattern), m_cs(from.m_cs), m_program( new program(*from.m_program) ) {
+
+}
+
+regex& regex::operator= (const regex& r) {
+    if(this != &r) {
+        program* new_program = new program(*r.m_program);
+        delete m_program;
+        m_program = new_program;
+        m_pattern = r.m_pattern;
+        m_cs = r.m_cs;
+    }
+    return *this;
+}
+
+regex::~regex() {
+    delete m_program;
+}
+
+/*!
+    \brief Returns \b true if whole \a text matches pattern.
+*/
+bool regex::matches(const string_ref& text) const {
+    return m_program->matches(text.data(), text.data() + text.bytes());
+}
+
+/*!
+    \brief Returns \b true if some part of \a text matches pattern.
+
+    Searching stops at the first byte where some match ends.
+*/
+bool regex::contains(const string_ref& text) const {
+    const char* first = text.data();
+    return m_program->search(first, first, first + text.bytes(), true) != NULL;
+}
+
+/*!
+    \brief Finds leftmost match in \a text.
+
+    End of match is found by searching forward from character \a from and
+    its beginning by reversed automaton from the end, only positions of
+    match are converted to indexes. \c ^ matches only at beginning of
+    \a text, not at \a from.
+
+    \param text Text to search in.
+    \param from Index of character where searching starts.
+    \param len If it is not NULL, number of characters of found match is stored to it.
+    \return Index of first character of match or string::npos.
+*/
+regex::size_type regex::find(const string_ref& text, size_type from, size_type* len) const {
+    if(from > text.size()) {
+        return string::npos;
+    }
+    const char* first = text.data();
+    const char* last = first + text.bytes();
+    const char* ptr = text.is_ascii() ? first + from : utf8_skip(first, last, from);
+    const char* end = m_program->search(first, ptr, last, false);
+    if(end == NULL) {
+        return string::npos;
+    }
+    const char* start = m_program->search_back(first, ptr, end, last);
+    if(len != NULL) {
+        *len = utf8_count(start, end);
+    }
+    return from + utf8_count(ptr, start);
+}
+
+}  // namespace core
+}  // namespace wq
@@ -0,0 +1,486 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/rope.h"
+#include "wq/core/exception.h"
+#include "wq/core/p/utf8.h"
+
+namespace wq {
+namespace core {
+
+// one node of rope's tree - leaves hold text, other nodes
+// hold only sizes of their subtrees
+class rope::node {
+    public:
+        node(const string& text) : m_left(), m_right(), m_text(text),
+                m_len(text.size()), m_bytes(text.bytes()), m_height(1) { };
+        node(const node_ptr& left, const node_ptr& right) : m_left(left), m_right(right), m_text(),
+                m_len(left->m_len + right->m_len), m_bytes(left->m_bytes + right->m_bytes),
+                m_height( (left->m_height > right->m_height ? left->m_height : right->m_height) + 1 ) { };
+
+        bool is_leaf() const {
+            return !m_left.is_ok();
+        };
+
+        node_ptr m_left;
+        node_ptr m_right;
+        string m_text;
+        size_type m_len;
+        size_type m_bytes;
+        int m_height;
+};
+
+const rope::size_type rope::leaf_capacity;
+
+/*!
+    \class rope
+    \brief Class for long and often changed texts.
+
+    This class holds text in balanced tree whose leaves are short
+    string objects. Inserting, erasing and accessing characters by
+    index take O(log n) time so rope is suitable for editors and
+    other places where long text is changed at random positions.
+
+    Nodes of tree are never changed after their creation - every
+    change creates new path from root to changed leaf and all
+    other nodes are shared through auto_ptr. Because of that copying
+    of rope is cheap and copy can be used as snapshot of text which
+    is not affected by later changes of original object.
+
+    \sa string
+*/
+
+/*!
+    \brief Default constructor.
+
+    Creates empty rope.
+*/
+rope::rope() : m_root() {
+
+}
+
+/*!
+    \brief Constructs rope from string.
+
+    Contents of \a str are split to pieces of at most leaf_capacity bytes.
+*/
+rope::rope(const string& str) : m_root( make_tree(str, 0, str.size()) ) {
+
+}
+
+/*!
+    \brief Copy constructor.
+
+    This constructor only shares tree of \a from object so it
+    takes constant time.
+*/
+rope::rope(const rope& from) : m_root(from.m_root) {
+
+}
+
+rope::rope(const node_ptr& root) : m_root(root) {
+
+}
+
+/*!
+    \brief Assign operator.
+
+    Shares contents of \a r with this object.
+*/
+rope& rope::operator= (const rope& r) {
+    m_root = r.m_root;
+    return *this;
+}
+
+/*!
+    \brief Destructor.
+*/
+rope::~rope() {
+
+}
+
+/*!
+    \brief Returns number of characters in rope.
+*/
+rope::size_type rope::size() const {
+    return m_root.is_ok() ? m_root->m_len : 0;
+}
+
+/*!
+    \brief Returns number of bytes which are needed for UTF-8 representation of rope.
+*/
+rope::size_type rope::bytes() const {
+    return m_root.is_ok() ? m_root->m_bytes : 0;
+}
+
+/*!
+    \brief Returns height of rope's tree.
+
+    Height is logarithm of number of pieces so it can be used for
+    checking of rope's balance.
+*/
+rope::size_type rope::depth() const {
+    return height(m_root);
+}
+
+/*!
+    \brief Returns character at index \a i.
+
+    If \a i is out of range wq::core::range_error exception is thrown.
+*/
+rope::value_type rope::at(size_type i) const {
+    const node* leaf = find_leaf(m_root, i);
+    if(leaf == NULL) {
+        throw range_error();
+    }
+    return leaf->m_text[i];
+}
+
+/*!
+    \brief Clears contents of rope.
+*/
+void rope::clear() {
+    m_root.unset();
+}
+
+/*!
+    \brief Appends string to the end of rope.
+*/
+rope& rope::append(const string& str) {
+    m_root = join( m_root, make_tree(str, 0, str.size()) );
+    return *this;
+}
+
+/*!
+    \brief Appends rope to the end of rope.
+
+    Pieces of \a r are shared, not copied.
+*/
+rope& rope::append(const rope& r) {
+    m_root = join(m_root, r.m_root);
+    return *this;
+}
+
+/*!
+    \brief Inserts string into rope.
+
+    Contents of \a str are inserted before character at index \a i.
+    If \a i is greater than size() wq::core::range_error exception is thrown.
+*/
+rope& rope::insert(size_type i, const string& str) {
+    return insert( i, rope(str) );
+}
+
+/*!
+    \brief Inserts rope into rope.
+
+    Pieces of \a r are shared, not copied.
+*/
+rope& rope::insert(size_type i, const rope& r) {
+    if(i > size()) {
+        throw range_error();
+    }
+
+    node_ptr left, right;
+    split(m_root, i, left, right);
+    m_root = join( join(left, r.m_root), right );
+    return *this;
+}
+
+/*!
+    \brief Erases characters from rope.
+
+    Erases \a n characters which start at index \a from. If \a from
+    is greater than size() wq::core::range_error exception is thrown.
+*/
+rope& rope::erase(size_type from, size_type n) {
+    return replace( from, n, string() );
+}
+
+/*!
+    \brief Replaces characters of rope.
+
+    Replaces \a n characters which start at index \a from with
+    contents of \a with.
+*/
+rope& rope::replace(size_type from, size_type n, const string& with) {
+    if(from > size()) {
+        throw range_error();
+    }
+    n = (n > size() - from) ? (size() - from) : n;
+
+    node_ptr left, rest, middle, right;
+    split(m_root, from, left, rest);
+    split(rest, n, middle, right);
+    m_root = join( join( left, make_tree(with, 0, with.size()) ), right );
+    return *this;
+}
+
+/*!
+    \brief Returns part of rope as string.
+
+    \param from First character of returned string.
+    \param n Number of characters in returned string.
+*/
+string rope::substr(size_type from, size_type n) const {
+    if(from > size()) {
+        throw range_error();
+    }
+    n = (n > size() - from) ? (size() - from) : n;
+
+    string ret_str;
+    if(n > 0) {
+        append_to(m_root, ret_str, from, n);
+    }
+    return ret_str;
+}
+
+/*!
+    \brief Returns part of rope as rope.
+
+    Returned rope shares pieces with this one so this function
+    takes only O(log n) time.
+*/
+rope rope::subrope(size_type from, size_type n) const {
+    if(from > size()) {
+        throw range_error();
+    }
+    n = (n > size() - from) ? (size() - from) : n;
+
+    node_ptr left, rest, middle, right;
+    split(m_root, from, left, rest);
+    split(rest, n, middle, right);
+    return rope(middle);
+}
+
+// private functions
+int rope::height(const node_ptr& n) {
+    return n.is_ok() ? n->m_height : 0;
+}
+
+rope::node_ptr rope::make_leaf(const string& text) {
+    return text.empty() ? node_ptr() : node_ptr( new node(text) );
+}
+
+// creates node with two children, empty children are skipped
+rope::node_ptr rope::make_inner(const node_ptr& left, const node_ptr& right) {
+    if(!left.is_ok()) {
+        return right;
+    }
+    if(!right.is_ok()) {
+        return left;
+    }
+    return node_ptr( new node(left, right) );
+}
+
+// creates balanced tree from n characters of str which start at first
+rope::node_ptr rope::make_tree(const string& str, size_type first, size_type n) {
+    size_type first_byte = str.byte_offset(first);
+    size_type last_byte = str.byte_offset(first + n);
+    if(last_byte - first_byte <= leaf_capacity) {
+        return make_leaf( (first == 0 && n == str.size()) ? str : str.substr(first, n) );
+    }
+
+    // character which contains middle byte will be first in right half
+    size_type middle = str.index_of_byte( first_byte + (last_byte - first_byte) / 2 );
+    return make_inner( make_tree(str, first, middle - first), make_tree(str, middle, first + n - middle) );
+}
+
+// creates node with given children and rotates it if heights of children differ too much
+rope::node_ptr rope::balance(const node_ptr& left, const node_ptr& right) {
+    int lh = height(left);
+    int rh = height(right);
+    if(lh > rh + 1) {
+        if(height(left->m_left) >= height(left->m_right)) {
+            return make_inner( left->m_left, make_inner(left->m_right, right) );
+        }
+        return make_inner( make_inner(left->m_left, left->m_right->m_left),
+                           make_inner(left->m_right->m_right, right) );
+    }
+    if(rh > lh + 1) {
+        if(height(right->m_right) >= height(right->m_left)) {
+            return make_inner( make_inner(left, right->m_left), right->m_right );
+        }
+        return make_inner( make_inner(left, right->m_left->m_left),
+                           make_inner(right->m_left->m_right, right->m_right) );
+    }
+    return make_inner(left, right);
+}
+
+// concatenates two trees - lower tree is joined to the spine of higher one
+rope::node_ptr rope::join(const node_ptr& left, const node_ptr& right) {
+    if(!left.is_ok()) {
+        return right;
+    }
+    if(!right.is_ok()) {
+        return left;
+    }
+
+    if(left->is_leaf() && right->is_leaf() && left->m_bytes + right->m_bytes <= leaf_capacity) {
+        // small neighbours are merged so tree does not contain many tiny leaves
+        string text = left->m_text;
+        text.append(right->m_text);
+        return make_leaf(text);
+    }
+
+    int lh = height(left);
+    int rh = height(right);
+    if(lh > rh + 1) {
+        return balance( left->m_left, join(left->m_right, right) );
+    }
+    if(rh > lh + 1) {
+        return balance( join(left, right->m_left), right->m_right );
+    }
+    return make_inner(left, right);
+}
+
+// splits tree to first i characters and the rest
+void rope::split(const node_ptr& n, size_type i, node_ptr& left, node_ptr& right) {
+    if(!n.is_ok() || i == 0) {
+        left = node_ptr();
+        right = n;
+        return;
+    }
+    if(i >= n->m_len) {
+        left = n;
+        right = node_ptr();
+        return;
+    }
+
+    if(n->is_leaf()) {
+        left = make_leaf( n->m_text.substr(0, i) );
+        right = make_leaf( n->m_text.substr(i) );
+        return;
+    }
+
+    size_type left_len = n->m_left->m_len;
+    if(i <= left_len) {
+        node_ptr sub_right;
+        split(n->m_left, i, left, sub_right);
+        right = join(sub_right, n->m_right);
+    }
+    else {
+        node_ptr sub_left;
+        split(n->m_right, i - left_len, sub_left, right);
+        left = join(n->m_left, sub_left);
+    }
+}
+
+// finds leaf which contains character i, i is changed to index in leaf
+const rope::node* rope::find_leaf(const node_ptr& root, size_type& i) {
+    if(!root.is_ok() || i >= root->m_len) {
+        return NULL;
+    }
+
+    const node* n = root.const_data();
+    while(!n->is_leaf()) {
+        size_type left_len = n->m_left->m_len;
+        if(i < left_len) {
+            n = n->m_left.const_data();
+        }
+        else {
+            i -= left_len;
+            n = n->m_right.const_data();
+        }
+    }
+    return n;
+}
+
+// appends n characters starting at first to string
+void rope::append_to(const node_ptr& n, string& str, size_type first, size_type count) {
+    if(n->is_leaf()) {
+        str.append(n->m_text, first, count);
+        return;
+    }
+
+    size_type left_len = n->m_left->m_len;
+    if(first < left_len) {
+        size_type left_count = (count > left_len - first) ? (left_len - first) : count;
+        append_to(n->m_left, str, first, left_count);
+        first = left_len;
+        count -= left_count;
+    }
+    if(count > 0) {
+        append_to(n->m_right, str, first - left_len, count);
+    }
+}
+
+/*!
+    \class rope::const_iterator
+    \brief Constant iterator over characters of rope.
+
+    Iterator remembers leaf with current character so walking
+    through the rope takes constant time per character. Iterator
+    is valid until rope which created it is changed.
+*/
+
+rope::const_iterator::const_iterator(const rope* owner, size_type i) :
+        m_owner(owner), m_leaf(NULL), m_leaf_first(0), m_index(i), m_byte(0) {
+    load();
+}
+
+// finds leaf of current character and decodes it
+void rope::const_iterator::load() {
+    size_type i = m_index;
+    m_leaf = find_leaf(m_owner->m_root, i);
+    if(m_leaf != NULL) {
+        m_leaf_first = m_index - i;
+        m_byte = m_leaf->m_text.byte_offset(i);
+        m_val = value_type(m_leaf->m_text.data() + m_byte);
+    }
+    else {
+        m_val = value_type();
+    }
+}
+
+/*!
+    \brief Moves iterator to the next character.
+*/
+rope::const_iterator& rope::const_iterator::operator++ () {
+    m_index++;
+    if(m_leaf != NULL && m_index - m_leaf_first < m_leaf->m_len) {
+        m_byte += m_val.bytes();
+        m_val = value_type(m_leaf->m_text.data() + m_byte);
+    }
+    else {
+        load();
+    }
+    return *this;
+}
+
+/*!
+    \brief Moves iterator to the previous character.
+*/
+rope::const_iterator& rope::const_iterator::operator-- () {
+    if(m_leaf != NULL && m_index > m_leaf_first) {
+        m_index--;
+        const char* start = m_leaf->m_text.data();
+        do {
+            m_byte--;
+        } while(utf8_is_trail(start[m_byte]));
+        m_val = value_type(start + m_byte);
+    }
+    else {
+        m_index--;
+        load();
+    }
+    return *this;
+}
+
+}  // namespace core
+}  // namespace wq
@@ -17,6 +17,10 @@
 ****************************************************************************/
 
 #include "wq/core/string.h"
+#include "wq/core/string_ref.h"
+#include "wq/core/codepoint_set.h"
+#include "wq/core/hash.h"
+#include "wq/core/p/utf8.h"
 
 #include <cstring>
 
@@ -42,6 +46,17 @@ const string::value_type::uc_properties* string::value_type::get_uc_properties(w
     return string::value_type::sm_properties + index;
 }
 
+/*!
+    \brief Returns special case mapping of character.
+
+    When some of \c *_case_special flags of character's properties is set,
+    its \c *_case_diff is \a index of mapping to more characters. Mapping
+    is returned as zero terminated UTF-16 sequence.
+*/
+const wq::uint16* string::value_type::get_special_case(int index) {
+    return string::value_type::sm_special_case_map + index;
+}
+
 /*!
 	\class string::value_type
 	\brief Unicode character handler.
@@ -54,6 +69,7 @@ const string::value_type::uc_properties* string::value_type::get_uc_properties(w
 */
 
 /*!
+	\fn string::value_type::value_type()
 	\brief Default constructor.
 
 	Creates empty object that must be initialized
@@ -61,20 +77,15 @@ const string::value_type::uc_properties* string::value_type::get_uc_properties(w
 
 	\sa operator=()
 */
-string::value_type::value_type() : m_val(0) {
-
-}
 
 /*!
+	\fn string::value_type::value_type(const value_type& from)
 	\brief Copy constructor.
 
 	This constructor creates exact copy of \a from object.
 
 	\sa value_type(), operator=(const value_type&)
 */
-string::value_type::value_type(const value_type& from) : m_val(from.m_val) {
-
-}
 
 /*!
     \brief Basic construction.
@@ -157,18 +168,13 @@ string::value_type::value_type(wq::uint16 w1, wq::uint16 w2, bool throw_err) :
 */
 
 /*!
+    \fn string::value_type::operator= (const value_type& r)
     \brief Assign operator.
 
     This operator copy \a r object to \a this object.
 
     \sa operator= (const char*)
 */
-string::value_type& string::value_type::operator= (const value_type& r) {
-    if(this != &r) {
-        m_val = r.m_val;
-    }
-    return *this;
-}
 
 /*!
     \fn bool string::value_type::operator== (const value_type&) const
@@ -323,7 +329,7 @@ string::size_type string::value_type::octets_count(char c) {
     else if( c & (1 << 7) && c & (1 << 6) && c & (1 << 5) && !(c & (1 << 4)) ) {
         return 3;
     }
-    else if( c & (1 << 7) && c & (1 << 6) && c & (1 << 5) && c & (1 << 4) && !(c & (1 << 4)) ) {
+    else if( c & (1 << 7) && c & (1 << 6) && c & (1 << 5) && c & (1 << 4) && !(c & (1 << 3)) ) {
         return 4;
     }
     return 0;
@@ -410,36 +416,13 @@ wq::uint32 string::value_type::decode_utf16(wq::uint16 w1, wq::uint16 w2, bool t
 }
 
 // string::reference class
-string::reference::reference(string* owner, char* ptr) :
-        value_type(), m_owner(owner), m_ptr(ptr) {
-    if(m_ptr == m_owner->cd()->m_last) {
-        value_type::operator= ( wq::uint32(0) );
-    }
-    else {
-        value_type::operator= (m_ptr);
-    }
-}
-
-string::reference::reference(const string* owner, char* ptr) :
-        value_type(), m_owner(const_cast<string*>(owner)), m_ptr(ptr) {
-    if(m_ptr == m_owner->cd()->m_last) {
-        value_type::operator= ( wq::uint32(0) );
-    }
-    else {
-        value_type::operator= (m_ptr);
-    }
-}
-
-string::reference::reference(const reference& from) :
-        value_type(from), m_owner(from.m_owner), m_ptr(from.m_ptr) {
-
-}
-
 // assignment
 string::reference& string::reference::operator= (const reference& r) {
     if(&r != this) {
+        // replaced character ends by its own bytes, not by bytes of r
+        char* last = ptr() + bytes();
         value_type::operator= (r);
-        owner()->replace( iterator( reference(owner(), ptr()) ), iterator( reference(owner(), ptr() + bytes()) ),
+        owner()->replace( iterator( reference(owner(), ptr()) ), iterator( reference(owner(), last) ),
                           r.ptr(), r.bytes());
     }
     return *this;
@@ -447,8 +430,10 @@ string::reference& string::reference::operator= (const reference& r) {
 
 string::reference& string::reference::operator= (const_reference r) {
     if(&r != this) {
+        // replaced character ends by its own bytes, not by bytes of r
+        char* last = ptr() + bytes();
         value_type::operator= (r);
-        owner()->replace( iterator( reference(owner(), ptr()) ), iterator( reference(owner(), ptr() + bytes()) ),
+        owner()->replace( iterator( reference(owner(), ptr()) ), iterator( reference(owner(), last) ),
                           r.utf8(), r.bytes());
     }
     return *this;
@@ -456,118 +441,151 @@ string::reference& string::reference::operator= (const_reference r) {
 
 // private functions
 // new contents without changing string's data
-void string::reference::rebind(const reference& n) {
-    value_type::operator= (n);
-    m_owner = n.m_owner;
-    m_ptr = n.m_ptr;
-}
-
 // returns next character in string
 string::reference string::reference::next() const {
-    if(m_ptr + bytes() < owner()->d()->m_last) {
+    if(m_ptr + bytes() < owner()->data_last()) {
         return reference(m_owner, m_ptr + bytes());
     }
-    return reference(m_owner, owner()->d()->m_last);
+    return reference(m_owner, const_cast<char*>( owner()->data_last() ));
 }
 
 // returns previous character in string
 string::reference string::reference::prev() const {
-    // finding previous character is more complex :(
-    reference ret = reference(m_owner, m_ptr);
-    size_type clen = 0;
-    while(1) {
-        clen++;
-        try {
-            ret.rebind( reference( m_owner, (m_ptr - clen) ) );
-        }
-        catch(encode_error& err) {
-            continue;
+    // previous character starts by first byte before m_ptr which is not trail byte
+    char* ptr = m_ptr;
+    while(ptr != owner()->data()) {
+        if(!utf8_is_trail(*(--ptr))) {
+            break;
         }
-        break;
     }
-    if(m_ptr - clen > owner()->d()->m_start) {
-        return reference(m_owner, m_ptr - clen);
+    return reference(m_owner, ptr);
+}
+
+// moves to the next character, string data are valid UTF-8 so length of
+// character is given by its lead byte
+void string::reference::step_forward() {
+    const char* last = owner()->data_last();
+    if(m_ptr == last) {
+        throw range_error();
+    }
+    m_ptr += cp_iterator(m_ptr, last).bytes();
+    decode();
+}
+
+void string::reference::step_back() {
+    if(m_ptr == owner()->data()) {
+        throw range_error();
     }
-    return reference(m_owner, owner()->d()->m_start);
+    do {
+        m_ptr--;
+    } while(utf8_is_trail(*m_ptr));
+    decode();
 }
 
 // string::iterator class
 string::difference_type string::iterator::operator- (const const_iterator& r) const {
-    const_iterator tmp = r;
-    difference_type ret = 0;
-    int add = tmp < *this ? 1 : -1;
-    while(tmp != *this) {
-        tmp += add;
-        ret += add;
-    }
-    return ret;
+    return m_val.owner()->distance(r.ptr(), ptr());
 }
 
 string::iterator string::iterator::operator+ (size_type n) const {
-	iterator ret = *this;
-	for( ; n != 0; n--) {
-		ret.m_val.rebind(ret.m_val.next());
-		// only first increment to last char is allowed!
-		if(ret.m_val.is_last() && n > 1) {
-			throw range_error();
-		}
-	}
-	return ret;
+	return iterator( reference(m_val.owner(), const_cast<char*>( m_val.owner()->skip_forward(ptr(), n) )) );
 }
 
 string::iterator string::iterator::operator- (size_type n) const {
-	iterator ret = *this;
-	for( ; n != 0; n--) {
-		ret.m_val.rebind(ret.m_val.prev());
-		// only first decrement to first char is allowed!
-		if(ret.m_val.is_first() && n > 1) {
-			throw range_error();
-		}
-	}
-	return ret;
+	return iterator( reference(m_val.owner(), const_cast<char*>( m_val.owner()->skip_backward(ptr(), n) )) );
 }
 
 // string::const_iterator class
 string::difference_type string::const_iterator::operator- (const const_iterator& r) const {
-    const_iterator tmp = r;
-    difference_type ret = 0;
-    int add = tmp < *this ? 1 : -1;
-    while(tmp != *this) {
-        tmp += add;
-        ret += add;
-    }
-    return ret;
+    return m_val.owner()->distance(r.ptr(), ptr());
 }
 
 string::const_iterator string::const_iterator::operator+ (size_type n) const {
-	const_iterator ret = *this;
-	for( ; n != 0; n--) {
-		ret.m_val.rebind(ret.m_val.next());
-		// only first increment to last char is allowed!
-		if(ret.m_val.is_last() && n > 1) {
+	return const_iterator( reference(m_val.owner(), const_cast<char*>( m_val.owner()->skip_forward(ptr(), n) )) );
+}
+
+string::const_iterator string::const_iterator::operator- (size_type n) const {
+	return const_iterator( reference(m_val.owner(), const_cast<char*>( m_val.owner()->skip_backward(ptr(), n) )) );
+}
+
+// string::cp_iterator class
+/*!
+    \class string::cp_iterator
+    \brief Read-only iterator over code points.
+
+    Unlike const_iterator this iterator holds only two pointers - to current
+    character and to end of data. Character is decoded only when it is
+    dereferenced, so walking through string costs only reading of lead bytes.
+    Iterator can not change string and it is invalidated by every change.
+    It is used by searching and comparing functions of string and string_ref.
+
+    \sa string::cp_begin(), string::cp_end()
+*/
+
+// private functions for iterators
+// whole blocks of bytes are skipped by kernels from utf8.cpp, so moving
+// iterator does not decode characters between old and new position
+const char* string::skip_forward(const char* ptr, size_type n) const {
+	if(is_ascii()) {
+		if(n > size_type(data_last() - ptr)) {
 			throw range_error();
 		}
+		return ptr + n;
+	}
+	const char* ret = utf8_skip(ptr, data_last(), n);
+	// end of string is returned also when there is not enough characters
+	if(ret == data_last() && utf8_count(ptr, ret) < n) {
+		throw range_error();
 	}
 	return ret;
 }
 
-string::const_iterator string::const_iterator::operator- (size_type n) const {
-	const_iterator ret = *this;
-	for( ; n != 0; n--) {
-		ret.m_val.rebind(ret.m_val.prev());
-		// only first decrement to first char is allowed!
-		if(ret.m_val.is_first() && n > 1) {
+const char* string::skip_backward(const char* ptr, size_type n) const {
+	if(is_ascii()) {
+		if(n > size_type(ptr - data())) {
 			throw range_error();
 		}
+		return ptr - n;
+	}
+	const char* ret = utf8_skip_back(data(), ptr, n);
+	if(ret == data() && utf8_count(ret, ptr) < n) {
+		throw range_error();
 	}
 	return ret;
 }
 
+string::difference_type string::distance(const char* first, const char* last) const {
+	if(is_ascii()) {
+		// every character has 1 byte
+		return last - first;
+	}
+	if(first <= last) {
+		return difference_type( utf8_count(first, last) );
+	}
+	return -difference_type( utf8_count(last, first) );
+}
+
+// string::offset_index class
+string::offset_index::offset_index(const char* first, const char* last, size_type len) :
+        m_offsets(NULL), m_count(len / index_step + 1) {
+    m_offsets = new size_type[m_count];
+    // every offset is found by skipping index_step characters from previous one
+    const char* ptr = first;
+    for(size_type i = 0; i != m_count; i++) {
+        m_offsets[i] = ptr - first;
+        ptr = utf8_skip(ptr, last, index_step);
+    }
+}
+
+string::offset_index::~offset_index() {
+    delete[] m_offsets;
+}
+
 // string::wq_data class
 string::allocator_type string::wq_data::m_alloc;
 
 string::wq_data::wq_data(const wq_data& from) :
-		m_start(NULL), m_last(NULL), m_end(NULL), m_len(0) {
+		m_start(NULL), m_last(NULL), m_end(NULL), m_len(0), m_index(NULL), m_hash(from.m_hash.val()), m_owner() {
 	size_type size = from.m_last - from.m_start;
 	char* start = m_alloc.allocate(size);
 	m_alloc.copy(start, from.m_start, size);
@@ -579,7 +597,7 @@ string::wq_data::wq_data(const wq_data& from) :
 }
 
 string::wq_data::~wq_data() {
-	if(m_start != NULL && m_last != NULL) {
+	if(m_start != NULL && m_last != NULL && !m_owner.is_ok()) {
 		// it is not necessary to call destroy function for objects
 		m_alloc.deallocate(m_start);
 	}
@@ -587,13 +605,15 @@ string::wq_data::~wq_data() {
 
 // string class
 const string::size_type string::npos = -1;
+const string::size_type string::local_capacity;
 
 /*!
 	\brief Constructs string.
 
-	This constructor constructs empty string.
+	This constructor constructs empty string. Empty string
+	does not allocate any memory.
 */
-string::string() : m_tempbuff(NULL), d_ptr(new wq_data) {
+string::string() : m_tempbuff(NULL), m_local(), d_ptr() {
 
 }
 
@@ -603,32 +623,45 @@ string::string() : m_tempbuff(NULL), d_ptr(new wq_data) {
 	Constructor constructs string with the given context.
 */
 string::string(const char* str, size_type size, const text_encoder& enc) :
-        m_tempbuff(NULL), d_ptr(new wq_data) {
-	assign( enc.encode(str, size) );
+        m_tempbuff(NULL), m_local(), d_ptr() {
+	operator= ( enc.encode(str, size) );
 }
 
 /*!
+	\fn string::value_type::value_type(const value_type& from)
 	\brief Copy constructor.
 
 	Constructs string copying the context of other string.
 	However constructor will perform shallow copy of string
 	and later, if it is necessary, deep copy will be performed.
+	Strings shorter than local_capacity bytes are copied immediately
+	because they are stored directly in string object.
 */
-string::string(const string& other) : m_tempbuff(NULL), d_ptr(other.d_ptr) {
+string::string(const string& other) : m_tempbuff(NULL), m_local(other.m_local), d_ptr(other.d_ptr) {
 
 }
 
-string::string(size_type n, const_reference c) : m_tempbuff(NULL), d_ptr(new wq_data) {
+string::string(size_type n, const_reference c) : m_tempbuff(NULL), m_local(), d_ptr() {
     assign(n, c);
 }
 
-string::string(const_iterator first, const_iterator last) : m_tempbuff(NULL), d_ptr(new wq_data) {
+string::string(const_iterator first, const_iterator last) : m_tempbuff(NULL), m_local(), d_ptr() {
     assign(first, last);
 }
 
+/*!
+    \brief Constructs string from string_ref.
+
+    Copies text referred by \a str. No conversion is needed because
+    string_ref always refers to UTF-8 text.
+*/
+string::string(const string_ref& str) : m_tempbuff(NULL), m_local(), d_ptr() {
+    append(str);
+}
+
 #if WQ_STD_COMPATIBILITY
-string::string(const std::string& std_str, const text_encoder& enc) : m_tempbuff(NULL), d_ptr(new wq_data) {
-    assign( enc.encode(std_str.data(), std_str.size()) );
+string::string(const std::string& std_str, const text_encoder& enc) : m_tempbuff(NULL), m_local(), d_ptr() {
+    operator= ( enc.encode(std_str.data(), std_str.size()) );
 }
 #endif
 
@@ -643,7 +676,7 @@ string::~string() {
 
 string& string::operator= (const string& r) {
     if(&r != this) {
-        d_ptr.set(r.d_ptr);
+        share(r);
     }
     return *this;
 }
@@ -656,19 +689,44 @@ string& string::operator= (const string& r) {
 */
 void string::clear() {
     if(m_tempbuff != NULL) {
-         d()->m_alloc.deallocate(m_tempbuff);
-         m_tempbuff = NULL;
-     }
-    if(size() != 0) {
-		d_ptr.set(new wq_data);
-	}
+        wq_data::m_alloc.deallocate(m_tempbuff);
+        m_tempbuff = NULL;
+    }
+    d_ptr.unset();
+    m_local.m_bytes = 0;
+    m_local.m_len = 0;
 }
 
 void string::reserve(size_type least_size) {
-    // resize only if it is needed
+    size_type old_size = bytes();
+    if(is_local()) {
+        if(old_size + least_size > local_capacity) {
+            // contents will not fit to object anymore, so we
+            // have to move them to new shared data
+            size_type least_capacity = old_size + least_size;
+            size_type new_capacity = local_capacity;
+            while(new_capacity < least_capacity) new_capacity = new_capacity * 2;
+
+            wq_data* new_data = new wq_data;
+            new_data->m_start = wq_data::m_alloc.allocate(new_capacity);
+            new_data->m_end = new_data->m_start + new_capacity;
+            new_data->m_last = wq_data::m_alloc.copy(new_data->m_start, m_local.m_buff, old_size);
+            new_data->m_len = m_local.m_len;
+            d_ptr.set(new_data);
+        }
+        return;
+    }
+
+    // resize only if it is needed (data are detached here)
     size_type old_capacity = d()->m_end - d()->m_start;
-    size_type old_size = d()->m_last - d()->m_start;
-    if(least_size == 0) {
+    if(least_size == 0 && old_size <= local_capacity) {
+        // contents are short enough to be moved back to object
+        m_local.m_len = wq::uint8(cd()->m_len);
+        m_local.m_bytes = wq::uint8(old_size);
+        wq_data::m_alloc.copy(m_local.m_buff, cd()->m_start, old_size);
+        d_ptr.unset();
+    }
+    else if(least_size == 0) {
         // now we want deallocate unneeded space
         d()->m_start = d()->m_alloc.reallocate(d()->m_start, old_capacity, old_size);
         d()->m_end = d()->m_start + old_size;
@@ -691,7 +749,7 @@ void string::resize(size_type new_size, const_reference new_c) {
         append(new_size - size(), new_c);
     }
     else {
-        erase(begin() + new_size, begin() + size());
+        erase(new_size, size() - new_size);
     }
 }
 
@@ -706,10 +764,7 @@ void string::resize(size_type new_size, const_reference new_c) {
 	\sa operator[](), at(size_type) const;
 */
 string::reference string::at(size_type i) {
-	if(i > size()) {
-		throw range_error();
-	}
-	return *(begin() + i);
+	return reference(this, const_cast<char*>( data() ) + byte_offset(i));
 }
 
 /*!
@@ -720,11 +775,109 @@ string::reference string::at(size_type i) {
 
 	\sa operator[](), at(size_type)
 */
-string::const_reference string::at(size_type i) const {
-	if(i > size()) {
-		throw range_error();
-	}
-	return *(begin() + i);
+string::value_type string::at(size_type i) const {
+	return reference(this, const_cast<char*>( data() ) + byte_offset(i));
+}
+
+/*!
+    \fn bool string::is_ascii() const
+    \brief Checks for ASCII contents.
+
+    Returns \b true if all characters of string are encoded by single
+    byte (number of bytes is equal to number of characters). Indexes,
+    iterators arithmetic, copy() and substr() of such strings are simple
+    bytes arithmetic.
+
+    \sa size(), bytes()
+*/
+
+/*!
+    \brief Returns hash of string.
+
+    Hash is computed from UTF-8 bytes by hash_bytes(), so it is equal for
+    equal strings. Hash of long string is stored in its shared data, so it is
+    computed only once for all copies of string and again after change.
+
+    \sa wq::core::hash
+*/
+string::size_type string::hash() const {
+    if(is_local()) {
+        return hash_bytes( m_local.m_buff, m_local.m_bytes );
+    }
+    // other copy can compute the same hash at once, the first one is stored
+    size_type ret = cd()->m_hash.val();
+    if(ret == 0) {
+        ret = hash_bytes( data(), bytes() );
+        cd()->m_hash.cmp_set(0, ret);
+    }
+    return ret;
+}
+
+/*!
+    \brief Converts index to offset.
+
+    This function returns offset (in bytes) of character at index \a i
+    from the beginning of data(). If \a i is equal to size() number of bytes
+    is returned. Long strings build sparse index of offsets during the first
+    call so next calls have to walk at most index_step characters. Index
+    is dropped by every change of string.
+
+    \sa index_of_byte(), data()
+*/
+string::size_type string::byte_offset(size_type i) const {
+    if(i > size()) {
+        throw range_error();
+    }
+    if(i == 0 || i == size() || is_ascii()) {
+        return i == size() ? bytes() : i;
+    }
+
+    const char* start = data();
+    const offset_index* index = get_index();
+    if(index != NULL) {
+        return utf8_skip(start + index->m_offsets[i / index_step], data_last(), i % index_step) - start;
+    }
+    return utf8_skip(start, data_last(), i) - start;
+}
+
+/*!
+    \brief Converts offset to index.
+
+    This function is opposite of byte_offset(). It returns index of
+    character which contains byte at offset \a b. If \a b is equal to
+    bytes() size() is returned.
+
+    \sa byte_offset(), data()
+*/
+string::size_type string::index_of_byte(size_type b) const {
+    if(b > bytes()) {
+        throw range_error();
+    }
+    if(b == bytes() || is_ascii()) {
+        return b == bytes() ? size() : b;
+    }
+
+    const char* start = data();
+    const offset_index* index = get_index();
+    size_type first_index = 0;
+    size_type first_byte = 0;
+    if(index != NULL) {
+        // binary search of last indexed character before b
+        size_type low = 0;
+        size_type high = index->m_count;
+        while(high - low > 1) {
+            size_type middle = (low + high) / 2;
+            if(index->m_offsets[middle] <= b) {
+                low = middle;
+            }
+            else {
+                high = middle;
+            }
+        }
+        first_index = low * index_step;
+        first_byte = index->m_offsets[low];
+    }
+    return first_index + utf8_count(start + first_byte, start + b + 1) - 1;
 }
 
 string& string::assign(const string& str, size_type from, size_type size) {
@@ -736,11 +889,37 @@ string& string::assign(const string& str, size_type from, size_type size) {
     // when we are assigning full object we can simply assign
     // shared data only
     if(from == 0 && size == str.size()) {
-        d_ptr.set(str.d_ptr);
+        share(str);
     }
-    else {
+    else if(&str == this) {
+        // clear() would destroy source of our data
+        string tmp_str = str;
+        assign(tmp_str, from, size);
+    }
+    else if(str.is_local() || size <= local_capacity / 4) {
+        // short part is copied into object
         clear();
         append(str, from, size);
+    }
+    else {
+        size_type first = str.byte_offset(from);
+        size_type last = str.byte_offset(from + size);
+        if(last - first <= local_capacity) {
+            clear();
+            append_raw(str.data() + first, last - first, size);
+            return *this;
+        }
+
+        // long part only points to buffer of str, it is detached on change
+        wq_data* part = new wq_data;
+        part->m_owner = str.cd()->m_owner.is_ok() ? str.cd()->m_owner : str.d_ptr;
+        part->m_start = const_cast<char*>( str.data() ) + first;
+        part->m_last = part->m_start + (last - first);
+        part->m_end = part->m_last;
+        part->m_len = size;
+
+        clear();
+        d_ptr.set(part);
     }
 	return *this;
 }
@@ -753,11 +932,14 @@ string& string::assign(size_type n, const_reference c) {
 string& string::assign(const_iterator first, const_iterator last) {
     if(first.m_val.is_first() && last.m_val.is_last()) {
         // we can simply assign shared data
-        d_ptr.set( first.m_val.owner()->d_ptr );
+        share( *first.m_val.owner() );
     }
     else {
-        // we will append new data
-        append(first, last);
+        // we will append new data to empty string (iterators
+        // can point to this string)
+        string tmp_str;
+        tmp_str.append(first, last);
+        share(tmp_str);
     }
     return *this;
 }
@@ -769,12 +951,9 @@ string& string::append(const string& str, size_type from, size_type size) {
     size = (size > str.size() - from) ? (str.size() - from) : size;
 
     if(size > 0) {
-        const_iterator first = str.begin() + from;
-        const_iterator last = first + size;
-        size_type bytes_size = last.ptr() - first.ptr();
-        reserve(bytes_size);
-        d()->m_last = d()->m_alloc.copy(end().ptr(), first.ptr(), bytes_size);
-        d()->m_len += size;
+        size_type first = str.byte_offset(from);
+        size_type last = str.byte_offset(from + size);
+        append_raw(str.data() + first, last - first, size);
     }
     return *this;
 }
@@ -783,23 +962,64 @@ string& string::append(size_type n, const_reference c) {
     size_type c_bytes = c.bytes();
     const char* c_buff = c.utf8();
     reserve(n * c_bytes);
-    for(; n != 0; n--) {
-        d()->m_last = d()->m_alloc.copy(end().ptr(), c_buff, c_bytes);
-        d()->m_len++;
+
+    size_type old_bytes = bytes();
+    char* last = wdata() + old_bytes;
+    for(size_type i = 0; i != n; i++) {
+        last = wq_data::m_alloc.copy(last, c_buff, c_bytes);
     }
+    set_sizes(old_bytes + n * c_bytes, size() + n);
     return *this;
 }
 
 string& string::append(const_iterator first, const_iterator last) {
     size_type bytes_size = last.ptr() - first.ptr();
     if(bytes_size > 0) {
-        reserve(bytes_size);
-        d()->m_last = d()->m_alloc.copy(end().ptr(), first.ptr(), bytes_size);
-        d()->m_len += last - first;
+        append_raw(first.ptr(), bytes_size, last - first);
+    }
+    return *this;
+}
+
+/*!
+    \brief Appends text referred by \a str.
+
+    Bytes of \a str are copied directly without creating of temporary string.
+*/
+string& string::append(const string_ref& str) {
+    if(!str.empty()) {
+        append_raw(str.data(), str.bytes(), str.size());
     }
     return *this;
 }
 
+/*!
+    \brief Returns concatenation of this string and \a str.
+
+    Result is written to one buffer with exact size (none if it is short),
+    counts of bytes and characters of both strings are just summed. On
+    compilers with rvalue references the following operators of chain
+    like \code a + " = " + b + '\n' \endcode get temporary string at left
+    side and append to it in place, so no other string is created.
+*/
+string string::operator+ (const string& str) const {
+    string ret_str;
+    char* dest = ret_str.assign_raw(bytes() + str.bytes(), size() + str.size());
+    wq_data::m_alloc.copy( wq_data::m_alloc.copy(dest, data(), bytes()), str.data(), str.bytes() );
+    return ret_str;
+}
+
+/*!
+    \brief Returns concatenation of this string and character \a c.
+
+    \sa operator+(const string&)
+*/
+string string::operator+ (const_reference c) const {
+    string ret_str;
+    char* dest = ret_str.assign_raw(bytes() + c.bytes(), size() + 1);
+    wq_data::m_alloc.copy( wq_data::m_alloc.copy(dest, data(), bytes()), c.utf8(), c.bytes() );
+    return ret_str;
+}
+
 string& string::insert(size_type i, const string& str, size_type from, size_type size) {
     if(size == npos) {
         size = str.size();
@@ -807,77 +1027,79 @@ string& string::insert(size_type i, const string& str, size_type from, size_type
     size = (size > str.size() - from) ? (str.size() - from) : size;
 
     if(size > 0) {
-        const_iterator copy_from = str.begin() + from;
-        const_iterator copy_to = copy_from + size;
-        size_type insert_size = copy_to.ptr() - copy_from.ptr();
+        size_type copy_from = str.byte_offset(from);
+        size_type copy_to = str.byte_offset(from + size);
+        insert_raw(byte_offset(i), str.data() + copy_from, copy_to - copy_from, size);
+    }
+    return *this;
+}
 
-        reserve(insert_size);
-        iterator cut_at = begin() + i;
-        d()->m_last = d()->m_alloc.ocopy(cut_at.ptr() + insert_size, cut_at.ptr(), end().ptr() - cut_at.ptr());
-        d()->m_alloc.copy(cut_at.ptr(), copy_from.ptr(), insert_size);
-        d()->m_len += size;
+/*!
+    \brief Inserts text referred by \a str before character at index \a i.
+*/
+string& string::insert(size_type i, const string_ref& str) {
+    if(!str.empty()) {
+        insert_raw(byte_offset(i), str.data(), str.bytes(), str.size());
     }
     return *this;
 }
 
 string::iterator string::insert(iterator iter, const string& str, size_type from, size_type size) {
-    size_type dist = iter - begin();
+    size_type dist = index_of(iter);
     insert(dist, str, from, size);
-    return begin() + dist;
+    return iterator_at(dist);
 }
 
 string::iterator string::insert(iterator iter, const char* str, size_type size, const text_encoder& enc) {
-    size_type dist = iter - begin();
+    size_type dist = index_of(iter);
     insert(dist, str, size, enc);
-    return begin() + dist;
+    return iterator_at(dist);
 }
 
 string::iterator string::insert(iterator iter, size_type n, const_reference c) {
-    size_type dist = iter - begin();
+    size_type dist = index_of(iter);
     insert(dist, n, c);
-    return begin() + dist;
+    return iterator_at(dist);
 }
 
 string& string::erase(size_type from, size_type n) {
     if(n == npos) {
         n = size() - from;
     }
+    n = (n > size() - from) ? (size() - from) : n;
+
     if(n > 0) {
-        iterator first = begin() + from;
-        iterator last = first + n;
-        d()->m_last = d()->m_alloc.ocopy(first.ptr(), last.ptr(), end().ptr() - last.ptr());
-        d()->m_len -= n;
+        // we have to work with offsets because data can be detached
+        size_type first_byte = byte_offset(from);
+        size_type last_byte = byte_offset(from + n);
+        size_type old_bytes = bytes();
+
+        char* start = wdata();
+        wq_data::m_alloc.ocopy(start + first_byte, start + last_byte, old_bytes - last_byte);
+        set_sizes(old_bytes - (last_byte - first_byte), size() - n);
     }
     return *this;
 }
 
 string::iterator string::erase(iterator iter) {
-    size_type dist = iter - begin();
+    size_type dist = index_of(iter);
     erase(dist, 1);
-    try {
-        iter = begin() + dist;
-    }
-    catch(const range_error&) {
-        iter = end();
-    }
-    return iter;
+    return iterator_at(dist);
 }
 
 string::iterator string::erase(iterator start_iter, iterator end_iter) {
-    size_type dist1 = start_iter - begin();
-    size_type dist2 = end_iter - begin();
+    size_type dist1 = index_of(start_iter);
+    size_type dist2 = index_of(end_iter);
     erase(dist1, dist2 - dist1);
-    try {
-        start_iter = begin() + dist1;
-    }
-    catch(const range_error&) {
-        start_iter = end();
-    }
-    return start_iter;
+    return iterator_at(dist1);
 }
 
 string& string::replace(size_type from, size_type n, const string& with, size_type from2, size_type n2) {
-    d_ptr.detach();
+    if(&with == this) {
+        // our data will be changed so we need a copy of them
+        string tmp_str = with;
+        return replace(from, n, tmp_str, from2, n2);
+    }
     if(n2 == npos) {
         n2 = with.size();
     }
@@ -885,52 +1107,25 @@ string& string::replace(size_type from, size_type n, const string& with, size_ty
     if(n == npos) {
         n = size();
     }
-    n = (n > with.size() - from) ? (with.size() - from) : n;
-
-    // now we will initialize all iterators that we will need
-    iterator erase_from = begin() + from;
-    iterator erase_to = erase_from + n;
-    const_iterator insert_from = with.begin() + from2;
-    const_iterator insert_to = insert_from + n2;
+    n = (n > size() - from) ? (size() - from) : n;
 
-    // some sizes
-    size_type erase_bytes = erase_to.ptr() - erase_from.ptr();
-    size_type insert_bytes = insert_to.ptr() - insert_from.ptr();
-
-    // things will be more complex because I want replacing as fast as possible
-    if(erase_bytes == insert_bytes) {
-        // just put it there
-        d()->m_alloc.copy(erase_from.ptr(), insert_from.ptr(), insert_bytes);
-    }
-    else if(erase_bytes < insert_bytes) {
-        // next step will make our erase iterators invalid (in some cases only)
+    // some sizes, we have to use offsets because data can be detached or moved
+    size_type erase_at = byte_offset(from);
+    size_type erase_bytes = byte_offset(from + n) - erase_at;
+    const char* insert_from = with.data() + with.byte_offset(from2);
+    size_type insert_bytes = (with.data() + with.byte_offset(from2 + n2)) - insert_from;
+    size_type old_bytes = bytes();
+    if(insert_bytes > erase_bytes) {
         reserve(insert_bytes - erase_bytes);
-
-        // so we have to count them again
-        erase_from = begin() + from;
-        erase_to = erase_from + n;
-
-        // copy as many bytes as possible => erase_bytes bytes
-        d()->m_alloc.copy(erase_from.ptr(), insert_from.ptr(), erase_bytes);
-
-        // make space for other bytes
-        d()->m_last = d()->m_alloc.ocopy(erase_to.ptr() + (insert_bytes - erase_bytes),
-                                         erase_to.ptr(), end().ptr() - erase_to.ptr());
-
-        // and put other bytes to right place
-        d()->m_alloc.copy(erase_to.ptr(), insert_from.ptr() + erase_bytes, insert_bytes - erase_bytes);
     }
-    else if(erase_bytes > insert_bytes) {
-        // copy all bytes to right place
-        d()->m_alloc.copy(erase_from.ptr(), insert_from.ptr(), insert_bytes);
 
-        // and now copy data to left
-        d()->m_last = d()->m_alloc.ocopy(erase_from.ptr() + insert_bytes, erase_to.ptr(),
-                                         end().ptr() - erase_to.ptr());
-    }
+    // move tail of string to right place and put new bytes before it
+    char* start = wdata();
+    wq_data::m_alloc.ocopy(start + erase_at + insert_bytes, start + erase_at + erase_bytes,
+                           old_bytes - (erase_at + erase_bytes));
+    wq_data::m_alloc.copy(start + erase_at, insert_from, insert_bytes);
 
-    // adding size
-    d()->m_len += n2 - n;
+    set_sizes(old_bytes - erase_bytes + insert_bytes, size() - n + n2);
     return *this;
 }
 
@@ -944,118 +1139,202 @@ int string::compare(size_type from1, size_type n1, const string& with, size_type
     }
     n2 = (n2 > with.size() - from2) ? (with.size() - from2) : n2;
 
-    const_iterator with_iter = with.begin() + from2;
-    const_iterator start_iter = begin() + from1;
-    const_iterator end_iter = start_iter + (n1 < n2 ? n1 : n2);
-    while(start_iter != end_iter) {
-        if( (cs && *start_iter != *with_iter) || (!cs && start_iter->lower() != with_iter->lower()) ) {
-            return start_iter->utf32() - with_iter->utf32();
-        }
-        start_iter++;
-        with_iter++;
-    }
-    return n1 == n2 ? 0 : -(n1 < n2 ? with_iter->utf32() : start_iter->utf32());
+    // parts are compared as UTF-8 sequences
+    const char* first1 = data() + byte_offset(from1);
+    const char* first2 = with.data() + with.byte_offset(from2);
+    return string_ref::compare_bytes(first1, data() + byte_offset(from1 + n1),
+                                     first2, with.data() + with.byte_offset(from2 + n2), cs);
+}
+
+/*!
+    \brief Compares string with text referred by \a with.
+
+    Return value has same meaning as in other compare() functions.
+*/
+int string::compare(const string_ref& with) const {
+    return string_ref(*this).compare(with);
+}
+
+/*!
+    \brief Returns \b true if string begins with \a what.
+
+    \param what Text which is compared with beginning of string.
+    \param cs If \b false characters are compared case insensitively.
+    \sa string_ref::starts_with()
+*/
+bool string::starts_with(const string_ref& what, bool cs) const {
+    return string_ref(*this).starts_with(what, cs);
+}
+
+/*!
+    \brief Returns \b true if string ends with \a what.
+
+    \param what Text which is compared with end of string.
+    \param cs If \b false characters are compared case insensitively.
+    \sa string_ref::ends_with()
+*/
+bool string::ends_with(const string_ref& what, bool cs) const {
+    return string_ref(*this).ends_with(what, cs);
+}
+
+/*!
+    \brief Returns \b true if string contains \a what.
+
+    It is faster than comparing result of find() with npos, because found
+    position is not converted to index.
+
+    \param what Text to find.
+    \param cs If \b false characters are compared case insensitively.
+*/
+bool string::contains(const string_ref& what, bool cs) const {
+    return string_ref(*this).contains(what, cs);
 }
 
 string::size_type string::find(const string& what, size_type from, bool cs) const {
-    if(size() - from < what.size()) {
+    return find(string_ref(what), from, cs);
+}
+
+/*!
+    \brief Finds text referred by \a what.
+
+    Searching is done over UTF-8 bytes and only the found position
+    is converted back to character index.
+
+    \param what Text to find.
+    \param from Index of character where searching starts.
+    \param cs If \b false characters are compared case insensitively.
+    \return Index of first occurrence of \a what or npos.
+*/
+string::size_type string::find(const string_ref& what, size_type from, bool cs) const {
+    if(from > size()) {
         return npos;
     }
-    for(size_type start_at = from; start_at != size(); start_at++) {
-        if(compare(start_at, what.size(), what, 0, npos, cs) == 0) {
-            return start_at;
-        }
-    }
-    return npos;
+
+    const char* start = data();
+    const char* found = string_ref::find_bytes(start + byte_offset(from), data_last(),
+                                               what.data(), what.data() + what.bytes(), cs);
+    return found == NULL ? npos : index_of_byte(found - start);
+}
+
+string::size_type string::find(value_type c, size_type from, bool cs) const {
+    return find(string_ref( c.utf8() ), from, cs);
 }
 
 string::size_type string::rfind(const string& what, size_type from, bool cs) const {
-    if(from == npos) {
-        from = size() - 1;
-    }
-    from = from >= size() ? size() - 1 : from;
-    if(from < what.size()) {
+    return rfind(string_ref(what), from, cs);
+}
+
+/*!
+    \brief Finds last occurrence of text referred by \a what.
+
+    Only occurrences which start at character \a from or before it are found.
+    Searching is done backward over UTF-8 bytes by the same engine as find()
+    and only the found position is converted back to character index.
+
+    \param what Text to find.
+    \param from Index of last character where found text can start, npos means
+    whole string.
+    \param cs If \b false characters are compared case insensitively.
+    \return Index of last occurrence of \a what or npos.
+*/
+string::size_type string::rfind(const string_ref& what, size_type from, bool cs) const {
+    // characters are folded one to one, so every match has what.size() characters
+    if(what.size() > size()) {
         return npos;
     }
-    for(size_type start_at = from + what.size(); start_at >= 0; start_at--) {
-        size_type pos = start_at - what.size();
-        if(compare(pos, what.size(), what, 0, npos, cs) == 0) {
-            return pos;
-        }
-    }
-    return npos;
+    from = from > size() - what.size() ? size() - what.size() : from;
+
+    const char* start = data();
+    const char* last = start + byte_offset(from + what.size());
+    const char* found = string_ref::rfind_bytes(start, last, what.data(), what.data() + what.bytes(), cs);
+    return found == NULL ? npos : from + what.size() - distance(found, last);
+}
+
+string::size_type string::rfind(value_type c, size_type from, bool cs) const {
+    return rfind(string_ref( c.utf8() ), from, cs);
 }
 
 string::size_type string::find_first_of(const string& str, size_type pos, bool cs) const {
-    const_iterator end_iter = end();
-    const_iterator end_iter2 = str.end();
-    for(const_iterator iter = begin() + pos; iter != end_iter; iter++) {
-        for(const_iterator iter2 = str.begin(); iter2 != end_iter2; iter2++) {
-            if( (cs && *iter == *iter2) || (!cs && iter->lower() == iter2->lower()) ) {
-                return iter - begin();
-            }
-        }
+    return find_first_of(codepoint_set(str, cs), pos);
+}
+
+/*!
+    \brief Finds first character from \a set.
+
+    Set can be built once and used for many searches. Searching is done
+    over UTF-8 bytes, see codepoint_set for details.
+
+    \param set Set of searched characters.
+    \param pos Index of character where searching starts.
+    \return Index of found character or npos.
+*/
+string::size_type string::find_first_of(const codepoint_set& set, size_type pos) const {
+    if(pos >= size()) {
+        return npos;
     }
-    return npos;
+    // index is counted from pos, so only scanned bytes are counted
+    const char* from = data() + byte_offset(pos);
+    const char* found = utf8_find_of(from, data_last(), set, true);
+    return found == NULL ? npos : pos + distance(from, found);
 }
 
 string::size_type string::find_first_not_of(const string& str, size_type pos, bool cs) const {
-    const_iterator end_iter = end();
-    const_iterator end_iter2 = str.end();
-    for(const_iterator iter = begin() + pos; iter != end_iter; iter++) {
-        size_type num_of_not = 0;
-        for(const_iterator iter2 = str.begin(); iter2 != end_iter2; iter2++) {
-            // counting of not found characters
-            if( (cs && *iter != *iter2) || (!cs && iter->lower() != iter2->lower()) ) {
-                num_of_not++;
-            }
-        }
-        // returning if there was not character that is in str
-        if(num_of_not == str.size()) {
-            return iter - begin();
-        }
+    return find_first_not_of(codepoint_set(str, cs), pos);
+}
+
+/*!
+    \brief Finds first character which is not in \a set.
+
+    \sa find_first_of()
+*/
+string::size_type string::find_first_not_of(const codepoint_set& set, size_type pos) const {
+    if(pos >= size()) {
+        return npos;
     }
-    return npos;
+    // index is counted from pos, so only scanned bytes are counted
+    const char* from = data() + byte_offset(pos);
+    const char* found = utf8_find_of(from, data_last(), set, false);
+    return found == NULL ? npos : pos + distance(from, found);
 }
 
 string::size_type string::find_last_of(const string& str, size_type pos, bool cs) const {
-    if(pos == npos) {
-        pos = size() - 1;
+    return find_last_of(codepoint_set(str, cs), pos);
+}
+
+/*!
+    \brief Finds last character from \a set which is not after \a pos.
+
+    \sa find_first_of()
+*/
+string::size_type string::find_last_of(const codepoint_set& set, size_type pos) const {
+    if( empty() ) {
+        return npos;
     }
     pos = pos >= size() ? size() - 1 : pos;
-    const_iterator end_iter = begin();
-    const_iterator end_iter2 = str.end();
-    for(const_iterator iter = begin() + pos; iter != end_iter; iter--) {
-        for(const_iterator iter2 = str.begin(); iter2 != end_iter2; iter2++) {
-            if( (cs && *iter == *iter2) || (!cs && iter->lower() == iter2->lower()) ) {
-                return iter - begin();
-            }
-        }
-    }
-    return npos;
+    const char* start = data();
+    const char* to = start + byte_offset(pos + 1);
+    const char* found = utf8_rfind_of(start, to, set, true);
+    return found == NULL ? npos : pos + 1 - distance(found, to);
 }
 
 string::size_type string::find_last_not_of(const string& str, size_type pos, bool cs) const {
-    if(pos == npos) {
-        pos = size() - 1;
+    return find_last_not_of(codepoint_set(str, cs), pos);
+}
+
+/*!
+    \brief Finds last character which is not in \a set and is not after \a pos.
+
+    \sa find_first_of()
+*/
+string::size_type string::find_last_not_of(const codepoint_set& set, size_type pos) const {
+    if( empty() ) {
+        return npos;
     }
     pos = pos >= size() ? size() - 1 : pos;
-    const_iterator end_iter = begin();
-    const_iterator end_iter2 = str.end();
-    for(const_iterator iter = begin() + pos; iter != end_iter; iter--) {
-        size_type num_of_not = 0;
-        for(const_iterator iter2 = str.begin(); iter2 != end_iter2; iter2++) {
-            // counting of not found characters
-            if( (cs && *iter != *iter2) || (!cs && iter->lower() != iter2->lower()) ) {
-                num_of_not++;
-            }
-        }
-        // returning if there was not character that is in str
-        if(num_of_not == str.size()) {
-            return iter - begin();
-        }
-    }
-    return npos;
+    const char* start = data();
+    const char* to = start + byte_offset(pos + 1);
+    const char* found = utf8_rfind_of(start, to, set, false);
+    return found == NULL ? npos : pos + 1 - distance(found, to);
 }
 
 /*!
@@ -1070,18 +1349,13 @@ string::size_type string::find_last_not_of(const string& str, size_type pos, boo
     \return This function returns number of bytes copied (no characters).
 */
 string::size_type string::copy(char* out_str, size_type n, size_type from) const {
-    const_iterator start = begin() + from;
-    const_iterator end = start + n;
-    size_type copied = 0;
-    for( ; start != end; start++) {
-        // for every character we have to copy all bytes
-        size_type stop_after = start->bytes();
-        for(size_type i = 0; i != stop_after; i++) {
-            out_str[copied + i] = *(start.ptr() + i);
-        }
-        copied += stop_after;
+    if(n == npos || n > size() - from) {
+        n = size() - from;
     }
-    return copied;
+    size_type first = byte_offset(from);
+    size_type last = byte_offset(from + n);
+    wq_data::m_alloc.copy(out_str, data() + first, last - first);
+    return last - first;
 }
 
 /*!
@@ -1092,17 +1366,22 @@ string::size_type string::copy(char* out_str, size_type n, size_type from) const
     \param with Object with which to swap contents.
 */
 void string::swap(string& with) {
-    // this is really fast because of implicit sharing
-    string tmp_str = with;
-    with = *this;
-    *this = tmp_str;
+    // only members are exchanged so owners of shared data are not changed
+    d_ptr.swap(with.d_ptr);
+    local_data tmp_local = m_local;
+    m_local = with.m_local;
+    with.m_local = tmp_local;
 }
 
 /*!
     \brief Returns substring of string.
 
     This function returns string which contains particular
-    sequence of string.
+    sequence of string. Short substrings are copied into returned
+    object, longer ones share buffer with this string and are copied
+    only when one of strings is changed. Note that such substring keeps
+    whole buffer of this string allocated - call reserve(0) on it when
+    it is stored for long time.
 
     \param from First character to choose for new string.
     \param n Number of character in new string.
@@ -1114,6 +1393,197 @@ string string::substr(size_type from, size_type n) const {
     return ret_str;
 }
 
+/*!
+    \brief Returns copy of string with all characters mapped to lower case.
+
+    Whole string is mapped in one pass to new buffer - ASCII blocks are
+    mapped by SIMD instructions, other characters by Unicode properties.
+    Characters with special mapping to more characters (like U+0130, which
+    becomes "i" followed by U+0307) are expanded, so result can have more
+    characters and bytes than this string. Mappings which depend on language
+    or context are not applied.
+
+    \sa to_upper(), case_fold(), value_type::lower()
+*/
+string string::to_lower() const {
+    return map_case(utf8_to_lower);
+}
+
+/*!
+    \brief Returns copy of string with all characters mapped to upper case.
+
+    Special mappings are applied, so for example U+00DF (sharp s) becomes "SS".
+    \sa to_lower(), case_fold(), value_type::upper()
+*/
+string string::to_upper() const {
+    return map_case(utf8_to_upper);
+}
+
+/*!
+    \brief Returns copy of string with case folded characters.
+
+    Characters are folded the same way as by case insensitive comparing and
+    searching, so two strings are equal case insensitively exactly when
+    their folded versions are equal.
+    \sa to_lower(), compare()
+*/
+string string::case_fold() const {
+    return map_case(utf8_case_fold);
+}
+
+// private functions
+// returns shared data which can be changed, substring gets own copy of its bytes here
+string::wq_data* string::d() {
+    if(d_ptr.is_ok() && d_ptr.const_data()->m_owner.is_ok()) {
+        d_ptr.set( new wq_data( *cd() ) );
+    }
+    return static_cast<wq_data*>( d_ptr.data() );
+}
+
+// returns pointer to contents which can be changed (data are detached)
+char* string::wdata() {
+    return is_local() ? m_local.m_buff : d()->m_start;
+}
+
+// sets number of bytes and characters of contents
+void string::set_sizes(size_type bytes_size, size_type len) {
+    if(is_local()) {
+        m_local.m_bytes = wq::uint8(bytes_size);
+        m_local.m_len = wq::uint8(len);
+    }
+    else {
+        d()->m_last = d()->m_start + bytes_size;
+        d()->m_len = len;
+        d()->m_hash.release(0);
+        if(d()->m_index.val() != NULL) {
+            d()->m_index.unset();
+        }
+    }
+}
+
+// returns index of character offsets (only for long strings)
+const string::offset_index* string::get_index() const {
+    if(is_local() || is_ascii() || size() < 2 * index_step) {
+        return NULL;
+    }
+    const offset_index* index = cd()->m_index.val();
+    if(index == NULL) {
+        // more threads can build index at once, only one will be used
+        offset_index* new_index = new offset_index(data(), data_last(), size());
+        index = cd()->m_index.cmp_set(NULL, new_index);
+        if(index != NULL) {
+            delete new_index;
+        }
+        else {
+            index = new_index;
+        }
+    }
+    return index;
+}
+
+// maps case of all characters to new buffer, which grows when mapped characters are longer
+string string::map_case(int mapping) const {
+    size_type capacity = bytes() + bytes() / 8 + 16;
+    char* buff = wq_data::m_alloc.allocate(capacity);
+    char* out = buff;
+    size_type len = 0;
+    const char* ptr = data();
+    const char* last = data_last();
+    while(true) {
+        ptr = utf8_map_case(ptr, last, out, buff + capacity, utf8_case_mapping(mapping), len);
+        if(ptr == last) {
+            break;
+        }
+        size_type written = out - buff;
+        capacity *= 2;
+        char* new_buff = wq_data::m_alloc.allocate(capacity);
+        wq_data::m_alloc.copy(new_buff, buff, written);
+        wq_data::m_alloc.deallocate(buff);
+        buff = new_buff;
+        out = buff + written;
+    }
+
+    string ret_str;
+    ret_str.adopt_raw(buff, out - buff, capacity, len);
+    return ret_str;
+}
+
+// makes this string to be same as 'from' without copying of shared data
+void string::share(const string& from) {
+    d_ptr.set(from.d_ptr);
+    m_local = from.m_local;
+}
+
+// appends n bytes of UTF-8 sequence which contains len characters
+void string::append_raw(const char* str, size_type n, size_type len) {
+    // str can point to our own contents which can be moved by reserve()
+    size_type old_bytes = bytes();
+    bool is_own = str >= data() && str < data() + old_bytes;
+    size_type own_offset = str - data();
+
+    reserve(n);
+    char* start = wdata();
+    if(is_own) {
+        str = start + own_offset;
+    }
+    wq_data::m_alloc.copy(start + old_bytes, str, n);
+    set_sizes(old_bytes + n, size() + len);
+}
+
+// inserts n bytes of UTF-8 sequence which contains len characters at byte offset at
+void string::insert_raw(size_type at, const char* str, size_type n, size_type len) {
+    // our own contents will be moved so we have to copy them
+    if(str >= data() && str < data() + bytes()) {
+        char* tmp_buff = wq_data::m_alloc.allocate(n);
+        wq_data::m_alloc.copy(tmp_buff, str, n);
+        insert_raw(at, tmp_buff, n, len);
+        wq_data::m_alloc.deallocate(tmp_buff);
+        return;
+    }
+
+    size_type old_bytes = bytes();
+    reserve(n);
+    char* start = wdata();
+    wq_data::m_alloc.ocopy(start + at + n, start + at, old_bytes - at);
+    wq_data::m_alloc.copy(start + at, str, n);
+    set_sizes(old_bytes + n, size() + len);
+}
+
+// replaces contents by n uninitialized bytes which will contain len characters,
+// buffer is allocated with exact size and returned for writing
+char* string::assign_raw(size_type n, size_type len) {
+    if(n <= local_capacity) {
+        d_ptr.unset();
+        m_local.m_bytes = wq::uint8(n);
+        m_local.m_len = wq::uint8(len);
+        return m_local.m_buff;
+    }
+
+    wq_data* new_data = new wq_data;
+    new_data->m_start = wq_data::m_alloc.allocate(n);
+    new_data->m_end = new_data->m_last = new_data->m_start + n;
+    new_data->m_len = len;
+    d_ptr.set(new_data);
+    return new_data->m_start;
+}
+
+// replaces contents by n bytes with len characters in buffer buff which has given
+// capacity and was allocated by string's allocator, string takes ownership of buff
+void string::adopt_raw(char* buff, size_type n, size_type capacity, size_type len) {
+    if(n <= local_capacity) {
+        wq_data::m_alloc.copy( assign_raw(n, len), buff, n );
+        wq_data::m_alloc.deallocate(buff);
+        return;
+    }
+
+    wq_data* new_data = new wq_data;
+    new_data->m_start = buff;
+    new_data->m_last = buff + n;
+    new_data->m_end = buff + capacity;
+    new_data->m_len = len;
+    d_ptr.set(new_data);
+}
+
 /*!
     \fn string::utf8_str() const
 	\brief Converts string.
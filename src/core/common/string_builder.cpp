@@ -0,0 +1,203 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/string_builder.h"
+
+#include <cstring>
+
+namespace wq {
+namespace core {
+
+// capacity of first chunk if it is not specified and greatest capacity
+// which chunks reach by doubling
+static const string::size_type first_chunk_capacity = 256;
+static const string::size_type max_chunk_capacity = 1024 * 1024;
+
+/*!
+    \class string_builder
+    \brief Builder of long strings.
+
+    Appending to string reallocates and copies its buffer whenever
+    capacity is exhausted. string_builder stores appended text in chain
+    of chunks instead, full chunks are never moved and capacity of new
+    chunks grows up to 1 MB. Sizes in bytes and characters are summed
+    while appending, so resulting string is created by one copy (see str())
+    or even without copying when all text fits to first chunk (see freeze()).
+
+    \code
+        wq::string_builder out;
+        for(...) {
+            out += name;
+            out += wq::string::value_type('\n');
+        }
+        wq::string text = out.freeze();
+    \endcode
+
+    \sa string
+*/
+
+/*!
+    \brief Constructs empty builder.
+
+    \param capacity Number of bytes of first chunk. Whole text which is not
+    longer than \a capacity is returned by freeze() without copying.
+*/
+string_builder::string_builder(size_type capacity) :
+        m_first(NULL), m_current(NULL), m_bytes(0), m_len(0),
+        m_next_capacity(capacity == 0 ? first_chunk_capacity : capacity) {
+
+}
+
+/*!
+    \brief Destroys builder and all its chunks.
+*/
+string_builder::~string_builder() {
+    clear();
+}
+
+/*!
+    \fn string_builder::size() const
+    \brief Returns number of appended characters.
+*/
+
+/*!
+    \fn string_builder::bytes() const
+    \brief Returns number of bytes of appended text in UTF-8.
+*/
+
+/*!
+    \brief Appends text referred by \a str.
+*/
+string_builder& string_builder::append(const string_ref& str) {
+    size_type n = str.bytes();
+    if(n != 0) {
+        memcpy(reserve(n), str.data(), n);
+        m_current->m_last += n;
+        m_bytes += n;
+        m_len += str.size();
+    }
+    return *this;
+}
+
+/*!
+    \brief Appends \a n characters \a c.
+*/
+string_builder& string_builder::append(size_type n, const_reference c) {
+    size_type c_bytes = c.bytes();
+    if(n != 0) {
+        char* dest = reserve(n * c_bytes);
+        const char* c_data = c.utf8();
+        for(size_type i = 0; i != n; i++) {
+            memcpy(dest, c_data, c_bytes);
+            dest += c_bytes;
+        }
+        m_current->m_last = dest;
+        m_bytes += n * c_bytes;
+        m_len += n;
+    }
+    return *this;
+}
+
+/*!
+    \brief Removes all appended text.
+*/
+void string_builder::clear() {
+    string::allocator_type alloc;
+    while(m_first != NULL) {
+        chunk* next = m_first->m_next;
+        if(m_first->m_start != NULL) {
+            alloc.deallocate(m_first->m_start);
+        }
+        delete m_first;
+        m_first = next;
+    }
+    m_current = NULL;
+    m_bytes = m_len = 0;
+}
+
+/*!
+    \brief Returns built string.
+
+    Text is copied from chunks to new string with exact size, builder
+    is not changed.
+
+    \sa freeze()
+*/
+string string_builder::str() const {
+    string ret_str;
+    copy_to( ret_str.assign_raw(m_bytes, m_len) );
+    return ret_str;
+}
+
+/*!
+    \brief Returns built string and clears builder.
+
+    If whole text is stored in first chunk, its buffer is taken by returned
+    string without copying. Otherwise text is copied as by str().
+
+    \sa str()
+*/
+string string_builder::freeze() {
+    string ret_str;
+    if(m_first != NULL && m_first == m_current) {
+        ret_str.adopt_raw(m_first->m_start, m_bytes, m_first->m_end - m_first->m_start, m_len);
+        m_first->m_start = NULL;
+    }
+    else {
+        copy_to( ret_str.assign_raw(m_bytes, m_len) );
+    }
+    clear();
+    return ret_str;
+}
+
+// private functions
+// makes space for n bytes and returns pointer where they should be written
+char* string_builder::reserve(size_type n) {
+    if(m_current != NULL && size_type(m_current->m_end - m_current->m_last) >= n) {
+        return m_current->m_last;
+    }
+
+    // new chunk, old one is left with unused space
+    size_type capacity = m_next_capacity < n ? n : m_next_capacity;
+    if(m_next_capacity < max_chunk_capacity) {
+        m_next_capacity = m_next_capacity * 2;
+    }
+    chunk* new_chunk = new chunk;
+    new_chunk->m_start = new_chunk->m_last = string::allocator_type().allocate(capacity);
+    new_chunk->m_end = new_chunk->m_start + capacity;
+    new_chunk->m_next = NULL;
+    if(m_current != NULL) {
+        m_current->m_next = new_chunk;
+    }
+    else {
+        m_first = new_chunk;
+    }
+    m_current = new_chunk;
+    return new_chunk->m_last;
+}
+
+// copies contents of all chunks to dest
+void string_builder::copy_to(char* dest) const {
+    for(const chunk* c = m_first; c != NULL; c = c->m_next) {
+        memcpy(dest, c->m_start, c->m_last - c->m_start);
+        dest += c->m_last - c->m_start;
+    }
+}
+
+}  // namespace core
+}  // namespace wq
@@ -26,6 +26,10 @@ string_list::string_list(const string& str, string::const_reference delim) : lis
     operator= ( from_string(str, delim) );
 }
 
+string_list::string_list(const string_ref& str, string::const_reference delim) : list<string>() {
+    operator= ( from_string(str, delim) );
+}
+
 string_list::string_list(const_iterator first, const_iterator last) : list<string>(first, last) {
 
 }
@@ -50,27 +54,33 @@ string string_list::to_string(string::const_reference delim) const {
 }
 
 string_list string_list::from_string(const string& str, string::const_reference delim) {
+    return from_string(string_ref(str), delim);
+}
+
+/*!
+    \brief Splits text to list.
+
+    Text referred by \a str is split by \a delim character. Parts are
+    found directly in UTF-8 bytes of \a str so only the resulting
+    strings are created.
+*/
+string_list string_list::from_string(const string_ref& str, string::const_reference delim) {
     string_list result;
-    if(!str.empty() && str.find(delim) == string::npos) {
-        result.push_back(str);
-    }
-    else if(!str.empty()) {
-        string::size_type last_pos = 0;
-        string::size_type curr_pos = 0;
+    if(!str.empty()) {
+        string_ref delim_ref( delim.utf8() );
+        const char* last = str.data() + str.bytes();
+        const char* first = str.data();
 
         // adding parts of string that ends with delim char
-        while( (curr_pos = str.find(delim, last_pos)) != string::npos ) {
-            string::const_iterator first = str.begin() + last_pos;
-            string::const_iterator last = first + (curr_pos - last_pos);
-            result.push_back( string(first, last) );
-            last_pos = curr_pos + 1;
+        const char* found;
+        while( (found = string_ref::find_bytes(first, last, delim_ref.data(), delim_ref.data() + delim_ref.bytes(), true)) != NULL ) {
+            result.push_back( string( string_ref(first, found - first) ) );
+            first = found + delim_ref.bytes();
         }
 
         // after that we have to check/add last part of new list
-        if( last_pos < str.size() ) {
-            string::const_iterator first = str.begin() + last_pos;
-            string::const_iterator last = first + (str.size() - last_pos);
-            result.push_back( string(first, last) );
+        if(first != last) {
+            result.push_back( string( string_ref(first, last - first) ) );
         }
     }
     return result;
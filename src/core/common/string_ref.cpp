@@ -0,0 +1,244 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/string_ref.h"
+#include "wq/core/exception.h"
+#include "wq/core/p/utf8.h"
+
+#include <cstring>
+
+namespace wq {
+namespace core {
+
+/*!
+    \class string_ref
+    \brief Reference to UTF-8 text.
+
+    This class refers to valid UTF-8 sequence which is owned by someone
+    else - by string object or by raw buffer. Object holds only pointer,
+    number of bytes and number of characters, so creating string_ref from
+    part of string does not allocate any memory. This makes it useful for
+    parsing, where substrings are only compared or searched.
+
+    Referred memory must stay valid and unchanged while string_ref is used.
+    Note that short strings store their contents inside of the object so
+    string_ref to such string is valid only while the string object lives.
+
+    \sa string
+*/
+
+/*!
+    \fn string_ref::string_ref()
+    \brief Constructs reference to empty text.
+*/
+
+/*!
+    \fn string_ref::string_ref(const string& str)
+    \brief Constructs reference to whole contents of \a str.
+*/
+
+/*!
+    \brief Constructs reference to part of string.
+
+    Object will refer to \a n characters of \a str starting at index \a from.
+    If \a from is greater than size of \a str wq::core::range_error is thrown.
+*/
+string_ref::string_ref(const string& str, size_type from, size_type n) {
+    n = (n > str.size() - from) ? (str.size() - from) : n;
+    size_type first = str.byte_offset(from);
+    m_data = str.data() + first;
+    m_bytes = str.byte_offset(from + n) - first;
+    m_len = n;
+}
+
+/*!
+    \brief Constructs reference to raw UTF-8 buffer.
+
+    \param str Valid UTF-8 sequence. It is not checked, so caller is
+    responsible for its validity.
+    \param size Number of bytes in \a str or string::npos if \a str
+    ends with \b 0. Number of characters is counted on first request.
+*/
+string_ref::string_ref(const char* str, size_type size) :
+        m_data(str), m_bytes(size == string::npos ? strlen(str) : size), m_len(string::npos) {
+
+}
+
+/*!
+    \brief Returns number of characters in referred text.
+*/
+string_ref::size_type string_ref::size() const {
+    if(m_len == string::npos) {
+        m_len = utf8_count(m_data, m_data + m_bytes);
+    }
+    return m_len;
+}
+
+/*!
+    \brief Returns character at index \a i.
+
+    If \a i is out of range wq::core::range_error exception is thrown.
+*/
+string_ref::value_type string_ref::at(size_type i) const {
+    if(i >= size()) {
+        throw range_error();
+    }
+    return value_type( is_ascii() ? m_data + i : utf8_skip(m_data, m_data + m_bytes, i) );
+}
+
+/*!
+    \brief Returns reference to part of referred text.
+
+    This function does not copy any data.
+
+    \param from First character of returned reference.
+    \param n Number of characters in returned reference.
+*/
+string_ref string_ref::substr(size_type from, size_type n) const {
+    if(from > size()) {
+        throw range_error();
+    }
+    n = (n > size() - from) ? (size() - from) : n;
+
+    const char* last = m_data + m_bytes;
+    string_ref ret_ref;
+    ret_ref.m_data = is_ascii() ? m_data + from : utf8_skip(m_data, last, from);
+    if(from + n != size()) {
+        last = is_ascii() ? ret_ref.m_data + n : utf8_skip(ret_ref.m_data, last, n);
+    }
+    ret_ref.m_bytes = last - ret_ref.m_data;
+    ret_ref.m_len = n;
+    return ret_ref;
+}
+
+/*!
+    \brief Compares texts.
+
+    \param with Text to compare with.
+    \param cs If \b false characters are compared case insensitively.
+    \return Zero if texts are equal, negative number if this text is
+    less than \a with and positive number otherwise.
+*/
+int string_ref::compare(const string_ref& with, bool cs) const {
+    return compare_bytes(m_data, m_data + m_bytes, with.m_data, with.m_data + with.m_bytes, cs);
+}
+
+/*!
+    \brief Finds text.
+
+    \param what Text to find.
+    \param from Index of character where searching starts.
+    \param cs If \b false characters are compared case insensitively.
+    \return Index of first occurrence of \a what or string::npos.
+*/
+string_ref::size_type string_ref::find(const string_ref& what, size_type from, bool cs) const {
+    if(from > size()) {
+        return string::npos;
+    }
+
+    const char* last = m_data + m_bytes;
+    const char* first = is_ascii() ? m_data + from : utf8_skip(m_data, last, from);
+    const char* found = find_bytes(first, last, what.m_data, what.m_data + what.m_bytes, cs);
+    return found == NULL ? string::npos : from + utf8_count(first, found);
+}
+
+/*!
+    \brief Finds last occurrence of \a what which starts at character \a from or before it.
+
+    \sa string::rfind()
+*/
+string_ref::size_type string_ref::rfind(const string_ref& what, size_type from, bool cs) const {
+    // match which starts at from ends at most what.size() characters after it
+    size_type len = size();
+    if(what.size() > len) {
+        return string::npos;
+    }
+    from = from > len - what.size() ? len - what.size() : from;
+
+    const char* last = is_ascii() ? m_data + from + what.size() : utf8_skip(m_data, m_data + m_bytes, from + what.size());
+    const char* found = rfind_bytes(m_data, last, what.m_data, what.m_data + what.m_bytes, cs);
+    return found == NULL ? string::npos : from + what.size() - utf8_count(found, last);
+}
+
+/*!
+    \brief Returns \b true if text begins with \a what.
+
+    With \a cs only bytes of beginning are compared. Otherwise beginning
+    which has as many characters as \a what is compared case insensitively
+    (folded characters can be encoded by different number of bytes).
+*/
+bool string_ref::starts_with(const string_ref& what, bool cs) const {
+    if(cs) {
+        return what.m_bytes <= m_bytes && memcmp(m_data, what.m_data, what.m_bytes) == 0;
+    }
+    const char* last = m_data + m_bytes;
+    return utf8_compare_nocase(m_data, utf8_skip(m_data, last, what.size()), what.m_data, what.m_data + what.m_bytes) == 0;
+}
+
+/*!
+    \brief Returns \b true if text ends with \a what.
+
+    \sa starts_with()
+*/
+bool string_ref::ends_with(const string_ref& what, bool cs) const {
+    const char* last = m_data + m_bytes;
+    if(cs) {
+        return what.m_bytes <= m_bytes && memcmp(last - what.m_bytes, what.m_data, what.m_bytes) == 0;
+    }
+    return utf8_compare_nocase(utf8_skip_back(m_data, last, what.size()), last, what.m_data, what.m_data + what.m_bytes) == 0;
+}
+
+/*!
+    \fn bool string_ref::contains(const string_ref& what, bool cs) const
+    \brief Returns \b true if text contains \a what.
+
+    Unlike find() position of found text is not converted to index.
+*/
+
+// private functions
+// compares two valid UTF-8 sequences, with cs bytes are compared because
+// order of UTF-8 bytes is same as order of encoded characters
+int string_ref::compare_bytes(const char* first1, const char* last1, const char* first2, const char* last2, bool cs) {
+    if(!cs) {
+        return utf8_compare_nocase(first1, last1, first2, last2);
+    }
+
+    size_type n1 = last1 - first1;
+    size_type n2 = last2 - first2;
+    int diff = first1 == first2 ? 0 : memcmp(first1, first2, n1 < n2 ? n1 : n2);
+    if(diff != 0) {
+        return diff;
+    }
+
+    // one sequence is prefix of other one
+    return n1 < n2 ? -1 : (n1 > n2 ? 1 : 0);
+}
+
+// finds UTF-8 sequence in other sequence, returns NULL if it is not found
+const char* string_ref::find_bytes(const char* first, const char* last, const char* what, const char* what_last, bool cs) {
+    // found sequence always starts at beginning of character
+    return cs ? utf8_find(first, last, what, what_last) : utf8_find_nocase(first, last, what, what_last);
+}
+
+// finds last UTF-8 sequence in other sequence, returns NULL if it is not found
+const char* string_ref::rfind_bytes(const char* first, const char* last, const char* what, const char* what_last, bool cs) {
+    return cs ? utf8_rfind(first, last, what, what_last) : utf8_rfind_nocase(first, last, what, what_last);
+}
+
+}  // namespace core
+}  // namespace wq
@@ -4295,6 +4295,62 @@ const string::value_type::uc_properties string::value_type::sm_properties [] = {
     {13, 11, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
 };
 
+// special case mappings - zero terminated UTF-16 sequences, *_case_diff of
+// characters with *_case_special flag is index to this table, it is generated
+// by samples/tables_gen (option -s) from SpecialCasing.txt
+const unsigned short string::value_type::sm_special_case_map[] = {
+    0x53, 0x73, 0x0, 0x53, 0x53, 0x0, 0x69, 0x307,
+    0x0, 0x46, 0x66, 0x0, 0x46, 0x46, 0x0, 0x46,
+    0x69, 0x0, 0x46, 0x49, 0x0, 0x46, 0x6c, 0x0,
+    0x46, 0x4c, 0x0, 0x46, 0x66, 0x69, 0x0, 0x46,
+    0x46, 0x49, 0x0, 0x46, 0x66, 0x6c, 0x0, 0x46,
+    0x46, 0x4c, 0x0, 0x53, 0x74, 0x0, 0x53, 0x54,
+    0x0, 0x53, 0x54, 0x0, 0x535, 0x582, 0x0, 0x535,
+    0x552, 0x0, 0x544, 0x576, 0x0, 0x544, 0x546, 0x0,
+    0x544, 0x565, 0x0, 0x544, 0x535, 0x0, 0x544, 0x56b,
+    0x0, 0x544, 0x53b, 0x0, 0x54e, 0x576, 0x0, 0x54e,
+    0x546, 0x0, 0x544, 0x56d, 0x0, 0x544, 0x53d, 0x0,
+    0x2bc, 0x4e, 0x0, 0x2bc, 0x4e, 0x0, 0x399, 0x308,
+    0x301, 0x0, 0x399, 0x308, 0x301, 0x0, 0x3a5, 0x308,
+    0x301, 0x0, 0x3a5, 0x308, 0x301, 0x0, 0x4a, 0x30c,
+    0x0, 0x4a, 0x30c, 0x0, 0x48, 0x331, 0x0, 0x48,
+    0x331, 0x0, 0x54, 0x308, 0x0, 0x54, 0x308, 0x0,
+    0x57, 0x30a, 0x0, 0x57, 0x30a, 0x0, 0x59, 0x30a,
+    0x0, 0x59, 0x30a, 0x0, 0x41, 0x2be, 0x0, 0x41,
+    0x2be, 0x0, 0x3a5, 0x313, 0x0, 0x3a5, 0x313, 0x0,
+    0x3a5, 0x313, 0x300, 0x0, 0x3a5, 0x313, 0x300, 0x0,
+    0x3a5, 0x313, 0x301, 0x0, 0x3a5, 0x313, 0x301, 0x0,
+    0x3a5, 0x313, 0x342, 0x0, 0x3a5, 0x313, 0x342, 0x0,
+    0x391, 0x342, 0x0, 0x391, 0x342, 0x0, 0x397, 0x342,
+    0x0, 0x397, 0x342, 0x0, 0x399, 0x308, 0x300, 0x0,
+    0x399, 0x308, 0x300, 0x0, 0x399, 0x342, 0x0, 0x399,
+    0x342, 0x0, 0x399, 0x308, 0x342, 0x0, 0x399, 0x308,
+    0x342, 0x0, 0x3a5, 0x308, 0x300, 0x0, 0x3a5, 0x308,
+    0x300, 0x0, 0x3a1, 0x313, 0x0, 0x3a1, 0x313, 0x0,
+    0x3a5, 0x342, 0x0, 0x3a5, 0x342, 0x0, 0x3a5, 0x308,
+    0x342, 0x0, 0x3a5, 0x308, 0x342, 0x0, 0x3a9, 0x342,
+    0x0, 0x3a9, 0x342, 0x0, 0x1f08, 0x399, 0x0, 0x1f09,
+    0x399, 0x0, 0x1f0a, 0x399, 0x0, 0x1f0b, 0x399, 0x0,
+    0x1f0c, 0x399, 0x0, 0x1f0d, 0x399, 0x0, 0x1f0e, 0x399,
+    0x0, 0x1f0f, 0x399, 0x0, 0x1f0f, 0x399, 0x0, 0x1f28,
+    0x399, 0x0, 0x1f29, 0x399, 0x0, 0x1f2a, 0x399, 0x0,
+    0x1f2b, 0x399, 0x0, 0x1f2c, 0x399, 0x0, 0x1f2d, 0x399,
+    0x0, 0x1f2e, 0x399, 0x0, 0x1f2f, 0x399, 0x0, 0x1f2f,
+    0x399, 0x0, 0x1f68, 0x399, 0x0, 0x1f69, 0x399, 0x0,
+    0x1f6a, 0x399, 0x0, 0x1f6b, 0x399, 0x0, 0x1f6c, 0x399,
+    0x0, 0x1f6d, 0x399, 0x0, 0x1f6e, 0x399, 0x0, 0x1f6f,
+    0x399, 0x0, 0x1f6f, 0x399, 0x0, 0x391, 0x399, 0x0,
+    0x391, 0x399, 0x0, 0x397, 0x399, 0x0, 0x397, 0x399,
+    0x0, 0x3a9, 0x399, 0x0, 0x3a9, 0x399, 0x0, 0x1fba,
+    0x345, 0x0, 0x1fba, 0x399, 0x0, 0x386, 0x345, 0x0,
+    0x386, 0x399, 0x0, 0x1fca, 0x345, 0x0, 0x1fca, 0x399,
+    0x0, 0x389, 0x345, 0x0, 0x389, 0x399, 0x0, 0x1ffa,
+    0x345, 0x0, 0x1ffa, 0x399, 0x0, 0x38f, 0x345, 0x0,
+    0x38f, 0x399, 0x0, 0x391, 0x342, 0x345, 0x0, 0x391,
+    0x342, 0x399, 0x0, 0x397, 0x342, 0x345, 0x0, 0x397,
+    0x342, 0x399, 0x0, 0x3a9, 0x342, 0x345, 0x0, 0x3a9,
+    0x342, 0x399, 0x0,
+};
 
 }  // namespace core
 }  // namespace wq
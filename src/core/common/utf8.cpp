@@ -0,0 +1,1758 @@
+/****************************************************************************
+**
+** Copyright (C) 2010 Richard Kakaš.
+** All rights reserved.
+** Contact: Richard Kakaš <richard.kakas@gmail.com>
+**
+** @LICENSE_START@
+** GNU General Public License Usage
+** This file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** @LICENSE_END@
+**
+****************************************************************************/
+
+#include "wq/core/p/utf8.h"
+#include "wq/core/codepoint_set.h"
+
+#include <cstring>
+#include <algorithm>
+
+// characters are counted by comparing whole blocks of bytes - every byte which
+// is not trail byte (10xxxxxx, as signed char less than -64) starts character
+#if defined(__SSE2__)
+	#define WQ_UTF8_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define WQ_UTF8_SSE2 0
+#endif
+
+// AVX2 kernels are compiled always (with GCC) and chosen at runtime
+#if WQ_UTF8_SSE2 && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+		(__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+	#define WQ_UTF8_AVX2 1
+	#include <immintrin.h>
+#else
+	#define WQ_UTF8_AVX2 0
+#endif
+
+namespace wq {
+namespace core {
+
+typedef string::size_type size_type;
+
+// scalar versions for short parts and ends of blocks
+static inline size_type count_scalar(const char* ptr, const char* last) {
+	size_type ret_val = 0;
+	for( ; ptr != last; ptr++) {
+		ret_val += !utf8_is_trail(*ptr);
+	}
+	return ret_val;
+}
+
+static inline const char* skip_scalar(const char* ptr, const char* last, size_type& n) {
+	for( ; ptr != last; ptr++) {
+		if(!utf8_is_trail(*ptr)) {
+			if(n == 0) {
+				return ptr;
+			}
+			n--;
+		}
+	}
+	return last;
+}
+
+static inline const char* skip_back_scalar(const char* first, const char* ptr, size_type& n) {
+	while(ptr != first && n != 0) {
+		ptr--;
+		n -= !utf8_is_trail(*ptr);
+	}
+	return ptr;
+}
+
+// validation of UTF-8 sequences
+// returns length of valid sequence at ptr or 0 if it is invalid, in that
+// case invalid_len is set to length of its longest valid beginning (at least 1)
+static inline size_type sequence_scalar(const char* ptr, const char* last, size_type& invalid_len) {
+	wq::uint8 c = wq::uint8(*ptr);
+	invalid_len = 1;
+	if(c < 0x80) {
+		return 1;
+	}
+
+	// allowed range of second byte excludes overlong forms, surrogates and values above 0x10FFFF
+	size_type n = 0;
+	wq::uint8 low = 0x80, high = 0xBF;
+	if(c >= 0xC2 && c < 0xE0) {
+		n = 2;
+	}
+	else if(c >= 0xE0 && c < 0xF0) {
+		n = 3;
+		low = (c == 0xE0) ? 0xA0 : 0x80;
+		high = (c == 0xED) ? 0x9F : 0xBF;
+	}
+	else if(c >= 0xF0 && c < 0xF5) {
+		n = 4;
+		low = (c == 0xF0) ? 0x90 : 0x80;
+		high = (c == 0xF4) ? 0x8F : 0xBF;
+	}
+	else {
+		return 0;
+	}
+
+	for(size_type i = 1; i != n; i++, low = 0x80, high = 0xBF) {
+		if(ptr + i == last || wq::uint8(ptr[i]) < low || wq::uint8(ptr[i]) > high) {
+			invalid_len = i;
+			return 0;
+		}
+	}
+	return n;
+}
+
+static const char* validate_scalar(const char* ptr, const char* last, size_type& len) {
+	size_type invalid_len;
+	while(ptr != last) {
+#if WQ_UTF8_SSE2
+		// ASCII blocks are skipped at once
+		while(last - ptr >= 16 && _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr) ) ) == 0) {
+			ptr += 16;
+			len += 16;
+		}
+		if(ptr == last) {
+			break;
+		}
+#endif
+		size_type n = sequence_scalar(ptr, last, invalid_len);
+		if(n == 0) {
+			return ptr;
+		}
+		ptr += n;
+		len++;
+	}
+	return last;
+}
+
+// sequences with many false candidates are found by Two-Way algorithm of
+// Crochemore and Perrin, which needs only linear time and constant memory
+typedef string::difference_type difference_type;
+
+// bytes of sequence in searching direction, backward sequences are read from their end
+template<bool backward> class byte_seq {
+	public:
+		byte_seq(const char* first, const char* last) :
+				m_ptr( reinterpret_cast<const wq::uint8*>(backward ? last - 1 : first) ) { };
+		wq::uint8 operator[] (difference_type i) const {
+			return backward ? m_ptr[-i] : m_ptr[i];
+		};
+
+	private:
+		const wq::uint8* m_ptr;
+};
+
+// computes maximal suffix of what (by given order of bytes) and its period
+template<bool backward>
+static difference_type max_suffix(const byte_seq<backward>& what, difference_type n, bool reversed, difference_type& period) {
+	difference_type ms = -1, j = 0, k = 1;
+	period = 1;
+	while(j + k < n) {
+		wq::uint8 a = what[j + k];
+		wq::uint8 b = what[ms + k];
+		if(a == b) {
+			if(k != period) {
+				k++;
+			}
+			else {
+				j += period;
+				k = 1;
+			}
+		}
+		else if((a < b) != reversed) {
+			j += k;
+			k = 1;
+			period = j - ms;
+		}
+		else {
+			ms = j;
+			j = ms + 1;
+			k = period = 1;
+		}
+	}
+	return ms;
+}
+
+// returns distance of match from beginning (or end if backward) of text or -1
+template<bool backward>
+static difference_type two_way(const char* first, const char* last, const char* what, size_type n) {
+	const byte_seq<backward> x(what, what + n);
+	const byte_seq<backward> y(first, last);
+	difference_type m = difference_type(n);
+	difference_type stop = difference_type(last - first) - m;
+
+	// critical factorization of what
+	difference_type p, q;
+	difference_type i = max_suffix(x, m, false, p);
+	difference_type j = max_suffix(x, m, true, q);
+	difference_type ell = i > j ? i : j;
+	difference_type period = i > j ? p : q;
+
+	for(i = 0; i <= ell && x[i] == x[i + period]; i++) { }
+	if(i > ell) {
+		// what is periodic, already matched prefix is remembered
+		difference_type memory = -1;
+		for(j = 0; j <= stop; ) {
+			i = (ell > memory ? ell : memory) + 1;
+			while(i < m && x[i] == y[i + j]) {
+				i++;
+			}
+			if(i < m) {
+				j += i - ell;
+				memory = -1;
+				continue;
+			}
+			for(i = ell; i > memory && x[i] == y[i + j]; i--) { }
+			if(i <= memory) {
+				return j;
+			}
+			j += period;
+			memory = m - period - 1;
+		}
+	}
+	else {
+		period = (ell + 1 > m - ell - 1 ? ell + 1 : m - ell - 1) + 1;
+		for(j = 0; j <= stop; ) {
+			i = ell + 1;
+			while(i < m && x[i] == y[i + j]) {
+				i++;
+			}
+			if(i < m) {
+				j += i - ell;
+				continue;
+			}
+			for(i = ell; i >= 0 && x[i] == y[i + j]; i--) { }
+			if(i < 0) {
+				return j;
+			}
+			j += period;
+		}
+	}
+	return -1;
+}
+
+static const char* find_two_way(const char* first, const char* last, const char* what, size_type n) {
+	difference_type j = two_way<false>(first, last, what, n);
+	return j < 0 ? NULL : first + j;
+}
+
+// reverse search is forward search of reversed what in reversed text
+static const char* rfind_two_way(const char* first, const char* last, const char* what, size_type n) {
+	difference_type j = two_way<true>(first, last, what, n);
+	return j < 0 ? NULL : last - j - n;
+}
+
+// candidates of block search are checked whole, when there is too many of them
+// (repetitive text) searching continues by Two-Way algorithm
+static inline bool too_many_candidates(size_type candidates, size_type n, const char* start, const char* ptr) {
+	return candidates * n > 4 * size_type(ptr - start) + 4096;
+}
+
+// searching of byte sequence (at least 2 bytes long) in other one
+static const char* find_scalar(const char* first, const char* last, const char* what, size_type n) {
+	const char* start = first;
+	const char* stop = last - n + 1;
+	size_type candidates = 0;
+	while(first < stop) {
+		first = static_cast<const char*>( memchr(first, *what, stop - first) );
+		if(first == NULL) {
+			return NULL;
+		}
+		if(memcmp(first + 1, what + 1, n - 1) == 0) {
+			return first;
+		}
+		if(too_many_candidates(++candidates, n, start, first)) {
+			return find_two_way(first, last, what, n);
+		}
+		first++;
+	}
+	return NULL;
+}
+
+// backward version of find_scalar(), last match is returned
+static const char* rfind_scalar(const char* first, const char* last, const char* what, size_type n) {
+	const char* stop = last - n + 1;
+	size_type candidates = 0;
+	while(stop != first) {
+		stop--;
+		if(*stop != *what) {
+			continue;
+		}
+		if(memcmp(stop + 1, what + 1, n - 1) == 0) {
+			return stop;
+		}
+		if(too_many_candidates(++candidates, n, stop, last)) {
+			return rfind_two_way(first, stop + n - 1, what, n);
+		}
+	}
+	return NULL;
+}
+
+#if WQ_UTF8_SSE2
+static size_type count_sse2(const char* ptr, const char* last) {
+	const __m128i trail_max = _mm_set1_epi8(-65);
+	size_type ret_val = 0;
+	while(last - ptr >= 16) {
+		// byte counters can hold at most 255 blocks
+		__m128i counts = _mm_setzero_si128();
+		const char* stop = ptr + ((size_type(last - ptr) / 16 > 255) ? 255 * 16 : (size_type(last - ptr) / 16) * 16);
+		for( ; ptr != stop; ptr += 16) {
+			__m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr) );
+			counts = _mm_sub_epi8( counts, _mm_cmpgt_epi8(block, trail_max) );
+		}
+		__m128i sums = _mm_sad_epu8( counts, _mm_setzero_si128() );
+		ret_val += size_type( _mm_cvtsi128_si32(sums) ) + size_type( _mm_cvtsi128_si32( _mm_srli_si128(sums, 8) ) );
+	}
+	return ret_val + count_scalar(ptr, last);
+}
+
+static inline int block_leads_sse2(const char* ptr) {
+	__m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr) );
+	return __builtin_popcount( _mm_movemask_epi8( _mm_cmpgt_epi8(block, _mm_set1_epi8(-65)) ) );
+}
+
+static const char* skip_sse2(const char* ptr, const char* last, size_type n) {
+	while(last - ptr >= 16) {
+		size_type leads = block_leads_sse2(ptr);
+		if(leads > n) {
+			break;
+		}
+		n -= leads;
+		ptr += 16;
+	}
+	return skip_scalar(ptr, last, n);
+}
+
+static const char* skip_back_sse2(const char* first, const char* ptr, size_type n) {
+	while(ptr - first >= 16) {
+		size_type leads = block_leads_sse2(ptr - 16);
+		if(leads >= n) {
+			break;
+		}
+		n -= leads;
+		ptr -= 16;
+	}
+	return skip_back_scalar(first, ptr, n);
+}
+
+// candidates are positions where both first and last byte of what match
+static const char* find_sse2(const char* first, const char* last, const char* what, size_type n) {
+	const __m128i first_byte = _mm_set1_epi8(what[0]);
+	const __m128i last_byte = _mm_set1_epi8(what[n - 1]);
+	const char* start = first;
+	const char* stop = last - n + 1;
+	size_type candidates = 0;
+	for( ; stop - first >= 16; first += 16) {
+		__m128i block_first = _mm_loadu_si128( reinterpret_cast<const __m128i*>(first) );
+		__m128i block_last = _mm_loadu_si128( reinterpret_cast<const __m128i*>(first + n - 1) );
+		unsigned int mask = _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8(block_first, first_byte),
+		                                                       _mm_cmpeq_epi8(block_last, last_byte) ) );
+		for( ; mask != 0; mask &= mask - 1) {
+			const char* candidate = first + __builtin_ctz(mask);
+			if(memcmp(candidate + 1, what + 1, n - 2) == 0) {
+				return candidate;
+			}
+			candidates++;
+		}
+		if(too_many_candidates(candidates, n, start, first)) {
+			return find_two_way(first, last, what, n);
+		}
+	}
+	return find_scalar(first, last, what, n);
+}
+
+// blocks are checked from end of text and candidates from end of block
+static const char* rfind_sse2(const char* first, const char* last, const char* what, size_type n) {
+	const __m128i first_byte = _mm_set1_epi8(what[0]);
+	const __m128i last_byte = _mm_set1_epi8(what[n - 1]);
+	const char* stop = last - n + 1;
+	size_type candidates = 0;
+	while(stop - first >= 16) {
+		stop -= 16;
+		__m128i block_first = _mm_loadu_si128( reinterpret_cast<const __m128i*>(stop) );
+		__m128i block_last = _mm_loadu_si128( reinterpret_cast<const __m128i*>(stop + n - 1) );
+		unsigned int mask = _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8(block_first, first_byte),
+		                                                       _mm_cmpeq_epi8(block_last, last_byte) ) );
+		while(mask != 0) {
+			int bit = 31 - __builtin_clz(mask);
+			const char* candidate = stop + bit;
+			if(n < 3 || memcmp(candidate + 1, what + 1, n - 2) == 0) {
+				return candidate;
+			}
+			mask ^= 1u << bit;
+			candidates++;
+		}
+		if(too_many_candidates(candidates, n, stop, last)) {
+			return rfind_two_way(first, stop + n - 1, what, n);
+		}
+	}
+	return rfind_scalar(first, stop + n - 1, what, n);
+}
+#endif
+
+#if WQ_UTF8_AVX2
+__attribute__((target("avx2")))
+static size_type count_avx2(const char* ptr, const char* last) {
+	const __m256i trail_max = _mm256_set1_epi8(-65);
+	size_type ret_val = 0;
+	while(last - ptr >= 32) {
+		__m256i counts = _mm256_setzero_si256();
+		const char* stop = ptr + ((size_type(last - ptr) / 32 > 255) ? 255 * 32 : (size_type(last - ptr) / 32) * 32);
+		for( ; ptr != stop; ptr += 32) {
+			__m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+			counts = _mm256_sub_epi8( counts, _mm256_cmpgt_epi8(block, trail_max) );
+		}
+		__m256i sums = _mm256_sad_epu8( counts, _mm256_setzero_si256() );
+		__m128i half = _mm_add_epi64( _mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1) );
+		ret_val += size_type( _mm_cvtsi128_si32(half) ) + size_type( _mm_cvtsi128_si32( _mm_srli_si128(half, 8) ) );
+	}
+	return ret_val + count_sse2(ptr, last);
+}
+
+__attribute__((target("avx2")))
+static inline int block_leads_avx2(const char* ptr) {
+	__m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+	return __builtin_popcount( _mm256_movemask_epi8( _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-65)) ) );
+}
+
+__attribute__((target("avx2")))
+static const char* skip_avx2(const char* ptr, const char* last, size_type n) {
+	while(last - ptr >= 32) {
+		size_type leads = block_leads_avx2(ptr);
+		if(leads > n) {
+			break;
+		}
+		n -= leads;
+		ptr += 32;
+	}
+	return skip_sse2(ptr, last, n);
+}
+
+__attribute__((target("avx2")))
+static const char* skip_back_avx2(const char* first, const char* ptr, size_type n) {
+	while(ptr - first >= 32) {
+		size_type leads = block_leads_avx2(ptr - 32);
+		if(leads >= n) {
+			break;
+		}
+		n -= leads;
+		ptr -= 32;
+	}
+	return skip_back_sse2(first, ptr, n);
+}
+
+__attribute__((target("avx2")))
+static inline unsigned int find_candidates_avx2(const char* ptr, size_type n, __m256i first_byte, __m256i last_byte) {
+	__m256i block_first = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+	__m256i block_last = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr + n - 1) );
+	return _mm256_movemask_epi8( _mm256_and_si256( _mm256_cmpeq_epi8(block_first, first_byte),
+	                                               _mm256_cmpeq_epi8(block_last, last_byte) ) );
+}
+
+__attribute__((target("avx2")))
+static const char* find_avx2(const char* first, const char* last, const char* what, size_type n) {
+	const __m256i first_byte = _mm256_set1_epi8(what[0]);
+	const __m256i last_byte = _mm256_set1_epi8(what[n - 1]);
+	const char* start = first;
+	const char* stop = last - n + 1;
+	size_type candidates = 0;
+	while(stop - first >= 64) {
+		// two blocks at once, most of them have no candidates
+		unsigned int mask1 = find_candidates_avx2(first, n, first_byte, last_byte);
+		unsigned int mask2 = find_candidates_avx2(first + 32, n, first_byte, last_byte);
+		if((mask1 | mask2) == 0) {
+			first += 64;
+			continue;
+		}
+		wq::uint64 mask = wq::uint64(mask1) | (wq::uint64(mask2) << 32);
+		for( ; mask != 0; mask &= mask - 1) {
+			const char* candidate = first + __builtin_ctzll(mask);
+			if(memcmp(candidate + 1, what + 1, n - 2) == 0) {
+				return candidate;
+			}
+			candidates++;
+		}
+		first += 64;
+		if(too_many_candidates(candidates, n, start, first)) {
+			return find_two_way(first, last, what, n);
+		}
+	}
+	return find_sse2(first, last, what, n);
+}
+
+__attribute__((target("avx2")))
+static const char* rfind_avx2(const char* first, const char* last, const char* what, size_type n) {
+	const __m256i first_byte = _mm256_set1_epi8(what[0]);
+	const __m256i last_byte = _mm256_set1_epi8(what[n - 1]);
+	const char* stop = last - n + 1;
+	size_type candidates = 0;
+	while(stop - first >= 64) {
+		stop -= 64;
+		unsigned int mask1 = find_candidates_avx2(stop, n, first_byte, last_byte);
+		unsigned int mask2 = find_candidates_avx2(stop + 32, n, first_byte, last_byte);
+		if((mask1 | mask2) == 0) {
+			continue;
+		}
+		wq::uint64 mask = wq::uint64(mask1) | (wq::uint64(mask2) << 32);
+		while(mask != 0) {
+			int bit = 63 - __builtin_clzll(mask);
+			const char* candidate = stop + bit;
+			if(n < 3 || memcmp(candidate + 1, what + 1, n - 2) == 0) {
+				return candidate;
+			}
+			mask ^= wq::uint64(1) << bit;
+			candidates++;
+		}
+		if(too_many_candidates(candidates, n, stop, last)) {
+			return rfind_two_way(first, stop + n - 1, what, n);
+		}
+	}
+	return rfind_sse2(first, stop + n - 1, what, n);
+}
+
+// lookup tables of validation, every bit is one kind of error which is found
+// when all three tables (by first byte's nibbles and second byte's high nibble) set it
+enum {
+	err_too_short = 1 << 0,  // lead byte followed by lead byte or ASCII
+	err_too_long = 1 << 1,   // ASCII followed by trail byte
+	err_overlong_3 = 1 << 2,
+	err_too_large = 1 << 3,
+	err_surrogate = 1 << 4,
+	err_overlong_2 = 1 << 5,
+	err_too_large_1000 = 1 << 6,
+	err_overlong_4 = 1 << 6,
+	err_two_trails = 1 << 7,  // two trail bytes, they are valid only after 3 or 4 byte lead
+	err_carry = err_too_short | err_too_long | err_two_trails
+};
+
+__attribute__((target("avx2")))
+static inline __m256i table_avx2(char b0, char b1, char b2, char b3, char b4, char b5, char b6, char b7,
+                                 char b8, char b9, char b10, char b11, char b12, char b13, char b14, char b15) {
+	return _mm256_setr_epi8(b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15,
+	                        b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i high_nibbles_avx2(__m256i v) {
+	return _mm256_and_si256( _mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F) );
+}
+
+// returns non zero bytes where block does not continue correctly after prev block
+__attribute__((target("avx2")))
+static inline __m256i block_errors_avx2(__m256i block, __m256i prev_block) {
+	const __m256i byte_1_high = table_avx2(
+		err_too_long, err_too_long, err_too_long, err_too_long,
+		err_too_long, err_too_long, err_too_long, err_too_long,
+		err_two_trails, err_two_trails, err_two_trails, err_two_trails,
+		err_too_short | err_overlong_2,
+		err_too_short,
+		err_too_short | err_overlong_3 | err_surrogate,
+		char(err_too_short | err_too_large | err_too_large_1000 | err_overlong_4) );
+	const __m256i byte_1_low = table_avx2(
+		char(err_carry | err_overlong_3 | err_overlong_2 | err_overlong_4),
+		char(err_carry | err_overlong_2),
+		char(err_carry), char(err_carry),
+		char(err_carry | err_too_large),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000 | err_surrogate),
+		char(err_carry | err_too_large | err_too_large_1000),
+		char(err_carry | err_too_large | err_too_large_1000) );
+	const __m256i byte_2_high = table_avx2(
+		err_too_short, err_too_short, err_too_short, err_too_short,
+		err_too_short, err_too_short, err_too_short, err_too_short,
+		char(err_too_long | err_overlong_2 | err_two_trails | err_overlong_3 | err_too_large_1000 | err_overlong_4),
+		char(err_too_long | err_overlong_2 | err_two_trails | err_overlong_3 | err_too_large),
+		char(err_too_long | err_overlong_2 | err_two_trails | err_surrogate | err_too_large),
+		char(err_too_long | err_overlong_2 | err_two_trails | err_surrogate | err_too_large),
+		err_too_short, err_too_short, err_too_short, err_too_short );
+
+	// previous 1, 2 and 3 bytes for every byte of block
+	__m256i shifted = _mm256_permute2x128_si256(prev_block, block, 0x21);
+	__m256i prev1 = _mm256_alignr_epi8(block, shifted, 15);
+	__m256i prev2 = _mm256_alignr_epi8(block, shifted, 14);
+	__m256i prev3 = _mm256_alignr_epi8(block, shifted, 13);
+
+	__m256i special = _mm256_and_si256(
+		_mm256_and_si256( _mm256_shuffle_epi8( byte_1_high, high_nibbles_avx2(prev1) ),
+		                  _mm256_shuffle_epi8( byte_1_low, _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)) ) ),
+		_mm256_shuffle_epi8( byte_2_high, high_nibbles_avx2(block) ) );
+
+	// third and fourth bytes of sequences have to be trail bytes (checked by err_two_trails)
+	__m256i must_be_trail = _mm256_or_si256( _mm256_subs_epu8( prev2, _mm256_set1_epi8(char(0xE0 - 0x80)) ),
+	                                         _mm256_subs_epu8( prev3, _mm256_set1_epi8(char(0xF0 - 0x80)) ) );
+	must_be_trail = _mm256_and_si256( must_be_trail, _mm256_set1_epi8(char(0x80)) );
+	return _mm256_xor_si256(must_be_trail, special);
+}
+
+__attribute__((target("avx2")))
+static const char* validate_avx2(const char* ptr, const char* last, size_type& len) {
+	const char* first = ptr;
+	const __m256i trail_max = _mm256_set1_epi8(-65);
+	__m256i prev_block = _mm256_setzero_si256();
+	size_type count = 0;
+	while(last - ptr >= 32) {
+		__m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+		// blocks of ASCII are valid if previous block has not ended in middle of sequence
+		if(_mm256_movemask_epi8(block) != 0 || _mm256_movemask_epi8(prev_block) != 0) {
+			if(!_mm256_testz_si256( block_errors_avx2(block, prev_block), block_errors_avx2(block, prev_block) )) {
+				break;
+			}
+		}
+		count += __builtin_popcount( _mm256_movemask_epi8( _mm256_cmpgt_epi8(block, trail_max) ) );
+		prev_block = block;
+		ptr += 32;
+	}
+
+	// last character before ptr can continue after it, so it is checked again with rest
+	if(ptr != first) {
+		ptr--;
+		for(int i = 0; i != 3 && utf8_is_trail(*ptr); i++) {
+			ptr--;
+		}
+		count--;
+	}
+	len += count;
+	return validate_scalar(ptr, last, len);
+}
+
+// it can be called before constructors of libgcc, so CPU info is initialized here
+static bool cpu_has_avx2() {
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+}
+
+// false until static initialization is done, SSE2 is used till then
+static const bool sm_has_avx2 = cpu_has_avx2();
+#endif
+
+// skips n characters, returns last if there is not enough characters
+const char* utf8_skip(const char* ptr, const char* last, string::size_type n) {
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return skip_avx2(ptr, last, n);
+	}
+#endif
+#if WQ_UTF8_SSE2
+	return skip_sse2(ptr, last, n);
+#else
+	return skip_scalar(ptr, last, n);
+#endif
+}
+
+// skips n characters backwards from ptr, returns first if there is not enough characters
+const char* utf8_skip_back(const char* first, const char* ptr, string::size_type n) {
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return skip_back_avx2(first, ptr, n);
+	}
+#endif
+#if WQ_UTF8_SSE2
+	return skip_back_sse2(first, ptr, n);
+#else
+	return skip_back_scalar(first, ptr, n);
+#endif
+}
+
+// counts characters in sequence
+string::size_type utf8_count(const char* ptr, const char* last) {
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return count_avx2(ptr, last);
+	}
+#endif
+#if WQ_UTF8_SSE2
+	return count_sse2(ptr, last);
+#else
+	return count_scalar(ptr, last);
+#endif
+}
+
+/*!
+	\brief Validates UTF-8 sequence.
+
+	Returns pointer to first invalid byte in [\a ptr, \a last) or \a last
+	if whole sequence is valid. Number of characters before returned position
+	is added to \a len. Overlong forms, surrogates and values above 0x10FFFF are
+	invalid as well as sequences which are cut by \a last.
+
+	With AVX2 every 32 byte block is checked by table lookups of its nibbles,
+	so multibyte text is validated without branching on every character. Other
+	processors validate it character by character and skip only ASCII blocks.
+*/
+const char* utf8_validate(const char* ptr, const char* last, string::size_type& len) {
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return validate_avx2(ptr, last, len);
+	}
+#endif
+	return validate_scalar(ptr, last, len);
+}
+
+// returns length of invalid sequence at ptr, that is its longest valid beginning
+string::size_type utf8_invalid_length(const char* ptr, const char* last) {
+	size_type ret_val;
+	sequence_scalar(ptr, last, ret_val);
+	return ret_val;
+}
+
+/*!
+	\brief Finds byte sequence [\a what, \a what_last) in [\a first, \a last).
+
+	Returns pointer to first occurrence or NULL. First byte of \a what is
+	looked up by memchr() while it is rare in text, then blocks of 16 (SSE2)
+	or 32 (AVX2) positions are checked at once for matching first and last byte
+	of \a what and only these candidates are compared whole. If there are
+	too many false candidates (repetitive text), searching continues by Two-Way
+	algorithm, so it never takes more than linear time. Since UTF-8 is
+	self-synchronizing, every found valid sequence starts at beginning of character.
+*/
+const char* utf8_find(const char* first, const char* last, const char* what, const char* what_last) {
+	size_type n = what_last - what;
+	if(n == 0) {
+		return first;
+	}
+	if(size_type(last - first) < n) {
+		return NULL;
+	}
+	if(n == 1) {
+		return static_cast<const char*>( memchr(first, *what, last - first) );
+	}
+
+	// rare first byte is found fastest by memchr, block search is used when it is frequent
+	const char* stop = last - n + 1;
+	bool is_rare = true;
+	while(is_rare) {
+		const char* found = static_cast<const char*>( memchr(first, *what, stop - first) );
+		if(found == NULL) {
+			return NULL;
+		}
+		if(memcmp(found + 1, what + 1, n - 1) == 0) {
+			return found;
+		}
+		is_rare = found - first >= 256;
+		first = found + 1;
+	}
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return find_avx2(first, last, what, n);
+	}
+#endif
+#if WQ_UTF8_SSE2
+	return find_sse2(first, last, what, n);
+#else
+	return find_scalar(first, last, what, n);
+#endif
+}
+
+/*!
+	\brief Finds last occurrence of byte sequence \a what in other one.
+
+	This is backward version of utf8_find(), it uses the same engine. Blocks
+	are searched from end of text for positions where both first and last
+	byte of \a what match, and repetitive texts are searched by Two-Way
+	algorithm applied to reversed sequences.
+*/
+const char* utf8_rfind(const char* first, const char* last, const char* what, const char* what_last) {
+	size_type n = what_last - what;
+	if(n == 0) {
+		return last;
+	}
+	if(size_type(last - first) < n) {
+		return NULL;
+	}
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return rfind_avx2(first, last, what, n);
+	}
+#endif
+#if WQ_UTF8_SSE2
+	return rfind_sse2(first, last, what, n);
+#else
+	return rfind_scalar(first, last, what, n);
+#endif
+}
+
+// case insensitive kernels
+// characters are compared by simple case folding (one character to one character)
+static inline wq::uint32 fold_char(wq::uint32 c) {
+	if(c < 0x80) {
+		return (c - 'A' < 26) ? c + 32 : c;
+	}
+	return c + string::value_type::get_uc_properties(c)->case_fold_diff;
+}
+
+static inline wq::uint32 decode_char(const char* ptr) {
+	return string::cp_iterator(ptr, ptr).utf32();
+}
+
+static inline size_type char_bytes(const char* ptr) {
+	return string::cp_iterator(ptr, ptr).bytes();
+}
+
+static inline size_type encode_char(wq::uint32 c, char* out) {
+	if(c < 0x80) {
+		out[0] = char(c);
+		return 1;
+	}
+	if(c < 0x800) {
+		out[0] = char(0xC0 | (c >> 6));
+		out[1] = char(0x80 | (c & 0x3F));
+		return 2;
+	}
+	if(c < 0x10000) {
+		out[0] = char(0xE0 | (c >> 12));
+		out[1] = char(0x80 | ((c >> 6) & 0x3F));
+		out[2] = char(0x80 | (c & 0x3F));
+		return 3;
+	}
+	out[0] = char(0xF0 | (c >> 18));
+	out[1] = char(0x80 | ((c >> 12) & 0x3F));
+	out[2] = char(0x80 | ((c >> 6) & 0x3F));
+	out[3] = char(0x80 | (c & 0x3F));
+	return 4;
+}
+
+// table of characters which are folded to other ones, sorted by folded character,
+// it is built on first use from Unicode properties and lives until end of process
+struct fold_table {
+	wq::uint32* m_folded;
+	wq::uint32* m_chars;
+	size_type m_count;
+	wq::uint32 m_last;
+};
+
+static const fold_table* new_fold_table() {
+	// last character with case folding is in Deseret block
+	const wq::uint32 last_folded = 0x10500;
+	fold_table* table = new fold_table;
+	table->m_count = 0;
+	table->m_last = 0;
+	for(wq::uint32 c = 0; c != last_folded; c++) {
+		table->m_count += fold_char(c) != c;
+	}
+	table->m_folded = new wq::uint32[table->m_count];
+	table->m_chars = new wq::uint32[table->m_count];
+
+	// counting sort would be overkill, there is less than thousand of them
+	size_type n = 0;
+	for(wq::uint32 c = 0; c != last_folded; c++) {
+		wq::uint32 folded = fold_char(c);
+		if(folded == c) {
+			continue;
+		}
+		size_type i = n++;
+		for( ; i != 0 && table->m_folded[i - 1] > folded; i--) {
+			table->m_folded[i] = table->m_folded[i - 1];
+			table->m_chars[i] = table->m_chars[i - 1];
+		}
+		table->m_folded[i] = folded;
+		table->m_chars[i] = c;
+		table->m_last = std::max(table->m_last, std::max(c, folded));
+	}
+	return table;
+}
+
+static const fold_table& get_fold_table() {
+	static const fold_table* table = new_fold_table();
+	return *table;
+}
+
+// all encodings of characters which are folded to c (c included), returns their count
+// or 0 if there are more than max of them
+static size_type fold_variants(wq::uint32 c, char (*variants)[4], size_type max) {
+	wq::uint32 chars[4];
+	size_type n = utf8_case_variants(c, chars, max < 4 ? max : 4);
+	for(size_type i = 0; i != n; i++) {
+		encode_char(chars[i], variants[i]);
+	}
+	return n;
+}
+
+// compares folded characters of text at ptr with already folded sequence what,
+// returns end of matched text or NULL
+static const char* match_folded(const char* ptr, const char* last, const char* what, const char* what_last) {
+	while(what != what_last) {
+		if(ptr == last) {
+			return NULL;
+		}
+		if(*ptr == *what && wq::uint8(*ptr) < 0x80) {
+			ptr++;
+			what++;
+			continue;
+		}
+		size_type n = char_bytes(ptr);
+		size_type what_n = char_bytes(what);
+		if(size_type(last - ptr) < n || fold_char( decode_char(ptr) ) != decode_char(what)) {
+			return NULL;
+		}
+		ptr += n;
+		what += what_n;
+	}
+	return ptr;
+}
+
+// set of at most 4 bytes, if it has only one byte or two bytes differing
+// in one bit (typical for lower and upper case), it is checked by one compare
+// of byte with m_bit set
+struct byte_set {
+	char m_bytes[4];
+	char m_bit;
+	bool m_single;
+};
+
+// prefilter checks two bytes at fixed offsets from beginning of match
+struct fold_prefilter {
+	byte_set m_first;
+	byte_set m_second;
+	size_type m_first_at;
+	size_type m_second_at;
+};
+
+static inline bool in_set(char c, const byte_set& set) {
+	if(set.m_single) {
+		return char(c | set.m_bit) == set.m_bytes[0];
+	}
+	return c == set.m_bytes[0] || c == set.m_bytes[1] || c == set.m_bytes[2] || c == set.m_bytes[3];
+}
+
+// scalar version of prefilter, candidate is verified by match_folded
+static const char* find_folded_scalar(const char* first, const char* last, const char* what, const char* what_last,
+                                      const fold_prefilter& filter) {
+	for( ; size_type(last - first) > filter.m_second_at; first++) {
+		if(in_set(first[filter.m_first_at], filter.m_first) && in_set(first[filter.m_second_at], filter.m_second) &&
+		   !utf8_is_trail(*first) && match_folded(first, last, what, what_last) != NULL) {
+			return first;
+		}
+	}
+	return NULL;
+}
+
+// backward version of prefilter, start positions before stop are checked from the end
+static const char* rfind_folded_scalar(const char* first, const char* stop, const char* last, const char* what,
+                                       const char* what_last, const fold_prefilter& filter) {
+	while(stop != first) {
+		stop--;
+		if(size_type(last - stop) > filter.m_second_at && in_set(stop[filter.m_first_at], filter.m_first) &&
+		   in_set(stop[filter.m_second_at], filter.m_second) && !utf8_is_trail(*stop) &&
+		   match_folded(stop, last, what, what_last) != NULL) {
+			return stop;
+		}
+	}
+	return NULL;
+}
+
+#if WQ_UTF8_SSE2
+// byte set broadcasted to vectors
+struct byte_set_sse2 {
+	__m128i m_bytes[4];
+	__m128i m_bit;
+
+	byte_set_sse2(const byte_set& set) : m_bit( _mm_set1_epi8(set.m_bit) ) {
+		for(int i = 0; i != 4; i++) {
+			m_bytes[i] = _mm_set1_epi8(set.m_bytes[i]);
+		}
+	}
+
+	// single is template parameter so it is not tested in loops
+	template<bool single> __m128i mask(const char* ptr) const {
+		__m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr) );
+		if(single) {
+			return _mm_cmpeq_epi8( _mm_or_si128(block, m_bit), m_bytes[0] );
+		}
+		return _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8(block, m_bytes[0]), _mm_cmpeq_epi8(block, m_bytes[1]) ),
+		                     _mm_or_si128( _mm_cmpeq_epi8(block, m_bytes[2]), _mm_cmpeq_epi8(block, m_bytes[3]) ) );
+	}
+};
+
+template<bool single_first, bool single_second>
+static const char* find_folded_sse2(const char* first, const char* last, const char* what, const char* what_last,
+                                    const fold_prefilter& filter) {
+	const byte_set_sse2 first_set(filter.m_first), second_set(filter.m_second);
+	const size_type first_at = filter.m_first_at, second_at = filter.m_second_at;
+
+	// while bytes of first set are rare, only they are searched
+	for(const char* prev = first; size_type(last - first) >= second_at + 16; first += 16) {
+		unsigned int bits = _mm_movemask_epi8( first_set.mask<single_first>(first + first_at) );
+		if(bits == 0) {
+			continue;
+		}
+		for( ; bits != 0; bits &= bits - 1) {
+			const char* start = first + __builtin_ctz(bits);
+			if(in_set(start[second_at], filter.m_second) && !utf8_is_trail(*start) &&
+			   match_folded(start, last, what, what_last) != NULL) {
+				return start;
+			}
+		}
+		if(first - prev < 256) {
+			first += 16;
+			break;
+		}
+		prev = first;
+	}
+
+	for( ; size_type(last - first) >= second_at + 16; first += 16) {
+		__m128i mask = _mm_and_si128( first_set.mask<single_first>(first + first_at),
+		                              second_set.mask<single_second>(first + second_at) );
+		for(unsigned int bits = _mm_movemask_epi8(mask); bits != 0; bits &= bits - 1) {
+			const char* start = first + __builtin_ctz(bits);
+			if(!utf8_is_trail(*start) && match_folded(start, last, what, what_last) != NULL) {
+				return start;
+			}
+		}
+	}
+	return find_folded_scalar(first, last, what, what_last, filter);
+}
+
+static const char* find_folded_sse2(const char* first, const char* last, const char* what, const char* what_last,
+                                    const fold_prefilter& filter) {
+	if(filter.m_first.m_single) {
+		return filter.m_second.m_single ? find_folded_sse2<true, true>(first, last, what, what_last, filter) :
+		                                  find_folded_sse2<true, false>(first, last, what, what_last, filter);
+	}
+	return filter.m_second.m_single ? find_folded_sse2<false, true>(first, last, what, what_last, filter) :
+	                                  find_folded_sse2<false, false>(first, last, what, what_last, filter);
+}
+
+template<bool single_first, bool single_second>
+static const char* rfind_folded_sse2(const char* first, const char* last, const char* what, const char* what_last,
+                                     const fold_prefilter& filter) {
+	const byte_set_sse2 first_set(filter.m_first), second_set(filter.m_second);
+	const size_type first_at = filter.m_first_at, second_at = filter.m_second_at;
+
+	// bytes at second_at of all positions before stop are in text
+	const char* stop = size_type(last - first) > second_at ? last - second_at : first;
+	while(stop - first >= 16) {
+		stop -= 16;
+		__m128i mask = _mm_and_si128( first_set.mask<single_first>(stop + first_at),
+		                              second_set.mask<single_second>(stop + second_at) );
+		for(unsigned int bits = _mm_movemask_epi8(mask); bits != 0; ) {
+			int bit = 31 - __builtin_clz(bits);
+			const char* start = stop + bit;
+			if(!utf8_is_trail(*start) && match_folded(start, last, what, what_last) != NULL) {
+				return start;
+			}
+			bits ^= 1u << bit;
+		}
+	}
+	return rfind_folded_scalar(first, stop, last, what, what_last, filter);
+}
+
+static const char* rfind_folded_sse2(const char* first, const char* last, const char* what, const char* what_last,
+                                     const fold_prefilter& filter) {
+	if(filter.m_first.m_single) {
+		return filter.m_second.m_single ? rfind_folded_sse2<true, true>(first, last, what, what_last, filter) :
+		                                  rfind_folded_sse2<true, false>(first, last, what, what_last, filter);
+	}
+	return filter.m_second.m_single ? rfind_folded_sse2<false, true>(first, last, what, what_last, filter) :
+	                                  rfind_folded_sse2<false, false>(first, last, what, what_last, filter);
+}
+
+// returns number of equal bytes at beginning of both blocks
+static inline size_type equal_bytes_sse2(const char* ptr1, const char* ptr2) {
+	__m128i block1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr1) );
+	__m128i block2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr2) );
+	unsigned int diff = ~_mm_movemask_epi8( _mm_cmpeq_epi8(block1, block2) ) & 0xFFFF;
+	return diff == 0 ? 16 : __builtin_ctz(diff);
+}
+
+// ASCII bytes of both blocks are folded and compared, returns false if
+// they are not equal or some of them is not ASCII
+static inline bool equal_ascii_sse2(const char* ptr1, const char* ptr2) {
+	__m128i block1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr1) );
+	__m128i block2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr2) );
+	if(_mm_movemask_epi8( _mm_or_si128(block1, block2) ) != 0) {
+		return false;
+	}
+	const __m128i before_a = _mm_set1_epi8('A' - 1);
+	const __m128i after_z = _mm_set1_epi8('Z' + 1);
+	const __m128i case_bit = _mm_set1_epi8(0x20);
+	__m128i upper1 = _mm_and_si128( _mm_cmpgt_epi8(block1, before_a), _mm_cmplt_epi8(block1, after_z) );
+	__m128i upper2 = _mm_and_si128( _mm_cmpgt_epi8(block2, before_a), _mm_cmplt_epi8(block2, after_z) );
+	block1 = _mm_or_si128( block1, _mm_and_si128(upper1, case_bit) );
+	block2 = _mm_or_si128( block2, _mm_and_si128(upper2, case_bit) );
+	return _mm_movemask_epi8( _mm_cmpeq_epi8(block1, block2) ) == 0xFFFF;
+}
+#endif
+
+#if WQ_UTF8_AVX2
+struct byte_set_avx2 {
+	__m256i m_bytes[4];
+	__m256i m_bit;
+
+	__attribute__((target("avx2")))
+	byte_set_avx2(const byte_set& set) : m_bit( _mm256_set1_epi8(set.m_bit) ) {
+		for(int i = 0; i != 4; i++) {
+			m_bytes[i] = _mm256_set1_epi8(set.m_bytes[i]);
+		}
+	}
+
+	template<bool single> __attribute__((target("avx2"))) __m256i mask(const char* ptr) const {
+		__m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+		if(single) {
+			return _mm256_cmpeq_epi8( _mm256_or_si256(block, m_bit), m_bytes[0] );
+		}
+		return _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8(block, m_bytes[0]), _mm256_cmpeq_epi8(block, m_bytes[1]) ),
+		                        _mm256_or_si256( _mm256_cmpeq_epi8(block, m_bytes[2]), _mm256_cmpeq_epi8(block, m_bytes[3]) ) );
+	}
+};
+
+template<bool single_first, bool single_second>
+__attribute__((target("avx2")))
+static const char* find_folded_avx2(const char* first, const char* last, const char* what, const char* what_last,
+                                    const fold_prefilter& filter) {
+	const byte_set_avx2 first_set(filter.m_first), second_set(filter.m_second);
+	const size_type first_at = filter.m_first_at, second_at = filter.m_second_at;
+
+	// while bytes of first set are rare, only they are searched
+	for(const char* prev = first; size_type(last - first) >= second_at + 64; first += 64) {
+		unsigned int mask1 = _mm256_movemask_epi8( first_set.mask<single_first>(first + first_at) );
+		unsigned int mask2 = _mm256_movemask_epi8( first_set.mask<single_first>(first + 32 + first_at) );
+		if((mask1 | mask2) == 0) {
+			continue;
+		}
+		for(wq::uint64 mask = wq::uint64(mask1) | (wq::uint64(mask2) << 32); mask != 0; mask &= mask - 1) {
+			const char* start = first + __builtin_ctzll(mask);
+			if(in_set(start[second_at], filter.m_second) && !utf8_is_trail(*start) &&
+			   match_folded(start, last, what, what_last) != NULL) {
+				return start;
+			}
+		}
+		if(first - prev < 256) {
+			first += 64;
+			break;
+		}
+		prev = first;
+	}
+
+	for( ; size_type(last - first) >= second_at + 64; first += 64) {
+		// two blocks at once, most of them have no candidates
+		unsigned int mask1 = _mm256_movemask_epi8( _mm256_and_si256( first_set.mask<single_first>(first + first_at),
+		                                                              second_set.mask<single_second>(first + second_at) ) );
+		unsigned int mask2 = _mm256_movemask_epi8( _mm256_and_si256( first_set.mask<single_first>(first + 32 + first_at),
+		                                                              second_set.mask<single_second>(first + 32 + second_at) ) );
+		if((mask1 | mask2) == 0) {
+			continue;
+		}
+		for(wq::uint64 mask = wq::uint64(mask1) | (wq::uint64(mask2) << 32); mask != 0; mask &= mask - 1) {
+			const char* start = first + __builtin_ctzll(mask);
+			if(!utf8_is_trail(*start) && match_folded(start, last, what, what_last) != NULL) {
+				return start;
+			}
+		}
+	}
+	return find_folded_sse2<single_first, single_second>(first, last, what, what_last, filter);
+}
+
+__attribute__((target("avx2")))
+static const char* find_folded_avx2(const char* first, const char* last, const char* what, const char* what_last,
+                                    const fold_prefilter& filter) {
+	if(filter.m_first.m_single) {
+		return filter.m_second.m_single ? find_folded_avx2<true, true>(first, last, what, what_last, filter) :
+		                                  find_folded_avx2<true, false>(first, last, what, what_last, filter);
+	}
+	return filter.m_second.m_single ? find_folded_avx2<false, true>(first, last, what, what_last, filter) :
+	                                  find_folded_avx2<false, false>(first, last, what, what_last, filter);
+}
+#endif
+
+// fills set by bytes at given offset of variants
+static void fill_set(byte_set& set, char (*variants)[4], size_type count, size_type offset) {
+	for(size_type i = 0; i != 4; i++) {
+		set.m_bytes[i] = variants[i < count ? i : 0][offset];
+	}
+
+	// all bytes are equal or differ only in one bit
+	char diff = 0;
+	set.m_single = true;
+	for(size_type i = 1; i != 4 && set.m_single; i++) {
+		char bits = char(set.m_bytes[i] ^ set.m_bytes[0]);
+		set.m_single = bits == 0 || bits == diff || (diff == 0 && (bits & (bits - 1)) == 0);
+		diff = bits != 0 ? bits : diff;
+	}
+	set.m_bit = set.m_single ? diff : 0;
+	set.m_bytes[0] |= set.m_bit;
+}
+
+// returns true if all variants have the same length
+static bool same_length(char (*variants)[4], size_type count) {
+	for(size_type i = 1; i < count; i++) {
+		if(char_bytes(variants[i]) != char_bytes(variants[0])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// chooses bytes of prefilter, returns false if first character has too many variants
+static bool make_prefilter(const char* folded, const char* folded_last, fold_prefilter& filter) {
+	char variants[4][4];
+	size_type count = fold_variants(decode_char(folded), variants, 4);
+	if(count == 0) {
+		return false;
+	}
+
+	// first byte is last byte of first character (which is more distinct than lead byte)
+	// if it has fixed length, second byte is last byte of the furthest character
+	// which still has fixed offset from beginning of match
+	size_type len = char_bytes(variants[0]);
+	bool fixed = same_length(variants, count);
+	filter.m_first_at = fixed ? len - 1 : 0;
+	fill_set(filter.m_first, variants, count, filter.m_first_at);
+	filter.m_second_at = filter.m_first_at;
+	fill_set(filter.m_second, variants, count, filter.m_first_at);
+
+	size_type offset = len;
+	for(const char* ptr = folded + char_bytes(folded); fixed && ptr != folded_last; ptr += char_bytes(ptr)) {
+		count = fold_variants(decode_char(ptr), variants, 4);
+		if(count == 0) {
+			break;
+		}
+		len = char_bytes(variants[0]);
+		fixed = same_length(variants, count);
+		filter.m_second_at = fixed ? offset + len - 1 : offset;
+		fill_set(filter.m_second, variants, count, filter.m_second_at - offset);
+		offset += len;
+	}
+	return true;
+}
+
+/*!
+	\brief Folds character \a c by simple case folding.
+
+	Characters which differ only in case have the same folded character.
+	Folding of ASCII characters does not use Unicode tables.
+*/
+wq::uint32 utf8_fold(wq::uint32 c) {
+	return fold_char(c);
+}
+
+/*!
+	\brief Writes UTF-8 encoding of character \a c to \a out.
+
+	\a out must have room for 4 bytes. Returns number of written bytes.
+*/
+size_type utf8_encode(wq::uint32 c, char* out) {
+	return encode_char(c, out);
+}
+
+/*!
+	\brief Finds all characters which have the same case folding as \a c.
+
+	Folded character is stored first and \a c is one of returned characters.
+	Returns count of characters or 0 if there are more than \a max of them.
+*/
+size_type utf8_case_variants(wq::uint32 c, wq::uint32* variants, size_type max) {
+	const fold_table& table = get_fold_table();
+	wq::uint32 folded = fold_char(c);
+	const wq::uint32* found = std::lower_bound(table.m_folded, table.m_folded + table.m_count, folded);
+	size_type n = 0;
+	if(max == 0) {
+		return 0;
+	}
+	variants[n++] = folded;
+	for( ; found != table.m_folded + table.m_count && *found == folded; found++) {
+		if(n == max) {
+			return 0;
+		}
+		variants[n++] = table.m_chars[found - table.m_folded];
+	}
+	return n;
+}
+
+/*!
+	\brief Returns the last character which has case variants.
+
+	It is taken from case folding tables, so characters after it have
+	no other variants than themselves.
+
+	\sa utf8_case_variants()
+*/
+wq::uint32 utf8_last_cased() {
+	return get_fold_table().m_last;
+}
+
+/*!
+	\brief Compares two UTF-8 sequences case insensitively.
+
+	Returns difference of first folded characters which are not equal
+	(or of first extra character if one sequence is prefix of other one).
+	Blocks of 16 equal bytes (or ASCII bytes equal after folding by SSE2
+	instructions) are skipped at once, so only characters which really differ
+	are decoded and folded.
+*/
+int utf8_compare_nocase(const char* first1, const char* last1, const char* first2, const char* last2) {
+	while(first1 != last1 && first2 != last2) {
+#if WQ_UTF8_SSE2
+		// equal blocks are skipped, otherwise both pointers are moved to the first different character
+		if(last1 - first1 >= 16 && last2 - first2 >= 16) {
+			size_type same = equal_bytes_sse2(first1, first2);
+			bool equal = same == 16 || equal_ascii_sse2(first1, first2);
+			same = equal ? 16 : same;
+
+			// pointers are kept at beginnings of characters, bytes before are equal in both sequences
+			while(first1 + same != last1 && utf8_is_trail(first1[same])) {
+				same--;
+			}
+			first1 += same;
+			first2 += same;
+			if(equal) {
+				continue;
+			}
+		}
+#endif
+		wq::uint32 c1 = decode_char(first1);
+		wq::uint32 c2 = decode_char(first2);
+		if(c1 != c2) {
+			c1 = fold_char(c1);
+			c2 = fold_char(c2);
+			if(c1 != c2) {
+				return int(c1) - int(c2);
+			}
+		}
+		first1 += char_bytes(first1);
+		first2 += char_bytes(first2);
+	}
+
+	// one sequence is prefix of other one
+	if(first1 != last1) {
+		return int( fold_char( decode_char(first1) ) );
+	}
+	if(first2 != last2) {
+		return -int( fold_char( decode_char(first2) ) );
+	}
+	return 0;
+}
+
+/*!
+	\brief Finds [\a what, \a what_last) in [\a first, \a last) case insensitively.
+
+	\a what is folded only once. Then all encodings of characters which have
+	the same folded character as its characters are found (e.g. 'k', 'K' and
+	Kelvin sign for 'k'). Text is searched in 16 (SSE2) or 32 (AVX2) byte blocks
+	for positions where bytes of these encodings are at two fixed offsets - in
+	the first character and in the furthest character, which has fixed offset
+	(all encodings of preceding characters have the same length). Only these
+	candidates are compared character by character.
+*/
+const char* utf8_find_nocase(const char* first, const char* last, const char* what, const char* what_last) {
+	if(what == what_last) {
+		return first;
+	}
+
+	// folded what, every character can get at most one byte longer
+	size_type what_bytes = what_last - what;
+	char local_buff[128];
+	char* folded = (2 * what_bytes <= sizeof(local_buff)) ? local_buff : new char[2 * what_bytes];
+	char* folded_last = folded;
+	for(const char* ptr = what; ptr != what_last; ptr += char_bytes(ptr)) {
+		folded_last += encode_char( fold_char( decode_char(ptr) ), folded_last );
+	}
+
+	// prefilter by encodings of first and some next character
+	fold_prefilter filter;
+	const char* ret = NULL;
+	if(!make_prefilter(folded, folded_last, filter)) {
+		// too many variants, every character is candidate
+		for( ; first != last && ret == NULL; first += char_bytes(first)) {
+			ret = match_folded(first, last, folded, folded_last) != NULL ? first : NULL;
+		}
+	}
+	else {
+#if WQ_UTF8_AVX2
+		if(sm_has_avx2) {
+			ret = find_folded_avx2(first, last, folded, folded_last, filter);
+		}
+		else
+#endif
+#if WQ_UTF8_SSE2
+		ret = find_folded_sse2(first, last, folded, folded_last, filter);
+#else
+		ret = find_folded_scalar(first, last, folded, folded_last, filter);
+#endif
+	}
+
+	if(folded != local_buff) {
+		delete[] folded;
+	}
+	return ret;
+}
+
+/*!
+	\brief Finds last occurrence of \a what in text, characters are compared case insensitively.
+
+	Folded \a what and bytes of prefilter are the same as in utf8_find_nocase(),
+	but blocks (of 16 positions with SSE2) are checked from end of text.
+*/
+const char* utf8_rfind_nocase(const char* first, const char* last, const char* what, const char* what_last) {
+	if(what == what_last) {
+		return last;
+	}
+
+	size_type what_bytes = what_last - what;
+	char local_buff[128];
+	char* folded = (2 * what_bytes <= sizeof(local_buff)) ? local_buff : new char[2 * what_bytes];
+	char* folded_last = folded;
+	for(const char* ptr = what; ptr != what_last; ptr += char_bytes(ptr)) {
+		folded_last += encode_char( fold_char( decode_char(ptr) ), folded_last );
+	}
+
+	fold_prefilter filter;
+	const char* ret = NULL;
+	if(!make_prefilter(folded, folded_last, filter)) {
+		// too many variants, every character is candidate
+		for(const char* ptr = last; ptr != first && ret == NULL; ) {
+			ptr--;
+			ret = !utf8_is_trail(*ptr) && match_folded(ptr, last, folded, folded_last) != NULL ? ptr : NULL;
+		}
+	}
+	else {
+#if WQ_UTF8_SSE2
+		ret = rfind_folded_sse2(first, last, folded, folded_last, filter);
+#else
+		ret = rfind_folded_scalar(first, last, last, folded, folded_last, filter);
+#endif
+	}
+
+	if(folded != local_buff) {
+		delete[] folded;
+	}
+	return ret;
+}
+
+// set kernels, bytes of ASCII sets are tested by nibble lookup - byte b is in set
+// if nibbles[b & 15] has bit (b >> 4) set, which never happens for non ASCII bytes
+static inline bool in_ascii_set(char b, const char* nibbles) {
+	return (b & 0x80) == 0 && ((nibbles[b & 15] >> (b >> 4)) & 1) != 0;
+}
+
+static const char* find_ascii_of_scalar(const char* first, const char* last, const char* nibbles, bool in_set) {
+	for( ; first != last; first++) {
+		if(in_ascii_set(*first, nibbles) == in_set) {
+			return first;
+		}
+	}
+	return NULL;
+}
+
+static const char* rfind_ascii_of_scalar(const char* first, const char* last, const char* nibbles, bool in_set) {
+	while(last != first) {
+		if(in_ascii_set(*--last, nibbles) == in_set) {
+			return last;
+		}
+	}
+	return NULL;
+}
+
+#if WQ_UTF8_AVX2
+// returns mask of bytes which are not in set
+__attribute__((target("avx2")))
+static inline unsigned int not_in_set_avx2(const char* ptr, __m256i low, __m256i high) {
+	const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+	__m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+	__m256i low_bits = _mm256_shuffle_epi8( low, _mm256_and_si256(block, nibble_mask) );
+	__m256i high_bits = _mm256_shuffle_epi8( high, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask) );
+	return _mm256_movemask_epi8( _mm256_cmpeq_epi8(_mm256_and_si256(low_bits, high_bits), _mm256_setzero_si256()) );
+}
+
+// tables for lookup of both nibbles, shuffle works in 128 bit lanes so they are repeated
+__attribute__((target("avx2")))
+static inline void nibble_tables_avx2(const char* nibbles, __m256i& low, __m256i& high) {
+	__m128i low_table = _mm_loadu_si128( reinterpret_cast<const __m128i*>(nibbles) );
+	__m128i high_table = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, char(128), 0, 0, 0, 0, 0, 0, 0, 0);
+	low = _mm256_inserti128_si256(_mm256_castsi128_si256(low_table), low_table, 1);
+	high = _mm256_inserti128_si256(_mm256_castsi128_si256(high_table), high_table, 1);
+}
+
+__attribute__((target("avx2")))
+static const char* find_ascii_of_avx2(const char* first, const char* last, const char* nibbles, bool in_set) {
+	__m256i low, high;
+	nibble_tables_avx2(nibbles, low, high);
+	unsigned int flip = in_set ? ~0u : 0u;
+	for( ; last - first >= 32; first += 32) {
+		unsigned int mask = not_in_set_avx2(first, low, high) ^ flip;
+		if(mask != 0) {
+			return first + __builtin_ctz(mask);
+		}
+	}
+	return find_ascii_of_scalar(first, last, nibbles, in_set);
+}
+
+__attribute__((target("avx2")))
+static const char* rfind_ascii_of_avx2(const char* first, const char* last, const char* nibbles, bool in_set) {
+	__m256i low, high;
+	nibble_tables_avx2(nibbles, low, high);
+	unsigned int flip = in_set ? ~0u : 0u;
+	for( ; last - first >= 32; last -= 32) {
+		unsigned int mask = not_in_set_avx2(last - 32, low, high) ^ flip;
+		if(mask != 0) {
+			return last - 1 - __builtin_clz(mask);
+		}
+	}
+	return rfind_ascii_of_scalar(first, last, nibbles, in_set);
+}
+#endif
+
+/*!
+	\brief Finds first character which is in \a set (or is not if \a in_set is \b false).
+
+	If all characters of \a set are ASCII, bytes are tested directly because
+	every byte of other characters is out of set. The bytes are tested in 32 byte
+	blocks by AVX2 shuffles, which look up both halves of every byte in 16 byte
+	tables. Other sets are tested character by character.
+*/
+const char* utf8_find_of(const char* first, const char* last, const codepoint_set& set, bool in_set) {
+	if(set.is_ascii()) {
+#if WQ_UTF8_AVX2
+		if(sm_has_avx2) {
+			return find_ascii_of_avx2(first, last, set.m_nibbles, in_set);
+		}
+#endif
+		return find_ascii_of_scalar(first, last, set.m_nibbles, in_set);
+	}
+	for( ; first != last; first += char_bytes(first)) {
+		if(set.contains( decode_char(first) ) == in_set) {
+			return first;
+		}
+	}
+	return NULL;
+}
+
+/*!
+	\brief Finds last character which is in \a set (or is not if \a in_set is \b false).
+
+	This is backward version of utf8_find_of(), returned pointer is
+	beginning of found character.
+*/
+const char* utf8_rfind_of(const char* first, const char* last, const codepoint_set& set, bool in_set) {
+	if(set.is_ascii()) {
+		const char* found;
+#if WQ_UTF8_AVX2
+		if(sm_has_avx2) {
+			found = rfind_ascii_of_avx2(first, last, set.m_nibbles, in_set);
+		}
+		else
+#endif
+		found = rfind_ascii_of_scalar(first, last, set.m_nibbles, in_set);
+
+		// byte which is not in set can be trail byte
+		while(found != NULL && utf8_is_trail(*found)) {
+			found--;
+		}
+		return found;
+	}
+	while(last != first) {
+		do {
+			last--;
+		} while(utf8_is_trail(*last));
+		if(set.contains( decode_char(last) ) == in_set) {
+			return last;
+		}
+	}
+	return NULL;
+}
+
+
+// case mapping of whole sequences
+// ASCII letters are mapped by arithmetic, other characters by properties trie
+static inline char map_ascii(char c, utf8_case_mapping mapping) {
+	if(mapping == utf8_to_upper) {
+		return wq::uint8(c - 'a') < 26 ? char(c - 32) : c;
+	}
+	return wq::uint8(c - 'A') < 26 ? char(c + 32) : c;
+}
+
+// maps one character which is not ASCII, it writes at most 9 bytes (special
+// mappings have at most three characters)
+static inline const char* map_char(const char* ptr, char*& out, utf8_case_mapping mapping, size_type& len) {
+	string::cp_iterator iter(ptr, ptr);
+	wq::uint32 c = iter.utf32();
+	const string::value_type::uc_properties* p = string::value_type::get_uc_properties(c);
+	bool special = p->case_fold_special;
+	int diff = p->case_fold_diff;
+	if(mapping != utf8_case_fold) {
+		special = mapping == utf8_to_lower ? p->lower_case_special : p->upper_case_special;
+		diff = mapping == utf8_to_lower ? p->lower_case_diff : p->upper_case_diff;
+	}
+	if(!special) {
+		out += encode_char(c + diff, out);
+		len++;
+		return ptr + iter.bytes();
+	}
+
+	// special mappings are UTF-16 sequences
+	for(const wq::uint16* seq = string::value_type::get_special_case(diff); *seq != 0; seq++, len++) {
+		wq::uint32 u = *seq;
+		if(u >= 0xD800 && u < 0xDC00) {
+			u = 0x10000 + ((u - 0xD800) << 10) + (seq[1] - 0xDC00);
+			seq++;
+		}
+		out += encode_char(u, out);
+	}
+	return ptr + iter.bytes();
+}
+
+static const size_type sm_max_mapped_bytes = 9;
+
+static const char* map_case_scalar(const char* ptr, const char* last, char*& out, char* out_last,
+		utf8_case_mapping mapping, size_type& len) {
+	while(ptr != last && size_type(out_last - out) >= sm_max_mapped_bytes) {
+		if(wq::uint8(*ptr) < 0x80) {
+			*out++ = map_ascii(*ptr++, mapping);
+			len++;
+			continue;
+		}
+		ptr = map_char(ptr, out, mapping, len);
+	}
+	return ptr;
+}
+
+#if WQ_UTF8_SSE2
+// blocks are mapped whole and written, output continues after their ASCII
+// beginning, so bytes of other characters are overwritten by their mappings
+static const char* map_case_sse2(const char* ptr, const char* last, char*& out, char* out_last,
+		utf8_case_mapping mapping, size_type& len) {
+	const __m128i before = _mm_set1_epi8(mapping == utf8_to_upper ? 'a' - 1 : 'A' - 1);
+	const __m128i after = _mm_set1_epi8(mapping == utf8_to_upper ? 'z' + 1 : 'Z' + 1);
+	const __m128i diff = _mm_set1_epi8(mapping == utf8_to_upper ? -32 : 32);
+	while(last - ptr >= 16 && out_last - out >= 16) {
+		__m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr) );
+		__m128i letters = _mm_and_si128( _mm_cmpgt_epi8(block, before), _mm_cmplt_epi8(block, after) );
+		_mm_storeu_si128( reinterpret_cast<__m128i*>(out), _mm_add_epi8(block, _mm_and_si128(letters, diff)) );
+		int mask = _mm_movemask_epi8(block);
+		int ascii = mask == 0 ? 16 : __builtin_ctz(mask);
+		ptr += ascii;
+		out += ascii;
+		len += ascii;
+		if(mask != 0 && size_type(out_last - out) >= sm_max_mapped_bytes) {
+			ptr = map_char(ptr, out, mapping, len);
+		}
+	}
+	return map_case_scalar(ptr, last, out, out_last, mapping, len);
+}
+#endif
+
+#if WQ_UTF8_AVX2
+__attribute__((target("avx2")))
+static const char* map_case_avx2(const char* ptr, const char* last, char*& out, char* out_last,
+		utf8_case_mapping mapping, size_type& len) {
+	const __m256i before = _mm256_set1_epi8(mapping == utf8_to_upper ? 'a' - 1 : 'A' - 1);
+	const __m256i after = _mm256_set1_epi8(mapping == utf8_to_upper ? 'z' + 1 : 'Z' + 1);
+	const __m256i diff = _mm256_set1_epi8(mapping == utf8_to_upper ? -32 : 32);
+	while(last - ptr >= 32 && out_last - out >= 32) {
+		__m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+		__m256i letters = _mm256_and_si256( _mm256_cmpgt_epi8(block, before), _mm256_cmpgt_epi8(after, block) );
+		_mm256_storeu_si256( reinterpret_cast<__m256i*>(out), _mm256_add_epi8(block, _mm256_and_si256(letters, diff)) );
+		unsigned int mask = _mm256_movemask_epi8(block);
+		int ascii = mask == 0 ? 32 : __builtin_ctz(mask);
+		ptr += ascii;
+		out += ascii;
+		len += ascii;
+		if(mask != 0 && size_type(out_last - out) >= sm_max_mapped_bytes) {
+			ptr = map_char(ptr, out, mapping, len);
+		}
+	}
+	return map_case_sse2(ptr, last, out, out_last, mapping, len);
+}
+#endif
+
+/*!
+	\brief Maps case of characters of UTF-8 sequence.
+
+	Characters from [\a ptr, \a last) are mapped and written to \a out while
+	there is room for the longest mapping (9 bytes) before \a out_last. \a out
+	is moved after written bytes and number of written characters is added
+	to \a len. Returns end of mapped characters, caller grows buffer and
+	continues from it when it is not \a last.
+
+	ASCII blocks are mapped by SIMD compares, other characters by their
+	properties - characters with \c *_case_special flag are mapped to
+	sequence from special case table, so UTF-8 length can change.
+*/
+const char* utf8_map_case(const char* ptr, const char* last, char*& out, char* out_last,
+		utf8_case_mapping mapping, string::size_type& len) {
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return map_case_avx2(ptr, last, out, out_last, mapping, len);
+	}
+#endif
+#if WQ_UTF8_SSE2
+	return map_case_sse2(ptr, last, out, out_last, mapping, len);
+#else
+	return map_case_scalar(ptr, last, out, out_last, mapping, len);
+#endif
+}
+
+
+// skipping of bytes below limit
+static const char* skip_below_scalar(const char* ptr, const char* last, wq::uint8 limit) {
+	while(ptr != last && wq::uint8(*ptr) < limit) {
+		ptr++;
+	}
+	return ptr;
+}
+
+#if WQ_UTF8_SSE2
+// bytes are at least limit where their unsigned maximum with limit is the byte itself
+static const char* skip_below_sse2(const char* ptr, const char* last, wq::uint8 limit) {
+	const __m128i limits = _mm_set1_epi8(char(limit));
+	for( ; last - ptr >= 16; ptr += 16) {
+		__m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>(ptr) );
+		int mask = _mm_movemask_epi8( _mm_cmpeq_epi8(_mm_max_epu8(block, limits), block) );
+		if(mask != 0) {
+			return ptr + __builtin_ctz(mask);
+		}
+	}
+	return skip_below_scalar(ptr, last, limit);
+}
+#endif
+
+#if WQ_UTF8_AVX2
+__attribute__((target("avx2")))
+static const char* skip_below_avx2(const char* ptr, const char* last, wq::uint8 limit) {
+	const __m256i limits = _mm256_set1_epi8(char(limit));
+	for( ; last - ptr >= 32; ptr += 32) {
+		__m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(ptr) );
+		unsigned int mask = _mm256_movemask_epi8( _mm256_cmpeq_epi8(_mm256_max_epu8(block, limits), block) );
+		if(mask != 0) {
+			return ptr + __builtin_ctz(mask);
+		}
+	}
+	return skip_below_sse2(ptr, last, limit);
+}
+#endif
+
+// returns first byte which is not less than limit (as unsigned number) or last,
+// limits above 0xC1 stop only at lead bytes of characters
+const char* utf8_skip_below(const char* ptr, const char* last, wq::uint8 limit) {
+#if WQ_UTF8_AVX2
+	if(sm_has_avx2) {
+		return skip_below_avx2(ptr, last, limit);
+	}
+#endif
+#if WQ_UTF8_SSE2
+	return skip_below_sse2(ptr, last, limit);
+#else
+	return skip_below_scalar(ptr, last, limit);
+#endif
+}
+
+}  // namespace core
+}  // namespace wq